@@ -94,78 +94,84 @@ public:
       int fFileDes = -1;
    };
 
-   /// Submit a number of read events and wait for completion. Events are submitted in batches if
-   /// the number of events is larger than the submission queue depth.
+   /// Submit a number of read events and wait for completion. If the number of events is larger than the
+   /// submission queue depth, the remaining events are submitted as the earlier ones complete.
    void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
-      unsigned int batch = 0;
-      unsigned int batchSize = fDepth;
-      unsigned int readPos = 0;
+      SubmitReadsAndComplete(readEvents, nReads, [](unsigned int) {});
+   }
 
-      while (readPos < nReads) {
-         if (readPos + batchSize > nReads) {
-            batchSize = nReads - readPos;
+   /// Submit a number of read events and call `onCompletion(index)` for every event as soon as its completion
+   /// has been reaped, i.e. in the order of completion rather than in the order of submission. The submission
+   /// queue is refilled as completions arrive, so that up to GetQueueDepth() reads are in flight at any time.
+   /// The callback runs in the calling thread and must not throw. Returns when all the events are completed.
+   template <typename CallbackT>
+   void SubmitReadsAndComplete(RReadEvent *readEvents, unsigned int nReads, CallbackT &&onCompletion) {
+      unsigned int nSubmitted = 0;
+      unsigned int nCompleted = 0;
+
+      while (nCompleted < nReads) {
+         // fill up the submission queue
+         unsigned int nPrepared = 0;
+         while ((nSubmitted + nPrepared < nReads) && (nSubmitted + nPrepared - nCompleted < fDepth)) {
+            PrepareRead(readEvents[nSubmitted + nPrepared], nSubmitted + nPrepared);
+            ++nPrepared;
          }
-         // prep reads
-         struct io_uring_sqe *sqe;
-         for (std::size_t i = readPos; i < readPos + batchSize; ++i) {
-            sqe = io_uring_get_sqe(&fRing);
-            if (!sqe) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "get SQE failed for read request '" + std::to_string(i)
-                  + "', error: " + std::string(strerror(errno)));
-            }
-            if (readEvents[i].fFileDes == -1) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "bad fd (-1) for read request '" + std::to_string(i) + "'");
+         if (nPrepared > 0) {
+            int submitted = io_uring_submit(&fRing);
+            if (submitted <= 0) {
+               throw std::runtime_error("ring submit failed, error: " + std::string(strerror(-submitted)));
             }
-            if (readEvents[i].fBuffer == nullptr) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "null read buffer for read request '" + std::to_string(i) + "'");
+            if (submitted != static_cast<int>(nPrepared)) {
+               throw std::runtime_error("ring submitted " + std::to_string(submitted) +
+                  " events but requested " + std::to_string(nPrepared));
             }
-            io_uring_prep_read(sqe,
-               readEvents[i].fFileDes,
-               readEvents[i].fBuffer,
-               readEvents[i].fSize,
-               readEvents[i].fOffset
-            );
-            sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
-            sqe->user_data = i;
+            nSubmitted += nPrepared;
          }
 
-         // todo(max) check for any difference between submit vs. submit and wait for large nReq
-         int submitted = io_uring_submit_and_wait(&fRing, batchSize);
-         if (submitted <= 0) {
-            throw std::runtime_error("batch " + std::to_string(batch) + ": "
-               "ring submit failed, error: " + std::string(strerror(errno)));
-         }
-         if (submitted != static_cast<int>(batchSize)) {
-            throw std::runtime_error("ring submitted " + std::to_string(submitted) +
-               " events but requested " + std::to_string(batchSize));
-         }
-         // reap reads
+         // reap at least one completion and all the further ones that are already available
          struct io_uring_cqe *cqe;
-         int ret;
-         for (int i = 0; i < submitted; ++i) {
-            ret = io_uring_wait_cqe(&fRing, &cqe);
-            if (ret < 0) {
-               throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
-            }
+         int ret = io_uring_wait_cqe(&fRing, &cqe);
+         if (ret < 0) {
+            throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
+         }
+         do {
             auto index = reinterpret_cast<std::size_t>(io_uring_cqe_get_data(cqe));
             if (index >= nReads) {
                throw std::runtime_error("bad cqe user data: " + std::to_string(index));
             }
             if (cqe->res < 0) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "read failed for ReadEvent[" + std::to_string(index) + "], "
+               throw std::runtime_error("read failed for ReadEvent[" + std::to_string(index) + "], "
                   "error: " + std::string(std::strerror(-cqe->res)));
             }
             readEvents[index].fOutBytes = static_cast<std::size_t>(cqe->res);
             io_uring_cqe_seen(&fRing, cqe);
-         }
-         readPos += batchSize;
-         batch += 1;
+            ++nCompleted;
+            onCompletion(static_cast<unsigned int>(index));
+         } while ((nCompleted < nSubmitted) && (io_uring_peek_cqe(&fRing, &cqe) == 0));
+      }
+   }
+
+private:
+   void PrepareRead(const RReadEvent &readEvent, std::size_t index) {
+      struct io_uring_sqe *sqe = io_uring_get_sqe(&fRing);
+      if (!sqe) {
+         throw std::runtime_error("get SQE failed for read request '" + std::to_string(index)
+            + "', error: " + std::string(strerror(errno)));
+      }
+      if (readEvent.fFileDes == -1) {
+         throw std::runtime_error("bad fd (-1) for read request '" + std::to_string(index) + "'");
+      }
+      if (readEvent.fBuffer == nullptr) {
+         throw std::runtime_error("null read buffer for read request '" + std::to_string(index) + "'");
       }
-      return;
+      io_uring_prep_read(sqe,
+         readEvent.fFileDes,
+         readEvent.fBuffer,
+         readEvent.fSize,
+         readEvent.fOffset
+      );
+      sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
+      sqe->user_data = index;
    }
 };
 
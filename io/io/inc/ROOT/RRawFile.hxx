@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -63,7 +64,13 @@ public:
        * that the protocol-dependent default block size should be used.
        */
       int fBlockSize;
-      ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1) {}
+      /**
+       * Bypass the operating system's page cache if the implementation supports it (O_DIRECT for local files).
+       * Useful for large one-pass scans that should not evict the page cache. Unaligned requests are served through
+       * aligned intermediate buffers.
+       */
+      bool fUseDirectIO;
+      ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1), fUseDirectIO(false) {}
    };
 
    /// Used for vector reads from multiple offsets into multiple buffers. This is unlike readv(), which scatters a
@@ -78,6 +85,8 @@ public:
       /// The number of actually read bytes, set by ReadV()
       std::size_t fOutBytes = 0;
    };
+   /// Called by ReadVStreamed() with the index of a request once the request has been read
+   using RCompletionCallback_t = std::function<void(unsigned int)>;
 
 private:
    /// Don't change without adapting ReadAt()
@@ -137,6 +146,9 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// By default implemented as ReadVImpl() followed by the completion of all the requests in order. Derived classes
+   /// that read asynchronously should notify the completion of the requests as they arrive.
+   virtual void ReadVStreamedImpl(RIOVec *ioVec, unsigned int nReq, const RCompletionCallback_t &onCompletion);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -172,6 +184,10 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Like ReadV() but calls onCompletion(i) from the calling thread as soon as the i-th request has been read,
+   /// which allows for processing the data of early requests while later requests are still in flight.  Requests
+   /// may complete in any order.  Returns when all the requests are completed.
+   void ReadVStreamed(RIOVec *ioVec, unsigned int nReq, const RCompletionCallback_t &onCompletion);
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
@@ -27,15 +27,31 @@ namespace Internal {
  *
  * The RRawFileUnix class uses POSIX calls to read from a mounted file system. Thus the path name can refer,
  * for instance, to a named pipe instead of a regular file.
+ *
+ * If requested by the options and supported by the file system, the file is opened with O_DIRECT. In this case,
+ * reads bypass the page cache and need to be aligned in offset, size, and buffer address. Unaligned reads are served
+ * through aligned intermediate buffers; vector reads are coalesced into aligned spans so that requests sharing a
+ * block are read only once.
  */
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+   /// Set if the file was successfully opened with O_DIRECT
+   bool fIsDirectIO;
+
+   /// Reads the file range covering an unaligned request into an aligned buffer and copies out the requested part
+   size_t ReadAtBounced(void *buffer, size_t nbytes, std::uint64_t offset);
+   /// Vector read of the given requests as is, either through io_uring or through a loop of blocking reads
+   void ReadVStreamedPlain(RIOVec *ioVec, unsigned int nReq, const RCompletionCallback_t &onCompletion);
+   /// Vector read for direct I/O: coalesces the requests into aligned spans and reads the spans with
+   /// ReadVStreamedPlain()
+   void ReadVStreamedDirect(RIOVec *ioVec, unsigned int nReq, const RCompletionCallback_t &onCompletion);
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   void ReadVStreamedImpl(RIOVec *ioVec, unsigned int nReq, const RCompletionCallback_t &onCompletion) final;
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
@@ -46,6 +62,8 @@ public:
    std::unique_ptr<RRawFile> Clone() const final;
    int GetFeatures() const final;
    int GetFd() const { return fFileDes; }
+   /// True if the file has been opened with O_DIRECT; only meaningful once the file is open
+   bool IsDirectIO() const { return fIsDirectIO; }
 };
 
 } // namespace Internal
@@ -109,6 +109,14 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+void ROOT::Internal::RRawFile::ReadVStreamedImpl(RIOVec *ioVec, unsigned int nReq,
+                                                 const RCompletionCallback_t &onCompletion)
+{
+   ReadVImpl(ioVec, nReq);
+   for (unsigned i = 0; i < nReq; ++i)
+      onCompletion(i);
+}
+
 void ROOT::Internal::RRawFile::UnmapImpl(void * /* region */, size_t /* nbytes */)
 {
    throw std::runtime_error("Memory mapping unsupported");
@@ -216,6 +224,14 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+void ROOT::Internal::RRawFile::ReadVStreamed(RIOVec *ioVec, unsigned int nReq, const RCompletionCallback_t &onCompletion)
+{
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   ReadVStreamedImpl(ioVec, nReq, onCompletion);
+}
+
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
 {
    if (fOptions.fLineBreak == ELineBreaks::kAuto) {
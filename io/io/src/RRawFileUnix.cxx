@@ -18,9 +18,13 @@
 
 #include "TError.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <cstdlib>
 #include <cstring>
 #include <memory>
+#include <new>
+#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -33,10 +37,64 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
+/// Alignment of offsets, sizes, and buffers for direct I/O; covers the logical block size of common devices
+constexpr std::uint64_t kDirectIOAlignment = 4096;
+/// Upper limit for the size of a coalesced span of vector read requests in direct I/O mode
+constexpr std::uint64_t kMaxDirectIOSpan = 64 * 1024 * 1024;
+
+std::uint64_t AlignDown(std::uint64_t value)
+{
+   return value & ~(kDirectIOAlignment - 1);
+}
+
+std::uint64_t AlignUp(std::uint64_t value)
+{
+   return AlignDown(value + kDirectIOAlignment - 1);
+}
+
+bool IsAligned(const void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   return ((reinterpret_cast<std::uintptr_t>(buffer) | nbytes | offset) & (kDirectIOAlignment - 1)) == 0;
+}
+
+/// Memory block suitable as a target of direct I/O reads
+class RAlignedBuffer {
+   unsigned char *fBuffer = nullptr;
+
+public:
+   RAlignedBuffer() = default;
+   explicit RAlignedBuffer(std::size_t size)
+   {
+      void *buffer = nullptr;
+      if (posix_memalign(&buffer, kDirectIOAlignment, std::max(size, std::size_t(1))) != 0)
+         throw std::bad_alloc();
+      fBuffer = static_cast<unsigned char *>(buffer);
+   }
+   RAlignedBuffer(const RAlignedBuffer &) = delete;
+   RAlignedBuffer &operator=(const RAlignedBuffer &) = delete;
+   RAlignedBuffer(RAlignedBuffer &&other) : fBuffer(other.fBuffer) { other.fBuffer = nullptr; }
+   RAlignedBuffer &operator=(RAlignedBuffer &&other)
+   {
+      std::swap(fBuffer, other.fBuffer);
+      return *this;
+   }
+   ~RAlignedBuffer() { free(fBuffer); }
+
+   unsigned char *Get() const { return fBuffer; }
+};
+
+int OpenReadOnly(const std::string &path, int flags)
+{
+#ifdef R__SEEK64
+   return open64(path.c_str(), O_RDONLY | flags);
+#else
+   return open(path.c_str(), O_RDONLY | flags);
+#endif
+}
 } // anonymous namespace
 
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options)
-   : RRawFile(url, options), fFileDes(-1)
+   : RRawFile(url, options), fFileDes(-1), fIsDirectIO(false)
 {
 }
 
@@ -83,10 +141,21 @@ void *ROOT::Internal::RRawFileUnix::MapImpl(size_t nbytes, std::uint64_t offset,
 
 void ROOT::Internal::RRawFileUnix::OpenImpl()
 {
-#ifdef R__SEEK64
-   fFileDes = open64(GetLocation(fUrl).c_str(), O_RDONLY);
+   const auto path = GetLocation(fUrl);
+#ifdef O_DIRECT
+   if (fOptions.fUseDirectIO) {
+      fFileDes = OpenReadOnly(path, O_DIRECT);
+      fIsDirectIO = (fFileDes >= 0);
+      // Some file systems, e.g. tmpfs, refuse O_DIRECT; fall back to regular reads in this case
+      if (fFileDes < 0 && errno == EINVAL) {
+         Warning("RRawFileUnix", "direct I/O not supported for '%s', using the page cache", fUrl.c_str());
+         fFileDes = OpenReadOnly(path, 0);
+      }
+   } else {
+      fFileDes = OpenReadOnly(path, 0);
+   }
 #else
-   fFileDes = open(GetLocation(fUrl).c_str(), O_RDONLY);
+   fFileDes = OpenReadOnly(path, 0);
 #endif
    if (fFileDes < 0) {
       throw std::runtime_error("Cannot open '" + fUrl + "', error: " + std::string(strerror(errno)));
@@ -114,6 +183,74 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
 
 void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
+   ReadVStreamedImpl(ioVec, nReq, [](unsigned int) {});
+}
+
+void ROOT::Internal::RRawFileUnix::ReadVStreamedImpl(RIOVec *ioVec, unsigned int nReq,
+                                                     const RCompletionCallback_t &onCompletion)
+{
+   if (fIsDirectIO)
+      ReadVStreamedDirect(ioVec, nReq, onCompletion);
+   else
+      ReadVStreamedPlain(ioVec, nReq, onCompletion);
+}
+
+void ROOT::Internal::RRawFileUnix::ReadVStreamedDirect(RIOVec *ioVec, unsigned int nReq,
+                                                       const RCompletionCallback_t &onCompletion)
+{
+   std::vector<unsigned int> order(nReq);
+   std::iota(order.begin(), order.end(), 0);
+   std::sort(order.begin(), order.end(),
+             [ioVec](unsigned int a, unsigned int b) { return ioVec[a].fOffset < ioVec[b].fOffset; });
+
+   // Requests whose aligned ranges overlap or touch are merged into a single span, unless the span grows too large
+   std::vector<RIOVec> spans;
+   std::vector<std::vector<unsigned int>> spanRequests;
+   for (auto idx : order) {
+      const auto first = AlignDown(ioVec[idx].fOffset);
+      const auto last = AlignUp(ioVec[idx].fOffset + ioVec[idx].fSize);
+      if (!spans.empty()) {
+         auto &span = spans.back();
+         const auto spanEnd = span.fOffset + span.fSize;
+         if ((first <= spanEnd) && (std::max(last, spanEnd) - span.fOffset <= kMaxDirectIOSpan)) {
+            span.fSize = std::max(last, spanEnd) - span.fOffset;
+            spanRequests.back().emplace_back(idx);
+            continue;
+         }
+      }
+      RIOVec span;
+      span.fOffset = first;
+      span.fSize = last - first;
+      spans.emplace_back(span);
+      spanRequests.emplace_back(std::vector<unsigned int>{idx});
+   }
+
+   std::vector<RAlignedBuffer> buffers;
+   buffers.reserve(spans.size());
+   for (auto &span : spans) {
+      buffers.emplace_back(span.fSize);
+      span.fBuffer = buffers.back().Get();
+   }
+
+   ReadVStreamedPlain(spans.data(), spans.size(), [&](unsigned int spanIdx) {
+      const auto &span = spans[spanIdx];
+      for (auto idx : spanRequests[spanIdx]) {
+         const auto head = ioVec[idx].fOffset - span.fOffset;
+         const auto nbytes = (span.fOutBytes > head) ? std::min(ioVec[idx].fSize, span.fOutBytes - head) : 0;
+         memcpy(ioVec[idx].fBuffer, buffers[spanIdx].Get() + head, nbytes);
+         ioVec[idx].fOutBytes = nbytes;
+         onCompletion(idx);
+      }
+      // Release the memory early, the remaining spans may still be in flight
+      buffers[spanIdx] = RAlignedBuffer();
+   });
+}
+
+void ROOT::Internal::RRawFileUnix::ReadVStreamedPlain(RIOVec *ioVec, unsigned int nReq,
+                                                      const RCompletionCallback_t &onCompletion)
+{
+   // Requests that are already handed over to the callback must not be read again by the fallback
+   std::vector<bool> isCompleted(nReq, false);
 #ifdef R__HAS_URING
    thread_local bool uring_failed = false;
    if (!uring_failed) {
@@ -129,10 +266,11 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
             ev.fFileDes = fFileDes;
             reads.push_back(ev);
          }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            ioVec[i].fOutBytes = reads.at(i).fOutBytes;
-         }
+         ring.SubmitReadsAndComplete(reads.data(), nReq, [&](unsigned int i) {
+            ioVec[i].fOutBytes = reads[i].fOutBytes;
+            isCompleted[i] = true;
+            onCompletion(i);
+         });
          return;
       }
       catch(const std::runtime_error &e) {
@@ -143,11 +281,35 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
       }
    }
 #endif
-   RRawFile::ReadVImpl(ioVec, nReq);
+   for (unsigned int i = 0; i < nReq; ++i) {
+      if (isCompleted[i])
+         continue;
+      // Direct I/O spans are aligned and should not be copied through the (unaligned) block buffers
+      ioVec[i].fOutBytes = fIsDirectIO ? ReadAtImpl(ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset)
+                                       : ReadAt(ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset);
+      onCompletion(i);
+   }
+}
+
+size_t ROOT::Internal::RRawFileUnix::ReadAtBounced(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   const auto alignedOffset = AlignDown(offset);
+   const auto head = offset - alignedOffset;
+   const auto alignedSize = AlignUp(head + nbytes);
+   RAlignedBuffer bounceBuffer(alignedSize);
+   const auto nread = ReadAtImpl(bounceBuffer.Get(), alignedSize, alignedOffset);
+   if (nread <= head)
+      return 0;
+   const auto ncopy = std::min(nbytes, nread - head);
+   memcpy(buffer, bounceBuffer.Get() + head, ncopy);
+   return ncopy;
 }
 
 size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
+   if (fIsDirectIO && !IsAligned(buffer, nbytes, offset))
+      return ReadAtBounced(buffer, nbytes, offset);
+
    size_t total_bytes = 0;
    while (nbytes) {
 #ifdef R__SEEK64
@@ -163,6 +325,10 @@ size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std
          return total_bytes;
       }
       R__ASSERT(static_cast<size_t>(res) <= nbytes);
+      // With direct I/O, an unaligned short read only happens at the end of the file; a subsequent read from the
+      // unaligned offset would fail
+      if (fIsDirectIO && (res % kDirectIOAlignment) != 0)
+         return total_bytes + res;
       buffer = reinterpret_cast<unsigned char *>(buffer) + res;
       nbytes -= res;
       total_bytes += res;
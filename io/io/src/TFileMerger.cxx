@@ -374,16 +374,26 @@ Bool_t TFileMerger::Merge(Bool_t)
 
 namespace {
 
-/// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
+/// Merge a list of RNTuples. The RNTuple merge function expects the name of the RNTuple followed by the list of
+/// input files; the merged RNTuple is written into the output directory of the merge info.
+Long64_t MergeRNTuples(TClass *rntupleHandle, void *obj, const char *ntupleName, const TList &sources,
+                       TFileMergeInfo &info)
+{
+   if (!rntupleHandle || !obj) {
       return Long64_t(-1);
    }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
+   TObjString name(ntupleName);
+   TList mergeData;
+   mergeData.Add(&name);
+   TIter next(&sources);
+   while (auto inFile = next()) {
+      mergeData.Add(inFile);
+   }
+
    ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
+   auto result = func(obj, &mergeData, &info);
+   info.fIsFirst = kFALSE;
+   return result;
 }
 
 Bool_t IsMergeable(TClass *cl)
@@ -597,13 +607,21 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       // merge objects that don't derive from TObject
       if (std::string(keyclassname) == "ROOT::Experimental::RNTuple") {
          Warning("MergeRecursive", "merging RNTuples is experimental");
-         // todo(max): check if this works when a TDirectory is passed as the first
-         // input argument
-         Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
+         if (!path.IsNull()) {
+            Error("MergeRecursive", "merging RNTuples in sub directories is unsupported (key: %s in %s)", keyname,
+                  path.Data());
+            return kFALSE;
+         }
+         Long64_t mergeResult = MergeRNTuples(cl, obj, keyname, *sourcelist, info);
+         if (ownobj)
+            cl->Destructor(obj);
          if (mergeResult < 0) {
             Error("MergeRecursive", "error merging RNTuples");
             return kFALSE;
          }
+         // The merged RNTuple anchor has already been written by the RNTuple merger
+         oldkeyname = keyname;
+         return kTRUE;
       } else {
          TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
          Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
@@ -43,6 +43,29 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, ReadVStreamed)
+{
+   auto file = "test_uring_readv_streamed";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'a')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+
+   auto nReq = 2000; // more requests than the queue depth, the queue is refilled on completion
+
+   auto iovecs = make_iovecs(nReq, filesize);
+   std::vector<int> nCompletions(nReq, 0);
+   f->ReadVStreamed(iovecs.data(), nReq, [&](unsigned int idx) { nCompletions[idx]++; });
+
+   for (auto n : nCompletions)
+      EXPECT_EQ(1, n);
+   for (auto iovec: iovecs) {
+      for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+         EXPECT_EQ('a', ((unsigned char*)iovec.fBuffer)[i]);
+      }
+      free(iovec.fBuffer);
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
@@ -138,6 +138,73 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVStreamed)
+{
+   FileRaii readvGuard("test_rawfile_readv_streamed", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_readv_streamed");
+
+   char buffer[3];
+   buffer[0] = buffer[1] = buffer[2] = 0;
+   RRawFile::RIOVec iovec[3];
+   for (unsigned int i = 0; i < 3; ++i) {
+      iovec[i].fBuffer = &buffer[i];
+      iovec[i].fSize = 1;
+   }
+   iovec[0].fOffset = 4;
+   iovec[1].fOffset = 0;
+   iovec[2].fOffset = 100;
+
+   std::vector<unsigned int> nCompletions(3, 0);
+   f->ReadVStreamed(iovec, 3, [&](unsigned int idx) {
+      // The request must be complete when the callback fires
+      EXPECT_EQ(idx == 2 ? 0U : 1U, iovec[idx].fOutBytes);
+      nCompletions[idx]++;
+   });
+
+   EXPECT_EQ(std::vector<unsigned int>(3, 1), nCompletions);
+   EXPECT_EQ('o', buffer[0]);
+   EXPECT_EQ('H', buffer[1]);
+}
+
+
+TEST(RRawFile, DirectIO)
+{
+   std::string content;
+   for (int i = 0; i < 3 * 4096 + 100; ++i)
+      content.push_back('a' + (i % 26));
+   FileRaii directGuard("test_rawfile_directio", content);
+   RRawFile::ROptions options;
+   options.fUseDirectIO = true;
+   // If the file system does not support direct I/O, the reads fall back to regular I/O
+   auto f = RRawFile::Create("test_rawfile_directio", options);
+
+   char buffer[8192];
+   EXPECT_EQ(3U, f->ReadAt(buffer, 3, 4094));
+   EXPECT_EQ(content.substr(4094, 3), std::string(buffer, 3));
+   EXPECT_EQ(5000U, f->ReadAt(buffer, 5000, 1));
+   EXPECT_EQ(content.substr(1, 5000), std::string(buffer, 5000));
+   EXPECT_EQ(100U, f->ReadAt(buffer, 4096, 3 * 4096));
+   EXPECT_EQ(content.substr(3 * 4096, 100), std::string(buffer, 100));
+   EXPECT_EQ(0U, f->ReadAt(buffer, 10, content.size() + 10));
+
+   // Requests that share blocks, requests in reverse order, and requests beyond the end of the file
+   char vbuffer[5][4096];
+   RRawFile::RIOVec iovec[5];
+   const std::uint64_t offsets[] = {8190, 10, 4000, 3 * 4096 + 50, 4 * 4096};
+   const std::size_t sizes[] = {4096, 100, 200, 4096, 10};
+   for (unsigned int i = 0; i < 5; ++i) {
+      iovec[i].fBuffer = vbuffer[i];
+      iovec[i].fOffset = offsets[i];
+      iovec[i].fSize = sizes[i];
+   }
+   f->ReadV(iovec, 5);
+   for (unsigned int i = 0; i < 5; ++i) {
+      const auto expected = (offsets[i] < content.size()) ? content.substr(offsets[i], sizes[i]) : std::string();
+      EXPECT_EQ(expected.size(), iovec[i].fOutBytes);
+      EXPECT_EQ(expected, std::string(vbuffer[i], iovec[i].fOutBytes));
+   }
+}
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
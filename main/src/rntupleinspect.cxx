@@ -0,0 +1,93 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Prints the storage report of an RNTuple, as produced by RNTupleInspector::PrintJSONReport(), to stdout or to a file.
+
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleInspector.hxx>
+
+#include <TFile.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RNTuple;
+using ROOT::Experimental::RNTupleInspector;
+
+static void PrintUsage(const char *progName)
+{
+   std::cerr << "Usage: " << progName << " [-o <output.json>] <file> <ntuple name>\n"
+             << "Writes a JSON report on the storage layout of the given RNTuple: sizes and compression factors per\n"
+             << "cluster, column, field, and column encoding, page size histograms, and estimated decoding costs.\n";
+}
+
+int main(int argc, char **argv)
+{
+   std::string outputPath;
+   std::string inputPath;
+   std::string ntupleName;
+
+   for (int i = 1; i < argc; ++i) {
+      if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+         PrintUsage(argv[0]);
+         return 0;
+      } else if (strcmp(argv[i], "-o") == 0) {
+         if (++i == argc) {
+            PrintUsage(argv[0]);
+            return 1;
+         }
+         outputPath = argv[i];
+      } else if (inputPath.empty()) {
+         inputPath = argv[i];
+      } else if (ntupleName.empty()) {
+         ntupleName = argv[i];
+      } else {
+         PrintUsage(argv[0]);
+         return 1;
+      }
+   }
+   if (inputPath.empty() || ntupleName.empty()) {
+      PrintUsage(argv[0]);
+      return 1;
+   }
+
+   std::unique_ptr<TFile> file(TFile::Open(inputPath.c_str()));
+   if (!file || file->IsZombie()) {
+      std::cerr << "Error: cannot open " << inputPath << "\n";
+      return 1;
+   }
+   auto ntuple = file->Get<RNTuple>(ntupleName.c_str());
+   if (!ntuple) {
+      std::cerr << "Error: no RNTuple named '" << ntupleName << "' in " << inputPath << "\n";
+      return 1;
+   }
+
+   try {
+      auto inspector = RNTupleInspector::Create(ntuple).Unwrap();
+      if (outputPath.empty()) {
+         inspector->PrintJSONReport(std::cout);
+      } else {
+         std::ofstream output(outputPath);
+         if (!output) {
+            std::cerr << "Error: cannot write to " << outputPath << "\n";
+            return 1;
+         }
+         inspector->PrintJSONReport(output);
+      }
+   } catch (const RException &e) {
+      std::cerr << "Error: " << e.what() << "\n";
+      return 1;
+   }
+
+   return 0;
+}
@@ -0,0 +1,36 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RCACHEOPTIONS
+#define ROOT_RCACHEOPTIONS
+
+#include <Compression.h>
+#include <RtypesCore.h> // ULong64_t
+#include <string>
+
+namespace ROOT {
+
+namespace RDF {
+/// A collection of options to steer how Cache stores the column values
+struct RCacheOptions {
+   using ECAlgo = ROOT::ECompressionAlgorithm;
+   /// Maximum number of bytes of column values kept in memory, 0 means no limit. Once the budget is exceeded, the
+   /// values of the following chunks of entries are written to temporary RNTuple files. The budget can be exceeded by
+   /// at most one chunk per processing slot. The memory owned by values that are not compressed, e.g. the characters
+   /// of strings and the elements of collections of non-arithmetic types, is estimated from their capacity.
+   ULong64_t fMemoryBudget = 0;
+   ECAlgo fCompressionAlgorithm = ROOT::kLZ4; ///< Compression algorithm of the values in memory and on disk
+   int fCompressionLevel = 1;                 ///< Compression level of the values in memory and on disk, 0 disables it
+   std::string fSpillDirectory;               ///< Directory of the temporary files, the system's default if empty
+   /// Number of entries that are compressed, spilled and read back together
+   unsigned int fChunkSize = 10000;
+};
+} // ns RDF
+} // ns ROOT
+
+#endif
@@ -20,6 +20,7 @@
 #define ROOT_RDFOPERATIONS
 
 #include "Compression.h"
+#include "RConfigure.h" // R__HAS_ROOT7
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RVec.hxx"
 #include "ROOT/TBufferMerger.hxx" // for SnapshotHelper
@@ -46,8 +47,17 @@
 #include "TStatistic.h"
 #include "ROOT/RDF/RActionImpl.hxx"
 #include "ROOT/RDF/RMergeableValue.hxx"
+#ifdef R__HAS_ROOT7
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTuple.hxx" // for SnapshotRNTupleHelper
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RNTupleParallelWriter.hxx" // for SnapshotRNTupleHelperMT
+#endif
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -62,6 +72,7 @@
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
+class RDataFrame;
 namespace Internal {
 namespace RDF {
 using namespace ROOT::TypeTraits;
@@ -1647,6 +1658,9 @@ public:
    {
       return [this](unsigned int, const RSampleInfo &) mutable { fBranchAddressesNeedReset = true; };
    }
+
+   /// The output branches point to the addresses of the input values of the first entry
+   bool SupportsBlockExecution() const final { return false; }
 };
 
 /// Helper object for a multi-thread Snapshot action
@@ -1814,7 +1828,237 @@ public:
    {
       return [this](unsigned int slot, const RSampleInfo &) mutable { fBranchAddressesNeedReset[slot] = 1; };
    }
+
+   /// The output branches point to the addresses of the input values of the first entry
+   bool SupportsBlockExecution() const final { return false; }
+};
+
+#ifdef R__HAS_ROOT7
+
+/// RNTuple has fields for the fixed-width integer types only. Other integer types with the same size, e.g. Long64_t,
+/// are written through the field of the corresponding fixed-width type.
+template <typename T>
+struct RNTupleSnapshotFieldType {
+   using type = T;
+};
+template <>
+struct RNTupleSnapshotFieldType<long> {
+   using type = std::conditional_t<sizeof(long) == 8, std::int64_t, std::int32_t>;
+};
+template <>
+struct RNTupleSnapshotFieldType<unsigned long> {
+   using type = std::conditional_t<sizeof(unsigned long) == 8, std::uint64_t, std::uint32_t>;
+};
+template <>
+struct RNTupleSnapshotFieldType<long long> {
+   using type = std::int64_t;
+};
+template <>
+struct RNTupleSnapshotFieldType<unsigned long long> {
+   using type = std::uint64_t;
+};
+template <typename T>
+struct RNTupleSnapshotFieldType<RVec<T>> {
+   using type = RVec<typename RNTupleSnapshotFieldType<T>::type>;
 };
+template <typename T>
+struct RNTupleSnapshotFieldType<std::vector<T>> {
+   using type = std::vector<typename RNTupleSnapshotFieldType<T>::type>;
+};
+
+/// Creates the model of the RNTuple written by Snapshot: one top-level field per column, RVecs and other collections
+/// are written as RNTuple collections.
+template <typename... ColTypes, std::size_t... S>
+std::unique_ptr<ROOT::Experimental::RNTupleModel>
+MakeSnapshotRNTupleModel(const ColumnNames_t &fieldNames, std::index_sequence<S...> /*dummy*/)
+{
+   auto model = ROOT::Experimental::RNTupleModel::CreateBare();
+   int expander[] = {
+      (model->AddField(
+          std::make_unique<ROOT::Experimental::RField<typename RNTupleSnapshotFieldType<ColTypes>::type>>(
+             fieldNames[S])),
+       0)...,
+      0};
+   (void)expander; // avoid unused variable warnings for older compilers such as gcc 4.9
+   return model;
+}
+
+void ValidateSnapshotRNTupleOutput(const RSnapshotOptions &opts, const std::string &dirName,
+                                   const std::string &ntupleName, const std::string &fileName);
+ROOT::Experimental::RNTupleWriteOptions GetSnapshotRNTupleWriteOptions(const RSnapshotOptions &opts);
+/// Lets the entry point to the values of the current event. Values are captured anew only if their address changed
+/// since the previous event.
+void CaptureSnapshotRNTupleValues(ROOT::Experimental::REntry &entry, const ColumnNames_t &fieldNames,
+                                  std::vector<void *> &capturedAddresses, void *const *addresses);
+/// Replaces the (empty) data frame returned by Snapshot by a data frame reading the written RNTuple
+void ResetSnapshotRNTupleDataFrame(ROOT::RDataFrame &df, const std::string &ntupleName, const std::string &fileName);
+
+/// Helper object for a single-thread Snapshot action writing an RNTuple
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   std::string fFileName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fOutputFieldNames;
+   /// The data frame returned by Snapshot; it can only read the output once the event loop is done
+   std::shared_ptr<ROOT::RDataFrame> fOutputDataFrame;
+   std::unique_ptr<TFile> fOutputFile;
+   std::unique_ptr<ROOT::Experimental::RNTupleWriter> fWriter;
+   std::unique_ptr<ROOT::Experimental::REntry> fOutputEntry; // bare entry, its values point to the input values
+   std::vector<void *> fCapturedAddresses;
+   ULong64_t fNEntries = 0; // number of entries written, used to commit clusters according to fOptions.fAutoFlush
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(std::string_view filename, std::string_view dirname, std::string_view ntuplename,
+                         const ColumnNames_t &bnames, const RSnapshotOptions &options,
+                         const std::shared_ptr<ROOT::RDataFrame> &outputDataFrame)
+      : fFileName(filename), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames)), fOutputDataFrame(outputDataFrame)
+   {
+      ValidateSnapshotRNTupleOutput(fOptions, std::string(dirname), fNTupleName, fFileName);
+   }
+
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+   ~SnapshotRNTupleHelper()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && !fOutputFile /* did not run */ && fOptions.fLazy)
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   void InitTask(TTreeReader *, unsigned int /* slot */) {}
+
+   void Exec(unsigned int /* slot */, ColTypes &... values)
+   {
+      std::array<void *, sizeof...(ColTypes)> addresses{{&values...}};
+      CaptureSnapshotRNTupleValues(*fOutputEntry, fOutputFieldNames, fCapturedAddresses, addresses.data());
+      fWriter->Fill(*fOutputEntry);
+      if ((fOptions.fAutoFlush > 0) && (++fNEntries % fOptions.fAutoFlush == 0))
+         fWriter->CommitCluster();
+   }
+
+   void Initialize()
+   {
+      auto model = MakeSnapshotRNTupleModel<ColTypes...>(fOutputFieldNames, std::index_sequence_for<ColTypes...>{});
+      fOutputFile.reset(
+         TFile::Open(fFileName.c_str(), fOptions.fMode.c_str(), /*ftitle=*/"",
+                     ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel)));
+      if (!fOutputFile)
+         throw std::runtime_error("Snapshot: could not create output file " + fFileName);
+
+      fWriter = ROOT::Experimental::RNTupleWriter::Append(std::move(model), fNTupleName, *fOutputFile,
+                                                          GetSnapshotRNTupleWriteOptions(fOptions));
+      fOutputEntry = fWriter->GetModel()->CreateBareEntry();
+      fCapturedAddresses.assign(sizeof...(ColTypes), nullptr);
+      fNEntries = 0;
+   }
+
+   void Finalize()
+   {
+      assert(fWriter != nullptr);
+      assert(fOutputFile != nullptr);
+
+      fOutputEntry.reset();
+      // destructing the writer commits the last cluster and writes the footer
+      fWriter.reset();
+      fOutputFile->Close();
+      ResetSnapshotRNTupleDataFrame(*fOutputDataFrame, fNTupleName, fFileName);
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+
+/// Helper object for a multi-thread Snapshot action writing an RNTuple. Every slot fills its own fill context of a
+/// parallel writer; the entries of a task are committed as one cluster at the end of the task.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelperMT : public RActionImpl<SnapshotRNTupleHelperMT<ColTypes...>> {
+   unsigned int fNSlots;
+   std::string fFileName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fOutputFieldNames;
+   /// The data frame returned by Snapshot; it can only read the output once the event loop is done
+   std::shared_ptr<ROOT::RDataFrame> fOutputDataFrame;
+   std::unique_ptr<TFile> fOutputFile;
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   std::vector<std::shared_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts; // one per slot
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fOutputEntries;            // bare entries, one per slot
+   std::vector<std::vector<void *>> fCapturedAddresses;
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelperMT(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                           std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options,
+                           const std::shared_ptr<ROOT::RDataFrame> &outputDataFrame)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames)), fOutputDataFrame(outputDataFrame),
+        fFillContexts(fNSlots), fOutputEntries(fNSlots),
+        fCapturedAddresses(fNSlots, std::vector<void *>(sizeof...(ColTypes), nullptr))
+   {
+      ValidateSnapshotRNTupleOutput(fOptions, std::string(dirname), fNTupleName, fFileName);
+   }
+   SnapshotRNTupleHelperMT(const SnapshotRNTupleHelperMT &) = delete;
+   SnapshotRNTupleHelperMT(SnapshotRNTupleHelperMT &&) = default;
+   ~SnapshotRNTupleHelperMT()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && !fOutputFile /* did not run */ && fOptions.fLazy)
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (fFillContexts[slot])
+         return;
+      // first time this slot executes something: its fill context lives until the end of the event loop
+      fFillContexts[slot] = fWriter->CreateFillContext();
+      fOutputEntries[slot] = fFillContexts[slot]->GetModel()->CreateBareEntry();
+      std::fill(fCapturedAddresses[slot].begin(), fCapturedAddresses[slot].end(), nullptr);
+   }
+
+   void FinalizeTask(unsigned int slot) { fFillContexts[slot]->CommitCluster(); }
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      std::array<void *, sizeof...(ColTypes)> addresses{{&values...}};
+      CaptureSnapshotRNTupleValues(*fOutputEntries[slot], fOutputFieldNames, fCapturedAddresses[slot],
+                                   addresses.data());
+      auto &fillContext = *fFillContexts[slot];
+      fillContext.Fill(*fOutputEntries[slot]);
+      if ((fOptions.fAutoFlush > 0) && (fillContext.GetNEntries() % fOptions.fAutoFlush == 0))
+         fillContext.CommitCluster();
+   }
+
+   void Initialize()
+   {
+      auto model = MakeSnapshotRNTupleModel<ColTypes...>(fOutputFieldNames, std::index_sequence_for<ColTypes...>{});
+      fOutputFile.reset(
+         TFile::Open(fFileName.c_str(), fOptions.fMode.c_str(), /*ftitle=*/"",
+                     ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel)));
+      if (!fOutputFile)
+         throw std::runtime_error("Snapshot: could not create output file " + fFileName);
+
+      fWriter = ROOT::Experimental::RNTupleParallelWriter::Append(std::move(model), fNTupleName, *fOutputFile,
+                                                                  GetSnapshotRNTupleWriteOptions(fOptions));
+   }
+
+   void Finalize()
+   {
+      assert(fWriter != nullptr);
+      assert(fOutputFile != nullptr);
+
+      // the fill contexts must be destructed before the writer, which then writes the footer
+      fOutputEntries.clear();
+      fFillContexts.clear();
+      fWriter.reset();
+      fOutputFile->Close();
+      ResetSnapshotRNTupleDataFrame(*fOutputDataFrame, fNTupleName, fFileName);
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+
+#endif // R__HAS_ROOT7
 
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
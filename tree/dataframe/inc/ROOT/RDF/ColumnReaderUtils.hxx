@@ -11,6 +11,7 @@
 #ifndef ROOT_RDF_COLUMNREADERUTILS
 #define ROOT_RDF_COLUMNREADERUTILS
 
+#include "RBlockColumnReader.hxx"
 #include "RColumnReaderBase.hxx"
 #include "RColumnRegister.hxx"
 #include "RDefineBase.hxx"
@@ -30,6 +31,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <typeinfo> // for typeid
 #include <vector>
 
@@ -40,13 +42,25 @@ namespace RDF {
 using namespace ROOT::TypeTraits;
 namespace RDFDetail = ROOT::Detail::RDF;
 
+/// Flat branches of fundamental type are read basket by basket with the TTree bulk I/O interface.
 template <typename T>
-RDFDetail::RColumnReaderBase *GetColumnReader(unsigned int slot, RColumnReaderBase *defineOrVariationReader,
-                                              RLoopManager &lm, TTreeReader *r, const std::string &colName)
+std::unique_ptr<RDFDetail::RColumnReaderBase>
+MakeTreeColumnReader(TTreeReader &r, const std::string &colName, std::true_type /*isBulkReadable*/)
 {
-   if (defineOrVariationReader != nullptr)
-      return defineOrVariationReader;
+   return std::make_unique<RTreeBulkColumnReader<T>>(r, colName);
+}
 
+template <typename T>
+std::unique_ptr<RDFDetail::RColumnReaderBase>
+MakeTreeColumnReader(TTreeReader &r, const std::string &colName, std::false_type /*isBulkReadable*/)
+{
+   return std::make_unique<RTreeColumnReader<T>>(r, colName);
+}
+
+template <typename T>
+RDFDetail::RColumnReaderBase *
+GetDatasetColumnReader(unsigned int slot, RLoopManager &lm, TTreeReader *r, const std::string &colName)
+{
    // Check if we already inserted a reader for this column in the dataset column readers (RDataSource or Tree/TChain
    // readers)
    auto *datasetColReader = lm.GetDatasetColumnReader(slot, colName, typeid(T));
@@ -56,10 +70,46 @@ RDFDetail::RColumnReaderBase *GetColumnReader(unsigned int slot, RColumnReaderBa
    assert(r != nullptr && "We could not find a reader for this column, this should never happen at this point.");
 
    // Make a RTreeColumnReader for this column and insert it in RLoopManager's map
-   auto treeColReader = std::make_unique<RTreeColumnReader<T>>(*r, colName);
+   auto treeColReader = MakeTreeColumnReader<T>(*r, colName, RIsBulkReadable<T>{});
    return lm.AddTreeColumnReader(slot, colName, std::move(treeColReader), typeid(T));
 }
 
+/// In block-wise execution, nodes read dataset columns through readers that buffer the values of the whole block.
+template <typename T>
+RDFDetail::RColumnReaderBase *GetBlockColumnReader(unsigned int slot, RLoopManager &lm, TTreeReader *r,
+                                                   const std::string &colName, std::true_type /*isBufferable*/)
+{
+   auto *blockColReader = lm.GetBlockColumnReader(slot, colName, typeid(T));
+   if (blockColReader != nullptr)
+      return blockColReader;
+
+   auto *datasetColReader = GetDatasetColumnReader<T>(slot, lm, r, colName);
+   return lm.AddBlockColumnReader(
+      slot, colName, std::make_unique<RBlockColumnReader<T>>(*datasetColReader, lm.GetEntryBlock(slot)), typeid(T));
+}
+
+/// Values that can't be buffered are read directly from the dataset, which requires blocks of one entry.
+template <typename T>
+RDFDetail::RColumnReaderBase *GetBlockColumnReader(unsigned int slot, RLoopManager &lm, TTreeReader *r,
+                                                   const std::string &colName, std::false_type /*isBufferable*/)
+{
+   lm.SetBlockUnbufferable(slot);
+   return GetDatasetColumnReader<T>(slot, lm, r, colName);
+}
+
+template <typename T>
+RDFDetail::RColumnReaderBase *GetColumnReader(unsigned int slot, RColumnReaderBase *defineOrVariationReader,
+                                              RLoopManager &lm, TTreeReader *r, const std::string &colName)
+{
+   if (defineOrVariationReader != nullptr)
+      return defineOrVariationReader;
+
+   if (lm.GetBlockSize() > 0)
+      return GetBlockColumnReader<T>(slot, lm, r, colName, RIsBlockBufferable<T>{});
+
+   return GetDatasetColumnReader<T>(slot, lm, r, colName);
+}
+
 /// This type aggregates some of the arguments passed to GetColumnReaders.
 /// We need to pass a single RColumnReadersInfo object rather than each argument separately because with too many
 /// arguments passed, gcc 7.5.0 and cling disagree on the ABI, which leads to the last function argument being read
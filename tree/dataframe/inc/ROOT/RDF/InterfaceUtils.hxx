@@ -251,6 +251,8 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// For RNTuple output: the data frame returned by Snapshot, which is set up to read the output after the event loop
+   std::shared_ptr<ROOT::RDataFrame> fOutputDataFrame;
 };
 
 // Snapshot action
@@ -276,7 +278,25 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    std::vector<bool> isDefine = makeIsDefine();
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+      const auto &outputDataFrame = snapHelperArgs->fOutputDataFrame;
+      if (!ROOT::IsImplicitMTEnabled()) {
+         using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+         using Action_t = RAction<Helper_t, PrevNodeType>;
+         actionPtr.reset(new Action_t(Helper_t(filename, dirname, treename, outputColNames, options, outputDataFrame),
+                                      colNames, prevNode, colRegister));
+      } else {
+         using Helper_t = SnapshotRNTupleHelperMT<ColTypes...>;
+         using Action_t = RAction<Helper_t, PrevNodeType>;
+         actionPtr.reset(
+            new Action_t(Helper_t(nSlots, filename, dirname, treename, outputColNames, options, outputDataFrame),
+                         colNames, prevNode, colRegister));
+      }
+#else
+      throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7 support");
+#endif
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -329,6 +349,10 @@ void CheckForNoVariations(const std::string &where, std::string_view definedColV
 
 std::string PrettyPrintAddr(const void *const addr);
 
+/// Return the declaration of the jitted function `funcFullName` (e.g. "R_rdf::func3") under the name `newBaseName`,
+/// for use outside of namespace R_rdf. Return an empty string if no such function was jitted.
+std::string GetJittedFunctionDeclaration(const std::string &funcFullName, const std::string &newBaseName);
+
 std::shared_ptr<RJittedFilter> BookFilterJit(std::shared_ptr<RNodeBase> *prevNodeOnHeap, std::string_view name,
                                              std::string_view expression, const ColumnNames_t &branches,
                                              const RColumnRegister &colRegister, TTree *tree, RDataSource *ds);
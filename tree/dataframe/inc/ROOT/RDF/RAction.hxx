@@ -15,6 +15,7 @@
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/REntryBlock.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RVariedAction.hxx"
@@ -113,6 +114,19 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   void RunBlock(unsigned int slot, REntryBlock &block) final
+   {
+      const auto &mask = fPrevNode.CheckFiltersBlock(slot, block);
+      for (std::size_t i = 0u; i < block.fSize; ++i) {
+         if (mask[i]) {
+            block.fCurrent = i;
+            CallExec(slot, block.fEntries[i], ColumnTypes_t{}, TypeInd_t{});
+         }
+      }
+   }
+
+   bool SupportsBlockExecution() const final { return fHelper.SupportsBlockExecution(); }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
    /// Clean-up operations to be performed at the end of a task.
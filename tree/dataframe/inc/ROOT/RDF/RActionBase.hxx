@@ -34,6 +34,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+struct REntryBlock;
 
 using namespace ROOT::Detail::RDF;
 
@@ -64,6 +65,10 @@ public:
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Block-wise counterpart of Run: execute the action for the entries of the block that pass the upstream filters.
+   virtual void RunBlock(unsigned int slot, REntryBlock &block) = 0;
+   /// Whether the action can be executed block-wise, see ROOT::RDF::Experimental::EnableBlockExecution().
+   virtual bool SupportsBlockExecution() const = 0;
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -71,6 +71,11 @@ public:
    /// Override this method to register a callback that is executed before the processing a new data sample starts.
    /// The callback will be invoked in the same conditions as with DefinePerSample().
    virtual ROOT::RDF::SampleCallback_t GetSampleCallback() { return {}; }
+
+   /// Override this method to return false if the helper relies on the input values of all entries being stored at
+   /// the same addresses (e.g. because it stores the addresses at the first Exec call), which is not the case in
+   /// block-wise execution. See ROOT::RDF::Experimental::EnableBlockExecution().
+   virtual bool SupportsBlockExecution() const { return true; }
 };
 
 } // namespace RDF
@@ -0,0 +1,67 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RBLOCKCOLUMNREADER
+#define ROOT_RDF_RBLOCKCOLUMNREADER
+
+#include "RColumnReaderBase.hxx"
+#include "REntryBlock.hxx"
+#include <Rtypes.h> // Long64_t, R__CLING_PTRCHECK
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Whether the values of a dataset column of type T can be buffered for block-wise execution.
+template <typename T>
+struct RIsBlockBufferable
+   : std::integral_constant<bool, std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value> {
+};
+
+/// Type-independent part of RBlockColumnReader.
+class RBlockColumnReaderBase : public ROOT::Detail::RDF::RColumnReaderBase {
+public:
+   /// Copy the value of the entry the dataset is currently positioned at into the buffer at the given block index.
+   /// Called for every entry of the block, whether or not the entry passes the filters of the graph: once the dataset
+   /// moved on, the value is no longer available.
+   virtual void Load(std::size_t idx, Long64_t entry) = 0;
+};
+
+/// Column reader that serves the values of a dataset column for all the entries of a REntryBlock.
+///
+/// Tree and data source readers only provide the value of the entry the dataset is positioned at. In block-wise
+/// execution, the RLoopManager moves through all entries of a block and calls Load for each of them before the
+/// computation graph is evaluated; nodes then read the buffered value of the entry they are evaluating.
+template <typename T>
+class R__CLING_PTRCHECK(off) RBlockColumnReader final : public RBlockColumnReaderBase {
+   /// The wrapped tree or data source column reader.
+   ROOT::Detail::RDF::RColumnReaderBase &fReader;
+   const REntryBlock &fBlock;
+   /// One value per entry of the block. A plain array rather than std::vector to get addressable values for T = bool.
+   std::unique_ptr<T[]> fValues;
+
+   void *GetImpl(Long64_t) final { return &fValues[fBlock.fCurrent]; }
+
+public:
+   RBlockColumnReader(ROOT::Detail::RDF::RColumnReaderBase &reader, const REntryBlock &block)
+      : fReader(reader), fBlock(block), fValues(new T[block.GetCapacity()]())
+   {
+   }
+
+   void Load(std::size_t idx, Long64_t entry) final { fValues[idx] = fReader.Get<T>(entry); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RBLOCKCOLUMNREADER
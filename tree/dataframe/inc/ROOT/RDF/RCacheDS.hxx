@@ -0,0 +1,185 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RCACHEDS
+#define ROOT_RDF_RCACHEDS
+
+#include "ROOT/RDataSource.hxx"
+#include "ROOT/RDF/RColumnCache.hxx"
+#include "ROOT/RDF/Utils.hxx" // TypeID2TypeName
+#include "ROOT/RResultPtr.hxx"
+#include "RtypesCore.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <typeinfo>
+#include <utility> // std::index_sequence
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief A RDataSource reading the columns stored by a Cache action.
+///
+/// Every chunk of the cache is one entry range, so that the values of a chunk are decompressed or read back from
+/// disk only once and by a single thread. Values of chunks that are neither compressed nor spilled are read in place.
+/// The event loop of the cached data frame starts the event loop of the original data frame, if needed.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) RCacheDS final : public ROOT::RDF::RDataSource {
+   using Cache_t = RColumnCache<ColTypes...>;
+
+   /// A chunk of the cache, at its position in the entries of the data source
+   struct RChunkLocation {
+      unsigned int fSlot;     ///< The slot of the cache that stored the chunk
+      std::size_t fIndex;     ///< The index of the chunk among the chunks of its slot
+      ULong64_t fFirstEntry;
+      ULong64_t fEndEntry;
+   };
+
+   struct RSlotState {
+      const RChunkLocation *fChunk = nullptr; ///< The chunk whose values are loaded
+      typename Cache_t::Buffers_t fBuffers;   ///< The values of the loaded chunk, if they had to be decompressed
+      typename Cache_t::ValuePtrs_t fChunkValues;
+      std::tuple<ColTypes *...> fValues; ///< The values of the current entry, the column readers point here
+      RColumnCacheReader fReader;
+   };
+
+   // the cache must outlive the spill file readers of the slots
+   ROOT::RDF::RResultPtr<Cache_t> fCache;
+   const std::vector<std::string> fColNames;
+   const std::vector<std::string> fColTypeNames;
+   std::vector<RChunkLocation> fChunks;
+   std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
+   std::vector<RSlotState> fSlots;
+
+   template <std::size_t... S>
+   static void *GetValuePtrAddress(RSlotState &slotState, std::size_t colIndex, std::index_sequence<S...>)
+   {
+      void *addresses[] = {static_cast<void *>(&std::get<S>(slotState.fValues))...};
+      return addresses[colIndex];
+   }
+
+   template <std::size_t... S>
+   static void SetValues(RSlotState &slotState, ULong64_t index, std::index_sequence<S...>)
+   {
+      int expander[] = {
+         (std::get<S>(slotState.fValues) = const_cast<ColTypes *>(std::get<S>(slotState.fChunkValues) + index),
+          0)...,
+         0};
+      (void)expander;
+   }
+
+   void LoadChunk(RSlotState &slotState, ULong64_t entry)
+   {
+      auto chunkIt = std::upper_bound(fChunks.begin(), fChunks.end(), entry,
+                                      [](ULong64_t e, const RChunkLocation &chunk) { return e < chunk.fEndEntry; });
+      if (chunkIt == fChunks.end())
+         throw std::runtime_error("Cache: entry " + std::to_string(entry) + " is not in the cache");
+      fCache->LoadChunk(chunkIt->fSlot, chunkIt->fIndex, slotState.fReader, slotState.fBuffers,
+                        slotState.fChunkValues);
+      slotState.fChunk = &*chunkIt;
+   }
+
+protected:
+   std::string AsString() final { return "cache data source"; };
+
+   Record_t GetColumnReadersImpl(std::string_view colName, const std::type_info &id) final
+   {
+      const auto colIt = std::find(fColNames.begin(), fColNames.end(), colName);
+      if (colIt == fColNames.end()) {
+         throw std::runtime_error("The specified column name, \"" + std::string(colName) +
+                                  "\" is not known to the data source.");
+      }
+      const auto colIndex = std::distance(fColNames.begin(), colIt);
+      const auto idName = TypeID2TypeName(id);
+      if (fColTypeNames[colIndex] != idName) {
+         throw std::runtime_error("Column " + std::string(colName) + " has type " + fColTypeNames[colIndex] +
+                                  " while the id specified is associated to type " + idName);
+      }
+
+      Record_t ret;
+      for (auto &slotState : fSlots)
+         ret.emplace_back(GetValuePtrAddress(slotState, colIndex, std::index_sequence_for<ColTypes...>{}));
+      return ret;
+   }
+
+public:
+   RCacheDS(const ROOT::RDF::RResultPtr<Cache_t> &cache, const std::vector<std::string> &colNames)
+      : fCache(cache), fColNames(colNames), fColTypeNames({TypeID2TypeName(typeid(ColTypes))...})
+   {
+   }
+
+   const std::vector<std::string> &GetColumnNames() const final { return fColNames; }
+
+   bool HasColumn(std::string_view colName) const final
+   {
+      return std::find(fColNames.begin(), fColNames.end(), colName) != fColNames.end();
+   }
+
+   std::string GetTypeName(std::string_view colName) const final
+   {
+      const auto colIt = std::find(fColNames.begin(), fColNames.end(), colName);
+      if (colIt == fColNames.end())
+         throw std::runtime_error("The specified column name, \"" + std::string(colName) +
+                                  "\" is not known to the data source.");
+      return fColTypeNames[std::distance(fColNames.begin(), colIt)];
+   }
+
+   void SetNSlots(unsigned int nSlots) final
+   {
+      // the slot states are not copyable, they are constructed in place
+      fSlots = std::vector<RSlotState>(nSlots);
+   }
+
+   void Initialize() final
+   {
+      // this runs the event loop that fills the cache, if it did not run yet
+      const auto &cache = *fCache;
+      fChunks.clear();
+      fEntryRanges.clear();
+      ULong64_t nEntries = 0;
+      for (auto slot = 0u; slot < cache.GetNSlots(); ++slot) {
+         const auto &chunks = cache.GetChunks(slot);
+         for (std::size_t i = 0; i < chunks.size(); ++i) {
+            fChunks.push_back({slot, i, nEntries, nEntries + chunks[i].fNEntries});
+            fEntryRanges.emplace_back(nEntries, nEntries + chunks[i].fNEntries);
+            nEntries += chunks[i].fNEntries;
+         }
+      }
+      for (auto &slotState : fSlots)
+         slotState.fChunk = nullptr;
+   }
+
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final
+   {
+      auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+      fEntryRanges.clear();
+      return entryRanges;
+   }
+
+   bool SetEntry(unsigned int slot, ULong64_t entry) final
+   {
+      auto &slotState = fSlots[slot];
+      if (!slotState.fChunk || entry < slotState.fChunk->fFirstEntry || entry >= slotState.fChunk->fEndEntry)
+         LoadChunk(slotState, entry);
+      SetValues(slotState, entry - slotState.fChunk->fFirstEntry, std::index_sequence_for<ColTypes...>{});
+      return true;
+   }
+
+   std::string GetLabel() final { return "CacheDS"; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RCACHEDS
@@ -0,0 +1,479 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RCOLUMNCACHE
+#define ROOT_RDF_RCOLUMNCACHE
+
+#include "RConfigure.h" // R__HAS_ROOT7
+#include "ROOT/RCacheOptions.hxx"
+#include "ROOT/RDF/ActionHelpers.hxx" // RActionImpl, MakeSnapshotRNTupleModel
+#include "ROOT/RDF/Utils.hxx"         // ColumnNames_t
+#include "ROOT/RVec.hxx"
+#include "RtypesCore.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility> // std::index_sequence
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Compresses a buffer with the given ROOT compression settings. If the data does not compress, it is stored as is:
+/// the size of the output is then equal to the size of the input.
+void ZipCacheBuffer(const std::vector<char> &source, int compression, std::vector<char> &target);
+/// Decompresses a buffer produced by ZipCacheBuffer, which had size dataLen before compression.
+void UnzipCacheBuffer(const std::vector<char> &source, std::size_t dataLen, std::vector<char> &target);
+
+template <typename T>
+struct IsPackableCacheElement
+   : std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {
+};
+
+/// Packs the values of a chunk of a cached column into a contiguous byte buffer before compression. Only columns of
+/// arithmetic types and collections thereof can be packed, values of other types are kept in memory uncompressed.
+template <typename T, typename = void>
+struct RColumnCachePacker {
+   static constexpr bool kIsPackable = false;
+};
+
+template <typename T>
+struct RColumnCachePacker<T, std::enable_if_t<std::is_arithmetic<T>::value>> {
+   static constexpr bool kIsPackable = true;
+
+   static std::size_t GetPackedSize(const RVec<T> &values) { return values.size() * sizeof(T); }
+
+   static void Pack(const RVec<T> &values, std::vector<char> &buffer)
+   {
+      buffer.resize(GetPackedSize(values));
+      std::memcpy(buffer.data(), values.data(), buffer.size());
+   }
+
+   static void Unpack(const std::vector<char> &buffer, std::size_t nEntries, RVec<T> &values)
+   {
+      values.resize(nEntries);
+      std::memcpy(values.data(), buffer.data(), nEntries * sizeof(T));
+   }
+};
+
+/// Collections are packed as the sizes of all collections of the chunk followed by all their elements
+template <typename Coll_t, typename Elem_t>
+struct RColumnCacheCollectionPacker {
+   static constexpr bool kIsPackable = true;
+
+   static std::size_t GetPackedSize(const RVec<Coll_t> &values)
+   {
+      std::size_t nBytes = values.size() * sizeof(std::uint64_t);
+      for (const auto &coll : values)
+         nBytes += coll.size() * sizeof(Elem_t);
+      return nBytes;
+   }
+
+   static void Pack(const RVec<Coll_t> &values, std::vector<char> &buffer)
+   {
+      buffer.resize(GetPackedSize(values));
+      char *pos = buffer.data();
+      for (const auto &coll : values) {
+         const std::uint64_t size = coll.size();
+         std::memcpy(pos, &size, sizeof(size));
+         pos += sizeof(size);
+      }
+      for (const auto &coll : values) {
+         std::memcpy(pos, coll.data(), coll.size() * sizeof(Elem_t));
+         pos += coll.size() * sizeof(Elem_t);
+      }
+   }
+
+   static void Unpack(const std::vector<char> &buffer, std::size_t nEntries, RVec<Coll_t> &values)
+   {
+      values.resize(nEntries);
+      const char *sizes = buffer.data();
+      const char *elements = buffer.data() + nEntries * sizeof(std::uint64_t);
+      for (auto &coll : values) {
+         std::uint64_t size;
+         std::memcpy(&size, sizes, sizeof(size));
+         sizes += sizeof(size);
+         coll.resize(size);
+         std::memcpy(coll.data(), elements, size * sizeof(Elem_t));
+         elements += size * sizeof(Elem_t);
+      }
+   }
+};
+
+template <typename T>
+struct RColumnCachePacker<RVec<T>, std::enable_if_t<IsPackableCacheElement<T>::value>>
+   : RColumnCacheCollectionPacker<RVec<T>, T> {
+};
+
+template <typename T>
+struct RColumnCachePacker<std::vector<T>, std::enable_if_t<IsPackableCacheElement<T>::value>>
+   : RColumnCacheCollectionPacker<std::vector<T>, T> {
+};
+
+/// Estimates the memory that a value which cannot be packed owns outside of its sizeof(T) bytes, so that it counts
+/// towards the memory budget of the cache. Strings and collections are accounted for by their capacity, other types
+/// by sizeof(T) only.
+template <typename T>
+struct RColumnCacheHeapSize {
+   static std::size_t Get(const T &) { return 0; }
+};
+
+/// Whether the buffer at `data` is allocated separately from `obj`, rather than in its small buffer
+template <typename T>
+bool IsOutOfObjectBuffer(const T &obj, const void *data)
+{
+   const auto begin = reinterpret_cast<std::uintptr_t>(&obj);
+   const auto ptr = reinterpret_cast<std::uintptr_t>(data);
+   return ptr < begin || ptr >= begin + sizeof(T);
+}
+
+template <>
+struct RColumnCacheHeapSize<std::string> {
+   static std::size_t Get(const std::string &s) { return IsOutOfObjectBuffer(s, s.data()) ? s.capacity() + 1 : 0; }
+};
+
+template <typename Coll_t, typename Elem_t>
+struct RColumnCacheCollectionHeapSize {
+   static std::size_t Get(const Coll_t &coll)
+   {
+      std::size_t nBytes = IsOutOfObjectBuffer(coll, coll.data()) ? coll.capacity() * sizeof(Elem_t) : 0;
+      for (const auto &elem : coll)
+         nBytes += RColumnCacheHeapSize<Elem_t>::Get(elem);
+      return nBytes;
+   }
+};
+
+template <typename T>
+struct RColumnCacheHeapSize<RVec<T>> : RColumnCacheCollectionHeapSize<RVec<T>, T> {
+};
+
+template <typename T>
+struct RColumnCacheHeapSize<std::vector<T>> : RColumnCacheCollectionHeapSize<std::vector<T>, T> {
+};
+
+/// std::vector<bool> has no data() member
+template <>
+struct RColumnCacheHeapSize<std::vector<bool>> {
+   static std::size_t Get(const std::vector<bool> &v) { return (v.capacity() + 7) / 8; }
+};
+
+/// The values of one column in one chunk of a column cache. RVec is used to store them, as, unlike
+/// std::vector<bool>, it gives access to boolean values by address.
+template <typename T>
+struct RColumnCacheChunkColumn {
+   RVec<T> fValues;                 ///< The values, unless they are compressed
+   std::vector<char> fZippedValues; ///< The packed and compressed values
+   std::size_t fPackedSize = 0;     ///< The size of the packed values before compression, 0 if not compressed
+};
+
+/// Per-thread state to load the chunks of a column cache, see RColumnCache::LoadChunk()
+struct RColumnCacheReader {
+   std::vector<char> fPackedValues;
+#ifdef R__HAS_ROOT7
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleReader>> fSpillReaders; ///< One per spill file
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fSpillEntries;       ///< One per spill file
+#endif
+};
+
+/// The type-independent part of RColumnCache: memory accounting, compression settings and spill files.
+class RColumnCacheBase {
+protected:
+   ROOT::RDF::RCacheOptions fOptions;
+   std::atomic<ULong64_t> fMemoryUsage{0};
+   /// Once the memory budget is exceeded, all following chunks are spilled to disk
+   std::atomic<bool> fIsSpilling{false};
+   std::vector<std::vector<char>> fPackBuffers; ///< Scratch buffers to pack the values, one per slot
+   std::vector<std::string> fSpillFileNames;    ///< One per slot, empty if the slot did not spill
+   std::vector<ULong64_t> fNSpilledEntries;     ///< The number of entries in the spill file of each slot
+   ColumnNames_t fSpillFieldNames;              ///< The spill files store column i in field "_i"
+#ifdef R__HAS_ROOT7
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleWriter>> fSpillWriters; ///< One per slot
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fSpillEntries;       ///< One per slot
+#endif
+
+   int GetCompression() const;
+   /// Accounts for nBytes more of values held in memory; starts spilling if that exceeds the memory budget
+   void AddMemoryUsage(ULong64_t nBytes);
+   bool IsSpilling() const { return fIsSpilling; }
+#ifdef R__HAS_ROOT7
+   using MakeSpillModel_t = std::unique_ptr<ROOT::Experimental::RNTupleModel> (*)(const ColumnNames_t &);
+   /// Returns the writer of the spill file of the slot; the file is created with the given model on first use
+   ROOT::Experimental::RNTupleWriter &GetSpillWriter(unsigned int slot, MakeSpillModel_t makeModel);
+   /// Opens the spill file of the given slot in the reader, unless it is open already
+   void OpenSpillFile(unsigned int spillSlot, RColumnCacheReader &reader) const;
+#endif
+
+public:
+   RColumnCacheBase(const ROOT::RDF::RCacheOptions &options, std::size_t nColumns, unsigned int nSlots);
+   RColumnCacheBase(const RColumnCacheBase &) = delete;
+   RColumnCacheBase &operator=(const RColumnCacheBase &) = delete;
+   /// Removes the spill files
+   virtual ~RColumnCacheBase();
+
+   unsigned int GetNSlots() const { return fPackBuffers.size(); }
+   const ROOT::RDF::RCacheOptions &GetOptions() const { return fOptions; }
+   ULong64_t GetMemoryUsage() const { return fMemoryUsage; }
+   /// Closes the spill files; no chunk can be added afterwards
+   void FinishFilling();
+};
+
+/// The result of a Cache action: the values of the cached columns in chunks of entries. Every processing slot adds
+/// its own chunks, so that filling the cache in a multi-thread event loop requires neither locking nor a final
+/// concatenation. Chunks are kept in memory, compressed if possible, as long as the memory budget allows it; the
+/// following chunks are written to a temporary RNTuple file per slot.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) RColumnCache final : public RColumnCacheBase {
+public:
+   using Buffers_t = std::tuple<RVec<ColTypes>...>;
+   using ValuePtrs_t = std::tuple<const ColTypes *...>;
+
+   struct RChunk {
+      ULong64_t fNEntries = 0;
+      std::tuple<RColumnCacheChunkColumn<ColTypes>...> fColumns; ///< Empty for spilled chunks
+      bool fIsSpilled = false;
+      ULong64_t fFirstSpilledEntry = 0; ///< The first entry of the chunk in the spill file of its slot
+   };
+
+private:
+   std::vector<std::vector<RChunk>> fChunks; ///< One sequence of chunks per slot
+
+#ifdef R__HAS_ROOT7
+   static std::unique_ptr<ROOT::Experimental::RNTupleModel> MakeSpillModel(const ColumnNames_t &fieldNames)
+   {
+      return MakeSnapshotRNTupleModel<ColTypes...>(fieldNames, std::index_sequence_for<ColTypes...>{});
+   }
+#endif
+
+   template <typename T>
+   std::size_t StoreColumn(unsigned int slot, RVec<T> &values, RColumnCacheChunkColumn<T> &column,
+                           std::true_type /*isPackable*/)
+   {
+      using Packer_t = RColumnCachePacker<T>;
+      const auto compression = GetCompression();
+      if (compression % 100 == 0) {
+         const auto nBytes = Packer_t::GetPackedSize(values);
+         column.fValues = std::move(values);
+         return nBytes;
+      }
+      auto &packed = fPackBuffers[slot];
+      Packer_t::Pack(values, packed);
+      column.fPackedSize = packed.size();
+      ZipCacheBuffer(packed, compression, column.fZippedValues);
+      return column.fZippedValues.size();
+   }
+
+   template <typename T>
+   std::size_t StoreColumn(unsigned int, RVec<T> &values, RColumnCacheChunkColumn<T> &column,
+                           std::false_type /*isPackable*/)
+   {
+      auto nBytes = values.size() * sizeof(T);
+      for (const auto &value : values)
+         nBytes += RColumnCacheHeapSize<T>::Get(value);
+      column.fValues = std::move(values);
+      return nBytes;
+   }
+
+   template <std::size_t... S>
+   std::size_t StoreColumns(unsigned int slot, Buffers_t &values, RChunk &chunk, std::index_sequence<S...>)
+   {
+      std::size_t nBytes = 0;
+      int expander[] = {
+         (nBytes += StoreColumn(slot, std::get<S>(values), std::get<S>(chunk.fColumns),
+                                std::integral_constant<bool, RColumnCachePacker<ColTypes>::kIsPackable>{}),
+          0)...,
+         0};
+      (void)expander;
+      return nBytes;
+   }
+
+   template <std::size_t... S>
+   static void ClearBuffers(Buffers_t &values, std::index_sequence<S...>)
+   {
+      int expander[] = {(std::get<S>(values).clear(), 0)..., 0};
+      (void)expander;
+   }
+
+   template <std::size_t... S>
+   void Spill(unsigned int slot, Buffers_t &values, RChunk &chunk, std::index_sequence<S...>)
+   {
+#ifdef R__HAS_ROOT7
+      auto &writer = GetSpillWriter(slot, &MakeSpillModel);
+      auto &entry = *fSpillEntries[slot];
+      chunk.fIsSpilled = true;
+      chunk.fFirstSpilledEntry = fNSpilledEntries[slot];
+      fNSpilledEntries[slot] += chunk.fNEntries;
+      for (ULong64_t i = 0; i < chunk.fNEntries; ++i) {
+         int expander[] = {(entry.CaptureValueUnsafe(fSpillFieldNames[S], &std::get<S>(values)[i]), 0)..., 0};
+         (void)expander;
+         writer.Fill(entry);
+      }
+      writer.CommitCluster();
+#else
+      (void)slot;
+      (void)values;
+      (void)chunk;
+#endif
+   }
+
+   template <typename T>
+   void LoadColumn(const RColumnCacheChunkColumn<T> &column, std::size_t nEntries, RColumnCacheReader &reader,
+                   RVec<T> &buffer, const T *&values, std::true_type /*isPackable*/)
+   {
+      if (column.fPackedSize == 0) {
+         values = column.fValues.data();
+         return;
+      }
+      UnzipCacheBuffer(column.fZippedValues, column.fPackedSize, reader.fPackedValues);
+      RColumnCachePacker<T>::Unpack(reader.fPackedValues, nEntries, buffer);
+      values = buffer.data();
+   }
+
+   template <typename T>
+   void LoadColumn(const RColumnCacheChunkColumn<T> &column, std::size_t, RColumnCacheReader &, RVec<T> &,
+                   const T *&values, std::false_type /*isPackable*/)
+   {
+      values = column.fValues.data();
+   }
+
+   template <std::size_t... S>
+   void LoadColumns(const RChunk &chunk, RColumnCacheReader &reader, Buffers_t &buffers, ValuePtrs_t &values,
+                    std::index_sequence<S...>)
+   {
+      int expander[] = {(LoadColumn(std::get<S>(chunk.fColumns), chunk.fNEntries, reader, std::get<S>(buffers),
+                                    std::get<S>(values),
+                                    std::integral_constant<bool, RColumnCachePacker<ColTypes>::kIsPackable>{}),
+                         0)...,
+                        0};
+      (void)expander;
+   }
+
+   template <std::size_t... S>
+   void LoadSpilledColumns(unsigned int slot, const RChunk &chunk, RColumnCacheReader &reader, Buffers_t &buffers,
+                           ValuePtrs_t &values, std::index_sequence<S...>)
+   {
+#ifdef R__HAS_ROOT7
+      OpenSpillFile(slot, reader);
+      auto &ntuple = *reader.fSpillReaders[slot];
+      auto &entry = *reader.fSpillEntries[slot];
+      int resizeExpander[] = {(std::get<S>(buffers).resize(chunk.fNEntries), 0)..., 0};
+      (void)resizeExpander;
+      for (ULong64_t i = 0; i < chunk.fNEntries; ++i) {
+         int expander[] = {(entry.CaptureValueUnsafe(fSpillFieldNames[S], &std::get<S>(buffers)[i]), 0)..., 0};
+         (void)expander;
+         ntuple.LoadEntry(chunk.fFirstSpilledEntry + i, entry);
+      }
+      int valuesExpander[] = {(std::get<S>(values) = std::get<S>(buffers).data(), 0)..., 0};
+      (void)valuesExpander;
+#else
+      (void)slot;
+      (void)chunk;
+      (void)reader;
+      (void)buffers;
+      (void)values;
+#endif
+   }
+
+public:
+   RColumnCache(const ROOT::RDF::RCacheOptions &options, unsigned int nSlots)
+      : RColumnCacheBase(options, sizeof...(ColTypes), nSlots), fChunks(nSlots)
+   {
+   }
+
+   /// Adds the values as a new chunk of the given slot. The values are moved from and cleared.
+   /// Concurrent calls must use different slots.
+   void AddChunk(unsigned int slot, Buffers_t &values)
+   {
+      RChunk chunk;
+      chunk.fNEntries = std::get<0>(values).size();
+      if (chunk.fNEntries == 0)
+         return;
+
+      if (IsSpilling()) {
+         Spill(slot, values, chunk, std::index_sequence_for<ColTypes...>{});
+      } else {
+         AddMemoryUsage(StoreColumns(slot, values, chunk, std::index_sequence_for<ColTypes...>{}));
+      }
+      fChunks[slot].emplace_back(std::move(chunk));
+      ClearBuffers(values, std::index_sequence_for<ColTypes...>{});
+   }
+
+   const std::vector<RChunk> &GetChunks(unsigned int slot) const { return fChunks[slot]; }
+
+   /// Makes values point to the values of the chunk of the given slot. Compressed and spilled values are loaded into
+   /// the buffers. Concurrent calls must use different readers and buffers.
+   void LoadChunk(unsigned int slot, std::size_t chunkIndex, RColumnCacheReader &reader, Buffers_t &buffers,
+                  ValuePtrs_t &values)
+   {
+      const auto &chunk = fChunks[slot][chunkIndex];
+      if (chunk.fIsSpilled)
+         LoadSpilledColumns(slot, chunk, reader, buffers, values, std::index_sequence_for<ColTypes...>{});
+      else
+         LoadColumns(chunk, reader, buffers, values, std::index_sequence_for<ColTypes...>{});
+   }
+};
+
+/// Helper object for the Cache action: every slot collects the values of a chunk of entries before adding them to
+/// the cache.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) CacheHelper : public RActionImpl<CacheHelper<ColTypes...>> {
+   using Cache_t = RColumnCache<ColTypes...>;
+   std::shared_ptr<Cache_t> fCache;
+   std::vector<typename Cache_t::Buffers_t> fBuffers; ///< The values not yet added to the cache, one per slot
+   std::size_t fChunkSize;
+
+   template <std::size_t... S>
+   void PushBack(typename Cache_t::Buffers_t &buffers, std::index_sequence<S...>, const ColTypes &...values)
+   {
+      int expander[] = {(std::get<S>(buffers).emplace_back(values), 0)..., 0};
+      (void)expander;
+   }
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   CacheHelper(const std::shared_ptr<Cache_t> &cache, const unsigned int nSlots)
+      : fCache(cache), fBuffers(nSlots), fChunkSize(cache->GetOptions().fChunkSize)
+   {
+   }
+   CacheHelper(CacheHelper &&) = default;
+   CacheHelper(const CacheHelper &) = delete;
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, const ColTypes &...values)
+   {
+      auto &buffers = fBuffers[slot];
+      PushBack(buffers, std::index_sequence_for<ColTypes...>{}, values...);
+      if (std::get<0>(buffers).size() >= fChunkSize)
+         fCache->AddChunk(slot, buffers);
+   }
+
+   void Initialize() {}
+
+   void Finalize()
+   {
+      for (auto slot = 0u; slot < fBuffers.size(); ++slot)
+         fCache->AddChunk(slot, fBuffers[slot]);
+      fCache->FinishFilling();
+   }
+
+   std::string GetActionName() { return "Cache"; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RCOLUMNCACHE
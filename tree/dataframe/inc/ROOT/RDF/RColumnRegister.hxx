@@ -140,6 +140,8 @@ public:
 
    std::vector<std::string> GetVariationsFor(const std::string &column) const;
 
+   RVariationBase *GetVariation(const std::string &colName, const std::string &variationName) const;
+
    std::vector<std::string> GetVariationDeps(const std::string &column) const;
 
    std::vector<std::string> GetVariationDeps(const ColumnNames_t &columns) const;
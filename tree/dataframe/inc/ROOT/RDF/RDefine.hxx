@@ -22,7 +22,10 @@
 
 #include <array>
 #include <deque>
+#include <memory>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
 #include <utility> // std::index_sequence
 #include <vector>
 
@@ -62,6 +65,11 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
 
    F fExpression;
    ValuesPerSlot_t fLastResults;
+   /// Per-slot values for each entry of the block in block-wise execution, null in entry-by-entry execution.
+   /// Plain arrays rather than std::vector to get addressable values also for bool.
+   std::vector<std::unique_ptr<ret_type[]>> fBlockResults;
+   /// Per-slot entry numbers the values in fBlockResults were computed for
+   std::vector<std::vector<Long64_t>> fBlockCheckedEntries;
 
    /// Column readers per slot and per input column
    std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
@@ -71,27 +79,24 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
+   ret_type UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
+   ret_type UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void
+   ret_type
    UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
 public:
@@ -99,7 +104,8 @@ public:
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fBlockResults(lm.GetNSlots()),
+        fBlockCheckedEntries(lm.GetNSlots()), fValues(lm.GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -113,6 +119,14 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+
+      const auto blockSize = fLoopManager->GetBlockSize();
+      if (blockSize == 0) {
+         fBlockResults[slot].reset();
+      } else if (!fBlockResults[slot] || fBlockCheckedEntries[slot].size() != blockSize) {
+         fBlockResults[slot].reset(new ret_type[blockSize]());
+      }
+      fBlockCheckedEntries[slot].assign(blockSize, -1);
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
@@ -121,18 +135,40 @@ public:
       return static_cast<void *>(&fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()]);
    }
 
-   /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
-   void Update(unsigned int slot, Long64_t entry) final
+   /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry.
+   /// In block-wise execution, the value is stored at the position of the entry in the block instead.
+   void *Update(unsigned int slot, Long64_t entry) final
    {
+      if (fEquivalentDefine != nullptr)
+         return fEquivalentDefine->Update(slot, entry);
+
+      if (fBlockResults[slot]) {
+         const auto idx = fLoopManager->GetEntryBlock(slot).fCurrent;
+         auto &lastCheckedEntry = fBlockCheckedEntries[slot][idx];
+         if (entry != lastCheckedEntry) {
+            fBlockResults[slot][idx] = UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+            lastCheckedEntry = entry;
+         }
+         return &fBlockResults[slot][idx];
+      }
+
+      auto &lastResult = fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()];
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          // evaluate this define expression, cache the result
-         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         lastResult = UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
+      return &lastResult;
    }
 
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
+   std::string GetExpressionId() const final
+   {
+      const auto callableId = RDFInternal::GetCallableId(fExpression);
+      return callableId.empty() ? "" : std::string(typeid(*this).name()) + ':' + callableId;
+   }
+
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
 
    /// Clean-up operations to be performed at the end of a task.
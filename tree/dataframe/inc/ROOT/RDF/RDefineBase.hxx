@@ -48,6 +48,11 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   /// Set by RLoopManager::OptimizeGraph(): an equivalent Define whose values this Define returns instead of
+   /// evaluating its own expression, or null.
+   RDefineBase *fEquivalentDefine = nullptr;
+   /// Set by RLoopManager::OptimizeGraph(): whether this Define is skipped in the current event loop.
+   bool fIsPruned = false;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -62,14 +67,29 @@ public:
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
    std::string GetTypeName() const;
-   /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
-   virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry.
+   /// Return the address of the updated value: in block-wise execution, each entry of the block has its own value.
+   virtual void *Update(unsigned int slot, Long64_t entry) = 0;
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
 
    const std::vector<std::string> &GetVariations() const { return fVariationDeps; }
+   const ROOT::RDF::ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   RDFInternal::RColumnRegister &GetColRegister() { return fColRegister; }
+   /// The variation this define evaluates values for.
+   const std::string &GetVariationName() const { return fVariation; }
+
+   /// Return an identifier of the expression of this Define that is equal for Defines of the same type that compute
+   /// the same values from the same input columns, or an empty string if that can not be established.
+   virtual std::string GetExpressionId() const { return ""; }
+   void SetEquivalentDefine(RDefineBase *define) { fEquivalentDefine = define; }
+   RDefineBase *GetEquivalentDefine() const { return fEquivalentDefine; }
+   void SetPruned(bool isPruned) { fIsPruned = isPruned; }
+   /// Whether this Define is not initialized in the current event loop, because no node reads it or because its
+   /// readers are served by an equivalent Define.
+   bool IsPruned() const { return fIsPruned; }
 
    /// Create clones of this Define that work with values in varied "universes".
    virtual void MakeVariations(const std::vector<std::string> &variations) = 0;
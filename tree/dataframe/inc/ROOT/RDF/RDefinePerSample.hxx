@@ -58,9 +58,10 @@ public:
       return static_cast<void *>(&fLastResults[slot * RDFInternal::CacheLineStep<RetType_t>()]);
    }
 
-   void Update(unsigned int, Long64_t) final
+   void *Update(unsigned int slot, Long64_t) final
    {
-      // no-op
+      // the value only changes with the sample
+      return GetValuePtr(slot);
    }
 
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
@@ -0,0 +1,51 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RENTRYBLOCK
+#define ROOT_RDF_RENTRYBLOCK
+
+#include <RtypesCore.h> // Long64_t, ULong64_t
+
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// A block of entries that a processing slot evaluates as a whole in block-wise execution mode
+/// (see ROOT::RDF::Experimental::EnableBlockExecution()).
+///
+/// The values of the dataset columns of all the entries of the block are loaded before the computation graph is
+/// evaluated. Filters then compute one selection mask per block, Defines store one value per entry of the block and
+/// actions loop over the entries selected by the mask of their upstream node.
+struct REntryBlock {
+   /// The entry numbers, only the first fSize elements are valid.
+   std::vector<Long64_t> fEntries;
+   std::size_t fSize = 0;
+   /// The number of entries after which the block is evaluated. Lower than the capacity if the slot reads dataset
+   /// columns whose values can not be buffered: those only provide the value of the entry the dataset is positioned at.
+   std::size_t fMaxSize = 0;
+   /// The index of the entry that is being evaluated. The nodes set it while they iterate over the block, the column
+   /// readers and the defines use it to address their per-entry values.
+   std::size_t fCurrent = 0;
+   /// Identifies the block among those processed by the slot, so that nodes can cache per-block results.
+   ULong64_t fId = 0;
+   /// A mask that selects all entries of the block, i.e. the mask of the RLoopManager.
+   std::vector<char> fAllEntries;
+
+   explicit REntryBlock(std::size_t capacity = 0) : fEntries(capacity), fMaxSize(capacity), fAllEntries(capacity, 1) {}
+
+   std::size_t GetCapacity() const { return fEntries.size(); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RENTRYBLOCK
@@ -14,6 +14,7 @@
 #include "ROOT/RDF/ColumnReaderUtils.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RCutFlowReport.hxx"
+#include "ROOT/RDF/REntryBlock.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
@@ -22,6 +23,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -91,6 +93,9 @@ public:
 
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      if (fEquivalentFilter != nullptr)
+         return fEquivalentFilter->CheckFilters(slot, entry);
+
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          if (!fPrevNode.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
@@ -107,6 +112,35 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   const std::vector<char> &CheckFiltersBlock(unsigned int slot, RDFInternal::REntryBlock &block) final
+   {
+      if (fEquivalentFilter != nullptr)
+         return fEquivalentFilter->CheckFiltersBlock(slot, block);
+
+      auto &mask = fBlockMasks[slot];
+      auto &lastCheckedBlock = fLastCheckedBlock[slot * RDFInternal::CacheLineStep<ULong64_t>()];
+      if (block.fId != lastCheckedBlock) {
+         const auto &prevMask = fPrevNode.CheckFiltersBlock(slot, block);
+         mask.resize(block.GetCapacity());
+         ULong64_t nAccepted = 0ull;
+         ULong64_t nRejected = 0ull;
+         for (std::size_t i = 0u; i < block.fSize; ++i) {
+            if (!prevMask[i]) {
+               mask[i] = false;
+               continue;
+            }
+            block.fCurrent = i;
+            const bool passed = CheckFilterHelper(slot, block.fEntries[i], ColumnTypes_t{}, TypeInd_t{});
+            passed ? ++nAccepted : ++nRejected;
+            mask[i] = passed;
+         }
+         fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+         fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nRejected;
+         lastCheckedBlock = block.fId;
+      }
+      return mask;
+   }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
@@ -121,8 +155,13 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fLastCheckedBlock[slot * RDFInternal::CacheLineStep<ULong64_t>()] = std::numeric_limits<ULong64_t>::max();
    }
 
+   RNodeBase *GetPrevNode() const final { return &fPrevNode; }
+
+   std::string GetExpressionId() const final { return RDFInternal::GetCallableId(fFilter); }
+
    // recursive chain of `Report`s
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { PartialReport(rep); }
 
@@ -11,6 +11,7 @@
 #ifndef ROOT_RFILTERBASE
 #define ROOT_RFILTERBASE
 
+#include "ROOT/RDataSource.hxx" // RColumnRangeHint
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
@@ -41,6 +42,10 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   /// Per-slot selection masks of block-wise execution, see RNodeBase::CheckFiltersBlock
+   std::vector<std::vector<char>> fBlockMasks;
+   /// Per-slot ids of the blocks the masks in fBlockMasks correspond to
+   std::vector<ULong64_t> fLastCheckedBlock;
    const std::string fName;
    const ROOT::RDF::ColumnNames_t fColumnNames;
    RDFInternal::RColumnRegister fColRegister;
@@ -48,6 +53,14 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   /// Simple cuts on data source columns extracted from the filter expression; only set for jitted filters that are
+   /// attached directly to the RLoopManager.
+   std::vector<ROOT::RDF::RColumnRangeHint> fColumnRangeHints;
+   /// Set by RLoopManager::OptimizeGraph(): an equivalent filter whose results this filter returns instead of
+   /// evaluating its own expression, or null.
+   RFilterBase *fEquivalentFilter = nullptr;
+   /// Set by RLoopManager::OptimizeGraph(): whether this filter is skipped in the current event loop.
+   bool fIsPruned = false;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -72,6 +85,26 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+   /// Whether the filter is part of the computation graph of the current event loop. Valid after the children counts
+   /// of the nodes have been evaluated.
+   virtual bool IsActive() const { return fNChildren > 0 || HasName(); }
+   const std::vector<ROOT::RDF::RColumnRangeHint> &GetColumnRangeHints() const { return fColumnRangeHints; }
+   void SetColumnRangeHints(const std::vector<ROOT::RDF::RColumnRangeHint> &hints) { fColumnRangeHints = hints; }
+
+   const ROOT::RDF::ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   RDFInternal::RColumnRegister &GetColRegister() { return fColRegister; }
+   /// The variation this filter evaluates values for.
+   const std::string &GetVariationName() const { return fVariation; }
+   /// The node this filter is attached to.
+   virtual RNodeBase *GetPrevNode() const = 0;
+   /// Return an identifier of the filter expression that is equal for filters that compute the same results from
+   /// the same input columns, or an empty string if that can not be established.
+   virtual std::string GetExpressionId() const { return ""; }
+   void SetEquivalentFilter(RFilterBase *filter) { fEquivalentFilter = filter; }
+   void SetPruned(bool isPruned) { fIsPruned = isPruned; }
+   /// Whether this filter is not initialized in the current event loop, because it is not active or because its
+   /// results are served by an equivalent filter.
+   bool IsPruned() const { return fIsPruned; }
 };
 
 } // ns RDF
@@ -11,10 +11,12 @@
 #ifndef ROOT_RDF_TINTERFACE
 #define ROOT_RDF_TINTERFACE
 
+#include "ROOT/RCacheOptions.hxx"
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/ActionHelpers.hxx"
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
+#include "ROOT/RDF/RCacheDS.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RDefine.hxx"
 #include "ROOT/RDF/RDefinePerSample.hxx"
@@ -910,6 +912,14 @@ public:
    /// the TTree as part of the TTree name, e.g. `df.Snapshot("subdir/t", "f.root")` write TTree `t` in the
    /// sub-directory `subdir` of file `f.root` (creating file and sub-directory as needed).
    ///
+   /// ### Writing an RNTuple
+   ///
+   /// Setting `RSnapshotOptions::fOutputFormat` to `ESnapshotOutputFormat::kRNTuple` writes the columns as fields of an
+   /// RNTuple `treename` instead of a TTree. RVec and other collection columns are written as RNTuple collections.
+   /// In multi-thread runs, every task writes its entries as a separate cluster through a parallel writer.
+   /// The returned data frame reads the RNTuple through an RNTupleDS. Writing the RNTuple in a sub-directory is not
+   /// supported.
+   ///
    /// \attention In multi-thread runs (i.e. when EnableImplicitMT() has been called) threads will loop over clusters of
    /// entries in an undefined order, so Snapshot will produce outputs in which (clusters of) entries will be shuffled with
    /// respect to the input TTree. Using such "shuffled" TTrees as friends of the original trees would result in wrong
@@ -989,7 +999,7 @@ public:
                                          colListWithAliasesAndSizeBranches, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      auto newRDF = MakeSnapshotDataFrame(fullTreeName, filename, colListNoAliasesWithSizeBranches, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -1096,6 +1106,8 @@ public:
    /// ~~~{.cpp}
    /// auto cache_all_cols_df = df.Cache(myRegexp);
    /// ~~~
+   ///
+   /// **Selections that do not fit in memory:** see the overloads taking a ROOT::RDF::RCacheOptions.
    template <typename... ColumnTypes>
    RInterface<RLoopManager> Cache(const ColumnNames_t &columnList)
    {
@@ -1103,13 +1115,57 @@ public:
       return CacheImpl<ColumnTypes...>(columnList, staticSeq);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in memory within a memory budget, spilling to disk what does not fit.
+   /// \tparam ColumnTypes variadic list of branch/column types.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options the memory budget and the compression of the cached values.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// The values are stored in chunks of RCacheOptions::fChunkSize entries. Values of arithmetic types and of
+   /// collections thereof are compressed with the configured algorithm; values of other types are stored as they are.
+   /// Once the memory taken by the chunks exceeds RCacheOptions::fMemoryBudget, the following chunks are written to
+   /// temporary RNTuple files in RCacheOptions::fSpillDirectory, which are removed together with the cached data frame.
+   /// Spilling to disk requires ROOT to be built with root7 support, otherwise all values are kept in memory.
+   ///
+   /// In multi-thread runs, each thread stores its own chunks: the order of the cached entries may differ from the
+   /// order of the entries of the original dataset. Each chunk is decompressed or read back from disk once per event
+   /// loop over the cached data frame.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDF::RCacheOptions opts;
+   /// opts.fMemoryBudget = 8ull * 1024 * 1024 * 1024; // 8 GB, the rest goes to local temporary files
+   /// auto cached = df.Filter("pt > 30").Cache<float, ROOT::RVecF>({"pt", "jet_pt"}, opts);
+   /// ~~~
+   template <typename... ColumnTypes>
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const ROOT::RDF::RCacheOptions &options)
+   {
+      return CacheImpl<ColumnTypes...>(columnList, options);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns in memory.
    /// \param[in] columnList columns to be cached in memory
    /// \return a `RDataFrame` that wraps the cached dataset.
    ///
    /// See the previous overloads for more information.
-   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList)
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList) { return JitCache(columnList, nullptr); }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns within a memory budget, spilling to disk what does not fit.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options the memory budget and the compression of the cached values.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// See the previous overloads for more information.
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const ROOT::RDF::RCacheOptions &options)
+   {
+      return JitCache(columnList, &options);
+   }
+
+private:
+   RInterface<RLoopManager> JitCache(const ColumnNames_t &columnList, const ROOT::RDF::RCacheOptions *options)
    {
       // Early return: if the list of columns is empty, just return an empty RDF
       // If we proceed, the jitted call will not compile!
@@ -1142,7 +1198,12 @@ public:
       if (!columnListWithoutSizeColumns.empty())
          cacheCall.seekp(-2, cacheCall.cur);                         // remove the last ",
       cacheCall << ">(*reinterpret_cast<std::vector<std::string>*>(" // vector<string> should be ColumnNames_t
-                << RDFInternal::PrettyPrintAddr(&columnListWithoutSizeColumns) << "));";
+                << RDFInternal::PrettyPrintAddr(&columnListWithoutSizeColumns) << ")";
+      if (options) {
+         cacheCall << ", *reinterpret_cast<const ROOT::RDF::RCacheOptions*>(" << RDFInternal::PrettyPrintAddr(options)
+                   << ")";
+      }
+      cacheCall << ");";
 
       // book the code to jit with the RLoopManager and trigger the event loop
       fLoopManager->ToJitExec(cacheCall.str());
@@ -1151,6 +1212,7 @@ public:
       return resRDF;
    }
 
+public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns in memory.
    /// \param[in] columnNameRegexp The regular expression to match the column names to be selected. The presence of a '^' and a '$' at the end of the string is implicitly assumed if they are not specified. The dialect supported is PCRE via the TPRegexp class. An empty string signals the selection of all columns.
@@ -2782,6 +2844,22 @@ private:
       return *this; // never reached
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the data frame returned by Snapshot, which reads the output dataset.
+   /// A TTree output is opened lazily. An RNTuple output can only be opened once it is written; until then, the
+   /// returned data frame is empty and the Snapshot action replaces it at the end of the event loop.
+   std::shared_ptr<ROOT::RDataFrame> MakeSnapshotDataFrame(std::string_view fullTreeName, std::string_view filename,
+                                                          const ColumnNames_t &defaultColumns,
+                                                          RDFInternal::SnapshotHelperArgs &snapHelperArgs)
+   {
+      if (snapHelperArgs.fOptions.fOutputFormat == ESnapshotOutputFormat::kRNTuple) {
+         snapHelperArgs.fOutputDataFrame = std::make_shared<ROOT::RDataFrame>(ULong64_t(0));
+         return snapHelperArgs.fOutputDataFrame;
+      }
+
+      return std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, defaultColumns);
+   }
+
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>> SnapshotImpl(std::string_view fullTreeName, std::string_view filename,
                                                      const ColumnNames_t &columnList, const RSnapshotOptions &options)
@@ -2803,7 +2881,7 @@ private:
 
       ::TDirectory::TContext ctxt;
       auto newRDF =
-         std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns);
+         MakeSnapshotDataFrame(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns, *snapHelperArgs);
 
       // The Snapshot helper will use validCols (with aliases resolved) as input columns, and
       // columnListWithoutSizeColumns (still with aliases in it, passed through snapHelperArgs) as output column names.
@@ -2838,6 +2916,38 @@ private:
       return cachedRDF;
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Implementation of cache with a memory budget.
+   template <typename... ColTypes>
+   RInterface<RLoopManager> CacheImpl(const ColumnNames_t &columnList, const ROOT::RDF::RCacheOptions &options)
+   {
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "Cache");
+
+      constexpr bool areCopyConstructible =
+         RDFInternal::TEvalAnd<std::is_copy_constructible<ColTypes>::value...>::value;
+      static_assert(areCopyConstructible, "Columns of a type which is not copy constructible cannot be cached yet.");
+
+      RDFInternal::CheckTypesAndPars(sizeof...(ColTypes), columnListWithoutSizeColumns.size());
+      if (options.fChunkSize == 0)
+         throw std::invalid_argument("Cache: the chunk size must be larger than 0.");
+
+      const auto validColumnNames = GetValidatedColumnNames(sizeof...(ColTypes), columnListWithoutSizeColumns);
+      CheckAndFillDSColumns(validColumnNames, TTraits::TypeList<ColTypes...>());
+
+      using Cache_t = RDFInternal::RColumnCache<ColTypes...>;
+      using Helper_t = RDFInternal::CacheHelper<ColTypes...>;
+      using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
+      const auto nSlots = fLoopManager->GetNSlots();
+      auto cache = std::make_shared<Cache_t>(options, nSlots);
+      auto action = std::make_unique<Action_t>(Helper_t(cache, nSlots), validColumnNames, fProxiedPtr, fColRegister);
+      auto cacheResult = MakeResultPtr(cache, *fLoopManager, std::move(action));
+
+      auto ds = std::make_unique<RDFInternal::RCacheDS<ColTypes...>>(cacheResult, columnListWithoutSizeColumns);
+      RInterface<RLoopManager> cachedRDF(std::make_shared<RLoopManager>(std::move(ds), columnListWithoutSizeColumns));
+
+      return cachedRDF;
+   }
+
    template <bool IsSingleColumn, typename F>
    RInterface<Proxied, DS_t>
    VaryImpl(const std::vector<std::string> &colNames, F &&expression, const ColumnNames_t &inputColumns,
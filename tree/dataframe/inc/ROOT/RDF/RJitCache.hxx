@@ -0,0 +1,49 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RJITCACHE
+#define ROOT_RDF_RJITCACHE
+
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// The code to jit of a computation graph, made independent of the process that produced it.
+struct RNormalizedJitCode {
+   /// The code, in which the object addresses are replaced by `rdf_jit_args[i]` and the jitted functions
+   /// `R_rdf::funcN` by `R_rdf::func<k>`, with k numbering the functions in order of appearance
+   std::string fCode;
+   /// The object addresses, in the order of the `rdf_jit_args` indexes
+   std::vector<void *> fArgs;
+   /// The original names of the jitted functions, in the order of the new names
+   std::vector<std::string> fFuncNames;
+};
+
+RNormalizedJitCode NormalizeJitCode(const std::string &code);
+
+/// Set the directory of the persistent jit cache; an empty string disables the cache.
+void SetJitCacheDir(const std::string &dir);
+/// The directory of the persistent jit cache, initialized from the ROOT_RDF_JIT_CACHE environment variable.
+/// Empty if the cache is disabled.
+const std::string &GetJitCacheDir();
+
+/// Run code produced for RLoopManager::Jit() from a shared library of the persistent jit cache.
+/// A library that is not found in the cache is compiled and added to it.
+/// Return false if the cache is disabled or the code cannot be run from the cache, in which case the caller
+/// has to hand the code to the interpreter.
+/// Must be called without holding gROOTMutex, which is released while a missing library is compiled.
+bool RunJitCodeFromCache(const std::string &code);
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -44,9 +44,11 @@ public:
    ~RJittedFilter();
 
    void SetFilter(std::unique_ptr<RFilterBase> f);
+   RFilterBase *GetConcreteFilter() const { return fConcreteFilter.get(); }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   const std::vector<char> &CheckFiltersBlock(unsigned int slot, ROOT::Internal::RDF::REntryBlock &block) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -56,11 +58,13 @@ public:
    void TriggerChildrenCount() final;
    void ResetReportCount() final;
    void InitNode() final;
+   bool IsActive() const final;
    void AddFilterName(std::vector<std::string> &filters) final;
    void FinalizeSlot(unsigned int slot) final;
    std::shared_ptr<RDFGraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap) final;
    std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final;
+   RNodeBase *GetPrevNode() const final;
 };
 
 } // ns RDF
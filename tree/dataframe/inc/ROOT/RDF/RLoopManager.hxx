@@ -12,8 +12,10 @@
 #define ROOT_RLOOPMANAGER
 
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
+#include "ROOT/RDF/RBlockColumnReader.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/REntryBlock.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
@@ -24,6 +26,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility> // std::pair
 #include <vector>
 
 // forward declarations
@@ -35,6 +38,7 @@ namespace ROOT {
 namespace RDF {
 class RCutFlowReport;
 class RDataSource;
+struct RColumnRangeHint;
 } // ns RDF
 
 namespace Internal {
@@ -152,6 +156,15 @@ class RLoopManager : public RNodeBase {
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
 
+   /// Number of entries per block of the current event loop in block-wise execution, 0 in entry-by-entry execution.
+   unsigned int fBlockSize{0};
+   /// The blocks of entries being filled (one per slot) in block-wise execution.
+   std::vector<RDFInternal::REntryBlock> fEntryBlocks;
+   /// Readers that buffer the dataset column values of the entries of a block (one collection per slot), keyed like
+   /// the dataset column readers they wrap. They are re-created at every task.
+   std::vector<std::vector<std::pair<std::string, std::unique_ptr<RDFInternal::RBlockColumnReaderBase>>>>
+      fBlockColumnReaders;
+
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
@@ -164,11 +177,17 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunSampleCallbacks(unsigned int slot);
+   void ProcessEntry(unsigned int slot, Long64_t entry);
+   void RunBlock(unsigned int slot);
+   unsigned int EvalBlockSize() const;
+   void OptimizeGraph();
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
+   std::vector<ROOT::RDF::RColumnRangeHint> GetColumnRangeHints() const;
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
    void UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range);
    void UpdateSampleInfo(unsigned int slot, TTreeReader &r);
@@ -201,6 +220,10 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   const std::vector<char> &CheckFiltersBlock(unsigned int, RDFInternal::REntryBlock &block) final
+   {
+      return block.fAllEntries;
+   }
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -217,6 +240,15 @@ public:
    RColumnReaderBase *AddTreeColumnReader(unsigned int slot, const std::string &col,
                                           std::unique_ptr<RColumnReaderBase> &&reader, const std::type_info &ti);
    RColumnReaderBase *GetDatasetColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const;
+   /// Number of entries per block of the current event loop in block-wise execution, 0 in entry-by-entry execution.
+   unsigned int GetBlockSize() const { return fBlockSize; }
+   /// The block of entries of the given slot. Only valid in block-wise execution.
+   RDFInternal::REntryBlock &GetEntryBlock(unsigned int slot) { return fEntryBlocks[slot]; }
+   RColumnReaderBase *GetBlockColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const;
+   RColumnReaderBase *AddBlockColumnReader(unsigned int slot, const std::string &col,
+                                           std::unique_ptr<RDFInternal::RBlockColumnReaderBase> &&reader,
+                                           const std::type_info &ti);
+   void SetBlockUnbufferable(unsigned int slot);
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) final {}
@@ -29,6 +29,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+struct REntryBlock;
 }
 }
 
@@ -54,6 +55,9 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Block-wise counterpart of CheckFilters: return a mask with the result of CheckFilters for each entry of the block.
+   /// The mask is cached per block and stays valid until the next block is evaluated by the same slot.
+   virtual const std::vector<char> &CheckFiltersBlock(unsigned int slot, ROOT::Internal::RDF::REntryBlock &block) = 0;
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
@@ -11,6 +11,7 @@
 #ifndef ROOT_RDFRANGE
 #define ROOT_RDFRANGE
 
+#include "ROOT/RDF/REntryBlock.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/Utils.hxx"
@@ -87,6 +88,30 @@ public:
       return fLastResult;
    }
 
+   const std::vector<char> &CheckFiltersBlock(unsigned int slot, RDFInternal::REntryBlock &block) final
+   {
+      if (block.fId != fLastCheckedBlock) {
+         const auto &prevMask = fPrevNode.CheckFiltersBlock(slot, block);
+         fBlockMask.resize(block.GetCapacity());
+         for (std::size_t i = 0u; i < block.fSize; ++i) {
+            // same logic as CheckFilters, applied to each entry of the block in turn
+            if (fHasStopped || !prevMask[i]) {
+               fBlockMask[i] = false;
+               continue;
+            }
+            fBlockMask[i] = !(fNProcessedEntries < fStart || (fStop > 0 && fNProcessedEntries >= fStop) ||
+                              (fStride != 1 && (fNProcessedEntries - fStart) % fStride != 0));
+            ++fNProcessedEntries;
+            if (fNProcessedEntries == fStop) {
+               fHasStopped = true;
+               fPrevNode.StopProcessing();
+            }
+         }
+         fLastCheckedBlock = block.fId;
+      }
+      return fBlockMask;
+   }
+
    // recursive chain of `Report`s
    // RRange simply forwards these calls to the previous node
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { fPrevNode.PartialReport(rep); }
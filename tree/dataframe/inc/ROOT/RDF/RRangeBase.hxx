@@ -14,7 +14,9 @@
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "RtypesCore.h"
 
+#include <limits>
 #include <unordered_map>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -37,6 +39,10 @@ protected:
    unsigned int fStride;
    Long64_t fLastCheckedEntry{-1};
    bool fLastResult{true};
+   /// Selection mask of block-wise execution, see RNodeBase::CheckFiltersBlock
+   std::vector<char> fBlockMask;
+   /// Id of the block fBlockMask corresponds to
+   ULong64_t fLastCheckedBlock{std::numeric_limits<ULong64_t>::max()};
    ULong64_t fNProcessedEntries{0};
    bool fHasStopped{false};    ///< True if the end of the range has been reached
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
@@ -14,12 +14,19 @@
 #include "RColumnReaderBase.hxx"
 #include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
+#include <TBufferFile.h>
+#include <TDataType.h>
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
+
+class TBranch;
 
 namespace ROOT {
 namespace Internal {
@@ -181,6 +188,100 @@ public:
    ~RTreeColumnReader() override { fTreeArray.reset(); }
 };
 
+/// Whether values of type T can be read from a TTree with the bulk I/O interface (TBranch::GetBulkEntries), i.e.
+/// whether T is one of the fundamental types that the bulk interface deserializes in place.
+template <typename T>
+struct RIsBulkReadable
+   : std::integral_constant<
+        bool, std::is_same<T, bool>::value || std::is_same<T, Char_t>::value || std::is_same<T, UChar_t>::value ||
+                 std::is_same<T, Short_t>::value || std::is_same<T, UShort_t>::value ||
+                 std::is_same<T, Int_t>::value || std::is_same<T, UInt_t>::value ||
+                 std::is_same<T, Long64_t>::value || std::is_same<T, ULong64_t>::value ||
+                 std::is_same<T, Float_t>::value || std::is_same<T, Double_t>::value> {
+};
+
+/// Type-independent part of RTreeBulkColumnReader.
+///
+/// Every time the TTreeReader moves to a new tree, the branch backing the column is checked for bulk readability:
+/// it must be a plain TBranch of the tree itself (not of a friend) with a single scalar leaf of the expected type.
+/// For such branches, whole baskets are deserialized at once with TBranch::GetBulkEntries and the values of the
+/// following entries are served from the decoded block, bypassing the per-entry TTreeReaderValue machinery.
+class RTreeBulkColumnReaderBase : public ROOT::Detail::RDF::RColumnReaderBase {
+   TTreeReader &fReader;
+   std::string fColName;
+   /// The type of the values, as expected from the branch
+   EDataType fType;
+   /// The tree (not chain) the TTreeReader was last seen on
+   TTree *fTree = nullptr;
+   /// The number of fTree in the chain, to tell apart trees that happen to be allocated at the same address
+   Int_t fTreeNumber = -1;
+   /// The branch read in bulk, nullptr if the branch of the current tree must be read via TTreeReaderValue
+   TBranch *fBranch = nullptr;
+   /// Backs the memory of the baskets read in bulk
+   std::unique_ptr<TBufferFile> fBuffer;
+   /// The values of the entries [fFirstEntry, fEndEntry) of fTree
+   const char *fValues = nullptr;
+   Long64_t fFirstEntry = 0;
+   Long64_t fEndEntry = 0;
+
+   void AttachTree(TTree *tree, Int_t treeNumber);
+   bool LoadBlock(Long64_t entry, std::size_t valueSize);
+
+protected:
+   /// Return the address of the value of the current entry, or nullptr if the current tree can't be read in bulk.
+   void *GetBulkValue(std::size_t valueSize)
+   {
+      auto *treeOrChain = fReader.GetTree();
+      auto *tree = treeOrChain->GetTree();
+      const auto treeNumber = treeOrChain->GetTreeNumber();
+      if (R__unlikely(tree != fTree || treeNumber != fTreeNumber))
+         AttachTree(tree, treeNumber);
+      if (!fBranch)
+         return nullptr;
+
+      const auto entry = tree->GetReadEntry();
+      if (R__unlikely(entry < fFirstEntry || entry >= fEndEntry)) {
+         if (!LoadBlock(entry, valueSize))
+            return nullptr;
+      }
+      return const_cast<char *>(fValues + (entry - fFirstEntry) * valueSize);
+   }
+
+public:
+   RTreeBulkColumnReaderBase(TTreeReader &r, const std::string &colName, EDataType type);
+   ~RTreeBulkColumnReaderBase() override;
+
+   /// The number of baskets that the bulk column readers of this process deserialized with TBranch::GetBulkEntries.
+   /// Used by the tests to check that the bulk code path is taken.
+   static ULong64_t GetNBulkBaskets();
+};
+
+/// Column reader for flat branches of fundamental type that reads whole baskets at a time.
+///
+/// The TTreeReaderValue is still created: it registers the branch with the TTreeCache and it is used as a fallback
+/// for the trees in which the branch does not qualify for bulk reading (see RTreeBulkColumnReaderBase).
+template <typename T>
+class R__CLING_PTRCHECK(off) RTreeBulkColumnReader final : public RTreeBulkColumnReaderBase {
+   std::unique_ptr<TTreeReaderValue<T>> fTreeValue;
+
+   void *GetImpl(Long64_t) final
+   {
+      if (auto *value = GetBulkValue(sizeof(T)))
+         return value;
+      return fTreeValue->Get();
+   }
+
+public:
+   RTreeBulkColumnReader(TTreeReader &r, const std::string &colName)
+      : RTreeBulkColumnReaderBase(r, colName, TDataType::GetType(typeid(T))),
+        fTreeValue(std::make_unique<TTreeReaderValue<T>>(r, colName.c_str()))
+   {
+   }
+
+   /// See RTreeColumnReader for why the TTreeReaderValue is reset explicitly.
+   ~RTreeBulkColumnReader() override { fTreeValue.reset(); }
+};
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
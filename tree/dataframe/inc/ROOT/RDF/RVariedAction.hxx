@@ -128,6 +128,21 @@ public:
       }
    }
 
+   void RunBlock(unsigned int slot, REntryBlock &block) final
+   {
+      for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
+         const auto &mask = fPrevNodes[varIdx]->CheckFiltersBlock(slot, block);
+         for (std::size_t i = 0u; i < block.fSize; ++i) {
+            if (mask[i]) {
+               block.fCurrent = i;
+               CallExec(slot, varIdx, block.fEntries[i], ColumnTypes_t{}, TypeInd_t{});
+            }
+         }
+      }
+   }
+
+   bool SupportsBlockExecution() const final { return fHelpers[0].SupportsBlockExecution(); }
+
    void TriggerChildrenCount() final
    {
       std::for_each(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) { f->IncrChildrenCount(); });
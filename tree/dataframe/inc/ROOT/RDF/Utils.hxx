@@ -18,12 +18,14 @@
 #include "Rtypes.h"
 
 #include <array>
+#include <cstdint> // std::uintptr_t
 #include <deque>
 #include <functional>
 #include <memory>
 #include <new> // std::hardware_destructive_interference_size
 #include <string>
 #include <type_traits> // std::decay, std::false_type
+#include <typeinfo>
 #include <vector>
 
 class TTree;
@@ -134,6 +136,41 @@ char TypeName2ROOTTypeName(const std::string &b);
 
 unsigned int GetNSlots();
 
+/// Set the number of entries per block of the block-wise execution mode; 0 selects entry-by-entry execution.
+void SetBlockSize(unsigned int blockSize);
+/// The number of entries per block of the block-wise execution mode, initialized from the ROOT_RDF_BLOCK_SIZE
+/// environment variable. 0 if entries are processed one at a time.
+unsigned int GetBlockSize();
+
+/// Enable or disable the optimization of computation graphs before the event loop (see RLoopManager::OptimizeGraph()).
+void SetGraphOptimization(bool enable);
+/// Whether computation graphs are optimized before the event loop, initialized from the ROOT_RDF_GRAPH_OPTIMIZATION
+/// environment variable.
+bool IsGraphOptimizationEnabled();
+
+/// Return an identifier of the callable that is equal for callables that compute the same values from the same
+/// arguments, or an empty string if that can not be established. Function pointers, e.g. those of jitted
+/// expressions, are identified by their address.
+template <typename F, std::enable_if_t<std::is_pointer<F>::value, int> = 0>
+std::string GetCallableId(const F &f)
+{
+   return std::string(typeid(F).name()) + '@' + std::to_string(reinterpret_cast<std::uintptr_t>(f));
+}
+
+/// Stateless function objects (e.g. lambdas without captures) are identified by their type.
+template <typename F, std::enable_if_t<!std::is_pointer<F>::value && std::is_empty<F>::value, int> = 0>
+std::string GetCallableId(const F &)
+{
+   return typeid(F).name();
+}
+
+/// Function objects with a state can not be compared.
+template <typename F, std::enable_if_t<!std::is_pointer<F>::value && !std::is_empty<F>::value, int> = 0>
+std::string GetCallableId(const F &)
+{
+   return "";
+}
+
 /// `type` is TypeList if MustRemove is false, otherwise it is a TypeList with the first type removed
 template <bool MustRemove, typename TypeList>
 struct RemoveFirstParameterIf {
@@ -17,6 +17,7 @@
 #include <ROOT/RDF/RActionBase.hxx>
 #include <ROOT/RDF/RResultMap.hxx>
 #include <ROOT/RResultHandle.hxx> // users of RunGraphs might rely on this transitive include
+#include <ROOT/RStringView.hxx>
 #include <ROOT/TypeTraits.hxx>
 
 #include <fstream>
@@ -248,6 +249,91 @@ RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
                                         *resPtr.fLoopManager, std::move(nominalAction), std::move(variedAction));
 }
 
+/// \brief Enable the persistent on-disk cache of just-in-time compiled RDataFrame code.
+/// \param[in] dir The cache directory, created if needed. It can be shared by concurrent processes.
+///
+/// When the cache is enabled, the code that RDataFrame would just-in-time compile before the event loop, which
+/// instantiates the nodes of jitted Filter, Define and Vary expressions and the actions booked without template
+/// parameters, is instead compiled into a shared library stored in the cache directory. The library is identified by a
+/// digest of the generated code, which includes the expressions and the column types, and of the ROOT version. Later
+/// processes that build the same computation graph load the library and skip this just-in-time compilation phase.
+///
+/// The functions wrapping the string expressions of Filter, Define and Vary calls are still declared to the
+/// interpreter when the nodes are booked, so the cache reduces but does not remove the time spent in the interpreter.
+///
+/// The first process that runs a given computation graph compiles the library with the compiler used by ACLiC, which
+/// takes longer than just-in-time compilation. Code that can only be compiled by the interpreter, e.g. because it
+/// calls functions that were declared to the interpreter or uses types from headers that are not included by
+/// RDataFrame, keeps being just-in-time compiled; the compiler output is stored in a `.failed` file in the cache.
+///
+/// The cache can also be enabled by setting the environment variable `ROOT_RDF_JIT_CACHE` to the cache directory.
+/// Changing headers included via the interpreter does not invalidate the cache: remove the cache directory then.
+void EnableJitCache(std::string_view dir);
+
+/// \brief Disable the persistent on-disk cache of just-in-time compiled RDataFrame code.
+/// See EnableJitCache().
+void DisableJitCache();
+
+/// \brief Evaluate RDataFrame computation graphs on blocks of entries rather than one entry at a time.
+/// \param[in] blockSize The maximum number of entries per block, must be larger than zero.
+///
+/// By default, the event loop evaluates the whole computation graph for each entry: every action asks its upstream
+/// filters whether the entry passes, and every node reads its inputs through a virtual call. For graphs with many
+/// nodes, these calls can take more time than the user code. In block-wise execution, each processing slot first
+/// reads the values of the dataset columns of up to `blockSize` entries into buffers. Each Filter then computes a
+/// selection mask for the whole block, each Define stores one value per entry of the block and each action loops
+/// over the entries selected by its upstream mask.
+///
+/// The results do not change, with the following caveats:
+/// - Filter, Define and action callables are still called once per (selected) entry, but the calls for different
+///   nodes are no longer interleaved entry by entry. Callables that depend on the order of the calls across nodes
+///   (e.g. a Define that reads state modified by a Foreach) see a different order.
+/// - The addresses of the values passed to actions change from entry to entry: Book()ed action helpers that store
+///   the addresses of their inputs must override RActionImpl::SupportsBlockExecution() to return false.
+/// - Callbacks registered with RResultPtr::OnPartialResult() are invoked after the block has been processed.
+///
+/// Block-wise execution has a cost of its own. Tree and data source readers only provide the values of the entry
+/// the dataset is positioned at, so the values of all the dataset columns read by the graph are copied into the block
+/// buffers for every entry, before any Filter runs. Entries rejected by the first Filter and columns only read
+/// downstream of a selective Filter are thus copied, too. Collections (RVec) are copied element by element into
+/// buffers that keep their capacity from one block to the next. Graphs with very selective early filters on
+/// large collections may therefore run faster entry by entry.
+///
+/// Event loops fall back to entry-by-entry execution if systematic variations (Vary()) are booked or if one of the
+/// booked actions does not support block-wise execution (e.g. Snapshot() to TTree). Slots fall back to blocks of one
+/// entry when they read dataset columns whose type can not be copied into a buffer.
+///
+/// Block-wise execution can also be enabled by setting the environment variable `ROOT_RDF_BLOCK_SIZE` to the block
+/// size.
+void EnableBlockExecution(unsigned int blockSize = 256);
+
+/// \brief Go back to evaluating RDataFrame computation graphs one entry at a time.
+/// See EnableBlockExecution().
+void DisableBlockExecution();
+
+/// \brief Optimize RDataFrame computation graphs before each event loop.
+///
+/// Computation graphs that book many similar branches, e.g. one per systematic variation, often contain several
+/// Define and Filter nodes that compute the same thing. With graph optimization enabled, before each event loop:
+/// - Defines with the same expression, the same input columns and the same systematic variation are evaluated once
+///   per entry: the duplicates return the values of the first one;
+/// - unnamed Filters with the same expression, the same input columns and the same upstream node are evaluated
+///   once per entry in the same way;
+/// - Defines that no node of the event loop reads, and Filters that are not part of the event loop, are not
+///   initialized, so that the dataset columns that only they read are not read.
+///
+/// Expressions are known to be the same if they are the same jitted string expression, the same function
+/// pointer, or function objects of the same stateless type (e.g. the same lambda without captures). Enable this
+/// optimization only if these expressions have no side effects and do not depend on an external state (e.g. random
+/// number generators), as they are evaluated fewer times.
+///
+/// Graph optimization can also be enabled by setting the environment variable `ROOT_RDF_GRAPH_OPTIMIZATION` to 1.
+void EnableGraphOptimization();
+
+/// \brief Stop optimizing RDataFrame computation graphs before each event loop.
+/// See EnableGraphOptimization().
+void DisableGraphOptimization();
+
 } // namespace Experimental
 } // namespace RDF
 } // namespace ROOT
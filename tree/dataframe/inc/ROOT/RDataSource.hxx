@@ -74,6 +74,14 @@ public:
 
 namespace RDF {
 
+/// Entries whose value of the data source column fColumnName lies outside of [fMin, fMax] cannot pass the event
+/// selection; see RDataSource::SetColumnRangeHints()
+struct RColumnRangeHint {
+   std::string fColumnName;
+   double fMin;
+   double fMax;
+};
+
 // clang-format off
 /**
 \class ROOT::RDF::RDataSource
@@ -101,6 +109,7 @@ RDataSource implementations must support running multiple event-loops consecutiv
  - \b GetColumnReaders() can be called several times, potentially with the same arguments, also in-between event-loops, but not during an event-loop.
  - \b GetEntryRanges() will be called several times, including during an event loop, as additional ranges are needed.  It will not be called concurrently.
  - \b Initialize() and \b Finalize() are called once per event-loop,  right before starting and right after finishing.
+ - \b SetColumnRangeHints() is called once per event-loop, right before Initialize().
  - \b InitSlot(), \b SetEntry(), and \b FinalizeSlot() can be called concurrently from multiple threads, multiple times per event-loop.
 
  Advanced users that plan to implement a custom RDataSource can check out existing implementations, e.g. RCsvDS or RNTupleDS.
@@ -198,6 +207,16 @@ public:
    // clang-format on
    virtual void Initialize() {}
 
+   // clang-format off
+   /// \brief Inform the data source about value ranges of its columns outside of which entries cannot pass the event
+   /// selection of the upcoming event-loop.
+   /// \param[in] hints The ranges that all selected entries satisfy; the list can be empty.
+   /// Called right before Initialize(). Data sources can use the hints to skip entries in GetEntryRanges(), e.g. based
+   /// on statistics stored with the data. The hints are advisory: RDataFrame still evaluates the full event selection
+   /// on all the entries that it processes.
+   // clang-format on
+   virtual void SetColumnRangeHints(const std::vector<RColumnRangeHint> & /*hints*/) {}
+
    // clang-format off
    /// \brief Convenience method called at the start of the data processing associated to a slot.
    /// \param[in] slot The data processing slot wihch needs to be initialized
@@ -23,8 +23,11 @@
 #include <ROOT/RStringView.hxx>
 
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace ROOT {
@@ -44,8 +47,39 @@ class RNTupleColumnReader;
 }
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
-   /// Clones of the first source, one for each slot
-   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fSources;
+   using RPageSources_t = std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>>;
+
+   /// The page sources of an opened member of a chain, one for each slot
+   struct RChainMember {
+      /// Index in fFileNames; 0 for a single page source
+      std::size_t fFileIndex = 0;
+      /// Entry number of the first entry of the file within the chain
+      ULong64_t fFirstEntry = 0;
+      ULong64_t fNEntries = 0;
+      RPageSources_t fSources;
+   };
+
+   /// A batch of entry ranges spans at most that many files of a chain, such that slots that finish their ranges
+   /// early can continue on the following files instead of waiting for the other slots at every file boundary
+   static constexpr std::size_t kMaxFilesPerBatch = 4;
+
+   /// The files whose entry ranges are handed out in the current batch; a single page source is the only member.
+   /// The sources of the first member are clones of the first source, one for each slot.
+   std::vector<RChainMember> fOpenFiles;
+   /// For every slot, the index in fOpenFiles of the file that its column readers are connected to
+   std::vector<std::size_t> fSlotFiles;
+
+   /// For a chain of RNTuples, the name of the RNTuple in all the files; empty for a single page source
+   std::string fNTupleName;
+   /// For a chain of RNTuples, the file names of the chain members
+   std::vector<std::string> fFileNames;
+   /// The page sources of the files of the following batch, one for each slot, together with their index in
+   /// fFileNames. They are opened in the background while the current batch is processed, so that the open latency
+   /// and the first cluster of the next files overlap with the event loop.
+   std::vector<std::pair<std::size_t, std::future<RPageSources_t>>> fStagedFiles;
+   /// The column readers handed out by GetColumnReaders() for every slot. When the event loop moves on to the next
+   /// file of a chain, they are reconnected to the new page sources.
+   std::vector<std::vector<ROOT::Experimental::Internal::RNTupleColumnReader *>> fActiveColumnReaders;
 
    /// We prepare a column reader prototype for every column. If a column reader is actually requested
    /// in GetColumnReaders(), we move a clone of the prototype into the hands of RDataFrame.
@@ -55,7 +89,14 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<std::string> fColumnTypes;
    std::vector<size_t> fActiveColumns;
 
+   /// Field IDs of the columns that correspond to top-level or record member fields with a single on-disk column,
+   /// i.e. the columns whose values are described by the page and cluster statistics of the RNTuple
+   std::unordered_map<std::string, DescriptorId_t> fStatisticsFieldIds;
+   /// Range hints of the upcoming event loop, see SetColumnRangeHints()
+   std::vector<ROOT::RDF::RColumnRangeHint> fColumnRangeHints;
+
    unsigned fNSlots = 0;
+   /// Set when the entry ranges of the current batch have been handed out
    bool fHasSeenAllRanges = false;
 
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
@@ -71,8 +112,28 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
                  DescriptorId_t fieldId,
                  std::vector<DescriptorId_t> skeinIDs);
 
+   /// Returns the sorted list of entry ranges of the given source that can contain entries in the range hints, based
+   /// on the cluster and page statistics. Clusters whose statistics exclude a hint are skipped entirely, saving their
+   /// I/O; within the remaining clusters, pages whose statistics exclude a hint are skipped, saving their
+   /// decompression.
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetSelectedEntryRanges(Detail::RPageSource &source) const;
+   /// Returns the entry ranges of the given source, in file-local entry numbers
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetFileEntryRanges(Detail::RPageSource &source) const;
+
+   /// Starts opening the page sources of the given chain members in the background. The sources are attached and
+   /// the cluster containing the first entry of every slot is loaded for the columns that are currently read.
+   void StageFiles(std::size_t firstFileIndex, std::size_t endFileIndex);
+   /// Waits for the staged files and returns them as chain members whose entries start at firstEntry
+   std::vector<RChainMember> TakeStagedFiles(ULong64_t firstEntry);
+   /// Makes the files of the batch starting at the given chain member the open ones, reconnects the active column
+   /// readers, and stages the files of the following batch.
+   void OpenBatch(std::size_t firstFileIndex);
+   /// Connects the active column readers of the slot to the page source of the given open file
+   void ConnectSlot(unsigned int slot, std::size_t openFileIndex);
 public:
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
+   /// Reads a chain of RNTuples with the same schema, stored in the given files under the same name
+   RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames);
    ~RNTupleDS();
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
@@ -83,6 +144,9 @@ public:
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   /// Skip entries whose values lie outside of the hinted ranges according to the page and cluster statistics.
+   /// Note that the RDataFrame cut-flow report of the filter providing the hints only counts the remaining entries.
+   void SetColumnRangeHints(const std::vector<ROOT::RDF::RColumnRangeHint> &hints) final;
    void Initialize() final;
    void Finalize() final;
 
@@ -99,6 +163,7 @@ namespace RDF {
 namespace Experimental {
 RDataFrame FromRNTuple(std::string_view ntupleName, std::string_view fileName);
 RDataFrame FromRNTuple(ROOT::Experimental::RNTuple *ntuple);
+RDataFrame FromRNTuple(std::string_view ntupleName, const std::vector<std::string> &fileNames);
 } // namespace Experimental
 } // namespace RDF
 
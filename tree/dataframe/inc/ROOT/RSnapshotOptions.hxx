@@ -18,6 +18,13 @@
 namespace ROOT {
 
 namespace RDF {
+/// The format of the dataset written by Snapshot
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently the same as kTTree
+   kTTree,
+   kRNTuple
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +44,9 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   /// Write the output as TTree or as RNTuple; for RNTuple output, fAutoFlush is the number of entries per cluster
+   /// and fSplitLevel is ignored
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault;
 };
 } // ns RDF
 } // ns ROOT
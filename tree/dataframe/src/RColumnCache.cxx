@@ -0,0 +1,187 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RColumnCache.hxx"
+#include "ROOT/RDF/Utils.hxx" // RDFLogChannel
+#include "ROOT/RLogger.hxx"
+
+#include <RZip.h>
+#include <TError.h>
+#include <TString.h>
+#include <TSystem.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+namespace {
+/// The name of the RNTuple in the spill files
+const char *const kSpillNTupleName = "rdf_cache";
+} // anonymous namespace
+
+void ZipCacheBuffer(const std::vector<char> &source, int compression, std::vector<char> &target)
+{
+   const auto cxLevel = compression % 100;
+   const auto nBytes = source.size();
+   if (cxLevel == 0 || nBytes == 0) {
+      target = source;
+      return;
+   }
+
+   // Compress in blocks of at most kMAXZIPBUF bytes, as TBasket and RNTuple do
+   const auto cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(compression / 100);
+   target.resize(nBytes);
+   std::size_t szZipped = 0;
+   std::size_t szConsumed = 0;
+   while (szConsumed < nBytes) {
+      int szSource = std::min<std::size_t>(kMAXZIPBUF, nBytes - szConsumed);
+      int szTarget = std::min<std::size_t>(kMAXZIPBUF, nBytes - szZipped);
+      int szOut = 0;
+      R__zipMultipleAlgorithm(cxLevel, &szSource, const_cast<char *>(source.data() + szConsumed), &szTarget,
+                              target.data() + szZipped, &szOut, cxAlgorithm);
+      if (szOut <= 0 || szOut >= szSource) {
+         // uncompressible block: store the whole buffer uncompressed
+         target = source;
+         return;
+      }
+      szZipped += szOut;
+      szConsumed += szSource;
+   }
+   target.resize(szZipped);
+   target.shrink_to_fit();
+}
+
+void UnzipCacheBuffer(const std::vector<char> &source, std::size_t dataLen, std::vector<char> &target)
+{
+   target.resize(dataLen);
+   if (source.size() == dataLen) {
+      std::copy(source.begin(), source.end(), target.begin());
+      return;
+   }
+
+   auto *src = reinterpret_cast<unsigned char *>(const_cast<char *>(source.data()));
+   auto *tgt = reinterpret_cast<unsigned char *>(target.data());
+   std::size_t szUnzipped = 0;
+   while (szUnzipped < dataLen) {
+      int szSource = 0;
+      int szTarget = 0;
+      if (R__unzip_header(&szSource, src, &szTarget) != 0)
+         throw std::runtime_error("Cache: corrupted compressed column values");
+      int szOut = 0;
+      R__unzip(&szSource, src, &szTarget, tgt, &szOut);
+      if (szOut != szTarget)
+         throw std::runtime_error("Cache: could not decompress column values");
+      src += szSource;
+      tgt += szTarget;
+      szUnzipped += szTarget;
+   }
+}
+
+RColumnCacheBase::RColumnCacheBase(const ROOT::RDF::RCacheOptions &options, std::size_t nColumns, unsigned int nSlots)
+   : fOptions(options), fPackBuffers(nSlots), fSpillFileNames(nSlots), fNSpilledEntries(nSlots, 0)
+#ifdef R__HAS_ROOT7
+     ,
+     fSpillWriters(nSlots), fSpillEntries(nSlots)
+#endif
+{
+   for (std::size_t i = 0; i < nColumns; ++i)
+      fSpillFieldNames.emplace_back("_" + std::to_string(i));
+}
+
+RColumnCacheBase::~RColumnCacheBase()
+{
+   FinishFilling();
+   for (const auto &fileName : fSpillFileNames) {
+      if (!fileName.empty())
+         gSystem->Unlink(fileName.c_str());
+   }
+}
+
+int RColumnCacheBase::GetCompression() const
+{
+   return ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel);
+}
+
+void RColumnCacheBase::AddMemoryUsage(ULong64_t nBytes)
+{
+   const auto memoryUsage = fMemoryUsage += nBytes;
+   if (fOptions.fMemoryBudget == 0 || memoryUsage <= fOptions.fMemoryBudget)
+      return;
+
+#ifdef R__HAS_ROOT7
+   if (!fIsSpilling.exchange(true)) {
+      R__LOG_INFO(RDFLogChannel()) << "Cache: memory budget of " << fOptions.fMemoryBudget
+                                   << " bytes exceeded, the following entries are written to temporary files";
+   }
+#else
+   static std::atomic<bool> hasWarned{false};
+   if (!hasWarned.exchange(true)) {
+      Warning("Cache",
+              "The memory budget of %llu bytes is exceeded, but spilling to disk requires ROOT to be built with root7 "
+              "support. All values are kept in memory.",
+              fOptions.fMemoryBudget);
+   }
+#endif
+}
+
+void RColumnCacheBase::FinishFilling()
+{
+#ifdef R__HAS_ROOT7
+   // destructing the writers commits the last cluster and writes the footer
+   for (auto &entry : fSpillEntries)
+      entry.reset();
+   for (auto &writer : fSpillWriters)
+      writer.reset();
+#endif
+}
+
+#ifdef R__HAS_ROOT7
+ROOT::Experimental::RNTupleWriter &RColumnCacheBase::GetSpillWriter(unsigned int slot, MakeSpillModel_t makeModel)
+{
+   auto &writer = fSpillWriters[slot];
+   if (writer)
+      return *writer;
+
+   TString fileName = "rdf_cache_";
+   const auto &dir = fOptions.fSpillDirectory;
+   FILE *file = gSystem->TempFileName(fileName, dir.empty() ? nullptr : dir.c_str());
+   if (!file)
+      throw std::runtime_error("Cache: could not create a temporary file in " +
+                               (dir.empty() ? std::string(gSystem->TempDirectory()) : dir));
+   fclose(file);
+   fSpillFileNames[slot] = fileName.Data();
+
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(GetCompression());
+   writer = ROOT::Experimental::RNTupleWriter::Recreate(makeModel(fSpillFieldNames), kSpillNTupleName,
+                                                        fSpillFileNames[slot], writeOptions);
+   fSpillEntries[slot] = writer->GetModel()->CreateBareEntry();
+   return *writer;
+}
+
+void RColumnCacheBase::OpenSpillFile(unsigned int spillSlot, RColumnCacheReader &reader) const
+{
+   if (reader.fSpillReaders.size() <= spillSlot) {
+      reader.fSpillReaders.resize(fSpillFileNames.size());
+      reader.fSpillEntries.resize(fSpillFileNames.size());
+   }
+   auto &ntuple = reader.fSpillReaders[spillSlot];
+   if (ntuple)
+      return;
+   ntuple = ROOT::Experimental::RNTupleReader::Open(kSpillNTupleName, fSpillFileNames[spillSlot]);
+   reader.fSpillEntries[spillSlot] = ntuple->GetModel()->CreateBareEntry();
+}
+#endif // R__HAS_ROOT7
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
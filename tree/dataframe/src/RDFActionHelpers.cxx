@@ -10,6 +10,10 @@
 
 #include "ROOT/RDF/ActionHelpers.hxx"
 #include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#ifdef R__HAS_ROOT7
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RNTupleDS.hxx" // FromRNTuple
+#endif
 
 namespace ROOT {
 namespace Internal {
@@ -279,6 +283,62 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+#ifdef R__HAS_ROOT7
+void ValidateSnapshotRNTupleOutput(const RSnapshotOptions &opts, const std::string &dirName,
+                                   const std::string &ntupleName, const std::string &fileName)
+{
+   if (!dirName.empty()) {
+      throw std::invalid_argument("Snapshot: cannot write RNTuple \"" + ntupleName + "\" into sub-directory \"" +
+                                  dirName + "\", RNTuples can only be written at the top level of a file");
+   }
+
+   TString fileMode = opts.fMode;
+   fileMode.ToLower();
+   if (fileMode != "update")
+      return;
+
+   // The RNTuple anchor is not a TObject, so we look for its key rather than reading it back
+   std::unique_ptr<TFile> outFile{TFile::Open(fileName.c_str(), "update")};
+   if (!outFile || outFile->IsZombie())
+      throw std::invalid_argument("Snapshot: cannot open file \"" + fileName + "\" in update mode");
+   if (!outFile->GetKey(ntupleName.c_str()))
+      return;
+
+   if (opts.fOverwriteIfExists) {
+      // Only the anchor is removed: the pages of the original RNTuple stay in the file, but are no longer reachable
+      outFile->Delete((ntupleName + ";*").c_str());
+   } else {
+      const std::string msg = "Snapshot: object \"" + ntupleName + "\" already present in file \"" + fileName +
+                              "\". If you want to delete the original object and write another RNTuple, please set "
+                              "RSnapshotOptions::fOverwriteIfExists to true.";
+      throw std::invalid_argument(msg);
+   }
+}
+
+ROOT::Experimental::RNTupleWriteOptions GetSnapshotRNTupleWriteOptions(const RSnapshotOptions &opts)
+{
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(ROOT::CompressionSettings(opts.fCompressionAlgorithm, opts.fCompressionLevel));
+   return writeOptions;
+}
+
+void CaptureSnapshotRNTupleValues(ROOT::Experimental::REntry &entry, const ColumnNames_t &fieldNames,
+                                  std::vector<void *> &capturedAddresses, void *const *addresses)
+{
+   for (std::size_t i = 0; i < fieldNames.size(); ++i) {
+      if (capturedAddresses[i] == addresses[i])
+         continue;
+      entry.CaptureValueUnsafe(fieldNames[i], addresses[i]);
+      capturedAddresses[i] = addresses[i];
+   }
+}
+
+void ResetSnapshotRNTupleDataFrame(ROOT::RDataFrame &df, const std::string &ntupleName, const std::string &fileName)
+{
+   df = ROOT::RDF::Experimental::FromRNTuple(ntupleName, fileName);
+}
+#endif // R__HAS_ROOT7
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -224,6 +224,19 @@ RColumnRegister::FindVariationAndReaders(const std::string &colName, const std::
    return nullptr;
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return the Variation node that provides the values of the column in the specified variation, or null.
+RVariationBase *RColumnRegister::GetVariation(const std::string &colName, const std::string &variationName) const
+{
+   auto range = fVariations->equal_range(colName);
+   for (auto it = range.first; it != range.second; ++it) {
+      if (IsStrInVec(variationName, it->second->GetVariation().GetVariationNames()))
+         return &it->second->GetVariation();
+   }
+
+   return nullptr;
+}
+
 ROOT::RDF::RVariationsDescription RColumnRegister::BuildVariationsDescription() const
 {
    std::set<const RVariationBase *> uniqueVariations;
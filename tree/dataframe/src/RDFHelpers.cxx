@@ -14,6 +14,7 @@
 #include "TStopwatch.h"
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RDF/RJitCache.hxx"
 #include "ROOT/RDF/RLoopManager.hxx" // for RLoopManager
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RResultHandle.hxx"    // for RResultHandle, RunGraphs
@@ -23,6 +24,7 @@
 
 #include <algorithm>
 #include <set>
+#include <stdexcept>
 
 using ROOT::RDF::RResultHandle;
 
@@ -92,3 +94,37 @@ void ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
       << "Finished RunGraphs run (" << uniqueLoops.size() << " unique computation graphs, " << sw.CpuTime() << "s CPU, "
       << sw.RealTime() << "s elapsed).";
 }
+
+void ROOT::RDF::Experimental::EnableJitCache(std::string_view dir)
+{
+   if (dir.empty())
+      throw std::invalid_argument("EnableJitCache: the cache directory must not be empty");
+   ROOT::Internal::RDF::SetJitCacheDir(std::string(dir));
+}
+
+void ROOT::RDF::Experimental::DisableJitCache()
+{
+   ROOT::Internal::RDF::SetJitCacheDir("");
+}
+
+void ROOT::RDF::Experimental::EnableBlockExecution(unsigned int blockSize)
+{
+   if (blockSize == 0)
+      throw std::invalid_argument("EnableBlockExecution: the block size must be larger than zero");
+   ROOT::Internal::RDF::SetBlockSize(blockSize);
+}
+
+void ROOT::RDF::Experimental::DisableBlockExecution()
+{
+   ROOT::Internal::RDF::SetBlockSize(0);
+}
+
+void ROOT::RDF::Experimental::EnableGraphOptimization()
+{
+   ROOT::Internal::RDF::SetGraphOptimization(true);
+}
+
+void ROOT::RDF::Experimental::DisableGraphOptimization()
+{
+   ROOT::Internal::RDF::SetGraphOptimization(false);
+}
@@ -47,10 +47,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cerrno>
+#include <cmath>
 #include <cstdlib>  // for size_t
 #include <iterator> // for back_insert_iterator
 #include <map>
+#include <limits>
 #include <memory>
+#include <regex>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -299,6 +303,14 @@ BuildFunctionString(const std::string &expr, const ColumnNames_t &vars, const Co
    return ss.str();
 }
 
+/// Build the declaration of a jitted function with the given name and code (see BuildFunctionString), together with
+/// a `<name>_ret_t` alias for its return type.
+static std::string MakeFunctionDeclaration(const std::string &funcBaseName, const std::string &funcCode)
+{
+   return "auto " + funcBaseName + funcCode + "\nusing " + funcBaseName +
+          "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" + funcBaseName + ")>::ret_type;\n";
+}
+
 /// Declare a function to the interpreter in namespace R_rdf, return the name of the jitted function.
 /// If the function is already in GetJittedExprs, return the name for the function that has already been jitted.
 static std::string DeclareFunction(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
@@ -318,9 +330,7 @@ static std::string DeclareFunction(const std::string &expr, const ColumnNames_t
    const auto funcBaseName = "func" + std::to_string(exprMap.size());
    const auto funcFullName = "R_rdf::" + funcBaseName;
 
-   const auto toDeclare = "namespace R_rdf {\nauto " + funcBaseName + funcCode + "\nusing " + funcBaseName +
-                          "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" + funcBaseName +
-                          ")>::ret_type;\n}";
+   const auto toDeclare = "namespace R_rdf {\n" + MakeFunctionDeclaration(funcBaseName, funcCode) + "}";
    ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
 
    // InterpreterDeclare could throw. If it doesn't, mark the function as already jitted
@@ -329,6 +339,17 @@ static std::string DeclareFunction(const std::string &expr, const ColumnNames_t
    return funcFullName;
 }
 
+std::string GetJittedFunctionDeclaration(const std::string &funcFullName, const std::string &newBaseName)
+{
+   R__LOCKGUARD(gROOTMutex);
+
+   for (const auto &codeAndName : GetJittedExprs()) {
+      if (codeAndName.second == funcFullName)
+         return MakeFunctionDeclaration(newBaseName, codeAndName.first);
+   }
+   return "";
+}
+
 /// Each jitted function comes with a func_ret_t type alias for its return type.
 /// Resolve that alias and return the true type as string.
 static std::string RetTypeOfFunc(const std::string &funcName)
@@ -361,6 +382,138 @@ ThrowJitBuildActionHelperTypeError(const std::string &actionTypeNameBase, const
    throw std::runtime_error(exceptionText);
 }
 
+/// Remove leading and trailing whitespace as well as parentheses that enclose the entire expression
+static std::string_view StripEnclosingParens(std::string_view expr)
+{
+   while (true) {
+      const auto first = expr.find_first_not_of(" \t\n");
+      if (first == std::string_view::npos)
+         return {};
+      expr = expr.substr(first, expr.find_last_not_of(" \t\n") - first + 1);
+      if (expr.size() < 2 || expr.front() != '(' || expr.back() != ')')
+         return expr;
+      int depth = 0;
+      for (std::size_t i = 0; i < expr.size() - 1; ++i) {
+         depth += (expr[i] == '(') - (expr[i] == ')');
+         if (depth == 0)
+            return expr; // the opening parenthesis is closed before the end, e.g. `(a) && (b)`
+      }
+      expr = expr.substr(1, expr.size() - 2);
+   }
+}
+
+/// Split a boolean expression into its top-level `&&` terms (recursively for parenthesized conjunctions)
+static void SplitConjunction(std::string_view expr, std::vector<std::string_view> &terms)
+{
+   expr = StripEnclosingParens(expr);
+   std::vector<std::string_view> parts;
+   int depth = 0;
+   std::size_t start = 0;
+   for (std::size_t i = 0; i + 1 < expr.size(); ++i) {
+      depth += (expr[i] == '(' || expr[i] == '[') - (expr[i] == ')' || expr[i] == ']');
+      if (depth == 0 && expr[i] == '&' && expr[i + 1] == '&') {
+         parts.emplace_back(expr.substr(start, i - start));
+         start = i + 2;
+         ++i;
+      }
+   }
+   if (parts.empty()) {
+      terms.emplace_back(expr);
+      return;
+   }
+   parts.emplace_back(expr.substr(start));
+   for (auto part : parts)
+      SplitConjunction(part, terms);
+}
+
+/// Extract the value ranges of data source columns implied by a jitted filter expression of the form
+/// `x > 1 && (y <= 2.5 && 3 < z)`. Only comparisons of a data source column with a numeric literal that are
+/// combined by `&&` at the top level of the expression are considered; anything else is ignored, so that the ranges
+/// are always satisfied by the entries that pass the filter.
+static std::vector<ROOT::RDF::RColumnRangeHint>
+ParseColumnRangeHints(std::string_view expression, const ROOT::Internal::RDF::RColumnRegister &colRegister,
+                      const ROOT::RDF::RDataSource &ds)
+{
+   // Bail out on expressions whose top-level structure cannot be determined by counting parentheses:
+   // string and character literals, comments, statements, preprocessor directives, and operators that have lower
+   // precedence than `&&` (`||`, ternary, assignments, comma)
+   static const std::regex unsupported(R"(["'#;{}?,]|\|\||/[/*]|\bor\b|([^=<>!]|^)=(?!=))");
+   const std::string expr(expression);
+   if (std::regex_search(expr, unsupported))
+      return {};
+
+   static const std::string ident = R"(([A-Za-z_][A-Za-z0-9_.]*))";
+   static const std::string number = R"(([-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?)([fF]?[uUlL]*))";
+   static const std::string op = R"((<=|>=|==|<|>))";
+   static const std::regex colFirst("^" + ident + R"(\s*)" + op + R"(\s*)" + number + "$");
+   static const std::regex numberFirst("^" + number + R"(\s*)" + op + R"(\s*)" + ident + "$");
+
+   std::vector<std::string_view> terms;
+   SplitConjunction(expr, terms);
+
+   std::vector<ROOT::RDF::RColumnRangeHint> hints;
+   for (auto term : terms) {
+      const std::string t(term);
+      std::smatch m;
+      std::string colName, opStr, literal, suffix;
+      if (std::regex_match(t, m, colFirst)) {
+         colName = m[1];
+         opStr = m[2];
+         literal = m[3];
+         suffix = m[4];
+      } else if (std::regex_match(t, m, numberFirst)) {
+         literal = m[1];
+         suffix = m[2];
+         opStr = m[3];
+         colName = m[4];
+         // mirror the comparison so that the column is on the left-hand side
+         if (opStr[0] == '<')
+            opStr[0] = '>';
+         else if (opStr[0] == '>')
+            opStr[0] = '<';
+      } else {
+         continue;
+      }
+
+      if (colRegister.IsDefineOrAlias(colName) || !colRegister.GetVariationDeps(colName).empty() ||
+          !ds.HasColumn(colName))
+         continue;
+
+      // std::stod would throw on literals that overflow (e.g. 1e400), in which case we just skip the hint
+      errno = 0;
+      double value = (suffix.find_first_of("fF") != std::string::npos) ? std::strtof(literal.c_str(), nullptr)
+                                                                       : std::strtod(literal.c_str(), nullptr);
+      if (errno == ERANGE || !std::isfinite(value))
+         continue;
+      // Negative literals are converted to large values when compared to unsigned integers
+      const auto typeName = ds.GetTypeName(colName);
+      const bool isUnsigned = typeName.find("unsigned") != std::string::npos ||
+                              typeName.find("uint") != std::string::npos || typeName.find("size_t") != std::string::npos ||
+                              typeName.rfind("U", 0) == 0;
+      if (isUnsigned && literal[0] == '-')
+         continue;
+
+      // Strict comparisons are relaxed to inclusive ones. Above 2^53, the literal may have been rounded in the
+      // conversion to double, so we widen the range by one ulp.
+      double min = -std::numeric_limits<double>::infinity();
+      double max = std::numeric_limits<double>::infinity();
+      const bool isExact = std::abs(value) < 9007199254740992.;
+      if (opStr[0] == '>' || opStr == "==")
+         min = isExact ? value : std::nextafter(value, -std::numeric_limits<double>::infinity());
+      if (opStr[0] == '<' || opStr == "==")
+         max = isExact ? value : std::nextafter(value, std::numeric_limits<double>::infinity());
+
+      auto itr = std::find_if(hints.begin(), hints.end(), [&](const auto &h) { return h.fColumnName == colName; });
+      if (itr == hints.end()) {
+         hints.push_back({colName, min, max});
+      } else {
+         itr->fMin = std::max(itr->fMin, min);
+         itr->fMax = std::min(itr->fMax, max);
+      }
+   }
+   return hints;
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -685,6 +838,10 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    auto lm = jittedFilter->GetLoopManagerUnchecked();
    lm->ToJitExec(filterInvocation.str());
 
+   // Only filters that are applied directly to the data source can restrict the entries it needs to provide
+   if (ds && (*prevNodeOnHeap).get() == lm)
+      jittedFilter->SetColumnRangeHints(ParseColumnRangeHints(expression, colRegister, *ds));
+
    return jittedFilter;
 }
 
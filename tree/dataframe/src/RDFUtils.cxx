@@ -26,6 +26,8 @@
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
 #include "TTree.h"
 
+#include <atomic>
+#include <cstdlib> // std::getenv, std::strtoul
 #include <stdexcept>
 #include <string>
 #include <cstring>
@@ -290,6 +292,48 @@ unsigned int GetNSlots()
    return nSlots;
 }
 
+namespace {
+std::atomic<unsigned int> &BlockSize()
+{
+   static std::atomic<unsigned int> blockSize{[] {
+      const char *env = std::getenv("ROOT_RDF_BLOCK_SIZE");
+      return env ? static_cast<unsigned int>(std::strtoul(env, nullptr, 10)) : 0u;
+   }()};
+   return blockSize;
+}
+} // anonymous namespace
+
+void SetBlockSize(unsigned int blockSize)
+{
+   BlockSize() = blockSize;
+}
+
+unsigned int GetBlockSize()
+{
+   return BlockSize();
+}
+
+namespace {
+std::atomic<bool> &GraphOptimization()
+{
+   static std::atomic<bool> enabled{[] {
+      const char *env = std::getenv("ROOT_RDF_GRAPH_OPTIMIZATION");
+      return env != nullptr && std::strcmp(env, "0") != 0;
+   }()};
+   return enabled;
+}
+} // anonymous namespace
+
+void SetGraphOptimization(bool enable)
+{
+   GraphOptimization() = enable;
+}
+
+bool IsGraphOptimizationEnabled()
+{
+   return GraphOptimization();
+}
+
 /// Replace occurrences of '.' with '_' in each string passed as argument.
 /// An Info message is printed when this happens. Dots at the end of the string are not replaced.
 /// An exception is thrown in case the resulting set of strings would contain duplicates.
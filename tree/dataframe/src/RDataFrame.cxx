@@ -886,6 +886,22 @@ See [Efficient analysis in Python](#python) for possible ways to speed up hot pa
 Just-in-time compilation happens once, right before starting an event loop. To reduce the runtime cost of this step, make sure to book all operations *for all RDataFrame computation graphs*
 before the first event loop is triggered: just-in-time compilation will happen once for all code required to be generated up to that point, also across different computation graphs.
 
+Applications that run the same computation graph in many short-lived processes, e.g. batch jobs over different
+input files, can store the generated code as compiled libraries in a persistent cache with
+ROOT::RDF::Experimental::EnableJitCache() or by setting the `ROOT_RDF_JIT_CACHE` environment variable to a
+directory: only the first process compiles the code that runs before the event loop, the others load it from the
+cache. The functions wrapping string expressions are still declared to the interpreter when Filter and Define are
+called.
+
+Computation graphs with many cheap filters and defines can be evaluated block-wise with
+ROOT::RDF::Experimental::EnableBlockExecution() or by setting the `ROOT_RDF_BLOCK_SIZE` environment variable: the
+values of the dataset columns of a block of entries are loaded first, then each node processes the whole block before
+the next node runs, which keeps the code of each node and its data hot in the CPU caches.
+
+Computation graphs that book the same Define and Filter expressions on many branches, e.g. once per systematic
+variation, can let RDataFrame evaluate each distinct expression only once per entry with
+ROOT::RDF::Experimental::EnableGraphOptimization(), which also skips the Defines that no node reads.
+
 Also make sure not to count the just-in-time compilation time (which happens once before the event loop and does not depend on the size of the dataset) as part of the event loop runtime (which scales with the size of the dataset). RDataFrame has an experimental logging feature that simplifies measuring the time spent in just-in-time compilation and in the event loop (as well as providing some more interesting information). See [Activating RDataFrame execution logs](\ref rdf-logging).
 
 ### Memory usage
@@ -908,6 +924,16 @@ auto h2 = df2.Histo1D("y");
 h2->Draw("SAME"); // we just-in-time compile again here, as the second Histo1D call is new
 ~~~
 
+Finally, Cache() keeps all cached values in memory by default. Selections that do not fit can be cached with a memory
+budget passed via ROOT::RDF::RCacheOptions: values are kept compressed in memory, and what exceeds the budget is
+written to temporary local RNTuple files that are read back by the cached data frame:
+
+~~~{.cpp}
+ROOT::RDF::RCacheOptions opts;
+opts.fMemoryBudget = 4ull * 1024 * 1024 * 1024; // 4 GB
+auto cached = df.Filter("nMuon == 2").Cache<ROOT::RVecF, ROOT::RVecF>({"Muon_pt", "Muon_eta"}, opts);
+~~~
+
 \anchor more-features
 ## More features
 Here is a list of the most important features that have been omitted in the "Crash course" for brevity.
@@ -12,6 +12,7 @@
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/Utils.hxx"
+#include <limits>
 #include <numeric> // std::accumulate
 
 using namespace ROOT::Detail::RDF;
@@ -23,7 +24,9 @@ RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const uns
      fLastCheckedEntry(nSlots * RDFInternal::CacheLineStep<Long64_t>(), -1),
      fLastResult(nSlots * RDFInternal::CacheLineStep<int>()),
      fAccepted(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
-     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fName(name), fColumnNames(columns),
+     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fBlockMasks(nSlots),
+     fLastCheckedBlock(nSlots * RDFInternal::CacheLineStep<ULong64_t>(), std::numeric_limits<ULong64_t>::max()),
+     fName(name), fColumnNames(columns),
      fColRegister(colRegister), fIsDefine(columns.size()), fVariation(variation)
 {
    const auto nColumns = fColumnNames.size();
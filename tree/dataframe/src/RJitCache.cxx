@@ -0,0 +1,291 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RJitCache.hxx"
+#include "ROOT/RDF/InterfaceUtils.hxx" // GetJittedFunctionDeclaration
+#include "ROOT/RDF/Utils.hxx"          // RDFLogChannel
+#include "ROOT/RLogger.hxx"
+
+#include <TError.h>
+#include <TMD5.h>
+#include <TROOT.h>
+#include <TString.h>
+#include <TSystem.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <map>
+
+/*
+The persistent jit cache stores the code that RLoopManager::Jit() would hand to the interpreter as compiled shared
+libraries in a directory, so that later processes running the same computation graph skip just-in-time compilation.
+
+The code to jit embeds the addresses of the RDF objects it operates on and refers to the jitted functions of Filter
+and Define expressions by process-dependent names. NormalizeJitCode() turns the addresses into arguments of an
+entry point and renames the jitted functions in order of appearance. The library source is the normalized code plus
+the declarations of the jitted functions; it is identified by the MD5 digest of its contents and of the ROOT version.
+
+A missing library is compiled with the same MakeSharedLib command that ACLiC uses, in a build directory of the
+cache. The library is moved into the cache only when complete, so that concurrent processes either find it or do not.
+Only one process builds a given library at a time, the others keep using the interpreter. Code that cannot be
+compiled outside of the interpreter, e.g. because it uses functions declared to the interpreter only, leaves a
+`.failed` file with the compiler output in the cache and is not compiled again.
+*/
+
+namespace {
+
+bool IsIdentifierChar(char c)
+{
+   return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+/// Remove a build lock left behind by a process that crashed while compiling
+bool RemoveStaleLock(const std::string &lockPath)
+{
+   constexpr long kMaxCompileTime = 3600; // seconds
+   FileStat_t stat;
+   if (gSystem->GetPathInfo(lockPath.c_str(), stat) != 0)
+      return true; // lock was released in the meantime
+   if (std::time(nullptr) - stat.fMtime < kMaxCompileTime)
+      return false;
+   return gSystem->Unlink(lockPath.c_str()) == 0;
+}
+
+/// Compile the library source into `<cacheDir>/<name>.<soext>`. Return false if the library is not available after
+/// the call, either because another process is building it or because the compilation failed.
+bool CompileJitLibrary(const std::string &cacheDir, const std::string &name, const std::string &source)
+{
+   const auto lockPath = cacheDir + "/" + name + ".lock";
+   auto lock = std::fopen(lockPath.c_str(), "wx");
+   if (!lock && RemoveStaleLock(lockPath))
+      lock = std::fopen(lockPath.c_str(), "wx");
+   if (!lock)
+      return false;
+   std::fclose(lock);
+
+   const auto buildDir = cacheDir + "/" + name + ".build";
+   const auto srcPath = buildDir + "/" + name + ".cxx";
+   const auto objPath = buildDir + "/" + name + ".o";
+   const auto logPath = buildDir + "/" + name + ".log";
+   const auto buildLibPath = buildDir + "/" + name + "." + gSystem->GetSoExt();
+   const auto libPath = cacheDir + "/" + name + "." + gSystem->GetSoExt();
+
+   bool success = false;
+   if (gSystem->mkdir(buildDir.c_str(), true) == 0 || !gSystem->AccessPathName(buildDir.c_str())) {
+      std::ofstream(srcPath) << source;
+
+      TString cmd = gSystem->GetMakeSharedLib();
+      const TString libs = gSystem->GetLibraries("", "SDL");
+      cmd.ReplaceAll("$SourceFiles", "\"" + TString(srcPath) + "\"");
+      cmd.ReplaceAll("$ObjectFiles", "\"" + TString(objPath) + "\"");
+      cmd.ReplaceAll("$IncludePath", gSystem->GetIncludePath());
+      cmd.ReplaceAll("$SharedLib", "\"" + TString(buildLibPath) + "\"");
+      cmd.ReplaceAll("$DepLibs", libs);
+      cmd.ReplaceAll("$LinkedLibs", libs);
+      cmd.ReplaceAll("$LibName", name.c_str());
+      cmd.ReplaceAll("$BuildDir", "\"" + TString(buildDir) + "\"");
+      cmd.ReplaceAll("$Opt", gSystem->GetFlagsOpt());
+      cmd += " > \"" + TString(logPath) + "\" 2>&1";
+
+      R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel()) << "Compiling " << libPath << " for the RDataFrame jit cache.";
+      success = gSystem->Exec(cmd) == 0 && !gSystem->AccessPathName(buildLibPath.c_str()) &&
+                gSystem->Rename(buildLibPath.c_str(), libPath.c_str()) == 0;
+      if (!success) {
+         gSystem->Rename(logPath.c_str(), (cacheDir + "/" + name + ".failed").c_str());
+         Warning("RDataFrame::Jit",
+                 "The jitted code could not be compiled for the jit cache, see %s/%s.failed. Falling back to "
+                 "just-in-time compilation.",
+                 cacheDir.c_str(), name.c_str());
+      }
+      for (const auto &path : {srcPath, objPath, logPath, buildLibPath, buildDir})
+         gSystem->Unlink(path.c_str());
+   }
+
+   gSystem->Unlink(lockPath.c_str());
+   return success;
+}
+
+std::string MakeLibrarySource(const std::string &entryPoint, const std::string &declarations, const std::string &code)
+{
+   return R"CODE(// Generated by RDataFrame for its persistent jit cache
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RVec.hxx"
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TH3D.h"
+#include "THn.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TGraph.h"
+#include "TGraphAsymmErrors.h"
+#include "TStatistic.h"
+#include "TMath.h"
+#if __has_include("Math/Vector4D.h")
+#include "Math/Vector4D.h"
+#endif
+
+// the interpreter runs the code with these using directives
+using namespace std;
+
+namespace )CODE" +
+          entryPoint + " {\nnamespace R_rdf {\n" + declarations + "} // namespace R_rdf\n\nextern \"C\" void " +
+          entryPoint + "(void **rdf_jit_args)\n{\n" + code + "\n}\n} // namespace " + entryPoint + "\n";
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+RNormalizedJitCode NormalizeJitCode(const std::string &code)
+{
+   static const std::string kFuncPrefix = "R_rdf::func";
+
+   RNormalizedJitCode result;
+   std::map<std::string, std::size_t> funcIndexes;
+   auto &out = result.fCode;
+   out.reserve(code.size());
+
+   std::size_t i = 0;
+   while (i < code.size()) {
+      const char c = code[i];
+
+      // string literals (column and filter names) are copied verbatim
+      if (c == '"') {
+         const auto start = i++;
+         while (i < code.size() && code[i] != '"')
+            i += (code[i] == '\\') ? 2 : 1;
+         i = std::min(i + 1, code.size());
+         out.append(code, start, i - start);
+         continue;
+      }
+
+      // object addresses, as printed by PrettyPrintAddr
+      if (code.compare(i, 3, "(0x") == 0) {
+         auto end = i + 3;
+         while (end < code.size() && std::isxdigit(static_cast<unsigned char>(code[end])))
+            ++end;
+         if (end > i + 3 && end < code.size() && code[end] == ')') {
+            const auto addr = std::strtoull(code.c_str() + i + 3, nullptr, 16);
+            out += "(rdf_jit_args[" + std::to_string(result.fArgs.size()) + "])";
+            result.fArgs.emplace_back(reinterpret_cast<void *>(static_cast<std::uintptr_t>(addr)));
+            i = end + 1;
+            continue;
+         }
+      }
+
+      // jitted functions
+      if (code.compare(i, kFuncPrefix.size(), kFuncPrefix) == 0 &&
+          (i == 0 || (!IsIdentifierChar(code[i - 1]) && code[i - 1] != ':'))) {
+         auto end = i + kFuncPrefix.size();
+         while (end < code.size() && std::isdigit(static_cast<unsigned char>(code[end])))
+            ++end;
+         if (end > i + kFuncPrefix.size() && (end == code.size() || !IsIdentifierChar(code[end]))) {
+            const auto funcName = code.substr(i, end - i);
+            auto it = funcIndexes.find(funcName);
+            if (it == funcIndexes.end()) {
+               it = funcIndexes.emplace(funcName, result.fFuncNames.size()).first;
+               result.fFuncNames.emplace_back(funcName);
+            }
+            out += kFuncPrefix + std::to_string(it->second);
+            i = end;
+            continue;
+         }
+      }
+
+      out += c;
+      ++i;
+   }
+
+   return result;
+}
+
+static std::string &JitCacheDir()
+{
+   static std::string dir = [] {
+      const char *env = gSystem->Getenv("ROOT_RDF_JIT_CACHE");
+      return std::string(env ? env : "");
+   }();
+   return dir;
+}
+
+void SetJitCacheDir(const std::string &dir)
+{
+   R__LOCKGUARD(gROOTMutex);
+   JitCacheDir() = dir;
+}
+
+const std::string &GetJitCacheDir()
+{
+   return JitCacheDir();
+}
+
+bool RunJitCodeFromCache(const std::string &code)
+{
+   // gROOTMutex is only taken to access the interpreter and the loaded libraries, so that other threads can use them
+   // while the library is compiled
+   std::string cacheDir;
+   {
+      R__LOCKGUARD(gROOTMutex);
+      cacheDir = GetJitCacheDir();
+   }
+   if (cacheDir.empty())
+      return false;
+
+   auto normalized = NormalizeJitCode(code);
+   std::string declarations;
+   for (std::size_t k = 0; k < normalized.fFuncNames.size(); ++k) {
+      const auto decl = GetJittedFunctionDeclaration(normalized.fFuncNames[k], "func" + std::to_string(k));
+      if (decl.empty())
+         return false;
+      declarations += decl;
+   }
+
+   TMD5 md5;
+   for (const auto &part : {std::string(gROOT->GetVersion()), std::string(gROOT->GetGitCommit()), declarations,
+                            normalized.fCode}) {
+      md5.Update(reinterpret_cast<const UChar_t *>(part.data()), part.size());
+      md5.Update(reinterpret_cast<const UChar_t *>("\n"), 1);
+   }
+   md5.Final();
+   const std::string name = std::string("R_rdf_jit_") + md5.AsString();
+   const auto libPath = cacheDir + "/" + name + "." + gSystem->GetSoExt();
+
+   if (gSystem->AccessPathName(libPath.c_str())) {
+      // not in the cache yet
+      if (!gSystem->AccessPathName((cacheDir + "/" + name + ".failed").c_str()))
+         return false;
+      if (gSystem->mkdir(cacheDir.c_str(), true) != 0 && gSystem->AccessPathName(cacheDir.c_str()))
+         return false;
+      if (!CompileJitLibrary(cacheDir, name, MakeLibrarySource(name, declarations, normalized.fCode)))
+         return false;
+   }
+
+   // like the interpreted code, the entry point books nodes of the computation graphs and runs under gROOTMutex
+   R__LOCKGUARD(gROOTMutex);
+   if (gSystem->Load(libPath.c_str()) < 0)
+      return false;
+   auto entryPoint = reinterpret_cast<void (*)(void **)>(gSystem->DynFindSymbol(libPath.c_str(), name.c_str()));
+   if (!entryPoint)
+      return false;
+
+   R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel()) << "Running the jitted code from " << libPath;
+   entryPoint(normalized.fArgs.data());
+   return true;
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -73,6 +73,18 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBlock(unsigned int slot, REntryBlock &block)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBlock(slot, block);
+}
+
+bool RJittedAction::SupportsBlockExecution() const
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->SupportsBlockExecution();
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
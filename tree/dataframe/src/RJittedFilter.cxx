@@ -59,6 +59,12 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const std::vector<char> &RJittedFilter::CheckFiltersBlock(unsigned int slot, ROOT::Internal::RDF::REntryBlock &block)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBlock(slot, block);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
@@ -119,6 +125,11 @@ void RJittedFilter::InitNode()
    fConcreteFilter->InitNode();
 }
 
+bool RJittedFilter::IsActive() const
+{
+   return fConcreteFilter != nullptr && fConcreteFilter->IsActive();
+}
+
 void RJittedFilter::AddFilterName(std::vector<std::string> &filters)
 {
    if (fConcreteFilter == nullptr) {
@@ -143,3 +154,9 @@ std::shared_ptr<RNodeBase> RJittedFilter::GetVariedFilter(const std::string &var
    assert(fConcreteFilter != nullptr);
    return fConcreteFilter->GetVariedFilter(variationName);
 }
+
+RNodeBase *RJittedFilter::GetPrevNode() const
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetPrevNode();
+}
@@ -13,6 +13,9 @@
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RJitCache.hxx"
+#include "ROOT/RDF/RJittedDefine.hxx"
+#include "ROOT/RDF/RJittedFilter.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
@@ -38,14 +41,17 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstdint> // std::uintptr_t
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <set>
 #include <limits> // For MaxTreeSizeRAII. Revert when #6640 will be solved.
@@ -307,6 +313,104 @@ static auto MakeDatasetColReadersKey(const std::string &colName, const std::type
    //    df.Sum<RVecI>("stdVectorBranch");
    return colName + ':' + ti.name();
 }
+
+static std::string PtrToString(const void *ptr)
+{
+   return std::to_string(reinterpret_cast<std::uintptr_t>(ptr));
+}
+
+/// Finds the Define and Filter nodes of a computation graph that compute the same values, see
+/// RLoopManager::OptimizeGraph(). Of each set of equivalent nodes, the first one that is looked up is the canonical
+/// one, i.e. the one that is evaluated during the event loop.
+class RGraphOptimizer {
+   std::unordered_map<RDefineBase *, RDefineBase *> fCanonicalDefines;
+   std::unordered_map<std::string, RDefineBase *> fDefinesByKey;
+   std::unordered_map<RNodeBase *, RNodeBase *> fCanonicalNodes;
+   std::unordered_map<std::string, RFilterBase *> fFiltersByKey;
+
+   /// Return an identifier of the values of the column that a node evaluating the given variation reads.
+   std::string GetColumnId(RColumnRegister &colRegister, const std::string &colName, const std::string &variation)
+   {
+      if (variation != "nominal") {
+         auto *variationPtr = colRegister.GetVariation(colName, variation);
+         if (variationPtr != nullptr)
+            return "var:" + PtrToString(variationPtr) + ':' + colName + ':' + variation;
+      }
+      auto *define = GetReadDefine(colRegister, colName, variation);
+      if (define != nullptr)
+         return "def:" + PtrToString(GetCanonicalDefine(define));
+      return "col:" + colName;
+   }
+
+   std::string GetInputsId(RColumnRegister &colRegister, const ColumnNames_t &columns, const std::string &variation)
+   {
+      std::string id = variation;
+      for (const auto &col : columns)
+         id += '|' + GetColumnId(colRegister, col, variation);
+      return id;
+   }
+
+public:
+   /// Return the (concrete) Define that the readers of the column read from in the given variation, or null if the
+   /// column is a varied or dataset column.
+   static RDefineBase *
+   GetReadDefine(RColumnRegister &colRegister, const std::string &colName, const std::string &variation)
+   {
+      if (variation != "nominal" && colRegister.GetVariation(colName, variation) != nullptr)
+         return nullptr;
+      auto *define = colRegister.GetDefine(colName);
+      if (define == nullptr)
+         return nullptr;
+      if (variation != "nominal" && IsStrInVec(variation, define->GetVariations()))
+         define = &define->GetVariedDefine(variation);
+      auto *jittedDefine = dynamic_cast<RJittedDefine *>(define);
+      return jittedDefine != nullptr ? jittedDefine->GetConcreteDefine() : define;
+   }
+
+   RDefineBase *GetCanonicalDefine(RDefineBase *define)
+   {
+      auto it = fCanonicalDefines.find(define);
+      if (it != fCanonicalDefines.end())
+         return it->second;
+
+      auto *canonical = define;
+      const auto exprId = define->GetExpressionId();
+      if (!exprId.empty()) {
+         auto key = exprId + '|' +
+                    GetInputsId(define->GetColRegister(), define->GetColumnNames(), define->GetVariationName());
+         canonical = fDefinesByKey.emplace(std::move(key), define).first->second;
+      }
+      fCanonicalDefines[define] = canonical;
+      return canonical;
+   }
+
+   /// Only active filters are compared. Named filters can be the canonical filter of a set of equivalent filters, but
+   /// they are never replaced by another filter as they need their own cut-flow counts.
+   RNodeBase *GetCanonicalNode(RNodeBase *node)
+   {
+      auto it = fCanonicalNodes.find(node);
+      if (it != fCanonicalNodes.end())
+         return it->second;
+
+      RNodeBase *canonical = node;
+      auto *filter = dynamic_cast<RFilterBase *>(node);
+      if (auto *jittedFilter = dynamic_cast<RJittedFilter *>(node))
+         filter = jittedFilter->GetConcreteFilter();
+      if (filter != nullptr && filter->IsActive()) {
+         canonical = filter;
+         const auto exprId = filter->GetExpressionId();
+         if (!exprId.empty()) {
+            auto key = exprId + '|' + PtrToString(GetCanonicalNode(filter->GetPrevNode())) + '|' +
+                       GetInputsId(filter->GetColRegister(), filter->GetColumnNames(), filter->GetVariationName());
+            auto *first = fFiltersByKey.emplace(std::move(key), filter).first->second;
+            if (!filter->HasName())
+               canonical = first;
+         }
+      }
+      fCanonicalNodes[node] = canonical;
+      return canonical;
+   }
+};
 } // anonymous namespace
 
 namespace ROOT {
@@ -346,7 +450,8 @@ RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
      fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBlockColumnReaders(fNSlots)
 {
 }
 
@@ -356,14 +461,16 @@ RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles),
      fNewSampleNotifier(fNSlots),
      fSampleInfos(fNSlots),
-     fDatasetColumnReaders(fNSlots)
+     fDatasetColumnReaders(fNSlots),
+     fBlockColumnReaders(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
    : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
-     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBlockColumnReaders(fNSlots)
 {
    fDataSource->SetNSlots(fNSlots);
 }
@@ -372,7 +479,8 @@ RLoopManager::RLoopManager(ROOT::RDF::Experimental::RDatasetSpec &&spec)
    : fBeginEntry(spec.GetEntryRangeBegin()), fEndEntry(spec.GetEntryRangeEnd()),
      fDatasetGroups(spec.MoveOutDatasetGroups()), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBlockColumnReaders(fNSlots)
 {
    auto chain = std::make_shared<TChain>("");
    for (auto &group : fDatasetGroups) {
@@ -434,8 +542,9 @@ void RLoopManager::RunEmptySourceMT()
       try {
          UpdateSampleInfo(slot, range);
          for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+            ProcessEntry(slot, currEntry);
          }
+         RunBlock(slot);
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -460,8 +569,9 @@ void RLoopManager::RunEmptySource()
       UpdateSampleInfo(/*slot*/ 0, fEmptyEntryRange);
       for (ULong64_t currEntry = fEmptyEntryRange.first;
            currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+         ProcessEntry(0, currEntry);
       }
+      RunBlock(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -495,10 +605,13 @@ void RLoopManager::RunTreeProcessorMT()
          // recursive call to check filters and conditionally execute actions
          while (r.Next()) {
             if (fNewSampleNotifier.CheckFlag(slot)) {
+               // the entries of the previous sample must be processed with the previous sample's information
+               RunBlock(slot);
                UpdateSampleInfo(slot, r);
             }
-            RunAndCheckFilters(slot, count++);
+            ProcessEntry(slot, count++);
          }
+         RunBlock(slot);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -536,10 +649,13 @@ void RLoopManager::RunTreeReader()
    try {
       while (r.Next() && fNStopsReceived < fNChildren) {
          if (fNewSampleNotifier.CheckFlag(0)) {
+            // the entries of the previous sample must be processed with the previous sample's information
+            RunBlock(0);
             UpdateSampleInfo(/*slot*/0, r);
          }
-         RunAndCheckFilters(0, r.GetCurrentEntry());
+         ProcessEntry(0, r.GetCurrentEntry());
       }
+      RunBlock(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -568,10 +684,11 @@ void RLoopManager::RunDataSource()
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
                if (fDataSource->SetEntry(0u, entry)) {
-                  RunAndCheckFilters(0u, entry);
+                  ProcessEntry(0u, entry);
                }
             }
          }
+         RunBlock(0u);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -603,9 +720,10 @@ void RLoopManager::RunDataSourceMT()
       try {
          for (auto entry = start; entry < end; ++entry) {
             if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+               ProcessEntry(slot, entry);
             }
          }
+         RunBlock(slot);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -628,18 +746,67 @@ void RLoopManager::RunDataSourceMT()
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
    // data-block callbacks run before the rest of the graph
+   RunSampleCallbacks(slot);
+
+   for (auto *actionPtr : fBookedActions)
+      actionPtr->Run(slot, entry);
+   for (auto *namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFilters(slot, entry);
+   for (auto &callback : fCallbacks)
+      callback(slot);
+}
+
+/// Run the sample callbacks if the slot started processing a new data block.
+void RLoopManager::RunSampleCallbacks(unsigned int slot)
+{
    if (fNewSampleNotifier.CheckFlag(slot)) {
       for (auto &callback : fSampleCallbacks)
          callback.second(slot, fSampleInfos[slot]);
       fNewSampleNotifier.UnsetFlag(slot);
    }
+}
+
+/// Process the entry the dataset is positioned at. In entry-by-entry execution, the computation graph is evaluated
+/// right away. In block-wise execution, the values of the dataset columns are copied to the block of the slot, which
+/// is evaluated once it is full.
+void RLoopManager::ProcessEntry(unsigned int slot, Long64_t entry)
+{
+   if (fBlockSize == 0) {
+      RunAndCheckFilters(slot, entry);
+      return;
+   }
+
+   auto &block = fEntryBlocks[slot];
+   // data-block callbacks run before the rest of the graph: blocks never span several data blocks
+   if (block.fSize == 0)
+      RunSampleCallbacks(slot);
+   block.fEntries[block.fSize] = entry;
+   for (auto &reader : fBlockColumnReaders[slot])
+      reader.second->Load(block.fSize, entry);
+   ++block.fSize;
+   if (block.fSize >= block.fMaxSize)
+      RunBlock(slot);
+}
+
+/// Evaluate the computation graph on the entries of the block of the slot and empty the block.
+/// Must be called at the end of each task and before a new data block starts. No-op in entry-by-entry execution.
+void RLoopManager::RunBlock(unsigned int slot)
+{
+   if (fBlockSize == 0 || fEntryBlocks[slot].fSize == 0)
+      return;
 
+   auto &block = fEntryBlocks[slot];
    for (auto *actionPtr : fBookedActions)
-      actionPtr->Run(slot, entry);
+      actionPtr->RunBlock(slot, block);
    for (auto *namedFilterPtr : fBookedNamedFilters)
-      namedFilterPtr->CheckFilters(slot, entry);
-   for (auto &callback : fCallbacks)
-      callback(slot);
+      namedFilterPtr->CheckFiltersBlock(slot, block);
+   for (auto i = 0u; i < block.fSize; ++i) {
+      for (auto &callback : fCallbacks)
+         callback(slot);
+   }
+
+   block.fSize = 0;
+   ++block.fId;
 }
 
 /// Build TTreeReaderValues for all nodes
@@ -648,12 +815,18 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
    SetupSampleCallbacks(r, slot);
+   if (fBlockSize > 0)
+      fEntryBlocks[slot].fMaxSize = fBlockSize;
    for (auto *ptr : fBookedActions)
       ptr->InitSlot(r, slot);
-   for (auto *ptr : fBookedFilters)
-      ptr->InitSlot(r, slot);
-   for (auto *ptr : fBookedDefines)
-      ptr->InitSlot(r, slot);
+   for (auto *ptr : fBookedFilters) {
+      if (!ptr->IsPruned())
+         ptr->InitSlot(r, slot);
+   }
+   for (auto *ptr : fBookedDefines) {
+      if (!ptr->IsPruned())
+         ptr->InitSlot(r, slot);
+   }
    for (auto *ptr : fBookedVariations)
       ptr->InitSlot(r, slot);
 
@@ -750,6 +923,9 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
    for (auto *ptr : fBookedDefines)
       ptr->FinalizeSlot(slot);
 
+   // the block readers point to the dataset column readers, which might be re-created below
+   fBlockColumnReaders[slot].clear();
+
    if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT) {
       // we are reading from a tree/chain and we need to re-create the RTreeColumnReaders at every task
       // because the TTreeReader object changes at every task
@@ -762,10 +938,18 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
 /// This method also clears the contents of GetCodeToJit().
 void RLoopManager::Jit()
 {
-   // TODO this should be a read lock unless we find GetCodeToJit non-empty
-   R__LOCKGUARD(gROOTMutex);
+   // The code to jit is shared by all RLoopManagers: an RLoopManager whose code is being jitted by another thread must
+   // wait for it to complete before running its event loop. gROOTMutex is only held while the interpreter is needed,
+   // so that other threads can use it while the code is compiled for the jit cache.
+   static std::mutex jitMutex;
+   std::lock_guard<std::mutex> jitLock(jitMutex);
 
-   const std::string code = std::move(GetCodeToJit());
+   std::string code;
+   {
+      // TODO this should be a read lock unless we find GetCodeToJit non-empty
+      R__LOCKGUARD(gROOTMutex);
+      code = std::move(GetCodeToJit());
+   }
    if (code.empty()) {
       R__LOG_INFO(RDFLogChannel()) << "Nothing to jit and execute.";
       return;
@@ -773,7 +957,10 @@ void RLoopManager::Jit()
 
    TStopwatch s;
    s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   if (!RDFInternal::RunJitCodeFromCache(code)) {
+      R__LOCKGUARD(gROOTMutex);
+      RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   }
    s.Stop();
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
@@ -794,6 +981,134 @@ void RLoopManager::EvalChildrenCounts()
       namedFilterPtr->TriggerChildrenCount();
 }
 
+/// Return the value ranges of data source columns that all entries processed by the current event loop must satisfy.
+/// Hints can only be given if the entire computation graph hangs from a single filter that provides range hints:
+/// any other node attached to the RLoopManager, as well as the cut-flow report of named filters, would see a different
+/// set of entries if the data source skipped entries based on the hints. Must be called after EvalChildrenCounts().
+std::vector<ROOT::RDF::RColumnRangeHint> RLoopManager::GetColumnRangeHints() const
+{
+   if (fNChildren != 1 || !fBookedNamedFilters.empty())
+      return {};
+   for (auto *filter : fBookedFilters) {
+      if (!filter->GetColumnRangeHints().empty() && filter->IsActive())
+         return filter->GetColumnRangeHints();
+   }
+   return {};
+}
+
+/// Optimize the computation graph for the next event loop, if enabled with
+/// ROOT::RDF::Experimental::EnableGraphOptimization():
+/// - Defines and unnamed Filters that are equivalent to another node, i.e. that have the same expression, the same
+///   inputs (and the same upstream node, for Filters), return the values of that node rather than evaluating their
+///   own expression;
+/// - Defines that are not read by any node of the event loop and Filters that are not active are pruned, i.e. they
+///   are not initialized, so that the columns only they read are not read.
+/// Must be called after InitNodes(), as it relies on the children counts of the filters.
+void RLoopManager::OptimizeGraph()
+{
+   for (auto *define : fBookedDefines) {
+      define->SetEquivalentDefine(nullptr);
+      define->SetPruned(false);
+   }
+   for (auto *filter : fBookedFilters) {
+      filter->SetEquivalentFilter(nullptr);
+      filter->SetPruned(false);
+   }
+   if (!RDFInternal::IsGraphOptimizationEnabled())
+      return;
+
+   RGraphOptimizer optimizer;
+
+   unsigned int nEquivalentFilters = 0u;
+   unsigned int nInactiveFilters = 0u;
+   for (auto *filter : fBookedFilters) {
+      if (!filter->IsActive()) {
+         filter->SetPruned(true);
+         ++nInactiveFilters;
+         continue;
+      }
+      auto *canonical = static_cast<RFilterBase *>(optimizer.GetCanonicalNode(filter));
+      if (canonical != filter) {
+         filter->SetEquivalentFilter(canonical);
+         filter->SetPruned(true);
+         ++nEquivalentFilters;
+      }
+   }
+
+   unsigned int nEquivalentDefines = 0u;
+   for (auto *define : fBookedDefines) {
+      auto *canonical = optimizer.GetCanonicalDefine(define);
+      if (canonical != define) {
+         define->SetEquivalentDefine(canonical);
+         ++nEquivalentDefines;
+      }
+   }
+
+   // Find the (canonical) Defines that are read, directly or through other Defines, by the nodes of the event loop.
+   std::unordered_set<RDefineBase *> readDefines;
+   std::vector<RDefineBase *> toVisit;
+   auto markRead = [&](RColumnRegister &colRegister, const ColumnNames_t &columns, const std::string &variation) {
+      for (const auto &col : columns) {
+         auto *define = RGraphOptimizer::GetReadDefine(colRegister, col, variation);
+         if (define == nullptr)
+            continue;
+         define = optimizer.GetCanonicalDefine(define);
+         if (readDefines.insert(define).second)
+            toVisit.push_back(define);
+      }
+   };
+   for (auto *action : fBookedActions) {
+      markRead(action->GetColRegister(), action->GetColumnNames(), "nominal");
+      for (const auto &variation : action->GetVariations())
+         markRead(action->GetColRegister(), action->GetColumnNames(), variation);
+   }
+   for (auto *filter : fBookedFilters) {
+      if (!filter->IsPruned())
+         markRead(filter->GetColRegister(), filter->GetColumnNames(), filter->GetVariationName());
+   }
+   for (auto *variation : fBookedVariations)
+      markRead(variation->GetColRegister(), variation->GetInputColumns(), "nominal");
+   while (!toVisit.empty()) {
+      auto *define = toVisit.back();
+      toVisit.pop_back();
+      markRead(define->GetColRegister(), define->GetColumnNames(), define->GetVariationName());
+   }
+
+   unsigned int nUnreadDefines = 0u;
+   for (auto *define : fBookedDefines) {
+      const bool isRead = readDefines.find(define) != readDefines.end();
+      define->SetPruned(!isRead);
+      if (!isRead && define->GetEquivalentDefine() == nullptr)
+         ++nUnreadDefines;
+   }
+
+   R__LOG_INFO(RDFLogChannel()) << "Graph optimization: " << nEquivalentDefines << " duplicate Defines, "
+                                << nEquivalentFilters << " duplicate Filters, " << nUnreadDefines
+                                << " unread Defines and " << nInactiveFilters << " inactive Filters are not evaluated.";
+}
+
+/// Return the number of entries per block for the next event loop: the one set with EnableBlockExecution(), or 0 if
+/// block-wise execution is disabled or not supported by the computation graph. Must be called after Jit().
+unsigned int RLoopManager::EvalBlockSize() const
+{
+   const auto blockSize = RDFInternal::GetBlockSize();
+   if (blockSize == 0)
+      return 0u;
+   // RVariation nodes store a single value per slot, so they can only be evaluated entry by entry
+   if (!fBookedVariations.empty()) {
+      R__LOG_INFO(RDFLogChannel()) << "Systematic variations are booked: entries are processed one at a time.";
+      return 0u;
+   }
+   for (auto *actionPtr : fBookedActions) {
+      if (!actionPtr->SupportsBlockExecution()) {
+         R__LOG_INFO(RDFLogChannel()) << "An action does not support block-wise execution: entries are processed one "
+                                         "at a time.";
+         return 0u;
+      }
+   }
+   return blockSize;
+}
+
 /// Start the event loop with a different mechanism depending on IMT/no IMT, data source/no data source.
 /// Also perform a few setup and clean-up operations (jit actions if necessary, clear booked actions after the loop...).
 /// The jitting phase is skipped if the `jit` parameter is `false` (unsafe, use with care).
@@ -810,6 +1125,12 @@ void RLoopManager::Run(bool jit)
       Jit();
 
    InitNodes();
+   OptimizeGraph();
+   if (fDataSource)
+      fDataSource->SetColumnRangeHints(GetColumnRangeHints());
+
+   fBlockSize = EvalBlockSize();
+   fEntryBlocks.assign(fBlockSize > 0 ? fNSlots : 0u, RDFInternal::REntryBlock(fBlockSize));
 
    TStopwatch s;
    s.Start();
@@ -1046,6 +1367,36 @@ RLoopManager::GetDatasetColumnReader(unsigned int slot, const std::string &col,
       return nullptr;
 }
 
+RColumnReaderBase *
+RLoopManager::GetBlockColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const
+{
+   const auto key = MakeDatasetColReadersKey(col, ti);
+   for (auto &reader : fBlockColumnReaders[slot]) {
+      if (reader.first == key)
+         return reader.second.get();
+   }
+   return nullptr;
+}
+
+/// \brief Register a reader that buffers the values of a dataset column for the entries of the block of the slot.
+/// \return A pointer to the inserted column reader.
+RColumnReaderBase *RLoopManager::AddBlockColumnReader(unsigned int slot, const std::string &col,
+                                                      std::unique_ptr<RDFInternal::RBlockColumnReaderBase> &&reader,
+                                                      const std::type_info &ti)
+{
+   assert(GetBlockColumnReader(slot, col, ti) == nullptr);
+   auto *rptr = reader.get();
+   fBlockColumnReaders[slot].emplace_back(MakeDatasetColReadersKey(col, ti), std::move(reader));
+   return rptr;
+}
+
+/// Signal that the slot reads a dataset column whose values cannot be buffered: the slot evaluates the computation
+/// graph after each entry for the rest of the task.
+void RLoopManager::SetBlockUnbufferable(unsigned int slot)
+{
+   fEntryBlocks[slot].fMaxSize = 1u;
+}
+
 void RLoopManager::AddSampleCallback(void *nodePtr, SampleCallback_t &&callback)
 {
    if (callback)
@@ -26,6 +26,10 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -42,9 +46,63 @@
 * For each column containing an array or a collection, a corresponding column `#colname` is available to access
 * `colname.size()` without reading and deserializing the collection values.
 *
+* A chain of RNTuples with identical schema stored in several files is read in batches of a few consecutive files.
+* The entry ranges of all the files of a batch are handed out together, so that slots can move on to the next file
+* of the batch without waiting for the others. While the event loop processes a batch, the page sources of the files
+* of the following batch are opened in the background and the cluster at which processing of each slot starts is
+* loaded, for the columns that the event loop reads.
+*
 **/
 // clang-format on
 
+namespace {
+
+/// The fields of the RDF columns are set up from the descriptor of the first file of a chain and they refer to the
+/// on-disk field IDs of that file. Hence all the files of the chain need to have the same schema.
+bool IsSameSchema(const ROOT::Experimental::RNTupleDescriptor &desc,
+                  const ROOT::Experimental::RNTupleDescriptor &other)
+{
+   using ROOT::Experimental::DescriptorId_t;
+   using ROOT::Experimental::kInvalidDescriptorId;
+
+   if (desc.GetNFields() != other.GetNFields() || desc.GetNLogicalColumns() != other.GetNLogicalColumns())
+      return false;
+
+   std::vector<DescriptorId_t> parentIds{desc.GetFieldZeroId()};
+   while (!parentIds.empty()) {
+      const auto parentId = parentIds.back();
+      parentIds.pop_back();
+      for (const auto &fieldDesc : desc.GetFieldIterable(parentId)) {
+         const auto otherId = other.FindFieldId(fieldDesc.GetFieldName(), parentId);
+         if (otherId != fieldDesc.GetId())
+            return false;
+         const auto &otherDesc = other.GetFieldDescriptor(otherId);
+         if (otherDesc.GetTypeName() != fieldDesc.GetTypeName() ||
+             otherDesc.GetStructure() != fieldDesc.GetStructure() ||
+             otherDesc.GetNRepetitions() != fieldDesc.GetNRepetitions())
+            return false;
+         for (const auto &columnDesc : desc.GetColumnIterable(fieldDesc)) {
+            const auto otherColumnId = other.FindLogicalColumnId(otherId, columnDesc.GetIndex());
+            if (otherColumnId != columnDesc.GetLogicalId() ||
+                other.GetColumnDescriptor(otherColumnId).GetModel() != columnDesc.GetModel())
+               return false;
+         }
+         parentIds.emplace_back(fieldDesc.GetId());
+      }
+   }
+   return true;
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RPageSource>
+CreateFirstPageSource(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+{
+   if (fileNames.empty())
+      throw std::invalid_argument("RNTupleDS: empty list of files");
+   return ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileNames[0]);
+}
+
+} // anonymous namespace
+
 namespace ROOT {
 namespace Experimental {
 namespace Internal {
@@ -122,9 +180,20 @@ class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    using RFieldValue = ROOT::Experimental::Detail::RFieldValue;
    using RPageSource = ROOT::Experimental::Detail::RPageSource;
 
+   /// Maximum number of values of simple fields that are read in one go
+   static constexpr NTupleSize_t kBlockSize = 4096;
+
    std::unique_ptr<RFieldBase> fField; ///< The field backing the RDF column
    RFieldValue fValue;                 ///< The memory location used to read from fField
    Long64_t fLastEntry;                ///< Last entry number that was read
+   bool fIsConnected = false;          ///< Fields can be connected to a page source only once
+   /// For chains, the number of entries in the files before the one the reader is connected to. RDataFrame passes
+   /// chain-wide entry numbers to GetImpl().
+   Long64_t fEntryOffset = 0;
+   /// For simple fields, holds a copy of the values of the entries [fBlockFirst, fBlockEnd), read in bulk from a page
+   std::unique_ptr<unsigned char[]> fBlock;
+   Long64_t fBlockFirst = 0;
+   Long64_t fBlockEnd = 0;
 
 public:
    RNTupleColumnReader(std::unique_ptr<RFieldBase> f)
@@ -139,16 +208,47 @@ public:
       return std::make_unique<RNTupleColumnReader>(fField->Clone(fField->GetName()));
    }
 
-   /// Connect the field and its subfields to the page source
-   void Connect(RPageSource &source)
+   /// Connect the field and its subfields to the page source. If the reader is already connected, it switches to
+   /// a fresh clone of its field that gets connected to the new page source.
+   void Connect(RPageSource &source, Long64_t entryOffset)
    {
+      if (fIsConnected) {
+         auto field = fField->Clone(fField->GetName());
+         fField->DestroyValue(fValue);
+         fField = std::move(field);
+         fValue = fField->GenerateValue();
+         fLastEntry = -1;
+         fBlockFirst = fBlockEnd = 0;
+      }
       fField->ConnectPageSource(source);
       for (auto &f : *fField)
          f.ConnectPageSource(source);
+      fIsConnected = true;
+      fEntryOffset = entryOffset;
    }
 
+   /// Returns an unconnected copy of the field backing the RDF column
+   std::unique_ptr<RFieldBase> CloneField() const { return fField->Clone(fField->GetName()); }
+
    void *GetImpl(Long64_t entry) final
    {
+      entry -= fEntryOffset;
+      if (fField->IsSimple()) {
+         const auto valueSize = fField->GetValueSize();
+         if (entry < fBlockFirst || entry >= fBlockEnd) {
+            // Never read beyond the current page so that we do not load pages that the entry ranges skip
+            NTupleSize_t nItems;
+            fField->MapBulk(entry, nItems);
+            nItems = std::min(nItems, kBlockSize);
+            if (!fBlock)
+               fBlock = std::make_unique<unsigned char[]>(kBlockSize * valueSize);
+            fField->ReadBulk(entry, nItems, fBlock.get());
+            fBlockFirst = entry;
+            fBlockEnd = entry + nItems;
+         }
+         return fBlock.get() + (entry - fBlockFirst) * valueSize;
+      }
+
       if (entry != fLastEntry) {
          fField->Read(entry, &fValue);
          fLastEntry = entry;
@@ -265,6 +365,12 @@ void RNTupleDS::AddField(const RNTupleDescriptor &desc, std::string_view colName
       fColumnReaderPrototypes.emplace_back(std::move(cardColReader));
    }
 
+   if (skeinIDs.empty() && fieldDesc.GetStructure() == ENTupleStructure::kLeaf && fieldDesc.GetNRepetitions() == 0) {
+      auto columns = desc.GetColumnIterable(fieldId);
+      if (std::distance(columns.begin(), columns.end()) == 1)
+         fStatisticsFieldIds[std::string(colName)] = fieldId;
+   }
+
    skeinIDs.emplace_back(fieldId);
    fColumnNames.emplace_back(colName);
    fColumnTypes.emplace_back(valueField->GetType());
@@ -276,11 +382,21 @@ RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
 {
    pageSource->Attach();
    auto descriptorGuard = pageSource->GetSharedDescriptorGuard();
-   fSources.emplace_back(std::move(pageSource));
+   RChainMember member;
+   member.fNEntries = descriptorGuard->GetNEntries();
+   member.fSources.emplace_back(std::move(pageSource));
+   fOpenFiles.emplace_back(std::move(member));
 
    AddField(descriptorGuard.GetRef(), "", descriptorGuard->GetFieldZeroId(), std::vector<DescriptorId_t>());
 }
 
+RNTupleDS::RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+   : RNTupleDS(CreateFirstPageSource(ntupleName, fileNames))
+{
+   fNTupleName = ntupleName;
+   fFileNames = fileNames;
+}
+
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* name */, const std::type_info & /* ti */)
 {
    // This datasource uses the GetColumnReaders2 API instead (better name in the works)
@@ -294,23 +410,108 @@ RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std:
    // TODO(jblomer): check incoming type
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
    auto clone = fColumnReaderPrototypes[index]->Clone();
-   clone->Connect(*fSources[slot]);
+   const auto &member = fOpenFiles[fSlotFiles[slot]];
+   clone->Connect(*member.fSources[slot], member.fFirstEntry);
+   fActiveColumnReaders[slot].emplace_back(clone.get());
    return clone;
 }
 
-bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
+bool RNTupleDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   return true;
+   const auto &member = fOpenFiles[fSlotFiles[slot]];
+   if (entry >= member.fFirstEntry && entry < member.fFirstEntry + member.fNEntries)
+      return true;
+
+   // The slot moves on to a range of another file of the batch
+   for (std::size_t i = 0; i < fOpenFiles.size(); ++i) {
+      if (entry >= fOpenFiles[i].fFirstEntry && entry < fOpenFiles[i].fFirstEntry + fOpenFiles[i].fNEntries) {
+         ConnectSlot(slot, i);
+         return true;
+      }
+   }
+   R__ASSERT(false && "entry is not in the current batch");
+   return false;
 }
 
-std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
+void RNTupleDS::ConnectSlot(unsigned int slot, std::size_t openFileIndex)
+{
+   const auto &member = fOpenFiles[openFileIndex];
+   for (auto reader : fActiveColumnReaders[slot])
+      reader->Connect(*member.fSources[slot], member.fFirstEntry);
+   fSlotFiles[slot] = openFileIndex;
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetSelectedEntryRanges(Detail::RPageSource &source) const
+{
+   auto descriptorGuard = source.GetSharedDescriptorGuard();
+   const auto &desc = descriptorGuard.GetRef();
+
+   std::vector<std::pair<DescriptorId_t, const RDF::RColumnRangeHint *>> hintedColumns;
+   for (const auto &hint : fColumnRangeHints) {
+      auto itr = fStatisticsFieldIds.find(hint.fColumnName);
+      if (itr == fStatisticsFieldIds.end())
+         continue;
+      hintedColumns.emplace_back(desc.FindPhysicalColumnId(itr->second, 0), &hint);
+   }
+
+   // Entry ranges [first, last) that cannot contain entries passing the hints
+   std::vector<std::pair<ULong64_t, ULong64_t>> excluded;
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      if (!clusterDesc.HasPageLocations())
+         continue;
+      const auto firstEntry = clusterDesc.GetFirstEntryIndex();
+      for (const auto &[physicalId, hint] : hintedColumns) {
+         if (!clusterDesc.ContainsColumn(physicalId))
+            continue;
+         const auto &columnRange = clusterDesc.GetColumnRange(physicalId);
+         if (columnRange.fNElements != clusterDesc.GetNEntries())
+            continue;
+         if (!columnRange.fStatistics.MayOverlap(hint->fMin, hint->fMax)) {
+            excluded.emplace_back(firstEntry, firstEntry + clusterDesc.GetNEntries());
+            break;
+         }
+         auto pageStart = firstEntry;
+         for (const auto &pageInfo : clusterDesc.GetPageRange(physicalId).fPageInfos) {
+            if (!pageInfo.fStatistics.MayOverlap(hint->fMin, hint->fMax))
+               excluded.emplace_back(pageStart, pageStart + pageInfo.fNElements);
+            pageStart += pageInfo.fNElements;
+         }
+      }
+   }
+
+   std::sort(excluded.begin(), excluded.end());
+   std::vector<std::pair<ULong64_t, ULong64_t>> selected;
+   ULong64_t start = 0;
+   for (const auto &[first, last] : excluded) {
+      if (first > start)
+         selected.emplace_back(start, first);
+      start = std::max<ULong64_t>(start, last);
+   }
+   const auto nEntries = desc.GetNEntries();
+   if (start < nEntries)
+      selected.emplace_back(start, nEntries);
+   return selected;
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetFileEntryRanges(Detail::RPageSource &source) const
 {
    // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
-   if (fHasSeenAllRanges)
+   if (!fColumnRangeHints.empty()) {
+      // Distribute the selected entries evenly among the slots
+      const auto selected = GetSelectedEntryRanges(source);
+      ULong64_t nSelected = 0;
+      for (const auto &[first, last] : selected)
+         nSelected += last - first;
+      const auto chunkSize = std::max<ULong64_t>(1, (nSelected + fNSlots - 1) / fNSlots);
+      for (auto [first, last] : selected) {
+         for (; first < last; first += chunkSize)
+            ranges.emplace_back(first, std::min(last, first + chunkSize));
+      }
       return ranges;
+   }
 
-   auto nEntries = fSources[0]->GetNEntries();
+   auto nEntries = source.GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
    auto start = 0UL;
@@ -322,10 +523,127 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
       (void)i;
    }
    ranges.back().second += reminder;
-   fHasSeenAllRanges = true;
    return ranges;
 }
 
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
+{
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   while (ranges.empty()) {
+      if (fHasSeenAllRanges) {
+         const auto nextFileIndex = fOpenFiles.back().fFileIndex + 1;
+         if (nextFileIndex >= fFileNames.size())
+            return ranges;
+         // All the ranges of the current batch are processed, move on to the next files of the chain
+         OpenBatch(nextFileIndex);
+      }
+      for (const auto &member : fOpenFiles) {
+         for (const auto &[first, last] : GetFileEntryRanges(*member.fSources[0])) {
+            if (first < last)
+               ranges.emplace_back(member.fFirstEntry + first, member.fFirstEntry + last);
+         }
+      }
+      fHasSeenAllRanges = true;
+   }
+   return ranges;
+}
+
+void RNTupleDS::StageFiles(std::size_t firstFileIndex, std::size_t endFileIndex)
+{
+   // The column readers are not thread-safe, so the fields for loading the first cluster are cloned upfront
+   std::vector<std::unique_ptr<Detail::RFieldBase>> fields;
+   if (!fActiveColumnReaders.empty()) {
+      for (auto reader : fActiveColumnReaders[0])
+         fields.emplace_back(reader->CloneField());
+   }
+
+   for (auto fileIndex = firstFileIndex; fileIndex < endFileIndex; ++fileIndex) {
+      std::vector<std::unique_ptr<Detail::RFieldBase>> fileFields;
+      for (const auto &f : fields)
+         fileFields.emplace_back(f->Clone(f->GetName()));
+
+      // The first open page source stays alive until the staged sources are taken over in TakeStagedFiles()
+      auto sources = std::async(std::launch::async, [ntupleName = fNTupleName, fileName = fFileNames[fileIndex],
+                                                     nSlots = fNSlots, fields = std::move(fileFields),
+                                                     &current = *fOpenFiles[0].fSources[0]]() {
+         RPageSources_t sources;
+         sources.emplace_back(Detail::RPageSource::Create(ntupleName, fileName));
+         sources[0]->Attach();
+         if (!IsSameSchema(current.GetSharedDescriptorGuard().GetRef(),
+                           sources[0]->GetSharedDescriptorGuard().GetRef()))
+            throw std::runtime_error("RNTupleDS: the schema of '" + fileName +
+                                     "' differs from the first file of the chain");
+         for (unsigned i = 1; i < nSlots; ++i) {
+            sources.emplace_back(sources[0]->Clone());
+            sources[i]->Attach();
+         }
+
+         // Reading an entry of any of the active fields makes the cluster pool of the page source load the cluster
+         // of that entry for all the connected columns, i.e. for the column subset that the event loop reads. The
+         // slots most likely start at the beginning of evenly sized entry ranges.
+         if (fields.empty())
+            return sources;
+         for (unsigned i = 0; i < nSlots; ++i) {
+            const auto nEntries = sources[i]->GetNEntries();
+            const auto firstEntry = nEntries * i / nSlots;
+            if (firstEntry >= nEntries)
+               continue;
+            std::vector<std::unique_ptr<Detail::RFieldBase>> connectedFields;
+            for (const auto &f : fields) {
+               connectedFields.emplace_back(f->Clone(f->GetName()));
+               connectedFields.back()->ConnectPageSource(*sources[i]);
+               for (auto &subField : *connectedFields.back())
+                  subField.ConnectPageSource(*sources[i]);
+            }
+            auto value = connectedFields[0]->GenerateValue();
+            connectedFields[0]->Read(firstEntry, &value);
+            connectedFields[0]->DestroyValue(value);
+         }
+         return sources;
+      });
+      fStagedFiles.emplace_back(fileIndex, std::move(sources));
+   }
+}
+
+std::vector<RNTupleDS::RChainMember> RNTupleDS::TakeStagedFiles(ULong64_t firstEntry)
+{
+   std::vector<RChainMember> members;
+   for (auto &[fileIndex, stagedSources] : fStagedFiles) {
+      RChainMember member;
+      member.fFileIndex = fileIndex;
+      member.fFirstEntry = firstEntry;
+      member.fSources = stagedSources.get();
+      member.fNEntries = member.fSources[0]->GetNEntries();
+      firstEntry += member.fNEntries;
+      members.emplace_back(std::move(member));
+   }
+   fStagedFiles.clear();
+   return members;
+}
+
+void RNTupleDS::OpenBatch(std::size_t firstFileIndex)
+{
+   R__ASSERT(firstFileIndex == 0 || firstFileIndex == fOpenFiles.back().fFileIndex + 1);
+   const auto endFileIndex = std::min(firstFileIndex + kMaxFilesPerBatch, fFileNames.size());
+   if (fStagedFiles.empty() || fStagedFiles.front().first != firstFileIndex) {
+      fStagedFiles.clear();
+      StageFiles(firstFileIndex, endFileIndex);
+   }
+
+   const auto firstEntry = (firstFileIndex == 0) ? 0 : fOpenFiles.back().fFirstEntry + fOpenFiles.back().fNEntries;
+   auto batch = TakeStagedFiles(firstEntry);
+   // The readers need to switch to the new sources before the old sources are destructed
+   for (unsigned i = 0; i < fNSlots; ++i) {
+      for (auto reader : fActiveColumnReaders[i])
+         reader->Connect(*batch[0].fSources[i], batch[0].fFirstEntry);
+      fSlotFiles[i] = 0;
+   }
+   fOpenFiles = std::move(batch);
+
+   if (endFileIndex < fFileNames.size())
+      StageFiles(endFileIndex, std::min(endFileIndex + kMaxFilesPerBatch, fFileNames.size()));
+}
+
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
 {
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), colName));
@@ -337,9 +655,29 @@ bool RNTupleDS::HasColumn(std::string_view colName) const
    return std::find(fColumnNames.begin(), fColumnNames.end(), colName) != fColumnNames.end();
 }
 
+void RNTupleDS::SetColumnRangeHints(const std::vector<ROOT::RDF::RColumnRangeHint> &hints)
+{
+   fColumnRangeHints = hints;
+}
+
 void RNTupleDS::Initialize()
 {
    fHasSeenAllRanges = false;
+   if (fFileNames.size() <= 1)
+      return;
+
+   if (fOpenFiles[0].fFileIndex != 0) {
+      // A previous event loop processed the chain
+      OpenBatch(0);
+   } else if (fOpenFiles.size() == 1 && fStagedFiles.empty()) {
+      // The first event loop: only the first file is open so far, complete the first batch
+      const auto endFileIndex = std::min(kMaxFilesPerBatch, fFileNames.size());
+      StageFiles(1, endFileIndex);
+      for (auto &member : TakeStagedFiles(fOpenFiles[0].fNEntries))
+         fOpenFiles.emplace_back(std::move(member));
+      if (endFileIndex < fFileNames.size())
+         StageFiles(endFileIndex, std::min(endFileIndex + kMaxFilesPerBatch, fFileNames.size()));
+   }
 }
 
 void RNTupleDS::Finalize() {}
@@ -349,11 +687,14 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
    R__ASSERT(fNSlots == 0);
    R__ASSERT(nSlots > 0);
    fNSlots = nSlots;
+   fActiveColumnReaders.resize(fNSlots);
+   fSlotFiles.resize(fNSlots, 0);
 
+   auto &sources = fOpenFiles[0].fSources;
    for (unsigned int i = 1; i < fNSlots; ++i) {
-      fSources.emplace_back(fSources[0]->Clone());
-      assert(i == (fSources.size() - 1));
-      fSources[i]->Attach();
+      sources.emplace_back(sources[0]->Clone());
+      assert(i == (sources.size() - 1));
+      sources[i]->Attach();
    }
 }
 } // namespace Experimental
@@ -371,3 +712,10 @@ ROOT::RDataFrame ROOT::RDF::Experimental::FromRNTuple(ROOT::Experimental::RNTupl
    ROOT::RDataFrame rdf(std::make_unique<ROOT::Experimental::RNTupleDS>(ntuple->MakePageSource()));
    return rdf;
 }
+
+ROOT::RDataFrame
+ROOT::RDF::Experimental::FromRNTuple(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+{
+   ROOT::RDataFrame rdf(std::make_unique<ROOT::Experimental::RNTupleDS>(ntupleName, fileNames));
+   return rdf;
+}
@@ -10,6 +10,8 @@
 
 #include "ROOT/RDF/RRangeBase.hxx"
 
+#include <limits>
+
 using ROOT::Detail::RDF::RRangeBase;
 
 RRangeBase::RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int stop, unsigned int stride,
@@ -21,6 +23,7 @@ RRangeBase::RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int s
 void RRangeBase::InitNode()
 {
    fLastCheckedEntry = -1;
+   fLastCheckedBlock = std::numeric_limits<ULong64_t>::max();
    fNProcessedEntries = 0;
    fHasStopped = false;
 }
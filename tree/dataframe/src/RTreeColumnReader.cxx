@@ -0,0 +1,100 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RTreeColumnReader.hxx"
+
+#include <TBranch.h>
+#include <TClass.h>
+#include <TLeaf.h>
+#include <TMath.h>
+#include <TTree.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+std::atomic<ULong64_t> gNBulkBaskets{0};
+}
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+ULong64_t RTreeBulkColumnReaderBase::GetNBulkBaskets()
+{
+   return gNBulkBaskets.load();
+}
+
+RTreeBulkColumnReaderBase::RTreeBulkColumnReaderBase(TTreeReader &r, const std::string &colName, EDataType type)
+   : fReader(r), fColName(colName), fType(type)
+{
+}
+
+RTreeBulkColumnReaderBase::~RTreeBulkColumnReaderBase() = default;
+
+void RTreeBulkColumnReaderBase::AttachTree(TTree *tree, Int_t treeNumber)
+{
+   fTree = tree;
+   fTreeNumber = treeNumber;
+   fBranch = nullptr;
+   fValues = nullptr;
+   fFirstEntry = fEndEntry = 0;
+   if (!tree)
+      return;
+
+   auto *branch = tree->GetBranch(fColName.c_str());
+   // Friend branches, split objects, leaf lists, disabled branches and branches with variable-size entries
+   // are left to TTreeReaderValue
+   if (!branch || branch->GetTree() != tree || branch->IsA() != TBranch::Class() || !branch->SupportsBulkRead() ||
+       branch->TestBit(kDoNotProcess) || branch->GetEntryOffsetLen() > 0)
+      return;
+   auto *leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->At(0));
+   if (leaf->GetLeafCount() || leaf->GetLenStatic() != 1)
+      return;
+   TClass *expectedClass = nullptr;
+   EDataType expectedType = kOther_t;
+   if (branch->GetExpectedType(expectedClass, expectedType) != 0 || expectedClass || expectedType != fType)
+      return;
+
+   if (!fBuffer)
+      fBuffer = std::make_unique<TBufferFile>(TBuffer::kWrite, 32 * 1024);
+   fBranch = branch;
+}
+
+/// Deserialize the basket that contains the given entry of the current tree.
+/// In case of failure, the reader falls back to TTreeReaderValue until the next tree switch.
+bool RTreeBulkColumnReaderBase::LoadBlock(Long64_t entry, std::size_t valueSize)
+{
+   // GetBulkEntries can only start from the first entry of a basket
+   const auto nBaskets = fBranch->GetWriteBasket() + 1;
+   const auto basketEntries = fBranch->GetBasketEntry();
+   const auto basketIdx = TMath::BinarySearch(nBaskets, basketEntries, entry);
+   const Int_t nEntries = basketIdx < 0 ? -1 : fBranch->GetBulkRead().GetBulkEntries(basketEntries[basketIdx], *fBuffer);
+   if (nEntries <= 0 || entry >= basketEntries[basketIdx] + nEntries) {
+      fBranch = nullptr;
+      return false;
+   }
+
+   // The values start after the basket key, which leaves them unaligned in general: move them to the beginning of
+   // the (suitably aligned) buffer so that they can be accessed as an array of the value type.
+   char *values = fBuffer->GetCurrent();
+   if (reinterpret_cast<std::uintptr_t>(values) % alignof(std::max_align_t) != 0) {
+      std::memmove(fBuffer->Buffer(), values, nEntries * valueSize);
+      values = fBuffer->Buffer();
+   }
+   fValues = values;
+   fFirstEntry = basketEntries[basketIdx];
+   fEndEntry = fFirstEntry + nEntries;
+   gNBulkBaskets.fetch_add(1, std::memory_order_relaxed);
+   return true;
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
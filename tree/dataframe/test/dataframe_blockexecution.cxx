@@ -0,0 +1,239 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RVec.hxx"
+#include "TChain.h"
+#include "TFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "gtest/gtest.h"
+
+#include <algorithm> // std::sort
+#include <atomic>
+#include <string>
+#include <vector>
+
+using ROOT::RVecF;
+
+namespace {
+
+struct FileRAII {
+   std::string fPath;
+   explicit FileRAII(const std::string &path) : fPath(path) {}
+   ~FileRAII() { gSystem->Unlink(fPath.c_str()); }
+};
+
+class RBlockExecutionRAII {
+public:
+   RBlockExecutionRAII(unsigned int blockSize) { ROOT::RDF::Experimental::EnableBlockExecution(blockSize); }
+   ~RBlockExecutionRAII() { ROOT::RDF::Experimental::DisableBlockExecution(); }
+};
+
+class RMTRAII {
+   bool fIsMT;
+
+public:
+   RMTRAII(bool isMT) : fIsMT(isMT)
+   {
+      if (fIsMT)
+         ROOT::EnableImplicitMT(4);
+   }
+   ~RMTRAII()
+   {
+      if (fIsMT)
+         ROOT::DisableImplicitMT();
+   }
+};
+
+// Write a tree with a scalar and an array branch. Values are derived from the global entry number.
+void MakeTree(const std::string &fileName, int nEntries, int firstValue = 0)
+{
+   TFile f(fileName.c_str(), "RECREATE");
+   TTree t("t", "t");
+   int i = 0;
+   int n = 0;
+   float v[4];
+   t.Branch("i", &i);
+   t.Branch("n", &n);
+   t.Branch("v", v, "v[n]/F");
+   for (i = firstValue; i < firstValue + nEntries; ++i) {
+      n = i % 5;
+      for (int k = 0; k < n; ++k)
+         v[k] = i + 0.5f * k;
+      t.Fill();
+   }
+   t.Write();
+}
+
+struct RGraphResults {
+   ULong64_t fCount;
+   double fSum;
+   std::vector<int> fSelected;
+   std::vector<std::string> fReport;
+};
+
+// Book a computation graph with shared filters and defines on several branches and return its results
+RGraphResults RunGraph(ROOT::RDF::RNode df, std::atomic<int> &nDefineCalls)
+{
+   auto withX = df.Define("x",
+                          [&nDefineCalls](int i) {
+                             ++nDefineCalls;
+                             return i * 0.5;
+                          },
+                          {"i"});
+   auto even = withX.Filter([](int i) { return i % 2 == 0; }, {"i"}, "even");
+   auto big = even.Filter([](double x) { return x > 10.; }, {"x"}, "big");
+   auto sq = big.Define("sq", [](double x) { return x * x; }, {"x"});
+   auto mult = withX.Filter("i % 3 == 0", "mult3");
+
+   auto count = mult.Count();
+   auto sum = sq.Sum<double>("sq");
+   auto selected = big.Take<int>("i");
+   auto report = df.Report();
+
+   RGraphResults res{*count, *sum, *selected, {}};
+   std::sort(res.fSelected.begin(), res.fSelected.end());
+   for (auto &&cut : report)
+      res.fReport.push_back(cut.GetName() + ':' + std::to_string(cut.GetPass()) + '/' + std::to_string(cut.GetAll()));
+   return res;
+}
+
+void CheckSameResults(const RGraphResults &expected, const RGraphResults &actual)
+{
+   EXPECT_EQ(expected.fCount, actual.fCount);
+   EXPECT_DOUBLE_EQ(expected.fSum, actual.fSum);
+   EXPECT_EQ(expected.fSelected, actual.fSelected);
+   EXPECT_EQ(expected.fReport, actual.fReport);
+}
+
+void TestEmptySource(bool isMT)
+{
+   RMTRAII gomt(isMT);
+   std::atomic<int> nDefineCalls{0};
+   const auto expected = RunGraph(ROOT::RDataFrame(1000).Define("i", [](ULong64_t e) { return int(e); }, {"rdfentry_"}),
+                                  nDefineCalls);
+   EXPECT_EQ(1000, nDefineCalls);
+
+   // block sizes that do and do not divide the number of entries per task
+   for (auto blockSize : {1u, 7u, 256u, 5000u}) {
+      RBlockExecutionRAII blocks(blockSize);
+      nDefineCalls = 0;
+      const auto actual = RunGraph(
+         ROOT::RDataFrame(1000).Define("i", [](ULong64_t e) { return int(e); }, {"rdfentry_"}), nDefineCalls);
+      CheckSameResults(expected, actual);
+      // defines are still evaluated at most once per entry
+      EXPECT_EQ(1000, nDefineCalls);
+   }
+}
+
+void TestChain(bool isMT)
+{
+   FileRAII file1("dataframe_blockexecution_chain1.root");
+   FileRAII file2("dataframe_blockexecution_chain2.root");
+   MakeTree(file1.fPath, 300);
+   MakeTree(file2.fPath, 500, 300);
+   RMTRAII gomt(isMT);
+
+   auto book = [&] {
+      TChain c("t");
+      c.Add(file1.fPath.c_str());
+      c.Add(file2.fPath.c_str());
+      ROOT::RDataFrame df(c);
+      auto withFile = df.DefinePerSample("firstFile", [&](unsigned int, const ROOT::RDF::RSampleInfo &id) {
+         return id.Contains(file1.fPath);
+      });
+      // the per-sample value must correspond to the sample of the entry also for blocks across a file boundary
+      auto nBadSample = withFile.Filter([](int i, bool firstFile) { return (i < 300) != firstFile; }, {"i", "firstFile"})
+                           .Count();
+      auto nBadArray = withFile
+                          .Filter(
+                             [](int i, const RVecF &v) {
+                                if (int(v.size()) != i % 5)
+                                   return true;
+                                for (auto k = 0u; k < v.size(); ++k)
+                                   if (v[k] != i + 0.5f * k)
+                                      return true;
+                                return false;
+                             },
+                             {"i", "v"})
+                          .Count();
+      auto sumArrays = withFile.Define("s", [](const RVecF &v) { return ROOT::VecOps::Sum(v); }, {"v"}).Sum<float>("s");
+      return std::make_tuple(*nBadSample, *nBadArray, *sumArrays);
+   };
+
+   const auto expected = book();
+   EXPECT_EQ(0ull, std::get<0>(expected));
+   EXPECT_EQ(0ull, std::get<1>(expected));
+
+   RBlockExecutionRAII blocks(64);
+   const auto actual = book();
+   EXPECT_EQ(0ull, std::get<0>(actual));
+   EXPECT_EQ(0ull, std::get<1>(actual));
+   EXPECT_FLOAT_EQ(std::get<2>(expected), std::get<2>(actual));
+}
+
+} // anonymous namespace
+
+TEST(RDFBlockExecution, EmptySource)
+{
+   TestEmptySource(false);
+}
+
+TEST(RDFBlockExecution, Chain)
+{
+   TestChain(false);
+}
+
+TEST(RDFBlockExecution, Range)
+{
+   RBlockExecutionRAII blocks(16);
+   ROOT::RDataFrame df(100);
+   auto entries = df.Range(10, 50, 3).Take<ULong64_t>("rdfentry_");
+   auto filtered = df.Filter([](ULong64_t e) { return e % 2 == 0; }, {"rdfentry_"}).Range(5).Take<ULong64_t>("rdfentry_");
+
+   std::vector<ULong64_t> expected;
+   for (ULong64_t e = 10; e < 50; e += 3)
+      expected.push_back(e);
+   EXPECT_EQ(expected, *entries);
+   EXPECT_EQ(std::vector<ULong64_t>({0, 2, 4, 6, 8}), *filtered);
+}
+
+TEST(RDFBlockExecution, PartialResultCallback)
+{
+   RBlockExecutionRAII blocks(8);
+   ROOT::RDataFrame df(100);
+   auto count = df.Count();
+   unsigned int nCalls = 0;
+   count.OnPartialResult(10, [&nCalls](ULong64_t &) { ++nCalls; });
+   EXPECT_EQ(100ull, *count);
+   EXPECT_EQ(10u, nCalls);
+}
+
+// Snapshot to TTree and Vary fall back to entry-by-entry execution
+TEST(RDFBlockExecution, Fallbacks)
+{
+   FileRAII file("dataframe_blockexecution_snapshot.root");
+   RBlockExecutionRAII blocks(16);
+
+   auto df = ROOT::RDataFrame(100).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto out = df.Snapshot<double>("t", file.fPath, {"x"});
+   EXPECT_DOUBLE_EQ(99. * 100. / 2., *out->Sum<double>("x"));
+
+   auto sum = df.Vary("x", [](double x) { return ROOT::RVecD{x - 1., x + 1.}; }, {"x"}, 2).Sum<double>("x");
+   auto sums = ROOT::RDF::Experimental::VariationsFor(sum);
+   EXPECT_DOUBLE_EQ(99. * 100. / 2., sums["nominal"]);
+   EXPECT_DOUBLE_EQ(99. * 100. / 2. - 100., sums["x:0"]);
+   EXPECT_DOUBLE_EQ(99. * 100. / 2. + 100., sums["x:1"]);
+}
+
+#ifdef R__USE_IMT
+TEST(RDFBlockExecution, EmptySourceMT)
+{
+   TestEmptySource(true);
+}
+
+TEST(RDFBlockExecution, ChainMT)
+{
+   TestChain(true);
+}
+#endif
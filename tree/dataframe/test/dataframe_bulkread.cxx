@@ -0,0 +1,276 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDF/RTreeColumnReader.hxx"
+#include "TBranch.h"
+#include "TChain.h"
+#include "TEntryList.h"
+#include "TFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+#include "gtest/gtest.h"
+
+#include <algorithm> // std::sort
+#include <numeric>   // std::iota
+#include <string>
+#include <vector>
+
+using ROOT::Internal::RDF::RTreeBulkColumnReaderBase;
+
+namespace {
+
+// Write a tree with flat branches of fundamental type and tiny baskets, so that every column spans many baskets.
+// Values are derived from the global entry number, starting at firstValue.
+void MakeFlatTree(const std::string &fileName, int nEntries, int firstValue = 0)
+{
+   TFile f(fileName.c_str(), "RECREATE");
+   TTree t("t", "t");
+   int i = 0;
+   float x = 0.f;
+   double d = 0.;
+   bool b = false;
+   Char_t c = 0;
+   Short_t s = 0;
+   ULong64_t u = 0;
+   // different basket sizes make baskets boundaries differ between branches
+   t.Branch("i", &i, "i/I", 128);
+   t.Branch("x", &x, "x/F", 160);
+   t.Branch("d", &d, "d/D", 256);
+   t.Branch("b", &b, "b/O", 100);
+   t.Branch("c", &c, "c/B", 100);
+   t.Branch("s", &s, "s/S", 100);
+   t.Branch("u", &u, "u/l", 200);
+   for (int e = firstValue; e < firstValue + nEntries; ++e) {
+      i = e;
+      x = 0.5f * e;
+      d = 0.25 * e;
+      b = e % 3 == 0;
+      c = e % 127;
+      s = -e;
+      u = 1000000000000ull + e;
+      t.Fill();
+   }
+   t.Write();
+}
+
+struct FileRAII {
+   std::string fPath;
+   explicit FileRAII(const std::string &path) : fPath(path) {}
+   ~FileRAII() { gSystem->Unlink(fPath.c_str()); }
+};
+
+class RMTRAII {
+   bool fIsMT;
+
+public:
+   RMTRAII(bool isMT) : fIsMT(isMT)
+   {
+      if (fIsMT)
+         ROOT::EnableImplicitMT(4);
+   }
+   ~RMTRAII()
+   {
+      if (fIsMT)
+         ROOT::DisableImplicitMT();
+   }
+};
+
+// Check all columns of the given entries, i.e. values, as read by an RDataFrame on the given tree or chain
+void CheckColumns(ROOT::RDF::RNode df, std::vector<int> expected)
+{
+   auto is = df.Take<int>("i");
+   auto xs = df.Take<float>("x");
+   auto ds = df.Take<double>("d");
+   auto bs = df.Take<bool>("b");
+   auto cs = df.Take<Char_t>("c");
+   auto ss = df.Take<Short_t>("s");
+   auto us = df.Take<ULong64_t>("u");
+   // every entry must see consistent values across columns, also if the entries are processed out of order
+   auto nBad = df.Filter(
+                    [](int i, float x, double d, bool b, Char_t c, Short_t s, ULong64_t u) {
+                       return x != 0.5f * i || d != 0.25 * i || b != (i % 3 == 0) || c != i % 127 || s != -i ||
+                              u != 1000000000000ull + i;
+                    },
+                    {"i", "x", "d", "b", "c", "s", "u"})
+                 .Count();
+
+   auto sorted = *is;
+   std::sort(sorted.begin(), sorted.end());
+   EXPECT_EQ(expected, sorted);
+   EXPECT_EQ(expected.size(), xs->size());
+   EXPECT_EQ(expected.size(), ds->size());
+   EXPECT_EQ(expected.size(), bs->size());
+   EXPECT_EQ(expected.size(), cs->size());
+   EXPECT_EQ(expected.size(), ss->size());
+   EXPECT_EQ(expected.size(), us->size());
+   EXPECT_EQ(0ull, *nBad);
+}
+
+// The number of baskets of the branch that contain entries from firstEntry onwards
+ULong64_t NBaskets(TBranch *branch, Long64_t firstEntry = 0)
+{
+   const auto nBaskets = branch->GetWriteBasket() + 1;
+   const auto *basketEntries = branch->GetBasketEntry();
+   ULong64_t n = 0;
+   for (Int_t i = 0; i < nBaskets; ++i) {
+      const auto endEntry = (i + 1 < nBaskets) ? basketEntries[i + 1] : branch->GetEntries();
+      if (endEntry > firstEntry && basketEntries[i] < endEntry)
+         ++n;
+   }
+   return n;
+}
+
+// The number of baskets of all branches of the tree "t" in the given file
+ULong64_t NBaskets(const std::string &fileName)
+{
+   TFile f(fileName.c_str());
+   auto t = f.Get<TTree>("t");
+   ULong64_t n = 0;
+   for (auto *b : TRangeDynCast<TBranch>(t->GetListOfBranches()))
+      n += NBaskets(b);
+   return n;
+}
+
+std::vector<int> Iota(int begin, int end)
+{
+   std::vector<int> v(end - begin);
+   std::iota(v.begin(), v.end(), begin);
+   return v;
+}
+
+void TestFlatTree(bool isMT)
+{
+   FileRAII file("dataframe_bulkread_flat.root");
+   MakeFlatTree(file.fPath, 1000);
+   RMTRAII gomt(isMT);
+
+   const auto nBulkBaskets = RTreeBulkColumnReaderBase::GetNBulkBaskets();
+   ROOT::RDataFrame df("t", file.fPath);
+   CheckColumns(df, Iota(0, 1000));
+   // Every branch spans several baskets, all of which are read in bulk
+   const auto nBasketsCheck = RTreeBulkColumnReaderBase::GetNBulkBaskets() - nBulkBaskets;
+   EXPECT_GE(nBasketsCheck, NBaskets(file.fPath));
+   // jitted actions read through the same column readers
+   EXPECT_DOUBLE_EQ(0.25 * 999 * 1000 / 2, *df.Sum("d"));
+   EXPECT_EQ(334ull, *df.Filter("b").Count());
+   EXPECT_GT(RTreeBulkColumnReaderBase::GetNBulkBaskets() - nBulkBaskets, nBasketsCheck);
+}
+
+void TestChain(bool isMT)
+{
+   FileRAII file1("dataframe_bulkread_chain1.root");
+   FileRAII file2("dataframe_bulkread_chain2.root");
+   MakeFlatTree(file1.fPath, 500);
+   MakeFlatTree(file2.fPath, 700, 500);
+   RMTRAII gomt(isMT);
+
+   TChain c("t");
+   c.Add(file1.fPath.c_str());
+   c.Add(file2.fPath.c_str());
+   const auto nBulkBaskets = RTreeBulkColumnReaderBase::GetNBulkBaskets();
+   CheckColumns(ROOT::RDataFrame(c), Iota(0, 1200));
+   // The readers switch to bulk reading again for the second tree
+   EXPECT_GE(RTreeBulkColumnReaderBase::GetNBulkBaskets() - nBulkBaskets,
+             NBaskets(file1.fPath) + NBaskets(file2.fPath));
+}
+
+} // anonymous namespace
+
+TEST(RDFBulkRead, ColumnReader)
+{
+   FileRAII file("dataframe_bulkread_reader.root");
+   MakeFlatTree(file.fPath, 1000);
+
+   TFile f(file.fPath.c_str());
+   auto t = f.Get<TTree>("t");
+   TTreeReader r(t);
+   ROOT::Internal::RDF::RTreeBulkColumnReader<float> x(r, "x");
+   ROOT::Internal::RDF::RTreeBulkColumnReader<ULong64_t> u(r, "u");
+   const auto nBulkBaskets = RTreeBulkColumnReaderBase::GetNBulkBaskets();
+   // Start in the middle of a basket
+   r.SetEntriesRange(17, 1000);
+   while (r.Next()) {
+      const auto entry = r.GetCurrentEntry();
+      EXPECT_FLOAT_EQ(0.5f * entry, x.Get<float>(entry));
+      EXPECT_EQ(1000000000000ull + entry, u.Get<ULong64_t>(entry));
+   }
+   EXPECT_EQ(TTreeReader::kEntryBeyondEnd, r.GetEntryStatus());
+   // Every basket of both branches is read exactly once, none through the TTreeReaderValue fallback
+   EXPECT_EQ(NBaskets(t->GetBranch("x"), 17) + NBaskets(t->GetBranch("u"), 17),
+             RTreeBulkColumnReaderBase::GetNBulkBaskets() - nBulkBaskets);
+}
+
+TEST(RDFBulkRead, FlatTree)
+{
+   TestFlatTree(false);
+}
+
+TEST(RDFBulkRead, Chain)
+{
+   TestChain(false);
+}
+
+TEST(RDFBulkRead, Range)
+{
+   FileRAII file("dataframe_bulkread_range.root");
+   MakeFlatTree(file.fPath, 1000);
+
+   ROOT::RDataFrame df("t", file.fPath);
+   CheckColumns(df.Range(101, 733), Iota(101, 733));
+   CheckColumns(df.Filter([](int i) { return i % 50 == 7; }, {"i"}),
+                {7, 57, 107, 157, 207, 257, 307, 357, 407, 457, 507, 557, 607, 657, 707, 757, 807, 857, 907, 957});
+}
+
+TEST(RDFBulkRead, EntryList)
+{
+   FileRAII file("dataframe_bulkread_entrylist.root");
+   MakeFlatTree(file.fPath, 1000);
+
+   TFile f(file.fPath.c_str());
+   auto t = f.Get<TTree>("t");
+   TEntryList elist("e", "e");
+   t->SetEntryList(&elist);
+   for (auto e : {3, 4, 250, 251, 999})
+      elist.Enter(e);
+   CheckColumns(ROOT::RDataFrame(*t), {3, 4, 250, 251, 999});
+}
+
+TEST(RDFBulkRead, Friend)
+{
+   FileRAII mainFile("dataframe_bulkread_main.root");
+   FileRAII friendFile("dataframe_bulkread_friend.root");
+   MakeFlatTree(mainFile.fPath, 300);
+   {
+      TFile f(friendFile.fPath.c_str(), "RECREATE");
+      TTree t("f", "f");
+      int y = 0;
+      t.Branch("y", &y, "y/I", 100);
+      for (y = 0; y < 300; ++y)
+         t.Fill();
+      t.Write();
+   }
+
+   TChain c("t");
+   c.Add(mainFile.fPath.c_str());
+   TChain fc("f");
+   fc.Add(friendFile.fPath.c_str());
+   c.AddFriend(&fc);
+
+   // Friend branches are read through TTreeReaderValues, main tree branches in bulk
+   ROOT::RDataFrame df(c);
+   auto nBad = df.Filter([](int i, int y, int fy) { return i != y || y != fy; }, {"i", "y", "f.y"}).Count();
+   EXPECT_EQ(0ull, *nBad);
+   EXPECT_EQ(300ull, *df.Count());
+}
+
+#ifdef R__USE_IMT
+TEST(RDFBulkRead, FlatTreeMT)
+{
+   TestFlatTree(true);
+}
+
+TEST(RDFBulkRead, ChainMT)
+{
+   TestChain(true);
+}
+#endif
@@ -1,13 +1,19 @@
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDF/RColumnCache.hxx"
 #include "ROOT/TSeq.hxx"
 #include "ROOT/RTrivialDS.hxx"
+#include "RConfigure.h" // R__HAS_ROOT7
 #include "TH1F.h"
 #include "TRandom.h"
+#include "TROOT.h"
 #include "TSystem.h"
 
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
 
 using namespace ROOT::RDF;
 using namespace ROOT::VecOps;
@@ -336,3 +342,222 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+namespace {
+
+using CacheRow_t = std::tuple<int, double, ROOT::RVecF, bool, std::string>;
+
+ROOT::RDF::RNode DefineCacheColumns(ROOT::RDF::RNode df)
+{
+   return df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+      .Define("y", [](ULong64_t e) { return e * 0.5; }, {"rdfentry_"})
+      .Define("v", [](ULong64_t e) { return ROOT::RVecF(e % 4, e); }, {"rdfentry_"})
+      .Define("b", [](ULong64_t e) { return e % 3 == 0; }, {"rdfentry_"})
+      .Define("s", [](ULong64_t e) { return std::to_string(e); }, {"rdfentry_"});
+}
+
+// Returns the cached rows sorted by x, as multi-thread caches do not preserve the order of the entries
+std::vector<CacheRow_t> GetCacheRows(ROOT::RDF::RNode cached)
+{
+   auto x = cached.Take<int>("x");
+   auto y = cached.Take<double>("y");
+   auto v = cached.Take<ROOT::RVecF>("v");
+   auto b = cached.Take<bool>("b");
+   auto s = cached.Take<std::string>("s");
+   std::vector<CacheRow_t> rows;
+   for (std::size_t i = 0; i < x->size(); ++i)
+      rows.emplace_back((*x)[i], (*y)[i], (*v)[i], (*b)[i], (*s)[i]);
+   std::sort(rows.begin(), rows.end(),
+             [](const CacheRow_t &r1, const CacheRow_t &r2) { return std::get<0>(r1) < std::get<0>(r2); });
+   return rows;
+}
+
+void CheckCacheRows(const std::vector<CacheRow_t> &rows, int nEntries)
+{
+   ASSERT_EQ(std::size_t(nEntries), rows.size());
+   for (int e = 0; e < nEntries; ++e) {
+      EXPECT_EQ(e, std::get<0>(rows[e]));
+      EXPECT_DOUBLE_EQ(e * 0.5, std::get<1>(rows[e]));
+      EXPECT_TRUE(ROOT::VecOps::All(std::get<2>(rows[e]) == ROOT::RVecF(e % 4, e)));
+      EXPECT_EQ(e % 3 == 0, std::get<3>(rows[e]));
+      EXPECT_EQ(std::to_string(e), std::get<4>(rows[e]));
+   }
+}
+
+unsigned int CountSpillFiles(const std::string &dir)
+{
+   unsigned int nFiles = 0;
+   void *dirp = gSystem->OpenDirectory(dir.c_str());
+   if (!dirp)
+      return 0;
+   while (const char *entry = gSystem->GetDirEntry(dirp)) {
+      if (std::string(entry).rfind("rdf_cache_", 0) == 0)
+         ++nFiles;
+   }
+   gSystem->FreeDirectory(dirp);
+   return nFiles;
+}
+
+struct DirRAII {
+   std::string fPath;
+   explicit DirRAII(const std::string &path) : fPath(path) { gSystem->mkdir(fPath.c_str()); }
+   ~DirRAII() { gSystem->Unlink(fPath.c_str()); }
+};
+
+class RMTRAII {
+   bool fIsMT;
+
+public:
+   RMTRAII(bool isMT) : fIsMT(isMT)
+   {
+      if (fIsMT)
+         ROOT::EnableImplicitMT(4);
+   }
+   ~RMTRAII()
+   {
+      if (fIsMT)
+         ROOT::DisableImplicitMT();
+   }
+};
+
+const std::vector<std::string> gCacheColumns{"x", "y", "v", "b", "s"};
+
+void TestCompressedCache(bool isMT)
+{
+   RMTRAII gomt(isMT);
+   ROOT::RDF::RCacheOptions opts;
+   opts.fChunkSize = 7;
+   auto cached = DefineCacheColumns(ROOT::RDataFrame(1000))
+                    .Cache<int, double, ROOT::RVecF, bool, std::string>(gCacheColumns, opts);
+   CheckCacheRows(GetCacheRows(cached), 1000);
+   // a second event loop reads the same chunks again
+   CheckCacheRows(GetCacheRows(cached), 1000);
+   EXPECT_EQ(1000ull, *cached.Count());
+}
+
+// Chunks of compressible values take less memory than their packed size, and they are restored when loaded
+void CheckCompressedMemoryUsage()
+{
+   using Cache_t = ROOT::Internal::RDF::RColumnCache<int, double, ROOT::RVecF, bool>;
+   using ROOT::Internal::RDF::RColumnCachePacker;
+   Cache_t cache(ROOT::RDF::RCacheOptions(), 1);
+   Cache_t::Buffers_t values;
+   for (int i = 0; i < 1000; ++i) {
+      std::get<0>(values).emplace_back(i);
+      std::get<1>(values).emplace_back(i * 0.5);
+      std::get<2>(values).emplace_back(ROOT::RVecF(i % 4, i));
+      std::get<3>(values).emplace_back(i % 3 == 0);
+   }
+   const auto packedSize = RColumnCachePacker<int>::GetPackedSize(std::get<0>(values)) +
+                           RColumnCachePacker<double>::GetPackedSize(std::get<1>(values)) +
+                           RColumnCachePacker<ROOT::RVecF>::GetPackedSize(std::get<2>(values)) +
+                           RColumnCachePacker<bool>::GetPackedSize(std::get<3>(values));
+   cache.AddChunk(0, values);
+   EXPECT_GT(cache.GetMemoryUsage(), 0u);
+   EXPECT_LT(cache.GetMemoryUsage(), packedSize);
+
+   ASSERT_EQ(1u, cache.GetChunks(0).size());
+   ROOT::Internal::RDF::RColumnCacheReader reader;
+   Cache_t::Buffers_t buffers;
+   Cache_t::ValuePtrs_t chunkValues;
+   cache.LoadChunk(0, 0, reader, buffers, chunkValues);
+   for (int i = 0; i < 1000; ++i) {
+      EXPECT_EQ(i, std::get<0>(chunkValues)[i]);
+      EXPECT_DOUBLE_EQ(i * 0.5, std::get<1>(chunkValues)[i]);
+      EXPECT_TRUE(ROOT::VecOps::All(std::get<2>(chunkValues)[i] == ROOT::RVecF(i % 4, i)));
+      EXPECT_EQ(i % 3 == 0, std::get<3>(chunkValues)[i]);
+   }
+}
+
+void TestSpillingCache(bool isMT)
+{
+   DirRAII dir("dataframe_cache_spill");
+   RMTRAII gomt(isMT);
+   ROOT::RDF::RCacheOptions opts;
+   opts.fChunkSize = 50;
+   opts.fMemoryBudget = 1000;
+   opts.fSpillDirectory = dir.fPath;
+   {
+      auto cached = DefineCacheColumns(ROOT::RDataFrame(1000))
+                       .Cache<int, double, ROOT::RVecF, bool, std::string>(gCacheColumns, opts);
+      CheckCacheRows(GetCacheRows(cached), 1000);
+      EXPECT_LE(1u, CountSpillFiles(dir.fPath));
+      CheckCacheRows(GetCacheRows(cached), 1000);
+   }
+   // the temporary files live as long as the cached data frame
+   EXPECT_EQ(0u, CountSpillFiles(dir.fPath));
+}
+
+} // anonymous namespace
+
+TEST(Cache, CompressedInMemory)
+{
+   TestCompressedCache(false);
+   CheckCompressedMemoryUsage();
+}
+
+TEST(Cache, Uncompressed)
+{
+   ROOT::RDF::RCacheOptions opts;
+   opts.fCompressionLevel = 0;
+   opts.fChunkSize = 64;
+   auto cached = DefineCacheColumns(ROOT::RDataFrame(100))
+                    .Cache<int, double, ROOT::RVecF, bool, std::string>(gCacheColumns, opts);
+   CheckCacheRows(GetCacheRows(cached), 100);
+}
+
+TEST(Cache, JittedWithOptions)
+{
+   ROOT::RDF::RCacheOptions opts;
+   opts.fChunkSize = 3;
+   auto cached = ROOT::RDataFrame(10).Define("x", "int(rdfentry_)").Filter("x % 2 == 0").Cache({"x"}, opts);
+   EXPECT_EQ(std::vector<int>({0, 2, 4, 6, 8}), *cached.Take<int>("x"));
+}
+
+TEST(Cache, InvalidChunkSize)
+{
+   ROOT::RDF::RCacheOptions opts;
+   opts.fChunkSize = 0;
+   ROOT::RDataFrame df(1);
+   EXPECT_THROW(df.Cache<ULong64_t>({"rdfentry_"}, opts), std::invalid_argument);
+}
+
+#ifdef R__HAS_ROOT7
+TEST(Cache, Spill)
+{
+   TestSpillingCache(false);
+}
+
+TEST(Cache, SpillLongStrings)
+{
+   DirRAII dir("dataframe_cache_spill_strings");
+   ROOT::RDF::RCacheOptions opts;
+   opts.fChunkSize = 10;
+   // the string objects fit in the budget, their characters do not
+   opts.fMemoryBudget = 100 * 2 * sizeof(std::string);
+   opts.fSpillDirectory = dir.fPath;
+   auto cached = ROOT::RDataFrame(100)
+                    .Define("s", [](ULong64_t e) { return std::string(1000, 'a' + e % 26); }, {"rdfentry_"})
+                    .Cache<std::string>({"s"}, opts);
+   EXPECT_EQ(100ull, *cached.Count());
+   EXPECT_LE(1u, CountSpillFiles(dir.fPath));
+   const auto strings = *cached.Take<std::string>("s");
+   ASSERT_EQ(100u, strings.size());
+   for (auto i = 0u; i < 100u; ++i)
+      EXPECT_EQ(std::string(1000, 'a' + i % 26), strings[i]);
+}
+#endif
+
+#ifdef R__USE_IMT
+TEST(Cache, CompressedInMemoryMT)
+{
+   TestCompressedCache(true);
+}
+
+#ifdef R__HAS_ROOT7
+TEST(Cache, SpillMT)
+{
+   TestSpillingCache(true);
+}
+#endif
+#endif
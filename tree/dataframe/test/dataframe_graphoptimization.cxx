@@ -0,0 +1,222 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RVec.hxx"
+#include "TInterpreter.h"
+#include "TROOT.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+
+using ROOT::RDF::Experimental::VariationsFor;
+using ROOT::RVecD;
+
+namespace {
+
+std::atomic<int> gNDefineCalls{0};
+std::atomic<int> gNFilterCalls{0};
+
+class RGraphOptimizationRAII {
+public:
+   RGraphOptimizationRAII()
+   {
+      ROOT::RDF::Experimental::EnableGraphOptimization();
+      gNDefineCalls = 0;
+      gNFilterCalls = 0;
+   }
+   ~RGraphOptimizationRAII() { ROOT::RDF::Experimental::DisableGraphOptimization(); }
+};
+
+class RMTRAII {
+   bool fIsMT;
+
+public:
+   RMTRAII(bool isMT) : fIsMT(isMT)
+   {
+      if (fIsMT)
+         ROOT::EnableImplicitMT(4);
+   }
+   ~RMTRAII()
+   {
+      if (fIsMT)
+         ROOT::DisableImplicitMT();
+   }
+};
+
+// Each call books the same (stateless) lambdas: the nodes of different branches are equivalent
+ROOT::RDF::RNode BookBranch(ROOT::RDF::RNode df, const std::string &inputCol)
+{
+   return df
+      .Define("y",
+              [](double x) {
+                 ++gNDefineCalls;
+                 return 2. * x;
+              },
+              {inputCol})
+      .Filter(
+         [](double y) {
+            ++gNFilterCalls;
+            return y > 10.;
+         },
+         {"y"});
+}
+
+void TestDuplicateNodes(bool isMT)
+{
+   RMTRAII gomt(isMT);
+   RGraphOptimizationRAII opt;
+
+   auto df = ROOT::RDataFrame(100).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto sum1 = BookBranch(df, "x").Sum<double>("y");
+   auto sum2 = BookBranch(df, "x").Sum<double>("y");
+   auto count = BookBranch(df, "x").Count();
+
+   const double expected = 2. * (99. * 100. / 2. - 5. * 6. / 2.);
+   EXPECT_DOUBLE_EQ(expected, *sum1);
+   EXPECT_DOUBLE_EQ(expected, *sum2);
+   EXPECT_EQ(94ull, *count);
+   EXPECT_EQ(100, gNDefineCalls);
+   EXPECT_EQ(100, gNFilterCalls);
+}
+
+} // anonymous namespace
+
+TEST(RDFGraphOptimization, DuplicateNodes)
+{
+   TestDuplicateNodes(false);
+}
+
+TEST(RDFGraphOptimization, Disabled)
+{
+   ROOT::RDF::Experimental::DisableGraphOptimization();
+   gNDefineCalls = 0;
+   gNFilterCalls = 0;
+
+   auto df = ROOT::RDataFrame(100).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto sum1 = BookBranch(df, "x").Sum<double>("y");
+   auto sum2 = BookBranch(df, "x").Sum<double>("y");
+   EXPECT_DOUBLE_EQ(*sum1, *sum2);
+   EXPECT_EQ(200, gNDefineCalls);
+   EXPECT_EQ(200, gNFilterCalls);
+}
+
+TEST(RDFGraphOptimization, DifferentInputs)
+{
+   RGraphOptimizationRAII opt;
+
+   auto df = ROOT::RDataFrame(100)
+                .Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                .Define("z", [](ULong64_t e) { return double(e) + 1.; }, {"rdfentry_"});
+   auto sumX = BookBranch(df, "x").Sum<double>("y");
+   auto sumZ = BookBranch(df, "z").Sum<double>("y");
+
+   EXPECT_DOUBLE_EQ(2. * (99. * 100. / 2. - 5. * 6. / 2.), *sumX);
+   EXPECT_DOUBLE_EQ(2. * (100. * 101. / 2. - 5. * 6. / 2.), *sumZ);
+   EXPECT_EQ(200, gNDefineCalls);
+   EXPECT_EQ(200, gNFilterCalls);
+}
+
+// Callables with a state can not be compared, they are always evaluated
+TEST(RDFGraphOptimization, StatefulCallables)
+{
+   RGraphOptimizationRAII opt;
+
+   int nCalls = 0;
+   auto countingDefine = [&nCalls](ULong64_t e) {
+      ++nCalls;
+      return double(e);
+   };
+   ROOT::RDataFrame df(10);
+   auto sum1 = df.Define("x", countingDefine, {"rdfentry_"}).Sum<double>("x");
+   auto sum2 = df.Define("x", countingDefine, {"rdfentry_"}).Sum<double>("x");
+   EXPECT_DOUBLE_EQ(45., *sum1);
+   EXPECT_DOUBLE_EQ(45., *sum2);
+   EXPECT_EQ(20, nCalls);
+}
+
+TEST(RDFGraphOptimization, JittedDuplicates)
+{
+   RGraphOptimizationRAII opt;
+   gInterpreter->Declare("int gRDFGraphOptimizationNCalls = 0;");
+
+   ROOT::RDataFrame df(100);
+   auto branch = [&] {
+      return df.Define("y", "++gRDFGraphOptimizationNCalls; return rdfentry_ * 2.;").Filter("y > 10").Filter("y < 100");
+   };
+   auto count1 = branch().Count();
+   auto count2 = branch().Count();
+   auto max = branch().Max<double>("y");
+
+   EXPECT_EQ(44ull, *count1);
+   EXPECT_EQ(44ull, *count2);
+   EXPECT_DOUBLE_EQ(98., *max);
+   EXPECT_EQ(100l, gInterpreter->Calc("gRDFGraphOptimizationNCalls"));
+}
+
+// The named filters keep their own cut-flow counts
+TEST(RDFGraphOptimization, NamedFilters)
+{
+   RGraphOptimizationRAII opt;
+
+   ROOT::RDataFrame df(10);
+   auto isEven = [](ULong64_t e) { return e % 2 == 0; };
+   auto f1 = df.Filter(isEven, {"rdfentry_"}, "even1");
+   auto f2 = df.Filter(isEven, {"rdfentry_"});
+   auto f3 = df.Filter(isEven, {"rdfentry_"}, "even2");
+   auto c1 = f1.Count();
+   auto c2 = f2.Count();
+   auto c3 = f3.Count();
+   auto report = df.Report();
+
+   EXPECT_EQ(5ull, *c1);
+   EXPECT_EQ(5ull, *c2);
+   EXPECT_EQ(5ull, *c3);
+   EXPECT_EQ(5ull, report->At("even1").GetPass());
+   EXPECT_EQ(10ull, report->At("even1").GetAll());
+   EXPECT_EQ(5ull, report->At("even2").GetPass());
+   EXPECT_EQ(10ull, report->At("even2").GetAll());
+}
+
+// Defines nobody reads are not initialized: here the initialization of "y" would throw because of the type mismatch
+TEST(RDFGraphOptimization, UnreadDefines)
+{
+   auto book = [] {
+      return ROOT::RDataFrame(10)
+         .Define("x", [] { return 1; })
+         .Define("y", [](float x) { return x; }, {"x"})
+         .Count();
+   };
+
+   auto count = book();
+   EXPECT_THROW(*count, std::runtime_error);
+
+   RGraphOptimizationRAII opt;
+   auto optimizedCount = book();
+   EXPECT_EQ(10ull, *optimizedCount);
+}
+
+TEST(RDFGraphOptimization, Vary)
+{
+   RGraphOptimizationRAII opt;
+
+   auto df = ROOT::RDataFrame(100)
+                .Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                .Vary("x", [](double x) { return RVecD{x - 1., x + 1.}; }, {"x"}, 2);
+   auto sum1 = VariationsFor(BookBranch(df, "x").Sum<double>("y"));
+   auto sum2 = VariationsFor(BookBranch(df, "x").Sum<double>("y"));
+
+   for (auto *sums : {&sum1, &sum2}) {
+      EXPECT_DOUBLE_EQ(2. * (99. * 100. / 2. - 5. * 6. / 2.), (*sums)["nominal"]);
+      EXPECT_DOUBLE_EQ(2. * (98. * 99. / 2. - 5. * 6. / 2.), (*sums)["x:0"]);
+      EXPECT_DOUBLE_EQ(2. * (100. * 101. / 2. - 5. * 6. / 2.), (*sums)["x:1"]);
+   }
+   // one evaluation per entry and per variation
+   EXPECT_EQ(300, gNDefineCalls);
+}
+
+#ifdef R__USE_IMT
+TEST(RDFGraphOptimization, DuplicateNodesMT)
+{
+   TestDuplicateNodes(true);
+}
+#endif
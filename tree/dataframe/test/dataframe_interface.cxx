@@ -3,6 +3,9 @@
 
 #include "ROOT/RCsvDS.hxx"
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RDF/Utils.hxx" // RDFLogChannel
+#include "ROOT/RLogger.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RTrivialDS.hxx"
 #include "TMemFile.h"
@@ -877,3 +880,86 @@ TEST(RDataFrameUtils, RegexWithFriendsInJittedFilters)
    EXPECT_EQ(df.Filter("fr.x < 0 && x > 0").Count().GetValue(), 1);
    EXPECT_EQ(df.Filter("x > 0 && fr.x < 0").Count().GetValue(), 1);
 }
+
+namespace {
+/// Collects the messages that RDataFrame logs when it runs jitted code from a library of the jit cache
+class RJitCacheLogRAII {
+   class RHandler : public ROOT::Experimental::RLogHandler {
+      std::vector<std::string> &fMessages;
+
+   public:
+      RHandler(std::vector<std::string> &messages) : fMessages(messages) {}
+      bool Emit(const ROOT::Experimental::RLogEntry &entry) override
+      {
+         if (entry.fMessage.find("Running the jitted code from") != std::string::npos)
+            fMessages.emplace_back(entry.fMessage);
+         return true;
+      }
+   };
+
+   ROOT::Experimental::RLogScopedVerbosity fVerbosity{ROOT::Detail::RDF::RDFLogChannel(),
+                                                      ROOT::Experimental::ELogLevel::kInfo};
+   RHandler *fHandler;
+
+public:
+   std::vector<std::string> fMessages;
+
+   RJitCacheLogRAII()
+   {
+      auto handler = std::make_unique<RHandler>(fMessages);
+      fHandler = handler.get();
+      ROOT::Experimental::RLogManager::Get().PushFront(std::move(handler));
+   }
+   ~RJitCacheLogRAII() { ROOT::Experimental::RLogManager::Get().Remove(fHandler); }
+};
+} // anonymous namespace
+
+TEST(RDataFrameInterface, JitCache)
+{
+   if (gSystem->AccessPathName(gSystem->GetBuildCompiler()))
+      GTEST_SKIP() << "the compiler " << gSystem->GetBuildCompiler() << " is not available";
+
+   const std::string cacheDir = "dataframe_interface_jitcache";
+   ROOT::RDF::Experimental::EnableJitCache(cacheDir);
+
+   auto run = [] {
+      ROOT::RDataFrame df(10);
+      auto d = df.Define("x", "rdfentry_ * 2.").Filter("x > 5", "cut");
+      return std::make_pair(*d.Sum<double>("x"), *d.Histo1D({"h", "h", 10, 0, 20}, "x"));
+   };
+   const auto first = run();
+
+   // exactly one entry was added to the cache, the compiled library
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   ASSERT_NE(nullptr, dir);
+   std::vector<std::string> entries;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      if (std::string(entry) != "." && std::string(entry) != "..")
+         entries.emplace_back(entry);
+   }
+   gSystem->FreeDirectory(dir);
+   ASSERT_EQ(1u, entries.size());
+   const std::string libName = entries[0];
+   const auto libPath = cacheDir + "/" + libName;
+   ASSERT_EQ("." + std::string(gSystem->GetSoExt()), libName.substr(libName.rfind('.')))
+      << "the jitted code could not be compiled, see " << libPath;
+   FileStat_t libStat;
+   ASSERT_EQ(0, gSystem->GetPathInfo(libPath.c_str(), libStat));
+
+   // the second run of the same graph runs the code from the library in the cache, without compiling it again
+   RJitCacheLogRAII log;
+   const auto second = run();
+   EXPECT_DOUBLE_EQ(first.first, second.first);
+   EXPECT_DOUBLE_EQ(84., second.first);
+   EXPECT_EQ(first.second.GetEntries(), second.second.GetEntries());
+   ASSERT_EQ(1u, log.fMessages.size());
+   EXPECT_NE(std::string::npos, log.fMessages[0].find(libPath));
+   EXPECT_NE(std::string::npos, std::string(gSystem->GetLibraries()).find(libName));
+   FileStat_t libStatAfter;
+   ASSERT_EQ(0, gSystem->GetPathInfo(libPath.c_str(), libStatAfter));
+   EXPECT_EQ(libStat.fMtime, libStatAfter.fMtime);
+
+   ROOT::RDF::Experimental::DisableJitCache();
+   gSystem->Unlink(libPath.c_str());
+   gSystem->Unlink(cacheDir.c_str());
+}
@@ -1,4 +1,5 @@
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDF/RJitCache.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "TTree.h"
 
@@ -232,3 +233,24 @@ TEST(RDataFrameUtils, TypeName2TypeID)
    // TODO(jblomer): Ideally, we would want the next one not to throw an exception
    EXPECT_THROW(RDFInt::TypeName2TypeID("std::vector<std::vector<float>>"), std::runtime_error);
 }
+
+TEST(RDataFrameUtils, NormalizeJitCode)
+{
+   const std::string code =
+      "ROOT::Internal::RDF::JitFilterHelper(R_rdf::func12, new const char*[1]{\"x\"}, 1, \"cut (0x10) R_rdf::func3\", "
+      "reinterpret_cast<A*>(0x7ffd12), reinterpret_cast<B*>(0xab));\n"
+      "ROOT::Internal::RDF::JitDefineHelper(R_rdf::func3, reinterpret_cast<C*>(0x7ffd12));\n"
+      "ROOT::Internal::RDF::JitDefineHelper(R_rdf::func12, nullptr);";
+   const auto normalized = RDFInt::NormalizeJitCode(code);
+
+   const std::string expected =
+      "ROOT::Internal::RDF::JitFilterHelper(R_rdf::func0, new const char*[1]{\"x\"}, 1, \"cut (0x10) R_rdf::func3\", "
+      "reinterpret_cast<A*>(rdf_jit_args[0]), reinterpret_cast<B*>(rdf_jit_args[1]));\n"
+      "ROOT::Internal::RDF::JitDefineHelper(R_rdf::func1, reinterpret_cast<C*>(rdf_jit_args[2]));\n"
+      "ROOT::Internal::RDF::JitDefineHelper(R_rdf::func0, nullptr);";
+   EXPECT_EQ(expected, normalized.fCode);
+   EXPECT_EQ(std::vector<void *>({reinterpret_cast<void *>(0x7ffd12), reinterpret_cast<void *>(0xab),
+                                  reinterpret_cast<void *>(0x7ffd12)}),
+             normalized.fArgs);
+   EXPECT_EQ(std::vector<std::string>({"R_rdf::func12", "R_rdf::func3"}), normalized.fFuncNames);
+}
@@ -8,9 +8,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdio>
+
 using ROOT::Experimental::RNTupleDS;
+using ROOT::Experimental::RNTupleWriteOptions;
 using ROOT::Experimental::RNTupleWriter;
 using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RNTupleReader;
 using ROOT::Experimental::Detail::RPageSource;
 
 class RNTupleDSTest : public ::testing::Test {
@@ -135,3 +140,190 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+static void WriteChainMember(const std::string &ntplName, const std::string &fileName, int firstValue, int nEntries)
+{
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrJets = model->MakeField<std::vector<float>>("jets");
+   RNTupleWriteOptions options;
+   options.SetApproxZippedClusterSize(64);
+   auto ntuple = RNTupleWriter::Recreate(std::move(model), ntplName, fileName, options);
+   for (int i = 0; i < nEntries; ++i) {
+      *wrPt = firstValue + i;
+      *wrJets = std::vector<float>(i % 3, 1.f);
+      ntuple->Fill();
+   }
+}
+
+static void ChainTest(const std::string &ntplName, const std::vector<std::string> &fileNames)
+{
+   auto df = ROOT::RDF::Experimental::FromRNTuple(ntplName, fileNames);
+   auto count = df.Count();
+   auto sumpt = df.Sum<float>("pt");
+   auto sumnjets = df.Sum<std::size_t>("R_rdf_sizeof_jets");
+   auto pts = df.Take<float>("pt");
+   // Chain-wide entry numbers are mapped to the right file, also when a slot moves on to another file of a batch
+   auto nMismatch = df.Filter([](float pt, ULong64_t entry) { return pt != entry; }, {"pt", "rdfentry_"}).Count();
+
+   EXPECT_EQ(60ull, count.GetValue());
+   // pt runs from 0 to 59
+   EXPECT_DOUBLE_EQ(1770., sumpt.GetValue());
+   EXPECT_EQ(58u, sumnjets.GetValue());
+   auto sortedPts = pts.GetValue();
+   std::sort(sortedPts.begin(), sortedPts.end());
+   for (int i = 0; i < 60; ++i)
+      EXPECT_FLOAT_EQ(i, sortedPts[i]);
+   EXPECT_EQ(0ull, nMismatch.GetValue());
+
+   // A second event loop starts again from the first file
+   EXPECT_EQ(60ull, *df.Count());
+   EXPECT_DOUBLE_EQ(1770., *df.Sum<float>("pt"));
+}
+
+TEST_F(RNTupleDSTest, Chain)
+{
+   // More files than fit in a single batch
+   std::vector<std::string> fileNames{"RNTupleDS_test_chain_1.root", "RNTupleDS_test_chain_2.root",
+                                      "RNTupleDS_test_chain_3.root", "RNTupleDS_test_chain_4.root",
+                                      "RNTupleDS_test_chain_5.root", "RNTupleDS_test_chain_6.root"};
+   WriteChainMember(fNtplName, fileNames[0], 0, 20);
+   WriteChainMember(fNtplName, fileNames[1], 20, 0);
+   WriteChainMember(fNtplName, fileNames[2], 20, 15);
+   WriteChainMember(fNtplName, fileNames[3], 35, 15);
+   WriteChainMember(fNtplName, fileNames[4], 50, 3);
+   WriteChainMember(fNtplName, fileNames[5], 53, 7);
+
+   ChainTest(fNtplName, fileNames);
+   {
+      IMTRAII _;
+      ChainTest(fNtplName, fileNames);
+   }
+
+   for (const auto &f : fileNames)
+      std::remove(f.c_str());
+}
+
+TEST_F(RNTupleDSTest, ChainBatches)
+{
+   std::vector<std::string> fileNames;
+   for (int i = 0; i < 6; ++i) {
+      fileNames.emplace_back("RNTupleDS_test_chain_batches_" + std::to_string(i) + ".root");
+      WriteChainMember(fNtplName, fileNames.back(), 10 * i, 10);
+   }
+
+   RNTupleDS ds(fNtplName, fileNames);
+   ds.SetNSlots(2);
+   ds.Initialize();
+
+   // The first batch hands out two ranges for each of the first four files
+   auto ranges = ds.GetEntryRanges();
+   std::sort(ranges.begin(), ranges.end());
+   std::vector<std::pair<ULong64_t, ULong64_t>> expected;
+   for (ULong64_t first = 0; first < 40; first += 5)
+      expected.emplace_back(first, first + 5);
+   EXPECT_EQ(expected, ranges);
+
+   ranges = ds.GetEntryRanges();
+   std::sort(ranges.begin(), ranges.end());
+   expected.clear();
+   for (ULong64_t first = 40; first < 60; first += 5)
+      expected.emplace_back(first, first + 5);
+   EXPECT_EQ(expected, ranges);
+
+   EXPECT_TRUE(ds.GetEntryRanges().empty());
+   ds.Finalize();
+
+   for (const auto &f : fileNames)
+      std::remove(f.c_str());
+}
+
+TEST_F(RNTupleDSTest, ChainSchemaMismatch)
+{
+   std::string otherFileName = "RNTupleDS_test_chain_mismatch.root";
+   WriteChainMember(fNtplName, otherFileName, 0, 1);
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple(fNtplName, {fFileName, otherFileName});
+   EXPECT_THROW(*df.Count(), std::runtime_error);
+
+   std::remove(otherFileName.c_str());
+}
+
+static void SnapshotTest(const std::string &ntplName, const std::string &fileName, bool jitted)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto df = ROOT::RDataFrame(100)
+                .Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+                .Define("entry", [](ULong64_t e) { return e; }, {"rdfentry_"})
+                .Define("vec", [](ULong64_t e) { return ROOT::RVecF(e % 4, 1.f); }, {"rdfentry_"});
+   const std::vector<std::string> columns{"x", "entry", "vec"};
+   auto snap = jitted ? df.Snapshot(ntplName, fileName, columns, opts)
+                      : df.Snapshot<float, ULong64_t, ROOT::RVecF>(ntplName, fileName, columns, opts);
+
+   EXPECT_EQ(100ull, *snap->Count());
+   EXPECT_DOUBLE_EQ(4950., *snap->Sum<float>("x"));
+   EXPECT_EQ(4950u, *snap->Sum<std::uint64_t>("entry"));
+   EXPECT_EQ(150u, *snap->Sum<std::size_t>("R_rdf_sizeof_vec"));
+   // Also in multi-thread runs, the values of an entry stay together
+   auto nMismatch = snap->Filter([](float x, std::uint64_t e, const ROOT::RVecF &v) {
+                            return (x != e) || (v.size() != e % 4);
+                         },
+                         {"x", "entry", "vec"})
+                       .Count();
+   EXPECT_EQ(0ull, *nMismatch);
+
+   auto reader = RNTupleReader::Open(ntplName, fileName);
+   EXPECT_EQ(100u, reader->GetNEntries());
+   EXPECT_EQ("std::uint64_t", reader->GetModel()->GetField("entry")->GetType());
+}
+
+TEST(RNTupleDSSnapshot, Basics)
+{
+   const std::string fileName = "RNTupleDS_test_snapshot.root";
+   SnapshotTest("ntuple", fileName, /*jitted=*/false);
+   SnapshotTest("ntuple", fileName, /*jitted=*/true);
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDSSnapshot, BasicsMT)
+{
+   IMTRAII _;
+
+   const std::string fileName = "RNTupleDS_test_snapshot_mt.root";
+   SnapshotTest("ntuple", fileName, /*jitted=*/false);
+   SnapshotTest("ntuple", fileName, /*jitted=*/true);
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDSSnapshot, SubDirectory)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto df = ROOT::RDataFrame(1).Define("x", [] { return 1; });
+   EXPECT_THROW(df.Snapshot<int>("dir/ntuple", "RNTupleDS_test_snapshot_dir.root", {"x"}, opts),
+                std::invalid_argument);
+}
+
+TEST(RNTupleDSSnapshot, Update)
+{
+   const std::string fileName = "RNTupleDS_test_snapshot_update.root";
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   ROOT::RDataFrame(10).Define("x", [] { return 1; }).Snapshot<int>("ntuple", fileName, {"x"}, opts);
+
+   opts.fMode = "UPDATE";
+   auto df = ROOT::RDataFrame(20).Define("x", [] { return 2; });
+   EXPECT_THROW(df.Snapshot<int>("ntuple", fileName, {"x"}, opts), std::invalid_argument);
+   // Other objects in the file are left untouched
+   df.Snapshot<int>("other", fileName, {"x"}, opts);
+   EXPECT_EQ(10u, RNTupleReader::Open("ntuple", fileName)->GetNEntries());
+
+   opts.fOverwriteIfExists = true;
+   auto snap = df.Snapshot<int>("ntuple", fileName, {"x"}, opts);
+   EXPECT_EQ(20ull, *snap->Count());
+   EXPECT_EQ(40, *snap->Sum<int>("x"));
+   EXPECT_EQ(20u, RNTupleReader::Open("other", fileName)->GetNEntries());
+
+   std::remove(fileName.c_str());
+}
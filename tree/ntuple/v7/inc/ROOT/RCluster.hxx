@@ -117,7 +117,7 @@ public:
    virtual ~ROnDiskPageMap();
 
    /// Inserts information about a page stored in fMemory.  Therefore, the address referenced by onDiskPage
-   /// needs to be owned by the page map (see derived classes).  If a page map contains a page of a given column,
+   /// needs to be owned by the page map (see derived classes) or to outlive it, e.g. a memory-mapped file.  If a page map contains a page of a given column,
    /// it is expected that _all_ the pages of that column in that cluster are part of the page map.
    void Register(const ROnDiskPage::Key &key, const ROnDiskPage &onDiskPage) { fOnDiskPages.emplace(key, onDiskPage); }
 };
@@ -143,6 +143,29 @@ public:
    ~ROnDiskPageMapHeap() override;
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::ROnDiskPageMapShared
+\ingroup NTuple
+\brief An ROnDiskPageMap whose memory region is shared with the page maps of other clusters.
+
+Used if the pages of several clusters are read by a single read request into a common buffer.  The buffer is
+released together with the last cluster referencing it.
+*/
+// clang-format on
+class ROnDiskPageMapShared : public ROnDiskPageMap {
+private:
+   /// The memory region containing the on-disk pages of this and other page maps.
+   std::shared_ptr<unsigned char[]> fMemory;
+public:
+   explicit ROnDiskPageMapShared(std::shared_ptr<unsigned char[]> memory) : fMemory(std::move(memory)) {}
+   ROnDiskPageMapShared(const ROnDiskPageMapShared &other) = delete;
+   ROnDiskPageMapShared(ROnDiskPageMapShared &&other) = default;
+   ROnDiskPageMapShared &operator =(const ROnDiskPageMapShared &other) = delete;
+   ROnDiskPageMapShared &operator =(ROnDiskPageMapShared &&other) = default;
+   ~ROnDiskPageMapShared() override;
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::Detail::RCluster
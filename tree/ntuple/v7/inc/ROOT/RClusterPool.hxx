@@ -19,7 +19,11 @@
 #include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -34,6 +38,41 @@ namespace Detail {
 
 class RPageSource;
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RClusterBunchSizeAdapter
+\ingroup NTuple
+\brief Decides on the number of clusters per vector read given the measured I/O and processing times
+
+The adapter is fed once per cluster of a linear access pattern, when the consumer moves on to the next cluster.
+It only takes measured durations, so that the policy does not depend on the clock used to obtain them.
+*/
+// clang-format on
+class RClusterBunchSizeAdapter {
+private:
+   /// The current number of clusters per vector read
+   unsigned int fBunchSize;
+   /// The upper limit for fBunchSize
+   unsigned int fMaxBunchSize;
+   /// The number of consecutive clusters processed without a stall since the last bunch size adjustment
+   unsigned int fNClustersWithoutStall = 0;
+
+public:
+   RClusterBunchSizeAdapter(unsigned int bunchSize, unsigned int maxBunchSize)
+      : fBunchSize(bunchSize), fMaxBunchSize(std::max(bunchSize, maxBunchSize))
+   {
+   }
+
+   /// Adjusts the bunch size after a cluster has been processed. All times are in nanoseconds: `consumeTime` is the
+   /// time the consumer spent outside of the cluster pool with the cluster, `stallTime` is the time it was blocked
+   /// waiting for the cluster to be loaded, and `readTimePerCluster` is the time of the last vector read divided by
+   /// the number of clusters it loaded.
+   void Update(std::uint64_t consumeTime, std::uint64_t stallTime, std::uint64_t readTimePerCluster);
+
+   unsigned int GetBunchSize() const { return fBunchSize; }
+   unsigned int GetMaxBunchSize() const { return fMaxBunchSize; }
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::Detail::RClusterPool
@@ -50,6 +89,13 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+If the maximum cluster bunch size is larger than the initial bunch size, the number of clusters per vector read
+(and thus the number of clusters in flight) is adjusted at runtime. When the consumer moves on to the next cluster,
+the pool compares the time the consumer was blocked waiting for I/O with the time it spent processing the previous
+cluster. If the consumer stalled, the bunch size is doubled, up to the maximum. If the consumer did not stall for
+the last two bunches and reading a cluster is much faster than processing it, the bunch size is decremented.
+The policy is implemented by RClusterBunchSizeAdapter.
 */
 // clang-format on
 class RClusterPool {
@@ -94,8 +140,21 @@ private:
    /// The number of clusters before the currently active cluster that should stay in the pool if present
    /// Reserved for later use.
    unsigned int fWindowPre = 0;
-   /// The number of clusters that are being read in a single vector read.
-   unsigned int fClusterBunchSize;
+   /// Keeps track of the number of clusters that are being read in a single vector read
+   RClusterBunchSizeAdapter fBunchSizeAdapter;
+   /// Set if the maximum bunch size is larger than the initial bunch size given in the constructor
+   bool fIsAdaptive;
+   /// The wall time in nanoseconds of the last vector read divided by the number of clusters it loaded;
+   /// set by the I/O thread
+   std::atomic<std::uint64_t> fReadTimePerCluster{0};
+   /// The cluster that was requested by the last call to GetCluster()
+   DescriptorId_t fLastClusterId = kInvalidDescriptorId;
+   /// The time when the last call to GetCluster() returned
+   std::chrono::steady_clock::time_point fTimeLastReturn;
+   /// Time in nanoseconds the consumer spent outside GetCluster() since it requested fLastClusterId
+   std::uint64_t fConsumeTime = 0;
+   /// Time in nanoseconds the consumer was blocked waiting for fLastClusterId to be loaded
+   std::uint64_t fStallTime = 0;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
@@ -140,10 +199,13 @@ private:
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
    RCluster *WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &physicalColumns);
-
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
-   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize, unsigned int maxClusterBunchSize);
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+      : RClusterPool(pageSource, clusterBunchSize, clusterBunchSize)
+   {
+   }
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
@@ -159,6 +221,9 @@ public:
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
+
+   /// The current number of clusters per vector read
+   unsigned int GetClusterBunchSize() const { return fBunchSizeAdapter.GetBunchSize(); }
 }; // class RClusterPool
 
 } // namespace Detail
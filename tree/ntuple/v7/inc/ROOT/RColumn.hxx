@@ -25,7 +25,11 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace ROOT {
@@ -74,6 +78,9 @@ private:
    ColumnId_t fColumnIdSource = kInvalidColumnId;
    /// Used to pack and unpack pages on writing/reading
    std::unique_ptr<RColumnElementBase> fElement;
+   /// Computes the value range of the in-memory elements of a write page; only set for arithmetic C++ types
+   /// stored with a lossless encoding
+   RColumnStatistics (*fComputeStatistics)(const void *values, std::size_t count) = nullptr;
 
    RColumn(const RColumnModel &model, std::uint32_t index);
 
@@ -99,12 +106,49 @@ private:
       fWritePage[otherIdx].Reset(0);
    }
 
+   template <typename CppT>
+   static RColumnStatistics ComputeStatistics(const void *values, std::size_t count)
+   {
+      auto typedValues = reinterpret_cast<const CppT *>(values);
+      RColumnStatistics stats;
+      if constexpr (std::is_floating_point_v<CppT>) {
+         // Comparisons with NaN are false, so that NaN values never enter the range
+         for (std::size_t i = 0; i < count; ++i) {
+            if (typedValues[i] < stats.fMin)
+               stats.fMin = typedValues[i];
+            if (typedValues[i] > stats.fMax)
+               stats.fMax = typedValues[i];
+         }
+      } else {
+         if (count == 0)
+            return stats;
+         CppT min = typedValues[0];
+         CppT max = typedValues[0];
+         for (std::size_t i = 1; i < count; ++i) {
+            min = std::min(min, typedValues[i]);
+            max = std::max(max, typedValues[i]);
+         }
+         stats.fMin = static_cast<double>(min);
+         stats.fMax = static_cast<double>(max);
+         if constexpr (std::numeric_limits<CppT>::digits > std::numeric_limits<double>::digits) {
+            // The conversion to double may round towards the inside of the range
+            stats.fMin = std::nextafter(stats.fMin, -std::numeric_limits<double>::infinity());
+            stats.fMax = std::nextafter(stats.fMax, std::numeric_limits<double>::infinity());
+         }
+      }
+      return stats;
+   }
+
 public:
    template <typename CppT>
    static std::unique_ptr<RColumn> Create(const RColumnModel &model, std::uint32_t index)
    {
       auto column = std::unique_ptr<RColumn>(new RColumn(model, index));
-      column->fElement = RColumnElementBase::Generate<CppT>(model.GetType());
+      column->fElement = RColumnElementBase::Generate<CppT>(model);
+      if constexpr (std::is_arithmetic_v<CppT>) {
+         if (!RColumnElementBase::IsLossy(model.GetType()))
+            column->fComputeStatistics = &ComputeStatistics<CppT>;
+      }
       return column;
    }
 
@@ -137,13 +181,14 @@ public:
          return;
       }
 
+      const auto nElementsBefore = fWritePage[fWritePageIdx].GetNElements();
       void *dst = fWritePage[fWritePageIdx].GrowUnchecked(count);
 
       // The check for flushing the shadow page is more complicated than for the Append() case
       // because we don't necessarily fill up to exactly fApproxNElementsPerPage / 2 elements;
       // we might instead jump over the 50% fill level
-      if ((fWritePage[fWritePageIdx].GetNElements() < fApproxNElementsPerPage / 2) &&
-          (fWritePage[fWritePageIdx].GetNElements() + count >= fApproxNElementsPerPage / 2))
+      if ((nElementsBefore < fApproxNElementsPerPage / 2) &&
+          (nElementsBefore + count >= fApproxNElementsPerPage / 2))
       {
          FlushShadowWritePage();
       }
@@ -246,6 +291,17 @@ public:
          (clusterIndex.GetIndex() - fReadPage.GetClusterRangeFirst()) * RColumnElement<CppT>::kSize);
    }
 
+   /// Untyped variant of MapV() for callers that know that the in-memory layout of the elements matches their type
+   void *MapRawV(const NTupleSize_t globalIndex, NTupleSize_t &nItems)
+   {
+      if (R__unlikely(!fReadPage.Contains(globalIndex))) {
+         MapPage(globalIndex);
+      }
+      nItems = fReadPage.GetGlobalRangeLast() - globalIndex + 1;
+      return static_cast<unsigned char *>(fReadPage.GetBuffer()) +
+             (globalIndex - fReadPage.GetGlobalRangeFirst()) * fReadPage.GetElementSize();
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fReadPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
@@ -295,6 +351,35 @@ public:
       *collectionStart = RClusterIndex(clusterIndex.GetClusterId(), idxStart);
    }
 
+   /// For offset columns only, bulk version of GetCollectionInfo() for up to `count` consecutive collections starting
+   /// at `globalIndex`.  Reading stops at the end of the cluster, such that the items of all returned collections are
+   /// consecutive, starting at `collectionStart`.  The `offsets` array needs to hold count + 1 values; the i-th
+   /// collection spans the items [offsets[i], offsets[i + 1]) relative to `collectionStart`.
+   /// Returns the number of collections read.
+   std::size_t GetCollectionInfoV(const NTupleSize_t globalIndex, std::size_t count, RClusterIndex *collectionStart,
+                                  ClusterSize_t *offsets)
+   {
+      if (count == 0)
+         return 0;
+      ClusterSize_t size;
+      GetCollectionInfo(globalIndex, collectionStart, &size);
+      const auto idxFirst = collectionStart->GetIndex();
+      offsets[0] = 0;
+      offsets[1] = size;
+      std::size_t nRead = 1;
+      while (nRead < count) {
+         NTupleSize_t nItems;
+         auto idxEnd = MapV<ClusterSize_t>(globalIndex + nRead, nItems);
+         if (fReadPage.GetClusterInfo().GetId() != collectionStart->GetClusterId())
+            break;
+         nItems = std::min<NTupleSize_t>(nItems, count - nRead);
+         for (NTupleSize_t i = 0; i < nItems; ++i)
+            offsets[nRead + i + 1] = idxEnd[i] - idxFirst;
+         nRead += nItems;
+      }
+      return nRead;
+   }
+
    /// Get the currently active cluster id
    void GetSwitchInfo(NTupleSize_t globalIndex, RClusterIndex *varIndex, std::uint32_t *tag) {
       auto varSwitch = Map<RColumnSwitch>(globalIndex);
@@ -307,6 +392,11 @@ public:
    void MapPage(const RClusterIndex &clusterIndex);
    NTupleSize_t GetNElements() const { return fNElements; }
    RColumnElementBase *GetElement() const { return fElement.get(); }
+   /// The value range of the elements of a write page; empty if the column does not support statistics
+   RColumnStatistics GetPageStatistics(const RPage &page) const
+   {
+      return fComputeStatistics ? fComputeStatistics(page.GetBuffer(), page.GetNElements()) : RColumnStatistics();
+   }
    const RColumnModel &GetModel() const { return fModel; }
    std::uint32_t GetIndex() const { return fIndex; }
    ColumnId_t GetColumnIdSource() const { return fColumnIdSource; }
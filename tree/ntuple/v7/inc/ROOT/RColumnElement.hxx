@@ -30,6 +30,7 @@
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
 
 #ifndef R__LITTLE_ENDIAN
 #ifdef R__BYTESWAP
@@ -114,6 +115,51 @@ static void UnsplitElementsBE(void *destination, const void *source, std::size_t
       }
    }
 }
+
+/// \brief Stores the lower `N` bytes of `count` integers in columnar layout, least significant bytes first.
+///
+/// The bytes are extracted arithmetically, so the on-disk layout does not depend on the endianness of the platform.
+/// The loops are written such that compilers can vectorize them.
+template <std::size_t N, typename T>
+static void SplitIntegersLE(void *destination, const T *source, std::size_t count)
+{
+   auto splitArray = reinterpret_cast<unsigned char *>(destination);
+   for (std::size_t b = 0; b < N; ++b) {
+      for (std::size_t i = 0; i < count; ++i) {
+         splitArray[b * count + i] = static_cast<unsigned char>(source[i] >> (8 * b));
+      }
+   }
+}
+
+/// Reverse of SplitIntegersLE. The destination type `T` can be wider than `N` bytes.
+template <std::size_t N, typename T>
+static void UnsplitIntegersLE(T *destination, const void *source, std::size_t count)
+{
+   auto splitArray = reinterpret_cast<const unsigned char *>(source);
+   for (std::size_t i = 0; i < count; ++i) {
+      destination[i] = splitArray[i];
+   }
+   for (std::size_t b = 1; b < N; ++b) {
+      for (std::size_t i = 0; i < count; ++i) {
+         destination[i] |= static_cast<T>(splitArray[b * count + i]) << (8 * b);
+      }
+   }
+}
+
+/// Maps signed integers stored in the unsigned type `T` to unsigned integers such that values with a small
+/// magnitude map to small values: 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+template <typename T>
+static T ZigzagEncode(T value)
+{
+   return static_cast<T>((value << 1) ^ (T(0) - (value >> (sizeof(T) * 8 - 1))));
+}
+
+/// Reverse of ZigzagEncode
+template <typename T>
+static T ZigzagDecode(T value)
+{
+   return static_cast<T>((value >> 1) ^ (T(0) - (value & 1)));
+}
 } // anonymous namespace
 
 namespace ROOT {
@@ -121,6 +167,24 @@ namespace Experimental {
 
 namespace Detail {
 
+/// Instruction set extensions used by the byte split and bit unpacking kernels
+enum class ESIMDLevel { kScalar, kSSE41, kAVX2 };
+
+/// The most capable instruction set extension supported by both the CPU and the build
+ESIMDLevel GetMaxSIMDLevel();
+/// By default, the byte split and bit unpacking kernels use GetMaxSIMDLevel().  Lower levels can be selected for testing and
+/// benchmarking.  Throws if the level is not supported.  Must not be called concurrently with (un)packing.
+void SetSIMDLevel(ESIMDLevel level);
+ESIMDLevel GetSIMDLevel();
+
+/// Same result as SplitElementsLE<N> but dispatched at runtime to SSE4.1 or AVX2 kernels, if available.
+/// Implemented for N = 2, 4, 8.
+template <std::size_t N>
+void SplitBytesLE(void *destination, const void *source, std::size_t count);
+/// Same result as UnsplitElementsLE<N>, dispatched like SplitBytesLE()
+template <std::size_t N>
+void UnsplitBytesLE(void *destination, const void *source, std::size_t count);
+
 // clang-format off
 /**
 \class ROOT::Experimental::Detail::RColumnElement
@@ -162,7 +226,23 @@ public:
    /// If CppT == void, use the default C++ type for the given column type
    template <typename CppT = void>
    static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
+   /// Like Generate(EColumnType) but also applies the precision settings of the model, if any
+   template <typename CppT = void>
+   static std::unique_ptr<RColumnElementBase> Generate(const RColumnModel &model);
+   /// For column types with a configurable precision, the maximum number of bits on storage
    static std::size_t GetBitsOnStorage(EColumnType type);
+   /// The smallest and the largest valid number of bits on storage; identical for fixed-size column types
+   static std::pair<std::uint16_t, std::uint16_t> GetValidBitRange(EColumnType type);
+   /// The size of a packed page with the given number of elements of the given column type.  For the bit-packed
+   /// integers, the size of a packed page depends on its values and this is the maximum size.
+   static std::size_t GetPackedSize(EColumnType type, std::size_t nElements);
+   /// Takes into account the precision settings of the column model
+   static std::size_t GetPackedSize(const RColumnModel &model, std::size_t nElements);
+   /// Whether reading back values of the given column type can yield different values than the ones written
+   static bool IsLossy(EColumnType type)
+   {
+      return type == EColumnType::kReal32Trunc || type == EColumnType::kReal32Quant;
+   }
    static std::string GetTypeName(EColumnType type);
 
    /// Write one or multiple column elements into destination
@@ -178,6 +258,9 @@ public:
    /// Derived, typed classes tell whether the on-storage layout is bitwise identical to the memory layout
    virtual bool IsMappable() const { R__ASSERT(false); return false; }
    virtual std::size_t GetBitsOnStorage() const { R__ASSERT(false); return 0; }
+   /// Column types with a configurable precision, such as truncated or quantized floats, take their
+   /// parameters from the column model.  Throws if the model's precision settings are invalid.
+   virtual void SetPrecision(const RColumnModel & /* model */) {}
 
    /// If the on-storage layout and the in-memory layout differ, packing creates an on-disk page from an in-memory page
    virtual void Pack(void *destination, void *source, std::size_t count) const
@@ -193,7 +276,17 @@ public:
 
    void *GetRawContent() const { return fRawContent; }
    std::size_t GetSize() const { return fSize; }
-   std::size_t GetPackedSize(std::size_t nElements) const { return (nElements * GetBitsOnStorage() + 7) / 8; }
+   /// Column types with a per-page header, such as the bit-packed integers, need to take the header into account.
+   /// If the size of a packed page depends on the values, this is the size of the largest possible packed page.
+   virtual std::size_t GetPackedSize(std::size_t nElements) const { return (nElements * GetBitsOnStorage() + 7) / 8; }
+   /// The number of leading bytes of a packed page that describe its encoding.  When a page is sealed, they are
+   /// stored uncompressed, so that the size of the packed page is known before decompression.
+   virtual std::size_t GetPackedHeaderSize() const { return 0; }
+   /// The size of a packed page given its first GetPackedHeaderSize() bytes
+   virtual std::size_t GetPackedSizeFromHeader(const void * /* header */, std::size_t nElements) const
+   {
+      return GetPackedSize(nElements);
+   }
 };
 
 /**
@@ -237,7 +330,7 @@ public:
    void Pack(void *dst, void *src, std::size_t count) const final
    {
 #if R__LITTLE_ENDIAN == 1
-      SplitElementsLE<sizeof(CppT)>(dst, src, count);
+      SplitBytesLE<sizeof(CppT)>(dst, src, count);
 #else
       SplitElementsBE<sizeof(CppT)>(dst, src, count);
 #endif
@@ -245,13 +338,125 @@ public:
    void Unpack(void *dst, void *src, std::size_t count) const final
    {
 #if R__LITTLE_ENDIAN == 1
-      UnsplitElementsLE<sizeof(CppT)>(dst, src, count);
+      UnsplitBytesLE<sizeof(CppT)>(dst, src, count);
 #else
       UnsplitElementsBE<sizeof(CppT)>(dst, src, count);
 #endif
    }
 }; // class RColumnElementSplitLE
 
+/**
+ * Base class for integer columns that store the zigzag-encoded differences of consecutive elements in split,
+ * little-endian layout.  The first element of a page is stored as difference to zero.  Works well for slowly
+ * varying values, e.g. sorted identifiers or time stamps.
+ */
+template <typename CppT>
+class RColumnElementDeltaSplitLE : public RColumnElementBase {
+   using UnsignedT = std::make_unsigned_t<CppT>;
+
+public:
+   static constexpr bool kIsMappable = false;
+   RColumnElementDeltaSplitLE(void *rawContent, std::size_t size) : RColumnElementBase(rawContent, size) {}
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      auto srcArray = reinterpret_cast<const UnsignedT *>(src);
+      auto splitArray = reinterpret_cast<unsigned char *>(dst);
+      UnsignedT prev = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+         const auto diff = ZigzagEncode(static_cast<UnsignedT>(srcArray[i] - prev));
+         prev = srcArray[i];
+         for (std::size_t b = 0; b < sizeof(UnsignedT); ++b) {
+            splitArray[b * count + i] = static_cast<unsigned char>(diff >> (8 * b));
+         }
+      }
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      auto dstArray = reinterpret_cast<UnsignedT *>(dst);
+#if R__LITTLE_ENDIAN == 1
+      UnsplitBytesLE<sizeof(UnsignedT)>(dstArray, src, count);
+#else
+      UnsplitIntegersLE<sizeof(UnsignedT)>(dstArray, src, count);
+#endif
+      UnsignedT prev = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+         prev += ZigzagDecode(dstArray[i]);
+         dstArray[i] = prev;
+      }
+   }
+}; // class RColumnElementDeltaSplitLE
+
+/**
+ * Base class for frame-of-reference encoded integer columns.  Every packed page starts with a header of the minimum
+ * value of the page (64bit little-endian) and the bit width of the page (one byte).  It is followed by the
+ * differences of the elements to the minimum, using the smallest bit width that fits the range of the page.
+ * The size of a packed page thus depends on the bit width; the header is the packed header of the page.
+ */
+template <typename CppT>
+class RColumnElementBitPackedLE : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kHeaderSize = 9;
+   RColumnElementBitPackedLE(void *rawContent, std::size_t size) : RColumnElementBase(rawContent, size) {}
+
+   std::size_t GetPackedSize(std::size_t nElements) const final
+   {
+      return kHeaderSize + nElements * sizeof(CppT);
+   }
+   std::size_t GetPackedHeaderSize() const final { return kHeaderSize; }
+   std::size_t GetPackedSizeFromHeader(const void *header, std::size_t nElements) const final;
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+}; // class RColumnElementBitPackedLE
+
+/**
+ * Base class for floating point columns with a reduced number of mantissa bits.  Every element keeps the sign bit,
+ * the 8 exponent bits and the fBitsOnStorage - 9 most significant mantissa bits of its single precision value,
+ * rounded to nearest.  Double precision values are first converted to single precision.  The elements are packed
+ * into a contiguous little-endian bit stream.
+ */
+template <typename CppT>
+class RColumnElementTruncatedReal : public RColumnElementBase {
+protected:
+   std::size_t fBitsOnStorage = 31;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(CppT);
+   explicit RColumnElementTruncatedReal(CppT *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetPrecision(const RColumnModel &model) final;
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+}; // class RColumnElementTruncatedReal
+
+/**
+ * Base class for fixed-point floating point columns.  Values in [fValueMin, fValueMax] are linearly mapped onto
+ * unsigned integers of fBitsOnStorage bits, rounded to nearest; values outside the range are clamped to its bounds.
+ * The integers are packed into a contiguous little-endian bit stream.
+ */
+template <typename CppT>
+class RColumnElementQuantizedReal : public RColumnElementBase {
+protected:
+   std::size_t fBitsOnStorage = 32;
+   double fValueMin = 0.0;
+   double fValueMax = 0.0;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(CppT);
+   explicit RColumnElementQuantizedReal(CppT *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetPrecision(const RColumnModel &model) final;
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+}; // class RColumnElementQuantizedReal
+
 /**
  * Pairs of C++ type and column type, like float and EColumnType::kReal32
  */
@@ -567,6 +772,164 @@ public:
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
 };
 
+template <>
+class RColumnElement<std::int16_t, EColumnType::kSplitDeltaInt16> : public RColumnElementDeltaSplitLE<std::int16_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int16_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int16_t *value) : RColumnElementDeltaSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint16_t, EColumnType::kSplitDeltaInt16> : public RColumnElementDeltaSplitLE<std::uint16_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint16_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint16_t *value) : RColumnElementDeltaSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int16_t, EColumnType::kBitPackedInt16> : public RColumnElementBitPackedLE<std::int16_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int16_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int16_t *value) : RColumnElementBitPackedLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint16_t, EColumnType::kBitPackedInt16> : public RColumnElementBitPackedLE<std::uint16_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint16_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint16_t *value) : RColumnElementBitPackedLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int32_t, EColumnType::kSplitDeltaInt32> : public RColumnElementDeltaSplitLE<std::int32_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int32_t *value) : RColumnElementDeltaSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint32_t, EColumnType::kSplitDeltaInt32> : public RColumnElementDeltaSplitLE<std::uint32_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint32_t *value) : RColumnElementDeltaSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int32_t, EColumnType::kBitPackedInt32> : public RColumnElementBitPackedLE<std::int32_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int32_t *value) : RColumnElementBitPackedLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint32_t, EColumnType::kBitPackedInt32> : public RColumnElementBitPackedLE<std::uint32_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint32_t *value) : RColumnElementBitPackedLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int64_t, EColumnType::kSplitDeltaInt64> : public RColumnElementDeltaSplitLE<std::int64_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int64_t *value) : RColumnElementDeltaSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint64_t, EColumnType::kSplitDeltaInt64> : public RColumnElementDeltaSplitLE<std::uint64_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint64_t *value) : RColumnElementDeltaSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int64_t, EColumnType::kBitPackedInt64> : public RColumnElementBitPackedLE<std::int64_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int64_t *value) : RColumnElementBitPackedLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint64_t, EColumnType::kBitPackedInt64> : public RColumnElementBitPackedLE<std::uint64_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint64_t *value) : RColumnElementBitPackedLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<float, EColumnType::kReal32Trunc> : public RColumnElementTruncatedReal<float> {
+public:
+   explicit RColumnElement(float *value) : RColumnElementTruncatedReal(value) {}
+};
+
+template <>
+class RColumnElement<double, EColumnType::kReal32Trunc> : public RColumnElementTruncatedReal<double> {
+public:
+   explicit RColumnElement(double *value) : RColumnElementTruncatedReal(value) {}
+};
+
+template <>
+class RColumnElement<float, EColumnType::kReal32Quant> : public RColumnElementQuantizedReal<float> {
+public:
+   explicit RColumnElement(float *value) : RColumnElementQuantizedReal(value) {}
+};
+
+template <>
+class RColumnElement<double, EColumnType::kReal32Quant> : public RColumnElementQuantizedReal<double> {
+public:
+   explicit RColumnElement(double *value) : RColumnElementQuantizedReal(value) {}
+};
+
+template <>
+class RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(ClusterSize_t);
+   static constexpr std::size_t kBitsOnStorage = 32;
+   explicit RColumnElement(ClusterSize_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
 template <>
 class RColumnElement<ClusterSize_t, EColumnType::kIndex32> : public RColumnElementBase {
 public:
@@ -679,6 +1042,21 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
    case EColumnType::kSplitInt64: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt64>>(nullptr);
    case EColumnType::kSplitInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt32>>(nullptr);
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt16>>(nullptr);
+   case EColumnType::kSplitIndex32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitIndex32>>(nullptr);
+   case EColumnType::kSplitDeltaInt64:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kSplitDeltaInt64>>(nullptr);
+   case EColumnType::kSplitDeltaInt32:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kSplitDeltaInt32>>(nullptr);
+   case EColumnType::kSplitDeltaInt16:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kSplitDeltaInt16>>(nullptr);
+   case EColumnType::kBitPackedInt64:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedInt64>>(nullptr);
+   case EColumnType::kBitPackedInt32:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedInt32>>(nullptr);
+   case EColumnType::kBitPackedInt16:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedInt16>>(nullptr);
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Trunc>>(nullptr);
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Quant>>(nullptr);
    default: R__ASSERT(false);
    }
    // never here
@@ -688,6 +1066,14 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
 template <>
 std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate<void>(EColumnType type);
 
+template <typename CppT>
+std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(const RColumnModel &model)
+{
+   auto element = Generate<CppT>(model.GetType());
+   element->SetPrecision(model);
+   return element;
+}
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
@@ -18,6 +18,7 @@
 
 #include <ROOT/RStringView.hxx>
 
+#include <cstdint>
 #include <string>
 
 namespace ROOT {
@@ -62,6 +63,21 @@ enum class EColumnType {
    kSplitInt64,
    kSplitInt32,
    kSplitInt16,
+   // index column that stores the differences of consecutive elements, split in bytes
+   kSplitIndex32,
+   // zigzag-encoded differences of consecutive elements, split in bytes
+   kSplitDeltaInt64,
+   kSplitDeltaInt32,
+   kSplitDeltaInt16,
+   // frame-of-reference encoding: per page minimum value followed by the differences to the minimum,
+   // bit-packed to the smallest width that fits all elements of the page
+   kBitPackedInt64,
+   kBitPackedInt32,
+   kBitPackedInt16,
+   // Floats with a configurable number of mantissa bits
+   kReal32Trunc,
+   // Floats mapped onto integers of a configurable bit width in a given value range
+   kReal32Quant,
    kMax,
 };
 
@@ -76,17 +92,35 @@ class RColumnModel {
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// For column types with a configurable precision, the number of bits per element on storage; zero otherwise
+   std::uint16_t fBitsOnStorage = 0;
+   /// For quantized column types, the value range that is mapped onto the integers of fBitsOnStorage bits
+   double fValueMin = 0.0;
+   double fValueMax = 0.0;
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
-   explicit RColumnModel(EColumnType type) : fType(type), fIsSorted(type == EColumnType::kIndex32) {}
+   explicit RColumnModel(EColumnType type)
+      : fType(type), fIsSorted((type == EColumnType::kIndex32) || (type == EColumnType::kSplitIndex32))
+   {
+   }
    RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted) {}
+   RColumnModel(EColumnType type, bool isSorted, std::uint16_t bitsOnStorage, double valueMin = 0.0,
+                double valueMax = 0.0)
+      : fType(type), fIsSorted(isSorted), fBitsOnStorage(bitsOnStorage), fValueMin(valueMin), fValueMax(valueMax)
+   {
+   }
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   std::uint16_t GetBitsOnStorage() const { return fBitsOnStorage; }
+   double GetValueMin() const { return fValueMin; }
+   double GetValueMax() const { return fValueMax; }
+   bool HasValueRange() const { return fValueMin != fValueMax; }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fBitsOnStorage == other.fBitsOnStorage) &&
+             (fValueMin == other.fValueMin) && (fValueMax == other.fValueMax);
    }
    bool operator!=(const RColumnModel &other) const { return !(other == *this); }
 };
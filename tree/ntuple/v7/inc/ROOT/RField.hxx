@@ -39,6 +39,7 @@
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 #include <utility>
@@ -313,6 +314,21 @@ public:
          InvokeReadCallbacks(*value);
    }
 
+   /// Populate `count` consecutive values starting at `globalIndex` into the array `to` of already constructed
+   /// objects of the field's type.  For mappable fields, the values are copied from the pages with one memcpy per page;
+   /// otherwise, the values are read one by one.
+   void ReadBulk(NTupleSize_t globalIndex, std::size_t count, void *to);
+   void ReadBulk(const RClusterIndex &clusterIndex, std::size_t count, void *to);
+   /// Zero-copy access for simple fields: returns a pointer into the page buffer to the value of `globalIndex` and sets
+   /// `nItems` to the number of consecutive values available from there on, i.e. up to the end of the page.  The memory
+   /// is valid until the field reads from another page.  Returns nullptr if the field is not simple.
+   const void *MapBulk(NTupleSize_t globalIndex, NTupleSize_t &nItems)
+   {
+      if (!fIsSimple)
+         return nullptr;
+      return fPrincipalColumn->MapRawV(globalIndex, nItems);
+   }
+
    /// Ensure that all received items are written from page buffers to the storage.
    void Flush() const;
    /// Perform housekeeping tasks for global to cluster-local index translation
@@ -943,6 +959,11 @@ public:
    void GetCollectionInfo(const RClusterIndex &clusterIndex, RClusterIndex *collectionStart, ClusterSize_t *size) {
       fPrincipalColumn->GetCollectionInfo(clusterIndex, collectionStart, size);
    }
+   std::size_t GetCollectionInfoV(NTupleSize_t globalIndex, std::size_t count, RClusterIndex *collectionStart,
+                                  ClusterSize_t *offsets)
+   {
+      return fPrincipalColumn->GetCollectionInfoV(globalIndex, count, collectionStart, offsets);
+   }
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
 };
 
@@ -1058,24 +1079,57 @@ public:
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
 };
 
-template <>
-class RField<float> : public Detail::RFieldBase {
+/// Base class for the floating point fields.  Instead of their native column types, floating point values can be
+/// stored with reduced precision, similar to TTree's Float16_t and Double32_t, either as floats with truncated mantissa
+/// (kReal32Trunc) or as fixed-point values in a given range (kReal32Quant).
+template <typename T>
+class RRealField : public Detail::RFieldBase {
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+   /// For truncated and quantized columns, the number of bits per value on storage
+   std::uint16_t fBitsOnStorage = 0;
+   /// For quantized columns, the value range that is mapped onto the available bits
+   double fValueMin = 0.0;
+   double fValueMax = 0.0;
+
+   RRealField(std::string_view name, std::string_view typeName)
+      : Detail::RFieldBase(name, typeName, ENTupleStructure::kLeaf, true /* isSimple */)
+   {
+      fTraits |= kTraitTrivialType;
    }
 
-   const RColumnRepresentations &GetColumnRepresentations() const final;
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
 
 public:
-   static std::string TypeName() { return "float"; }
-   explicit RField(std::string_view name)
-      : Detail::RFieldBase(name, TypeName(), ENTupleStructure::kLeaf, true /* isSimple */)
+   RRealField(RRealField &&other) = default;
+   RRealField &operator=(RRealField &&other) = default;
+   ~RRealField() override = default;
+
+   /// Store the values as single precision floats keeping only the nBits - 9 most significant mantissa bits,
+   /// with 10 <= nBits <= 31.  Double precision values are converted to single precision first.
+   void SetTruncated(std::size_t nBits);
+   /// Store the values as nBits wide integers that linearly map the range [min, max], with 1 <= nBits <= 32.
+   /// Values outside the range are clamped to its bounds.
+   void SetQuantized(double min, double max, std::size_t nBits);
+};
+
+template <>
+class RField<float> : public RRealField<float> {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
    {
-      fTraits |= kTraitTrivialType;
+      auto clone = std::make_unique<RField>(newName);
+      clone->fBitsOnStorage = fBitsOnStorage;
+      clone->fValueMin = fValueMin;
+      clone->fValueMax = fValueMax;
+      return clone;
    }
+
+   const RColumnRepresentations &GetColumnRepresentations() const final;
+
+public:
+   static std::string TypeName() { return "float"; }
+   explicit RField(std::string_view name) : RRealField(name, TypeName()) {}
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() override = default;
@@ -1112,23 +1166,22 @@ public:
 
 
 template <>
-class RField<double> : public Detail::RFieldBase {
+class RField<double> : public RRealField<double> {
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      auto clone = std::make_unique<RField>(newName);
+      clone->fBitsOnStorage = fBitsOnStorage;
+      clone->fValueMin = fValueMin;
+      clone->fValueMax = fValueMax;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
-   void GenerateColumnsImpl() final;
-   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
 
 public:
    static std::string TypeName() { return "double"; }
-   explicit RField(std::string_view name)
-      : Detail::RFieldBase(name, TypeName(), ENTupleStructure::kLeaf, true /* isSimple */)
-   {
-      fTraits |= kTraitTrivialType;
-   }
+   explicit RField(std::string_view name) : RRealField(name, TypeName()) {}
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() override = default;
@@ -1631,11 +1684,34 @@ public:
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
 };
 
+/// Strings are stored as an offset column and a character column.  Alternatively, for strings that take only few
+/// distinct values, they can be dictionary-encoded (see SetDictionaryEncoded()).  In this case, every cluster stores
+/// the distinct strings it contains once, as offset and character columns, and the principal column holds for every
+/// entry the cluster-local id of its string in this dictionary.
 template <>
 class RField<std::string> : public Detail::RFieldBase {
+public:
+   static constexpr std::uint32_t kInvalidDictionaryId = std::uint32_t(-1);
+
 private:
    ClusterSize_t fIndex;
    Detail::RColumnElement<ClusterSize_t, EColumnType::kIndex32> fElemIndex;
+   /// Dictionary-encoded writing: the ids of the strings of the current cluster
+   std::unordered_map<std::string, std::uint32_t> fDictionaryIds;
+   /// Dictionary-encoded reading: the dictionary entries of fDictionaryClusterId, loaded on demand
+   std::vector<std::string> fDictionary;
+   /// Dictionary-encoded reading: maps the entries of fDictionary to their ids.  Built by FindDictionaryId() once
+   /// all the entries are loaded, so that the keys referencing fDictionary remain valid.
+   std::unordered_map<std::string_view, std::uint32_t> fDictionaryLookup;
+   DescriptorId_t fDictionaryClusterId = kInvalidDescriptorId;
+   /// Number of entries of the dictionary of fDictionaryClusterId
+   std::uint64_t fDictionarySize = 0;
+
+   void EnsureDictionaryEncoded() const;
+   /// Makes clusterId the current dictionary cluster, i.e. resets fDictionary, fDictionaryLookup and sets
+   /// fDictionarySize
+   void LoadDictionary(DescriptorId_t clusterId);
+   const std::string &GetDictionaryEntry(DescriptorId_t clusterId, std::uint32_t dictionaryId);
 
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField>(newName);
@@ -1678,6 +1754,16 @@ public:
    size_t GetAlignment() const final { return std::alignment_of<std::string>(); }
    void CommitCluster() final;
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Store the strings dictionary-encoded, which pays off for strings with few distinct values per cluster
+   void SetDictionaryEncoded();
+   bool IsDictionaryEncoded() const;
+   /// For dictionary-encoded fields, the id of the string at the given index.  The ids are cluster-local:
+   /// two entries of the same cluster have the same string if and only if they have the same id.
+   std::uint32_t GetDictionaryId(NTupleSize_t globalIndex);
+   /// For dictionary-encoded fields, the id of the given string in the dictionary of the cluster that contains
+   /// globalIndex, or kInvalidDictionaryId if the string does not appear in that cluster.
+   std::uint32_t FindDictionaryId(NTupleSize_t globalIndex, std::string_view value);
 };
 
 
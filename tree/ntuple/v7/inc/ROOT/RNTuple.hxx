@@ -355,27 +355,26 @@ public:
 
 // clang-format off
 /**
-\class ROOT::Experimental::RNTupleWriter
+\class ROOT::Experimental::RNTupleFillContext
 \ingroup NTuple
-\brief An RNTuple that gets filled with entries (data) and writes them to storage
+\brief A context for filling entries (data) into clusters of an RNTuple
 
-An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
-is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
-writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
-triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+A fill context serializes the filled entries into the column page buffers of its own model and commits clusters to
+its page sink.  It decides when a cluster is full, based on the write options of the sink.  Every RNTupleWriter has
+a single fill context.  An RNTupleParallelWriter hands out one fill context per thread; all of them commit their
+clusters into the same ntuple.  A fill context must only be used by one thread at a time.
 */
 // clang-format on
-class RNTupleWriter {
+class RNTupleFillContext {
+   friend class RNTupleWriter;
+   friend class RNTupleParallelWriter;
+
 private:
-   /// The page sink's parallel page compression scheduler if IMT is on.
-   /// Needs to be destructed after the page sink is destructed and so declared before.
-   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fZipTasks;
    std::unique_ptr<Detail::RPageSink> fSink;
    /// Needs to be destructed before fSink
    std::unique_ptr<RNTupleModel> fModel;
    Detail::RNTupleMetrics fMetrics;
    NTupleSize_t fLastCommitted = 0;
-   NTupleSize_t fLastCommittedClusterGroup = 0;
    NTupleSize_t fNEntries = 0;
    /// Keeps track of the number of bytes written into the current cluster
    std::size_t fUnzippedClusterSize = 0;
@@ -389,9 +388,80 @@ private:
    /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
    NTupleSize_t fUnzippedClusterSizeEst;
 
+   /// Freezes the model and creates the sink with it. Throws an exception if the model or the sink is null.
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   /// Commits the entries filled since the last cluster commit
+   ~RNTupleFillContext();
+
+   /// The simplest user interface if the default entry that comes with the model is used.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   /// Multiple entries can have been instantiated from the model of the fill context.  This method will perform
+   /// a light check whether the entry comes from the context's own model.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      std::size_t bytesWritten = 0;
+      for (auto &value : entry) {
+         bytesWritten += value.GetField()->Append(value);
+      }
+      fUnzippedClusterSize += bytesWritten;
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+      return bytesWritten;
+   }
+   /// Ensure that the data from the so far seen Fill calls has been written to storage
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+
+   /// Returns the number of entries filled into this context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled with entries (data) and writes them to storage
+
+An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
+is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
+writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
+triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+*/
+// clang-format on
+class RNTupleWriter {
+   friend RNTupleModel::RUpdater;
+
+private:
+   /// The page sink's parallel page compression scheduler if IMT is on.
+   /// Needs to be destructed after the page sink (in the fill context) is destructed and so declared before.
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fZipTasks;
+   RNTupleFillContext fFillContext;
+   Detail::RNTupleMetrics fMetrics;
+   NTupleSize_t fLastCommittedClusterGroup = 0;
+
    // Helper function that is called from CommitCluster() when necessary
    void CommitClusterGroup();
 
+   Detail::RPageSink &GetSink() { return *fFillContext.fSink; }
+   /// Used by the model updater; the model of a writer is otherwise only accessible as const reference
+   RNTupleModel &GetUpdatableModel() { return *fFillContext.fModel; }
+
 public:
    /// Throws an exception if the model is null.
    static std::unique_ptr<RNTupleWriter> Recreate(std::unique_ptr<RNTupleModel> model,
@@ -411,33 +481,46 @@ public:
 
    /// The simplest user interface if the default entry that comes with the ntuple model is used.
    /// \return The number of uncompressed bytes written.
-   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   std::size_t Fill() { return fFillContext.Fill(); }
    /// Multiple entries can have been instantiated from the ntuple model.  This method will perform
    /// a light check whether the entry comes from the ntuple's own model.
    /// \return The number of uncompressed bytes written.
-   std::size_t Fill(REntry &entry) {
-      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
-         throw RException(R__FAIL("mismatch between entry and model"));
-
-      std::size_t bytesWritten = 0;
-      for (auto& value : entry) {
-         bytesWritten += value.GetField()->Append(value);
-      }
-      fUnzippedClusterSize += bytesWritten;
-      fNEntries++;
-      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
-         CommitCluster();
-      return bytesWritten;
-   }
+   std::size_t Fill(REntry &entry) { return fFillContext.Fill(entry); }
    /// Ensure that the data from the so far seen Fill calls has been written to storage
    void CommitCluster(bool commitClusterGroup = false);
 
-   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   std::unique_ptr<REntry> CreateEntry() { return fFillContext.CreateEntry(); }
+
+   /// Returns an updater for adding fields to the model after writing has started.
+   ///
+   /// **Example: add a field after the first entries have been written**
+   /// ~~~ {.cpp}
+   /// #include <ROOT/RNTuple.hxx>
+   /// using ROOT::Experimental::RNTupleModel;
+   /// using ROOT::Experimental::RNTupleWriter;
+   ///
+   /// auto model = RNTupleModel::Create();
+   /// auto pt = model->MakeField<float>("pt");
+   /// auto writer = RNTupleWriter::Recreate(std::move(model), "myNTuple", "myFile.root");
+   /// writer->Fill();
+   ///
+   /// auto updater = writer->CreateModelUpdater();
+   /// updater->BeginUpdate();
+   /// auto eta = updater->MakeField<float>("eta");
+   /// updater->CommitUpdate();
+   ///
+   /// // Readers see eta == 0 for the first entry
+   /// writer->Fill();
+   /// ~~~
+   std::unique_ptr<RNTupleModel::RUpdater> CreateModelUpdater()
+   {
+      return std::make_unique<RNTupleModel::RUpdater>(*this);
+   }
 
    void EnableMetrics() { fMetrics.Enable(); }
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
 
-   const RNTupleModel *GetModel() const { return fModel.get(); }
+   const RNTupleModel *GetModel() const { return fFillContext.GetModel(); }
 };
 
 // clang-format off
@@ -212,13 +212,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The combined statistics of the pages; only has a value range if all the pages have one
+      RColumnStatistics fStatistics{};
 
       bool operator==(const RColumnRange &other) const {
          return fPhysicalColumnId == other.fPhysicalColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fStatistics == other.fStatistics;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -235,9 +235,11 @@ public:
          std::uint32_t fNElements = std::uint32_t(-1);
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// Optional range of the values in the page
+         RColumnStatistics fStatistics{};
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fStatistics == other.fStatistics;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -705,6 +707,11 @@ public:
    /// We know the number of entries from adding the cluster summaries
    NTupleSize_t GetNEntries() const { return fNEntries; }
    NTupleSize_t GetNElements(DescriptorId_t physicalColumnId) const;
+   /// Returns the number of elements per entry of the given column, i.e. the product of the repetitions of the array
+   /// fields on the way to the field zero.  Returns zero for the columns that are not entry aligned, i.e. for the
+   /// columns below a collection or a variant and for the secondary columns of a field, which are addressed through
+   /// the principal column.
+   std::uint64_t GetNElementsPerEntry(DescriptorId_t physicalColumnId) const;
 
    /// Returns the logical parent of all top-level NTuple data fields.
    DescriptorId_t GetFieldZeroId() const;
@@ -882,6 +889,13 @@ public:
    RResult<void> CommitColumnRange(DescriptorId_t physicalId, std::uint64_t firstElementIndex,
                                    std::uint32_t compressionSettings, const RClusterDescriptor::RPageRange &pageRange);
 
+   /// Adds column and page ranges for the physical columns of `desc` that are not part of the cluster, i.e. for the
+   /// columns of fields that were added to the model after the cluster had been written.  The added ranges consist
+   /// of zero pages (see ROOT::Experimental::RNTupleLocator::kTypePageZero) that read as zero-valued elements, which
+   /// translate to default-constructed field values.  Must be called after all the regular column ranges have been
+   /// committed.
+   RResult<void> AddExtendedColumnRanges(const RNTupleDescriptor &desc);
+
    /// Move out the full cluster descriptor including page locations
    RResult<RClusterDescriptor> MoveDescriptor();
 };
@@ -16,9 +16,16 @@
 #ifndef ROOT7_RNTupleMerger
 #define ROOT7_RNTupleMerger
 
+#include <ROOT/RColumnModel.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RSpan.hxx>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -38,6 +45,47 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Given a set of RPageSources merge them into an RPageSink
+
+The merger concatenates the clusters of all the sources, in order, into the destination. The sources must have the
+same schema; the output schema and the column representations are taken from the first source.
+Pages whose compression settings match the ones of the destination are copied as they are stored ("fast merging").
+Other pages are decompressed and recompressed but they are never unpacked or re-serialized.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// Identifies a physical column across sources by the qualified name of its field and the column index
+   struct RColumnInfo {
+      /// The qualified field name and the column index, e.g. "jets._0.pt.0"
+      std::string fColumnName;
+      /// Includes the precision of truncated and quantized columns, which has to match across the sources
+      RColumnModel fColumnModel;
+      DescriptorId_t fColumnInputId = kInvalidDescriptorId;
+      DescriptorId_t fColumnOutputId = kInvalidDescriptorId;
+   };
+
+   /// Maps the column names of the destination to their physical column ids in the destination
+   std::unordered_map<std::string, RColumnInfo> fOutputColumns;
+
+   /// Recursively collects the physical columns of the given field and its sub fields
+   static void AddColumnsFromField(std::vector<RColumnInfo> &columns, const RNTupleDescriptor &desc,
+                                   const RFieldDescriptor &fieldDesc);
+   /// Returns the physical columns of the given descriptor, identified by their column names
+   static std::vector<RColumnInfo> CollectColumns(const RNTupleDescriptor &desc);
+   /// Sets the output ids of the given input columns; throws if the columns don't match the destination
+   void MapColumns(std::vector<RColumnInfo> &columns) const;
+
+public:
+   /// Merge a given set of sources into the destination. The destination must not have been created before;
+   /// it gets created from the schema of the first source.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -30,11 +30,24 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
 
 class RCollectionNTupleWriter;
+class RNTupleModel;
+class RNTupleWriter;
+
+/// The set of fields added to a frozen model by an RNTupleModel::RUpdater, passed to RPageSink::UpdateSchema()
+struct RNTupleModelChangeset {
+   RNTupleModel &fModel;
+   /// The added top-level fields
+   std::vector<Detail::RFieldBase *> fAddedFields;
+
+   explicit RNTupleModelChangeset(RNTupleModel &model) : fModel(model) {}
+   bool IsEmpty() const { return fAddedFields.empty(); }
+};
 
 // clang-format off
 /**
@@ -94,6 +107,49 @@ public:
       bool IsEmpty() const { return fFieldZero->begin() == fFieldZero->end(); }
    };
 
+   /// A model is usually immutable after passing it to an RNTupleWriter.  The updater provides limited support for
+   /// changing the model of a writer after writing has started, namely for adding new top-level fields.  The new
+   /// fields are stored from the next cluster on; for the entries written before, readers present the new fields
+   /// with their default values.  Absent columns do not take any space on storage.
+   ///
+   /// See RNTupleWriter::CreateModelUpdater() for an example.
+   class RUpdater {
+   private:
+      RNTupleWriter &fWriter;
+      RNTupleModelChangeset fOpenChangeset;
+
+   public:
+      explicit RUpdater(RNTupleWriter &writer);
+      RUpdater(const RUpdater &) = delete;
+      RUpdater &operator=(const RUpdater &) = delete;
+      /// Commits an open update
+      ~RUpdater() { CommitUpdate(); }
+
+      /// Begins a new set of alterations to the model.  As a side effect, all the entries created from the model,
+      /// including the default entry, become invalid until CommitUpdate() is called.
+      /// Throws an exception if the model has projected fields.
+      void BeginUpdate();
+      /// Commits the changes since the last call to BeginUpdate().  The current cluster is committed and the new fields
+      /// are part of the following clusters.  The model gets a new model identifier, so that entries created before
+      /// the update remain invalid; the default entry is valid again and contains the values of the new fields.
+      void CommitUpdate();
+
+      template <typename T, typename... ArgsT>
+      std::shared_ptr<T> MakeField(std::string_view fieldName, ArgsT &&...args)
+      {
+         return MakeField<T>({fieldName, ""}, std::forward<ArgsT>(args)...);
+      }
+      template <typename T, typename... ArgsT>
+      std::shared_ptr<T> MakeField(std::pair<std::string_view, std::string_view> fieldNameDesc, ArgsT &&...args)
+      {
+         auto objPtr = fOpenChangeset.fModel.MakeField<T>(fieldNameDesc, std::forward<ArgsT>(args)...);
+         fOpenChangeset.fAddedFields.emplace_back(fOpenChangeset.fModel.fFieldZero->GetSubFields().back());
+         return objPtr;
+      }
+      /// Throws an exception if the field is null.
+      void AddField(std::unique_ptr<Detail::RFieldBase> field);
+   };
+
 private:
    /// Hierarchy of fields consisting of simple types and collections (sub trees)
    std::unique_ptr<RFieldZero> fFieldZero;
@@ -229,6 +285,16 @@ public:
    RResult<void> AddProjectedField(std::unique_ptr<Detail::RFieldBase> field,
                                    std::function<std::string(const std::string &)> mapping);
 
+   /// Stores the float or double field `fieldName` (given by its qualified name) with a truncated mantissa,
+   /// using nBits bits per value; see RRealField::SetTruncated().  Throws if the field is not a floating point field.
+   void SetFieldTruncated(std::string_view fieldName, std::size_t nBits);
+   /// Stores the float or double field `fieldName` as fixed-point values in [min, max] with nBits bits per value;
+   /// see RRealField::SetQuantized().  Throws if the field is not a floating point field.
+   void SetFieldQuantized(std::string_view fieldName, double min, double max, std::size_t nBits);
+   /// Stores the std::string field `fieldName` dictionary-encoded; see RField<std::string>::SetDictionaryEncoded().
+   /// Throws if the field is not a string field.
+   void SetFieldDictionaryEncoded(std::string_view fieldName);
+
    template <typename T>
    T *Get(std::string_view fieldName) const
    {
@@ -239,6 +305,9 @@ public:
    const RProjectedFields &GetProjectedFields() const { return *fProjectedFields; }
 
    void Freeze();
+   /// Transitions a frozen model back to the building state, invalidating all the entries created from the model.
+   /// Used by RUpdater and by wrapper page sinks that keep a copy of the model.
+   void Unfreeze();
    bool IsFrozen() const { return fModelId != 0; }
    std::uint64_t GetModelId() const { return fModelId; }
 
@@ -61,6 +61,8 @@ protected:
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
    bool fUseBufferedWrite = true;
+   /// Record the value range of the pages of arithmetic columns, which allows readers to skip data
+   bool fEnablePageStatistics = true;
 
 public:
    virtual ~RNTupleWriteOptions() = default;
@@ -86,6 +88,9 @@ public:
 
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   bool GetEnablePageStatistics() const { return fEnablePageStatistics; }
+   void SetEnablePageStatistics(bool val) { fEnablePageStatistics = val; }
 };
 
 // clang-format off
@@ -140,12 +145,27 @@ public:
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// If larger than fClusterBunchSize, the cluster pool adjusts the number of clusters per vector read at runtime
+   /// between 1 and this value, starting from fClusterBunchSize, depending on the observed I/O and processing times
+   unsigned int fMaxClusterBunchSize = 1;
+   /// Page sources that support it map the ntuple file into memory instead of reading it. Uncompressed pages
+   /// whose on-disk representation matches the in-memory layout are then used directly from the mapping.
+   bool fUseMemoryMap = false;
+   /// Page sources that support it read the ntuple file bypassing the operating system's page cache (O_DIRECT).
+   /// Useful for large one-pass scans that should not evict other data from the page cache.
+   bool fUseDirectIO = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   unsigned int GetMaxClusterBunchSize() const { return fMaxClusterBunchSize; }
+   void SetMaxClusterBunchSize(unsigned int val) { fMaxClusterBunchSize = val; }
+   bool GetUseMemoryMap() const { return fUseMemoryMap; }
+   void SetUseMemoryMap(bool val) { fUseMemoryMap = val; }
+   bool GetUseDirectIO() const { return fUseDirectIO; }
+   void SetUseDirectIO(bool val) { fUseDirectIO = val; }
 };
 
 } // namespace Experimental
@@ -0,0 +1,132 @@
+/// \file ROOT/RNTupleParallelWriter.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-06-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleParallelWriter
+#define ROOT7_RNTupleParallelWriter
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class TFile;
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Detail {
+class RPageSink;
+class RPageSinkSync;
+} // namespace Detail
+
+class RNTupleFillContext;
+class RNTupleModel;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief A writer to fill an RNTuple from multiple threads
+
+The parallel writer creates fill contexts, which can be used concurrently.  Typically, every thread creates its own
+fill context and fills entries into it.  Each fill context has its own copy of the model and buffers the pages of its
+open cluster.  Pages are compressed by the thread owning the fill context.  When a cluster is committed, its pages are
+handed over to the page sink shared by all fill contexts; a lock is held only for the time of writing the cluster.
+Clusters are ordered by the time they are committed.  Therefore, the order of entries in the resulting ntuple is only
+defined within a cluster.  If the order of entries matters, ordered fill contexts can be used instead.  Their clusters
+are appended in the order of the sequence numbers given on creation.
+
+~~~ {.cpp}
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", "data.root");
+// In every thread
+{
+   auto fillContext = writer->CreateFillContext();
+   auto entry = fillContext->CreateEntry();
+   // ... set the values of the entry
+   fillContext->Fill(*entry);
+}
+~~~
+
+All fill contexts must be destructed before the parallel writer.  The parallel writer commits the page lists and the
+footer on destruction.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// Protects fSink and fFillContexts
+   std::mutex fMutex;
+   /// The sink shared by all fill contexts
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The original model; fill contexts use a clone of it
+   std::unique_ptr<RNTupleModel> fModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// Used to detect fill contexts that are still in use when the writer is destructed
+   std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
+   /// Protects fNextSequenceNumber and fReleasedSinks; must not be acquired while holding fMutex
+   std::mutex fOrderMutex;
+   /// The sequence number of the next ordered fill context whose clusters are appended
+   std::uint64_t fNextSequenceNumber = 0;
+   /// The sinks of destructed ordered fill contexts that wait for their predecessors, keyed by sequence number
+   std::map<std::uint64_t, std::unique_ptr<Detail::RPageSinkSync>> fReleasedSinks;
+
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   std::shared_ptr<RNTupleFillContext>
+   CreateFillContextImpl(std::unique_ptr<RNTupleModel> model, bool isOrdered, std::uint64_t sequenceNumber);
+   /// Called on destruction of an ordered fill context; appends the clusters of all ordered fill contexts whose
+   /// predecessors are done
+   void ReleaseOrderedFillContext(RNTupleFillContext *fillContext, std::uint64_t sequenceNumber);
+
+public:
+   /// Throws an exception if the model is null.  The buffered write option is ignored: pages are always buffered in
+   /// the fill contexts.
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName, std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model is null.  Adds the ntuple to an existing TFile.
+   static std::unique_ptr<RNTupleParallelWriter> Append(std::unique_ptr<RNTupleModel> model,
+                                                        std::string_view ntupleName, TFile &file,
+                                                        const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Creates a new fill context with its own clone of the model.  Entries filled into a fill context must be
+   /// created by that fill context.  This method is thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
+   /// Creates a new fill context that uses the given model instead of a clone of the writer's model, e.g. in order to
+   /// fill untyped collections through the collection writers of the model.  The model needs to have the same fields
+   /// as the writer's model.  This method is thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext(std::unique_ptr<RNTupleModel> model);
+   /// Creates a new fill context whose clusters are appended only when the fill context is destructed and after the
+   /// clusters of all the ordered fill contexts with smaller sequence numbers.  Sequence numbers start at zero and must
+   /// be used exactly once.  If no model is given, the fill context uses a clone of the writer's model.  This method is
+   /// thread-safe.
+   std::shared_ptr<RNTupleFillContext>
+   CreateOrderedFillContext(std::uint64_t sequenceNumber, std::unique_ptr<RNTupleModel> model = nullptr);
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
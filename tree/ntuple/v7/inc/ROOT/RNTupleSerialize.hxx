@@ -63,6 +63,7 @@ public:
    static constexpr std::uint32_t kFlagSortAscColumn     = 0x01;
    static constexpr std::uint32_t kFlagSortDesColumn     = 0x02;
    static constexpr std::uint32_t kFlagNonNegativeColumn = 0x04;
+   static constexpr std::uint32_t kFlagHasValueRange     = 0x08;
 
    static constexpr DescriptorId_t kZeroFieldId = std::uint64_t(-2);
 
@@ -98,6 +99,10 @@ public:
       std::vector<DescriptorId_t> fOnDisk2MemColumnIDs;
       std::vector<DescriptorId_t> fOnDisk2MemClusterIDs;
       std::vector<DescriptorId_t> fOnDisk2MemClusterGroupIDs;
+      /// The number of on-disk fields and columns described by the header.  Fields and columns mapped later on,
+      /// i.e. the ones added by a schema update during writing, are described by the footer's schema extension.
+      std::size_t fNHeaderFields = 0;
+      std::size_t fNHeaderColumns = 0;
 
    public:
       void SetHeaderSize(std::uint32_t size) { fHeaderSize = size; }
@@ -129,6 +134,18 @@ public:
          fOnDisk2MemClusterGroupIDs.push_back(memId);
          return onDiskId;
       }
+      /// Marks the fields and columns mapped so far as part of the header
+      void MarkHeaderSchema()
+      {
+         fNHeaderFields = fOnDisk2MemFieldIDs.size();
+         fNHeaderColumns = fOnDisk2MemColumnIDs.size();
+      }
+      std::size_t GetNHeaderFields() const { return fNHeaderFields; }
+      std::size_t GetNHeaderColumns() const { return fNHeaderColumns; }
+      std::size_t GetNFields() const { return fOnDisk2MemFieldIDs.size(); }
+      std::size_t GetNColumns() const { return fOnDisk2MemColumnIDs.size(); }
+      bool HasOnDiskFieldId(DescriptorId_t memId) const { return fMem2OnDiskFieldIDs.count(memId) > 0; }
+      bool HasOnDiskColumnId(DescriptorId_t memId) const { return fMem2OnDiskColumnIDs.count(memId) > 0; }
       DescriptorId_t GetOnDiskFieldId(DescriptorId_t memId) const { return fMem2OnDiskFieldIDs.at(memId); }
       DescriptorId_t GetOnDiskColumnId(DescriptorId_t memId) const { return fMem2OnDiskColumnIDs.at(memId); }
       DescriptorId_t GetOnDiskClusterId(DescriptorId_t memId) const { return fMem2OnDiskClusterIDs.at(memId); }
@@ -167,6 +184,10 @@ public:
    static std::uint32_t SerializeUInt64(std::uint64_t val, void *buffer);
    static std::uint32_t DeserializeUInt64(const void *buffer, std::uint64_t &val);
 
+   /// Doubles are stored as their IEEE-754 bit pattern in a little-endian 64bit integer
+   static std::uint32_t SerializeDouble(double val, void *buffer);
+   static std::uint32_t DeserializeDouble(const void *buffer, double &val);
+
    static std::uint32_t SerializeString(const std::string &val, void *buffer);
    static RResult<std::uint32_t> DeserializeString(const void *buffer, std::uint32_t bufSize, std::string &val);
 
@@ -213,6 +234,9 @@ public:
                                                          RClusterGroup &clusterGroup);
 
    static RContext SerializeHeaderV1(void *buffer, const RNTupleDescriptor &desc);
+   /// Maps the fields and physical columns of `desc` that were added after the header serialization.  They are
+   /// written to the schema extension of the footer.
+   static void MapSchemaExtension(const RNTupleDescriptor &desc, RContext &context);
    static std::uint32_t SerializePageListV1(void *buffer,
                                             const RNTupleDescriptor &desc,
                                             std::span<DescriptorId_t> physClusterIDs,
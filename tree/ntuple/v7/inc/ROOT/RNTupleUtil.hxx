@@ -17,6 +17,7 @@
 #define ROOT7_RNTupleUtil
 
 #include <cstdint>
+#include <limits>
 
 #include <string>
 #include <variant>
@@ -143,6 +144,9 @@ struct RNTupleLocator {
       kTypeFile = 0x00,
       kTypeURI = 0x01,
       kTypeDAOS = 0x02,
+      /// Not serializable (the on-disk type field has 7 bits): marks the zero pages that readers synthesize for
+      /// columns that are absent from a cluster.  Zero pages have no payload and read as zero-valued elements.
+      kTypePageZero = 0x80,
    };
 
    /// Simple on-disk locators consisting of a 64-bit offset use variant type `uint64_t`; extended locators have
@@ -165,6 +169,21 @@ struct RNTupleLocator {
    }
 };
 
+/// Summary of the values of a column in a page or in a cluster, used to skip data that cannot pass a selection.
+/// Statistics are only recorded for columns of arithmetic C++ type with a lossless on-disk encoding.  NaN values are
+/// ignored.  Values that cannot be represented exactly as double are rounded outwards.
+struct RColumnStatistics {
+   double fMin = std::numeric_limits<double>::infinity();
+   double fMax = -std::numeric_limits<double>::infinity();
+
+   /// False if there are no statistics or if there are no values other than NaN
+   bool HasRange() const { return fMin <= fMax; }
+   /// Whether some of the values may lie within [min, max]; true if the value range is unknown
+   bool MayOverlap(double min, double max) const { return !HasRange() || ((fMin <= max) && (fMax >= min)); }
+
+   bool operator==(const RColumnStatistics &other) const { return fMin == other.fMin && fMax == other.fMax; }
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -209,6 +209,28 @@ public:
    {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Fills `count` consecutive values starting at `globalIndex` into the array `to` of already constructed objects.
+   /// For mappable types, the values are copied page-wise; use MapV() for zero-copy access.
+   void ReadBulk(NTupleSize_t globalIndex, std::size_t count, T *to) { fField.ReadBulk(globalIndex, count, to); }
+   void ReadBulk(const RClusterIndex &clusterIndex, std::size_t count, T *to)
+   {
+      fField.ReadBulk(clusterIndex, count, to);
+   }
+
+   /// For dictionary-encoded string fields, compare entries by their cluster-local dictionary ids instead of
+   /// by their string values; see RField<std::string>.
+   template <typename C = T, std::enable_if_t<std::is_same_v<C, std::string>, C *> = nullptr>
+   std::uint32_t GetDictionaryId(NTupleSize_t globalIndex)
+   {
+      return fField.GetDictionaryId(globalIndex);
+   }
+
+   template <typename C = T, std::enable_if_t<std::is_same_v<C, std::string>, C *> = nullptr>
+   std::uint32_t FindDictionaryId(NTupleSize_t globalIndex, std::string_view value)
+   {
+      return fField.FindDictionaryId(globalIndex, value);
+   }
 };
 
 
@@ -254,6 +276,17 @@ public:
                                  collectionStart.GetIndex() + size);
    }
 
+   /// Bulk read of the coordinates of up to `count` consecutive collections starting at `globalIndex`.  Reading stops
+   /// at the end of the cluster, so that the items of all the returned collections are consecutive; they can be read in
+   /// one go by RNTupleView::ReadBulk() of an item view starting at `itemStart`.  The `offsets` array needs to hold
+   /// count + 1 values; the i-th collection spans the items [offsets[i], offsets[i + 1]) relative to `itemStart`.
+   /// Returns the number of collections read.
+   std::size_t
+   ReadBulkOffsets(NTupleSize_t globalIndex, std::size_t count, ClusterSize_t *offsets, RClusterIndex &itemStart)
+   {
+      return fField.GetCollectionInfoV(globalIndex, count, &itemStart, offsets);
+   }
+
    /// Raises an exception if there is no field with the given name.
    template <typename T>
    RNTupleView<T> GetView(std::string_view fieldName) {
@@ -40,6 +40,10 @@ with the page pool and allocated/freed by the page storage.
 // clang-format on
 class RPage {
 public:
+   /// The size of the shared, read-only buffer of zero bytes that backs the pages of columns that are absent from
+   /// a cluster; see MakePageZero()
+   static constexpr std::size_t kPageZeroSize = 0x10000;
+
    /**
     * Stores information about the cluster in which this page resides.
     */
@@ -127,7 +131,17 @@ public:
       fClusterInfo = RClusterInfo(clusterId, fClusterInfo.GetIndexOffset());
    }
 
+   /// Returns a page of zero-valued elements of the given size that is backed by a shared, read-only buffer.
+   /// The page must not be written to and its buffer must not be freed.
+   static RPage MakePageZero(ColumnId_t columnId, ClusterSize_t::ValueType elementSize)
+   {
+      return RPage{columnId, const_cast<void *>(GetPageZeroBuffer()), elementSize,
+                   ClusterSize_t::ValueType(kPageZeroSize / elementSize)};
+   }
+   static const void *GetPageZeroBuffer();
+
    bool IsNull() const { return fBuffer == nullptr; }
+   bool IsPageZero() const { return fBuffer == GetPageZeroBuffer(); }
    bool IsEmpty() const { return fNElements == 0; }
    bool operator ==(const RPage &other) const { return fBuffer == other.fBuffer; }
    bool operator !=(const RPage &other) const { return !(*this == other); }
@@ -16,11 +16,19 @@
 #ifndef ROOT7_RPageAllocator
 #define ROOT7_RPageAllocator
 
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPage.hxx>
 
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -77,6 +85,131 @@ public:
    static void DeletePage(const RPage &page);
 };
 
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageBufferAllocator
+\ingroup NTuple
+\brief Thread-safe allocator that recycles page and compression buffers
+
+Buffer sizes are rounded up to the next power of two, starting at 64 bytes.  Released buffers are kept in a free list
+per size class and handed out again by subsequent allocations of the same size class, so that reading or writing
+many clusters with similarly sized pages does not go through the global heap for every page.  Each buffer carries
+a small hidden header with its size class, such that buffers can be released without knowing their size.  The total
+size of the cached buffers is limited by a cache budget; buffers that do not fit in the budget or that are larger than
+half of the budget are returned to the heap.  Unless constructed with an explicit limit, all allocators of the process
+share a single budget, so that the memory kept for reuse does not grow with the number of open page sources and sinks.
+
+The allocator counts cache hits and misses in its own RNTupleMetrics object, which page sources and sinks register
+as observed metrics.
+*/
+// clang-format on
+class RPageBufferAllocator {
+public:
+   /// Returns a buffer to the allocator it was acquired from
+   class RDeleter {
+   private:
+      RPageBufferAllocator *fAllocator = nullptr;
+
+   public:
+      RDeleter() = default;
+      explicit RDeleter(RPageBufferAllocator *allocator) : fAllocator(allocator) {}
+      void operator()(unsigned char *buffer) const
+      {
+         if (buffer)
+            fAllocator->Release(buffer);
+      }
+   };
+   using RBufferPtr = std::unique_ptr<unsigned char[], RDeleter>;
+
+   /// Upper limit for the sum of the cached buffers of all the allocators that use the budget
+   class RCacheBudget {
+   private:
+      std::atomic<std::size_t> fNBytesCached{0};
+      const std::size_t fMaxBytes;
+
+   public:
+      explicit RCacheBudget(std::size_t maxBytes) : fMaxBytes(maxBytes) {}
+      /// Returns false and leaves the budget unchanged if nbytes do not fit
+      bool TryReserve(std::size_t nbytes)
+      {
+         if (fNBytesCached.fetch_add(nbytes) + nbytes <= fMaxBytes)
+            return true;
+         fNBytesCached -= nbytes;
+         return false;
+      }
+      void Return(std::size_t nbytes) { fNBytesCached -= nbytes; }
+      std::size_t GetNBytesCached() const { return fNBytesCached.load(); }
+      std::size_t GetMaxBytes() const { return fMaxBytes; }
+   };
+
+   /// The process-wide budget keeps at most 64 MiB of released buffers for reuse
+   static constexpr std::size_t kDefaultMaxCachedBytes = 64 * 1024 * 1024;
+   /// The budget used by all allocators that are not constructed with their own limit
+   static std::shared_ptr<RCacheBudget> GetSharedCacheBudget();
+
+private:
+   /// The smallest size class holds buffers of 2^kMinSizeShift bytes
+   static constexpr std::size_t kMinSizeShift = 6;
+   /// The largest size class holds buffers of 2^kMaxSizeShift bytes; larger buffers are never cached
+   static constexpr std::size_t kMaxSizeShift = 30;
+   static constexpr std::size_t kNSizeClasses = kMaxSizeShift - kMinSizeShift + 1;
+   /// Marks a buffer in the hidden header that is not subject to caching
+   static constexpr std::uint32_t kNoSizeClass = 0xFFFFFFFF;
+   /// The hidden header in front of every buffer; its size maintains the alignment guaranteed by operator new[]
+   static constexpr std::size_t kHeaderSize = 16;
+
+   struct RSizeClass {
+      std::mutex fLock;
+      std::vector<unsigned char *> fFreeBuffers;
+   };
+
+   /// I/O performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNHit;
+      RNTupleAtomicCounter &fNMiss;
+   };
+
+   std::array<RSizeClass, kNSizeClasses> fSizeClasses;
+   /// Sum of the sizes of the buffers in the free lists of this allocator
+   std::atomic<std::size_t> fNBytesCached{0};
+   std::shared_ptr<RCacheBudget> fBudget;
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+
+   static std::uint32_t GetSizeClass(std::size_t nbytes);
+
+public:
+   /// Uses the process-wide cache budget
+   explicit RPageBufferAllocator(const std::string &name = "RPageBufferAllocator");
+   /// Uses a budget private to this allocator
+   RPageBufferAllocator(const std::string &name, std::size_t maxCachedBytes);
+   RPageBufferAllocator(const std::string &name, std::shared_ptr<RCacheBudget> budget);
+   RPageBufferAllocator(const RPageBufferAllocator &other) = delete;
+   RPageBufferAllocator &operator=(const RPageBufferAllocator &other) = delete;
+   ~RPageBufferAllocator();
+
+   /// Returns a buffer of at least nbytes; the buffer must be given back by Release()
+   unsigned char *Acquire(std::size_t nbytes);
+   /// Puts the buffer in the free list of its size class or frees it
+   void Release(unsigned char *buffer);
+   RBufferPtr Allocate(std::size_t nbytes) { return RBufferPtr(Acquire(nbytes), RDeleter(this)); }
+
+   /// Same semantics as RPageAllocatorHeap::NewPage() but with a recycled buffer
+   RPage NewPage(ColumnId_t columnId, std::size_t elementSize, std::size_t nElements);
+   /// Releases the page buffer; the page must have been created by this allocator or with a buffer from Acquire()
+   void DeletePage(const RPage &page);
+   /// A page deleter that hands pages backed by a buffer of this allocator back to it
+   RPageDeleter MakePageDeleter();
+
+   /// Frees all cached buffers
+   void Trim();
+   std::size_t GetNBytesCached() const { return fNBytesCached.load(); }
+   std::size_t GetMaxCachedBytes() const { return fBudget->GetMaxBytes(); }
+   const RCacheBudget &GetCacheBudget() const { return *fBudget; }
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
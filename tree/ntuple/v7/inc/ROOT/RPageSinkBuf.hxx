@@ -20,6 +20,8 @@
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <algorithm>
+#include <atomic>
 #include <deque>
 #include <iterator>
 #include <memory>
@@ -35,6 +37,12 @@ namespace Detail {
 \ingroup NTuple
 \brief Wrapper sink that coalesces cluster column page writes
 *
+* If a task scheduler is set, pages are sealed (packed and compressed) by concurrent tasks as soon as they are
+* committed. Writing a committed cluster to the inner sink is deferred until all its pages are sealed, so that
+* compressing the tail of a cluster overlaps with filling the next cluster. The pending cluster is written at the
+* latest on the next cluster commit, or earlier if the buffered data of the pending and the open cluster exceed
+* the maximum uncompressed cluster size (back-pressure).
+*
 * TODO(jblomer): The interplay of derived class and RPageSink is not yet optimally designed for page storage wrapper
 * classes like this one. Header and footer serialization, e.g., are done twice.  To be revised.
 */
@@ -48,13 +56,15 @@ private:
       struct RPageZipItem {
          RPage fPage;
          // Compression scratch buffer for fSealedPage.
-         std::unique_ptr<unsigned char[]> fBuf;
+         RPageBufferAllocator::RBufferPtr fBuf;
          RPageStorage::RSealedPage *fSealedPage = nullptr;
          explicit RPageZipItem(RPage page)
             : fPage(page), fBuf(nullptr) {}
          bool IsSealed() const { return fSealedPage != nullptr; }
-         void AllocateSealedPageBuf() {
-            fBuf = std::make_unique<unsigned char[]>(fPage.GetNBytes());
+         /// The buffer needs to hold the packed page, which can be larger than the in-memory page
+         /// for column types with a page header
+         void AllocateSealedPageBuf(std::size_t nBytesPacked, RPageBufferAllocator &allocator) {
+            fBuf = allocator.Allocate(std::max<std::size_t>(fPage.GetNBytes(), nBytesPacked));
          }
       };
    public:
@@ -111,20 +121,49 @@ private:
       RPageStorage::SealedPageSequence_t fSealedPages;
    };
 
+   /// The buffered pages of a cluster until the cluster is written to the inner sink
+   struct RBufferedCluster {
+      /// Vector of buffered column pages. Indexed by column id.
+      std::vector<RColumnBuf> fColumns;
+      /// Number of pages that are still being sealed by a concurrent task
+      std::atomic<std::size_t> fNPagesToSeal{0};
+      /// Sum of the uncompressed sizes of the buffered pages
+      std::size_t fNBytesBuffered = 0;
+      /// The number of entries passed to CommitCluster()
+      NTupleSize_t fNEntries = 0;
+
+      explicit RBufferedCluster(std::size_t nColumns) : fColumns(nColumns) {}
+   };
+
 private:
    /// I/O performance counters that get registered in fMetrics
    struct RCounters {
       RNTuplePlainCounter &fParallelZip;
+      RNTuplePlainCounter &fNZipWait;
    };
    std::unique_ptr<RCounters> fCounters;
    RNTupleMetrics fMetrics;
    /// The inner sink, responsible for actually performing I/O.
    std::unique_ptr<RPageSink> fInnerSink;
+   /// Recycles the compression scratch buffers of the zip items; needs to outlive the buffered clusters
+   std::unique_ptr<RPageBufferAllocator> fBufferAllocator;
    /// The buffered page sink maintains a copy of the RNTupleModel for the inner sink.
    /// For the unbuffered case, the RNTupleModel is instead managed by a RNTupleWriter.
    std::unique_ptr<RNTupleModel> fInnerModel;
-   /// Vector of buffered column pages. Indexed by column id.
-   std::vector<RColumnBuf> fBufferedColumns;
+   /// The cluster that is currently being filled
+   std::unique_ptr<RBufferedCluster> fOpenCluster;
+   /// A committed cluster whose pages may still be sealed by concurrent tasks; only used with a task scheduler
+   std::unique_ptr<RBufferedCluster> fPendingCluster;
+   /// Sum of the uncompressed and the compressed sizes of the clusters written so far.  Used to estimate the
+   /// compressed size of a pending cluster.
+   std::uint64_t fNBytesUnzippedWritten = 0;
+   std::uint64_t fNBytesZippedWritten = 0;
+
+   /// Writes the buffered pages of the given cluster to the inner sink and commits the cluster there.
+   /// Returns the number of bytes written by the inner sink.
+   std::uint64_t WriteCluster(RBufferedCluster &cluster);
+   /// Waits for the pending cluster to be sealed, if necessary, and writes it
+   void FlushPendingCluster();
 
 protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
@@ -140,7 +179,10 @@ public:
    RPageSinkBuf& operator=(const RPageSinkBuf&) = delete;
    RPageSinkBuf(RPageSinkBuf&&) = default;
    RPageSinkBuf& operator=(RPageSinkBuf&&) = default;
-   ~RPageSinkBuf() override = default;
+   ~RPageSinkBuf() override;
+
+   /// Replicates the schema changes in the model of the inner sink
+   void UpdateSchema(const RNTupleModelChangeset &changeset, NTupleSize_t firstEntry) final;
 
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
    void ReleasePage(RPage &page) final;
@@ -0,0 +1,117 @@
+/// \file ROOT/RPageSinkSync.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-06-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageSinkSync
+#define ROOT7_RPageSinkSync
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkSync
+\ingroup NTuple
+\brief Wrapper sink that seals the pages of a cluster locally and commits complete clusters to a shared sink
+*
+* Several synchronized sinks can write into the same inner sink from different threads.  Pages are sealed (packed and
+* compressed) by the thread that commits them, without holding any lock.  The sealed pages of the open cluster are
+* buffered until the cluster is committed.  Only then, the pages and the cluster are handed over to the inner sink
+* while holding the given mutex.  The entry range of the cluster is determined at this point, i.e. clusters are
+* ordered by the time of their commit.
+*
+* The synchronized sink does not write a header, page lists, or a footer; the owner of the inner sink creates the
+* inner sink with the same model and is responsible for committing the cluster groups and the dataset.
+*
+* If the commit is deferred, committed clusters are kept until CommitDeferredClusters() is called.  This way, the owner
+* can define the order in which the clusters of several synchronized sinks are appended to the inner sink.
+*/
+// clang-format on
+class RPageSinkSync : public RPageSink {
+private:
+   /// I/O performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNClusterCommitted;
+      RNTupleAtomicCounter &fTimeWallLock;
+   };
+
+   /// The shared sink; must outlive the synchronized sink
+   RPageSink *fInnerSink;
+   /// Protects fInnerSink
+   std::mutex *fInnerSinkMutex;
+   /// Provides the write pages as well as the buffers of the sealed pages
+   std::unique_ptr<RPageBufferAllocator> fBufferAllocator;
+   std::unique_ptr<RCounters> fSyncCounters;
+   /// The sealed pages of the open cluster. Indexed by column id.
+   std::vector<SealedPageSequence_t> fSealedPages;
+   /// Owns the memory of fSealedPages
+   std::vector<RPageBufferAllocator::RBufferPtr> fSealedPageBuffers;
+   /// Whether page statistics are computed when sealing a page for the inner sink
+   bool fWithStatistics = false;
+   /// The number of entries of this sink passed to CommitCluster() so far
+   NTupleSize_t fNEntriesCommitted = 0;
+
+   /// A committed cluster that is not yet handed over to the inner sink
+   struct RDeferredCluster {
+      std::vector<SealedPageSequence_t> fSealedPages;
+      std::vector<RPageBufferAllocator::RBufferPtr> fSealedPageBuffers;
+      NTupleSize_t fNEntries = 0;
+   };
+   /// Whether clusters are handed over to the inner sink only by CommitDeferredClusters()
+   bool fDeferCommit = false;
+   std::vector<RDeferredCluster> fDeferredClusters;
+
+   void BufferSealedPage(DescriptorId_t physicalColumnId, RSealedPage &&sealedPage,
+                         RPageBufferAllocator::RBufferPtr buffer);
+   /// Appends a cluster of `nEntries` consisting of the given pages to the inner sink; the caller holds the mutex
+   std::uint64_t CommitToInnerSink(const std::vector<SealedPageSequence_t> &sealedPages, NTupleSize_t nEntries);
+
+protected:
+   void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t physicalColumnId, const RSealedPage &sealedPage) final;
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final;
+   RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) final;
+   void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) final;
+
+public:
+   RPageSinkSync(RPageSink &inner, std::mutex &innerMutex, bool deferCommit = false);
+   RPageSinkSync(const RPageSinkSync &) = delete;
+   RPageSinkSync &operator=(const RPageSinkSync &) = delete;
+   ~RPageSinkSync() override = default;
+
+   /// Throws; the clusters of several synchronized sinks could otherwise be appended with different schemas
+   void UpdateSchema(const RNTupleModelChangeset &changeset, NTupleSize_t firstEntry) final;
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
+   void ReleasePage(RPage &page) final;
+
+   /// If the commit is deferred, appends the clusters committed so far to the inner sink
+   void CommitDeferredClusters();
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
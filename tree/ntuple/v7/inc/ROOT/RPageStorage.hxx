@@ -39,6 +39,7 @@ namespace ROOT {
 namespace Experimental {
 
 class RNTupleModel;
+struct RNTupleModelChangeset;
 // TODO(jblomer): factory methods to create tree sinks and sources outside Detail namespace
 
 namespace Detail {
@@ -87,6 +88,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// Set by the producer of the sealed page, if known; stored in the page list by the sink
+      RColumnStatistics fStatistics;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -109,6 +112,16 @@ public:
       }
    };
 
+   /// Compresses the packed page `packed` of `packedBytes` bytes into `buf` and returns the size of the sealed page.
+   /// The packed header of the element, if any, is copied uncompressed in front of the compressed rest of the page.
+   static std::size_t ZipPackedPage(const RColumnElementBase &element, const void *packed, std::size_t packedBytes,
+                                    int compressionSetting, void *buf);
+   /// The size of the packed page that the sealed page decompresses to
+   static std::size_t GetPackedSize(const RSealedPage &sealedPage, const RColumnElementBase &element);
+   /// Decompresses the sealed page into `packed`, which must provide GetPackedSize(sealedPage, element) bytes
+   static void UnzipPackedPage(const RSealedPage &sealedPage, const RColumnElementBase &element,
+                               RNTupleDecompressor &decompressor, void *packed);
+
 protected:
    std::string fNTupleName;
    RTaskScheduler *fTaskScheduler = nullptr;
@@ -257,6 +270,8 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return *fOptions; }
+   /// Returns the descriptor of the data written so far; it is only meaningful after Create() was called.
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -265,6 +280,11 @@ public:
    /// To do so, Create() calls CreateImpl() after updating the descriptor.
    /// Create() associates column handles to the columns referenced by the model
    void Create(RNTupleModel &model);
+   /// Adds the fields of the changeset, which have been added to the model after Create(), to the descriptor and
+   /// connects them to the sink.  The current cluster must be empty.  The new fields are part of the clusters from
+   /// `firstEntry` on; the earlier clusters do not contain the new columns.  Readers present the new fields with
+   /// default values for these entries.  The fields and columns are stored in the footer's schema extension.
+   virtual void UpdateSchema(const RNTupleModelChangeset &changeset, NTupleSize_t firstEntry);
    /// Write a page to the storage. The column must have been added before.
    void CommitPage(ColumnHandle_t columnHandle, const RPage &page);
    /// Write a preprocessed page to storage. The column must have been added before.
@@ -358,6 +378,7 @@ protected:
       RNTupleAtomicCounter &fNClusterLoaded;
       RNTupleAtomicCounter &fNPageLoaded;
       RNTupleAtomicCounter &fNPagePopulated;
+      RNTupleAtomicCounter &fNPageMapped;
       RNTupleAtomicCounter &fTimeWallRead;
       RNTupleAtomicCounter &fTimeWallUnzip;
       RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuRead;
@@ -394,6 +415,9 @@ protected:
    /// Not all page sources need a decompressor (e.g. virtual ones for chains and friends don't), thus we
    /// leave it up to the derived class whether or not the decompressor gets constructed.
    std::unique_ptr<RNTupleDecompressor> fDecompressor;
+   /// Recycles the buffers of unsealed pages across clusters. Concrete page sources should use the page deleter
+   /// of the allocator for pages populated from UnsealPage(). Its counters are observed by the default metrics.
+   std::unique_ptr<RPageBufferAllocator> fPageBufferAllocator;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
    // Only called if a task scheduler is set. No-op be default.
@@ -403,8 +427,15 @@ protected:
    /// Helper for unstreaming a page. This is commonly used in derived, concrete page sources.  The implementation
    /// currently always makes a memory copy, even if the sealed page is uncompressed and in the final memory layout.
    /// The optimization of directly mapping pages is left to the concrete page source implementations.
-   /// Usage of this method requires construction of fDecompressor.
-   std::unique_ptr<unsigned char []> UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element);
+   /// Usage of this method requires construction of fDecompressor.  The returned buffer as well as the intermediate
+   /// buffer for packed pages are taken from fPageBufferAllocator.
+   RPageBufferAllocator::RBufferPtr UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element);
+
+   /// Helper for the pages of columns that are absent from a cluster (see RNTupleLocator::kTypePageZero).  The
+   /// returned page is a view of the shared zero buffer; nothing is read or allocated.  Zero pages are not registered
+   /// with the page pool, thus concrete page sources must not return them to the pool in ReleasePage().
+   static RPage PopulatePageZero(ColumnId_t columnId, std::uint32_t elementSize, std::uint32_t nElements,
+                                 NTupleSize_t rangeFirst, const RPage::RClusterInfo &clusterInfo);
 
    /// Enables the default set of metrics provided by RPageSource. `prefix` will be used as the prefix for
    /// the counters registered in the internal RNTupleMetrics object.
@@ -476,6 +507,14 @@ public:
    /// concurrently to other methods of the page source.
    virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) = 0;
 
+   /// Receives the index of a cluster key passed to LoadClustersStreamed() and the corresponding loaded cluster
+   using RClusterCallback_t = std::function<void(std::size_t, std::unique_ptr<RCluster>)>;
+   /// Like LoadClusters() but hands over every cluster to `onClusterLoaded` as soon as all its pages are read, such
+   /// that the processing of the first clusters can overlap with the I/O of the remaining ones.  Clusters may be
+   /// handed over in any order; the callback runs in the calling thread.  The default implementation hands over
+   /// the clusters after LoadClusters() returned.
+   virtual void LoadClustersStreamed(std::span<RCluster::RKey> clusterKeys, const RClusterCallback_t &onClusterLoaded);
+
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
    /// unzip thread. It is an optional optimization, the method can safely do nothing. In particular, the
@@ -142,7 +142,7 @@ Objects can correspond to pages or clusters of pages depending on the RNTuple-DA
 // clang-format on
 class RPageSinkDaos : public RPageSink {
 private:
-   std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
+   std::unique_ptr<RPageBufferAllocator> fPageAllocator;
 
    /// \brief Underlying DAOS container. An internal `std::shared_ptr` keep the pool connection alive.
    /// ISO C++ ensures the correct destruction order, i.e., `~RDaosContainer` is invoked first
@@ -58,7 +58,7 @@ The written file can be either in ROOT format or in RNTuple bare format.
 // clang-format on
 class RPageSinkFile : public RPageSink {
 private:
-   std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
+   std::unique_ptr<RPageBufferAllocator> fPageAllocator;
 
    std::unique_ptr<Internal::RNTupleFileWriter> fWriter;
    /// Number of bytes committed to storage in the current cluster
@@ -142,6 +142,10 @@ private:
    RNTupleDescriptorBuilder fDescriptorBuilder;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// If memory mapping is enabled by the read options, the entire file is mapped read-only into memory.
+   /// On-disk pages of clusters reference the mapping; uncompressed pages are used in place by RColumn.
+   unsigned char *fMappedFile = nullptr;
+   std::size_t fMappedFileSize = 0;
 
    /// Deserialized header and footer into a minimal descriptor held by fDescriptorBuilder
    void InitDescriptor(const Internal::RFileNTupleAnchor &anchor);
@@ -153,13 +157,41 @@ private:
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
 
-   /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
-   /// read requests for a given cluster and columns.  The reead requests are appended to
-   /// the provided vector.  This way, requests can be collected for multiple clusters before
-   /// sending them to RRawFile::ReadV().
-   std::unique_ptr<RCluster> PrepareSingleCluster(
+   /// The location of a page on storage and in the read buffer of its cluster
+   struct ROnDiskPageLocator {
+      DescriptorId_t fColumnId = 0;
+      NTupleSize_t fPageNo = 0;
+      std::uint64_t fOffset = 0;
+      std::uint64_t fSize = 0;
+      std::size_t fBufPos = 0;
+   };
+
+   /// The memory buffer layout of a cluster as determined by PrepareSingleCluster()
+   struct RClusterBufferInfo {
+      /// The size of the buffer, including the gaps between pages that are read along with the pages
+      std::size_t fSize = 0;
+      /// The part of the tolerated read overhead that was not used to coalesce the pages of the cluster.  Used to
+      /// coalesce the first read request of the cluster with the last read request of the previous cluster.
+      std::size_t fSpareOverhead = 0;
+   };
+
+   /// Helper function for LoadClusters: it determines the on-disk pages and the coalesced read requests for a given
+   /// cluster and columns.  The pages and the read requests are appended to the provided vectors.  This way, requests
+   /// can be collected for multiple clusters before sending them to RRawFile::ReadV().  The buffer positions of the
+   /// pages and the buffer addresses of the read requests are offsets into the cluster's memory buffer, which is
+   /// allocated by the caller.
+   RClusterBufferInfo PrepareSingleCluster(
       const RCluster::RKey &clusterKey,
+      std::vector<ROnDiskPageLocator> &onDiskPages,
       std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
+   /// Helper function for LoadClusters if the file is memory-mapped: the on-disk pages reference the mapping.
+   std::unique_ptr<RCluster> MapSingleCluster(const RCluster::RKey &clusterKey);
+   /// Maps the file into memory if requested by the read options and supported by fFile
+   void MapFile();
+   /// Returns a page that references the sealed page in place, provided that the sealed page is inside the
+   /// memory-mapped file, uncompressed, suitably aligned, and that its element type is mappable.
+   /// Otherwise, returns a null page.
+   RPage MapPage(ColumnId_t columnId, const RSealedPage &sealedPage, const RColumnElementBase &element);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
@@ -185,6 +217,9 @@ public:
    LoadSealedPage(DescriptorId_t physicalColumnId, const RClusterIndex &clusterIndex, RSealedPage &sealedPage) final;
 
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final;
+   /// The read requests of all the clusters are submitted in a single vector read; with io_uring, a cluster is
+   /// handed over as soon as its requests completed
+   void LoadClustersStreamed(std::span<RCluster::RKey> clusterKeys, const RClusterCallback_t &onClusterLoaded) final;
 };
 
 
@@ -33,6 +33,12 @@ ROOT::Experimental::Detail::ROnDiskPageMapHeap::~ROnDiskPageMapHeap() = default;
 ////////////////////////////////////////////////////////////////////////////////
 
 
+ROOT::Experimental::Detail::ROnDiskPageMapShared::~ROnDiskPageMapShared() = default;
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
 const ROOT::Experimental::Detail::ROnDiskPage *
 ROOT::Experimental::Detail::RCluster::GetOnDiskPage(const ROnDiskPage::Key &key) const
 {
@@ -48,10 +48,12 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
    return fClusterKey.fClusterId < other.fClusterKey.fClusterId;
 }
 
-ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize,
+                                                       unsigned int maxClusterBunchSize)
    : fPageSource(pageSource)
-   , fClusterBunchSize(clusterBunchSize)
-   , fPool(2 * clusterBunchSize)
+   , fBunchSizeAdapter(clusterBunchSize, maxClusterBunchSize)
+   , fIsAdaptive(maxClusterBunchSize > clusterBunchSize)
+   , fPool(2 * fBunchSizeAdapter.GetMaxBunchSize())
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
@@ -131,32 +133,35 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
-         auto clusters = fPageSource.LoadClusters(clusterKeys);
-         bool unzipQueueDirty = false;
-         for (std::size_t i = 0; i < clusters.size(); ++i) {
+         const auto timeStart = std::chrono::steady_clock::now();
+         // Clusters are handed over to the unzip thread as soon as they arrive, so that decompression overlaps
+         // with reading the remaining clusters of the bunch
+         fPageSource.LoadClustersStreamed(clusterKeys, [this, &readItems](std::size_t i,
+                                                                          std::unique_ptr<RCluster> cluster) {
             // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
             // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
             bool discard;
             {
                std::unique_lock<std::mutex> lock(fLockWorkQueue);
                discard = std::any_of(fInFlightClusters.begin(), fInFlightClusters.end(),
-                                     [thisClusterId = clusters[i]->GetId()](auto &inFlight) {
+                                     [thisClusterId = cluster->GetId()](auto &inFlight) {
                                         return inFlight.fClusterKey.fClusterId == thisClusterId && inFlight.fIsExpired;
                                      });
             }
             if (discard) {
-               clusters[i].reset();
-               readItems[i].fPromise.set_value(std::move(clusters[i]));
+               cluster.reset();
+               readItems[i].fPromise.set_value(std::move(cluster));
             } else {
                // Hand-over the loaded cluster pages to the unzip thread
                std::unique_lock<std::mutex> lock(fLockUnzipQueue);
-               fUnzipQueue.emplace_back(RUnzipItem{std::move(clusters[i]), std::move(readItems[i].fPromise)});
-               unzipQueueDirty = true;
+               fUnzipQueue.emplace_back(RUnzipItem{std::move(cluster), std::move(readItems[i].fPromise)});
+               fCvHasUnzipWork.notify_one();
             }
-         }
-         readItems.erase(readItems.begin(), readItems.begin() + clusters.size());
-         if (unzipQueueDirty)
-            fCvHasUnzipWork.notify_one();
+         });
+         const auto timeRead = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - timeStart).count();
+         fReadTimePerCluster = timeRead / std::max(clusterKeys.size(), std::size_t(1));
+         readItems.erase(readItems.begin(), readItems.begin() + clusterKeys.size());
       }
    } // while (true)
 }
@@ -238,15 +243,50 @@ public:
 
 } // anonymous namespace
 
+void ROOT::Experimental::Detail::RClusterBunchSizeAdapter::Update(std::uint64_t consumeTime, std::uint64_t stallTime,
+                                                                 std::uint64_t readTimePerCluster)
+{
+   // A stall of more than 10% of the processing time indicates that too few clusters are in flight to hide the
+   // I/O latency
+   if (stallTime * 10 > consumeTime) {
+      fBunchSize = std::min(2 * fBunchSize, fMaxBunchSize);
+      fNClustersWithoutStall = 0;
+      return;
+   }
+
+   if (++fNClustersWithoutStall < 2 * fBunchSize)
+      return;
+   fNClustersWithoutStall = 0;
+   // If reading is much faster than processing, a smaller read-ahead window suffices and saves memory
+   if ((fBunchSize > 1) && (4 * readTimePerCluster < consumeTime))
+      fBunchSize--;
+}
+
 ROOT::Experimental::Detail::RCluster *
 ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
                                                      const RCluster::ColumnSet_t &physicalColumns)
 {
+   if (fLastClusterId != kInvalidDescriptorId) {
+      fConsumeTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                           fTimeLastReturn).count();
+   }
+
    std::set<DescriptorId_t> keep;
    RProvides provide;
    {
       auto descriptorGuard = fPageSource.GetSharedDescriptorGuard();
 
+      if (clusterId != fLastClusterId) {
+         // Only linear access is considered for adjusting the bunch size; after a jump, stalls are expected
+         if (fIsAdaptive && (fLastClusterId != kInvalidDescriptorId) &&
+             (descriptorGuard->FindNextClusterId(fLastClusterId) == clusterId)) {
+            fBunchSizeAdapter.Update(fConsumeTime, fStallTime, fReadTimePerCluster.load());
+         }
+         fLastClusterId = clusterId;
+         fConsumeTime = 0;
+         fStallTime = 0;
+      }
+
       // Determine previous cluster ids that we keep if they happen to be in the pool
       auto prev = clusterId;
       for (unsigned int i = 0; i < fWindowPre; ++i) {
@@ -261,8 +301,9 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
       provideInfo.fPhysicalColumnSet = physicalColumns;
       provideInfo.fBunchId = fBunchId;
       provideInfo.fFlags = RProvides::kFlagRequired;
-      for (DescriptorId_t i = 0, next = clusterId; i < 2 * fClusterBunchSize; ++i) {
-         if (i == fClusterBunchSize)
+      const auto clusterBunchSize = fBunchSizeAdapter.GetBunchSize();
+      for (DescriptorId_t i = 0, next = clusterId; i < 2 * clusterBunchSize; ++i) {
+         if (i == clusterBunchSize)
             provideInfo.fBunchId = ++fBunchId;
 
          auto cid = next;
@@ -338,7 +379,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
 
       // Figure out if enough work accumulated to justify I/O calls
       bool skipPrefetch = false;
-      if (provide.GetSize() < fClusterBunchSize) {
+      if (provide.GetSize() < fBunchSizeAdapter.GetBunchSize()) {
          skipPrefetch = true;
          for (const auto &kv : provide) {
             if ((kv.second.fFlags & (RProvides::kFlagRequired | RProvides::kFlagLast)) == 0)
@@ -374,7 +415,9 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
       }
    } // work queue lock guard
 
-   return WaitFor(clusterId, physicalColumns);
+   auto result = WaitFor(clusterId, physicalColumns);
+   fTimeLastReturn = std::chrono::steady_clock::now();
+   return result;
 }
 
 ROOT::Experimental::Detail::RCluster *
@@ -413,7 +456,10 @@ ROOT::Experimental::Detail::RClusterPool::WaitFor(DescriptorId_t clusterId,
          // is released.  We need to release the lock before potentially blocking on the cluster future.
       }
 
+      const auto timeStart = std::chrono::steady_clock::now();
       auto cptr = itr->fFuture.get();
+      fStallTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                         timeStart).count();
       if (result) {
          result->Adopt(std::move(*cptr));
       } else {
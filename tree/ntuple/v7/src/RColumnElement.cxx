@@ -18,9 +18,13 @@
 #include <TError.h>
 
 #include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 template <>
@@ -47,6 +51,22 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
       return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
    case EColumnType::kSplitInt16:
       return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>(nullptr);
+   case EColumnType::kSplitIndex32:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32>>(nullptr);
+   case EColumnType::kSplitDeltaInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitDeltaInt64>>(nullptr);
+   case EColumnType::kSplitDeltaInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitDeltaInt32>>(nullptr);
+   case EColumnType::kSplitDeltaInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitDeltaInt16>>(nullptr);
+   case EColumnType::kBitPackedInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kBitPackedInt64>>(nullptr);
+   case EColumnType::kBitPackedInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kBitPackedInt32>>(nullptr);
+   case EColumnType::kBitPackedInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kBitPackedInt16>>(nullptr);
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<float, EColumnType::kReal32Trunc>>(nullptr);
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<float, EColumnType::kReal32Quant>>(nullptr);
    default: R__ASSERT(false);
    }
    // never here
@@ -71,12 +91,55 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
    case EColumnType::kSplitInt64: return 64;
    case EColumnType::kSplitInt32: return 32;
    case EColumnType::kSplitInt16: return 16;
+   case EColumnType::kSplitIndex32: return 32;
+   case EColumnType::kSplitDeltaInt64: return 64;
+   case EColumnType::kSplitDeltaInt32: return 32;
+   case EColumnType::kSplitDeltaInt16: return 16;
+   case EColumnType::kBitPackedInt64: return 64;
+   case EColumnType::kBitPackedInt32: return 32;
+   case EColumnType::kBitPackedInt16: return 16;
+   case EColumnType::kReal32Trunc: return 31;
+   case EColumnType::kReal32Quant: return 32;
    default: R__ASSERT(false);
    }
    // never here
    return 0;
 }
 
+std::pair<std::uint16_t, std::uint16_t>
+ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(EColumnType type)
+{
+   switch (type) {
+   // Sign, exponent and at least one mantissa bit
+   case EColumnType::kReal32Trunc: return {10, 31};
+   case EColumnType::kReal32Quant: return {1, 32};
+   default: {
+      const auto bits = static_cast<std::uint16_t>(GetBitsOnStorage(type));
+      return {bits, bits};
+   }
+   }
+}
+
+std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetPackedSize(EColumnType type, std::size_t nElements)
+{
+   switch (type) {
+   case EColumnType::kBitPackedInt64:
+   case EColumnType::kBitPackedInt32:
+   case EColumnType::kBitPackedInt16:
+      // All bit-packed column elements share the same page header
+      return RColumnElementBitPackedLE<std::int64_t>::kHeaderSize + (nElements * GetBitsOnStorage(type) + 7) / 8;
+   default: return (nElements * GetBitsOnStorage(type) + 7) / 8;
+   }
+}
+
+std::size_t
+ROOT::Experimental::Detail::RColumnElementBase::GetPackedSize(const RColumnModel &model, std::size_t nElements)
+{
+   if (model.GetBitsOnStorage() == 0)
+      return GetPackedSize(model.GetType(), nElements);
+   return (nElements * model.GetBitsOnStorage() + 7) / 8;
+}
+
 std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnType type) {
    switch (type) {
    case EColumnType::kIndex32: return "Index";
@@ -95,6 +158,15 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
    case EColumnType::kSplitInt64: return "SplitInt64";
    case EColumnType::kSplitInt32: return "SplitInt32";
    case EColumnType::kSplitInt16: return "SplitInt16";
+   case EColumnType::kSplitIndex32: return "SplitIndex32";
+   case EColumnType::kSplitDeltaInt64: return "SplitDeltaInt64";
+   case EColumnType::kSplitDeltaInt32: return "SplitDeltaInt32";
+   case EColumnType::kSplitDeltaInt16: return "SplitDeltaInt16";
+   case EColumnType::kBitPackedInt64: return "BitPackedInt64";
+   case EColumnType::kBitPackedInt32: return "BitPackedInt32";
+   case EColumnType::kBitPackedInt16: return "BitPackedInt16";
+   case EColumnType::kReal32Trunc: return "Real32Trunc";
+   case EColumnType::kReal32Quant: return "Real32Quant";
    default: return "UNKNOWN";
    }
 }
@@ -193,6 +265,391 @@ void ROOT::Experimental::Detail::RColumnElement<
    }
 }
 
+void ROOT::Experimental::Detail::RColumnElement<
+   ROOT::Experimental::ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32>::Pack(void *dst, void *src,
+                                                                                            std::size_t count) const
+{
+   auto indexArray = reinterpret_cast<const ClusterSize_t::ValueType *>(src);
+   auto splitArray = reinterpret_cast<unsigned char *>(dst);
+   ClusterSize_t::ValueType prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      // Index columns are non-decreasing within a page, so the differences are non-negative
+      const auto diff = static_cast<std::uint32_t>(indexArray[i] - prev);
+      prev = indexArray[i];
+      for (std::size_t b = 0; b < 4; ++b) {
+         splitArray[b * count + i] = static_cast<unsigned char>(diff >> (8 * b));
+      }
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElement<
+   ROOT::Experimental::ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32>::Unpack(void *dst, void *src,
+                                                                                              std::size_t count) const
+{
+   auto indexArray = reinterpret_cast<ClusterSize_t::ValueType *>(dst);
+#if R__LITTLE_ENDIAN == 1
+   // Unsplit into the first half of the destination and widen the 32bit differences back to front, such that
+   // no difference is overwritten before it is read
+   UnsplitBytesLE<4>(dst, src, count);
+   auto diffArray = reinterpret_cast<const std::uint32_t *>(dst);
+   for (std::size_t i = count; i-- > 0;) {
+      const ClusterSize_t::ValueType diff = diffArray[i];
+      indexArray[i] = diff;
+   }
+#else
+   UnsplitIntegersLE<4>(indexArray, src, count);
+#endif
+   ClusterSize_t::ValueType prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      prev += indexArray[i];
+      indexArray[i] = prev;
+   }
+}
+
+namespace {
+
+/// Stores the `nBytes` lower bytes of `value` in little-endian order
+void StoreLE(unsigned char *destination, std::uint64_t value, std::size_t nBytes)
+{
+   for (std::size_t b = 0; b < nBytes; ++b)
+      destination[b] = static_cast<unsigned char>(value >> (8 * b));
+}
+
+/// Reads `nBytes` (at most 8) little-endian bytes into a 64bit integer
+std::uint64_t LoadLE(const unsigned char *source, std::size_t nBytes)
+{
+   std::uint64_t result = 0;
+   for (std::size_t b = 0; b < nBytes; ++b)
+      result |= static_cast<std::uint64_t>(source[b]) << (8 * b);
+   return result;
+}
+
+/// Writes the differences of the `count` values to `reference` as a contiguous little-endian bit stream,
+/// using `width` bits per value
+template <typename T>
+void BitPack(unsigned char *destination, const T *values, T reference, std::size_t count, unsigned int width)
+{
+   if (width % 8 == 0) {
+      // Byte-aligned fast path
+      const std::size_t nBytes = width / 8;
+      for (std::size_t i = 0; i < count; ++i)
+         StoreLE(destination + i * nBytes, static_cast<T>(values[i] - reference), nBytes);
+      return;
+   }
+
+   std::uint64_t acc = 0;
+   unsigned int nAcc = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      const std::uint64_t v = static_cast<T>(values[i] - reference);
+      acc |= v << nAcc;
+      nAcc += width;
+      if (nAcc >= 64) {
+         StoreLE(destination, acc, 8);
+         destination += 8;
+         nAcc -= 64;
+         acc = (nAcc > 0) ? (v >> (width - nAcc)) : 0;
+      }
+   }
+   StoreLE(destination, acc, (nAcc + 7) / 8);
+}
+
+/// Reads the `count` little-endian values of NBytes bytes each; the fixed size lets the compiler vectorize the loop
+template <std::size_t NBytes, typename T>
+void UnpackBytesLE(T *values, const unsigned char *source, std::size_t count)
+{
+   for (std::size_t i = 0; i < count; ++i) {
+      std::uint64_t v = 0;
+      for (std::size_t b = 0; b < NBytes; ++b)
+         v |= static_cast<std::uint64_t>(source[i * NBytes + b]) << (8 * b);
+      values[i] = static_cast<T>(v);
+   }
+}
+
+/// Bit widths up to this value are unpacked by the SIMD kernels: every value fits in a 32bit word that starts at a
+/// byte boundary.
+constexpr unsigned int kMaxSIMDBitWidth = 25;
+
+/// Unpacks the leading values of a bit stream with width <= kMaxSIMDBitWidth in groups of 8 values, i.e. of `width`
+/// bytes, using the best available SIMD kernel.  Returns the number of unpacked values, a multiple of 8; the kernels
+/// stop early where their loads would read past the `size` bytes of `source`.
+std::size_t BitUnpackSIMD(std::uint32_t *values, const unsigned char *source, std::size_t size, std::size_t count,
+                          unsigned int width);
+
+/// Reverse of BitPack; `size` is the number of bytes available in `source`
+template <typename T>
+void BitUnpack(T *values, const unsigned char *source, std::size_t size, std::size_t count, unsigned int width)
+{
+   switch (width) {
+   case 8: UnpackBytesLE<1>(values, source, count); return;
+   case 16: UnpackBytesLE<2>(values, source, count); return;
+   case 32: UnpackBytesLE<4>(values, source, count); return;
+   case 64: UnpackBytesLE<8>(values, source, count); return;
+   default: break;
+   }
+
+   std::size_t i = 0;
+   if (width <= kMaxSIMDBitWidth) {
+      if constexpr (std::is_same<T, std::uint32_t>::value) {
+         i = BitUnpackSIMD(values, source, size, count, width);
+      } else {
+         // Every block starts at a multiple of 8 values and hence at a byte boundary
+         constexpr std::size_t kBlockSize = 256;
+         std::uint32_t block[kBlockSize];
+         while (i < count) {
+            const std::size_t offset = i * width / 8;
+            const auto nBlock = std::min(kBlockSize, count - i);
+            const auto n = BitUnpackSIMD(block, source + offset, size - offset, nBlock, width);
+            for (std::size_t j = 0; j < n; ++j)
+               values[i + j] = static_cast<T>(block[j]);
+            i += n;
+            if (n < nBlock)
+               break;
+         }
+      }
+   }
+
+   const std::uint64_t mask = (std::uint64_t(1) << width) - 1;
+   if (width <= 56) {
+      // Every value is contained in the 8 bytes starting at its first byte, so that the values are independent of
+      // each other and the loop vectorizes.  Only the last few values need a shorter load not to read past the end.
+      const std::size_t nFullLoads = (size < 8) ? 0 : std::min(count, (8 * (size - 8) + 7) / width + 1);
+      for (; i < nFullLoads; ++i) {
+         const std::size_t bit = i * width;
+         values[i] = static_cast<T>((LoadLE(source + bit / 8, 8) >> (bit % 8)) & mask);
+      }
+      for (; i < count; ++i) {
+         const std::size_t bit = i * width;
+         values[i] = static_cast<T>((LoadLE(source + bit / 8, size - bit / 8) >> (bit % 8)) & mask);
+      }
+      return;
+   }
+
+   const unsigned char *end = source + size;
+   std::uint64_t acc = 0;
+   unsigned int nAcc = 0;
+   for (; i < count; ++i) {
+      if (nAcc >= width) {
+         values[i] = static_cast<T>(acc & mask);
+         acc >>= width;
+         nAcc -= width;
+         continue;
+      }
+      // Combine the remaining bits of the accumulator with the lower bits of the next 64bit word
+      const auto nBytes = std::min<std::size_t>(8, end - source);
+      const auto word = LoadLE(source, nBytes);
+      source += nBytes;
+      values[i] = static_cast<T>((acc | (word << nAcc)) & mask);
+      const unsigned int nUsed = width - nAcc;
+      acc = word >> nUsed;
+      nAcc = 8 * nBytes - nUsed;
+   }
+}
+
+} // anonymous namespace
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementBitPackedLE<CppT>::Pack(void *dst, void *src, std::size_t count) const
+{
+   using UnsignedT = std::make_unsigned_t<CppT>;
+   auto srcArray = reinterpret_cast<const CppT *>(src);
+   auto packedArray = reinterpret_cast<unsigned char *>(dst);
+   std::memset(packedArray, 0, kHeaderSize);
+   if (count == 0)
+      return;
+
+   CppT min = srcArray[0];
+   CppT max = srcArray[0];
+   for (std::size_t i = 1; i < count; ++i) {
+      min = std::min(min, srcArray[i]);
+      max = std::max(max, srcArray[i]);
+   }
+   const auto reference = static_cast<UnsignedT>(min);
+   auto range = static_cast<UnsignedT>(static_cast<UnsignedT>(max) - reference);
+   unsigned int width = 0;
+   for (; range > 0; range >>= 1)
+      ++width;
+
+   StoreLE(packedArray, reference, 8);
+   packedArray[8] = static_cast<unsigned char>(width);
+   if (width == 0)
+      return;
+
+   BitPack(packedArray + kHeaderSize, reinterpret_cast<const UnsignedT *>(src), reference, count, width);
+}
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementBitPackedLE<CppT>::Unpack(void *dst, void *src,
+                                                                         std::size_t count) const
+{
+   using UnsignedT = std::make_unsigned_t<CppT>;
+   auto packedArray = reinterpret_cast<const unsigned char *>(src);
+   auto dstArray = reinterpret_cast<UnsignedT *>(dst);
+   if (count == 0)
+      return;
+
+   const auto reference = static_cast<UnsignedT>(LoadLE(packedArray, 8));
+   const unsigned int width = packedArray[8];
+   R__ASSERT(width <= sizeof(CppT) * 8);
+   if (width == 0) {
+      std::fill(dstArray, dstArray + count, reference);
+      return;
+   }
+
+   BitUnpack(dstArray, packedArray + kHeaderSize, (count * width + 7) / 8, count, width);
+   for (std::size_t i = 0; i < count; ++i)
+      dstArray[i] += reference;
+}
+
+template <typename CppT>
+std::size_t ROOT::Experimental::Detail::RColumnElementBitPackedLE<CppT>::GetPackedSizeFromHeader(
+   const void *header, std::size_t nElements) const
+{
+   const unsigned int width = reinterpret_cast<const unsigned char *>(header)[8];
+   if (width > sizeof(CppT) * 8)
+      throw RException(R__FAIL("invalid bit width " + std::to_string(width) + " of a bit-packed page"));
+   return kHeaderSize + (nElements * width + 7) / 8;
+}
+
+template class ROOT::Experimental::Detail::RColumnElementBitPackedLE<std::int16_t>;
+template class ROOT::Experimental::Detail::RColumnElementBitPackedLE<std::uint16_t>;
+template class ROOT::Experimental::Detail::RColumnElementBitPackedLE<std::int32_t>;
+template class ROOT::Experimental::Detail::RColumnElementBitPackedLE<std::uint32_t>;
+template class ROOT::Experimental::Detail::RColumnElementBitPackedLE<std::int64_t>;
+template class ROOT::Experimental::Detail::RColumnElementBitPackedLE<std::uint64_t>;
+
+namespace {
+
+/// Reduced-precision floats are converted in blocks of this many elements, which are then bit packed.  As a multiple
+/// of 8, every block starts at a byte boundary of the packed bit stream.
+constexpr std::size_t kRealBlockSize = 64;
+
+} // anonymous namespace
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementTruncatedReal<CppT>::SetPrecision(const RColumnModel &model)
+{
+   const auto validRange = GetValidBitRange(EColumnType::kReal32Trunc);
+   const auto nBits = model.GetBitsOnStorage();
+   if ((nBits < validRange.first) || (nBits > validRange.second)) {
+      throw RException(R__FAIL("invalid number of bits for truncated floating point column: " +
+                               std::to_string(nBits)));
+   }
+   fBitsOnStorage = nBits;
+}
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementTruncatedReal<CppT>::Pack(void *dst, void *src, std::size_t count) const
+{
+   auto srcArray = reinterpret_cast<const CppT *>(src);
+   auto packedArray = reinterpret_cast<unsigned char *>(dst);
+   const auto width = static_cast<unsigned int>(fBitsOnStorage);
+   const unsigned int nDropped = 32 - width;
+
+   std::uint32_t block[kRealBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kRealBlockSize) {
+      const auto n = std::min(kRealBlockSize, count - offset);
+      for (std::size_t i = 0; i < n; ++i) {
+         const float value = static_cast<float>(srcArray[offset + i]);
+         std::uint32_t bits;
+         std::memcpy(&bits, &value, sizeof(bits));
+         const bool isFinite = (bits & 0x7f800000u) != 0x7f800000u;
+         // Round to nearest; a carry into the exponent correctly rounds up to the next power of two
+         bits += static_cast<std::uint32_t>(isFinite) << (nDropped - 1);
+         // Keep NaNs NaN even if their payload is only in the dropped bits
+         if (!isFinite && (bits & 0x007fffffu))
+            bits |= 0x00400000u;
+         block[i] = bits >> nDropped;
+      }
+      BitPack(packedArray + (offset * width) / 8, block, std::uint32_t(0), n, width);
+   }
+}
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementTruncatedReal<CppT>::Unpack(void *dst, void *src,
+                                                                           std::size_t count) const
+{
+   auto dstArray = reinterpret_cast<CppT *>(dst);
+   auto packedArray = reinterpret_cast<const unsigned char *>(src);
+   const auto width = static_cast<unsigned int>(fBitsOnStorage);
+   const unsigned int nDropped = 32 - width;
+
+   std::uint32_t block[kRealBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kRealBlockSize) {
+      const auto n = std::min(kRealBlockSize, count - offset);
+      BitUnpack(block, packedArray + (offset * width) / 8, (n * width + 7) / 8, n, width);
+      for (std::size_t i = 0; i < n; ++i) {
+         const std::uint32_t bits = block[i] << nDropped;
+         float value;
+         std::memcpy(&value, &bits, sizeof(value));
+         dstArray[offset + i] = value;
+      }
+   }
+}
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementQuantizedReal<CppT>::SetPrecision(const RColumnModel &model)
+{
+   const auto validRange = GetValidBitRange(EColumnType::kReal32Quant);
+   const auto nBits = model.GetBitsOnStorage();
+   if ((nBits < validRange.first) || (nBits > validRange.second)) {
+      throw RException(R__FAIL("invalid number of bits for quantized floating point column: " +
+                               std::to_string(nBits)));
+   }
+   const auto min = model.GetValueMin();
+   const auto max = model.GetValueMax();
+   if (!std::isfinite(min) || !std::isfinite(max) || !(min < max))
+      throw RException(R__FAIL("invalid value range for quantized floating point column"));
+   fBitsOnStorage = nBits;
+   fValueMin = min;
+   fValueMax = max;
+}
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementQuantizedReal<CppT>::Pack(void *dst, void *src, std::size_t count) const
+{
+   auto srcArray = reinterpret_cast<const CppT *>(src);
+   auto packedArray = reinterpret_cast<unsigned char *>(dst);
+   const auto width = static_cast<unsigned int>(fBitsOnStorage);
+   const double maxQuant = static_cast<double>((std::uint64_t(1) << width) - 1);
+   const double scale = maxQuant / (fValueMax - fValueMin);
+
+   std::uint32_t block[kRealBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kRealBlockSize) {
+      const auto n = std::min(kRealBlockSize, count - offset);
+      for (std::size_t i = 0; i < n; ++i) {
+         double value = static_cast<double>(srcArray[offset + i]);
+         // Written such that NaN is mapped to the lower bound
+         value = (value > fValueMin) ? value : fValueMin;
+         value = (value < fValueMax) ? value : fValueMax;
+         block[i] = static_cast<std::uint32_t>(std::min((value - fValueMin) * scale + 0.5, maxQuant));
+      }
+      BitPack(packedArray + (offset * width) / 8, block, std::uint32_t(0), n, width);
+   }
+}
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementQuantizedReal<CppT>::Unpack(void *dst, void *src,
+                                                                           std::size_t count) const
+{
+   auto dstArray = reinterpret_cast<CppT *>(dst);
+   auto packedArray = reinterpret_cast<const unsigned char *>(src);
+   const auto width = static_cast<unsigned int>(fBitsOnStorage);
+   const double step = (fValueMax - fValueMin) / static_cast<double>((std::uint64_t(1) << width) - 1);
+
+   std::uint32_t block[kRealBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kRealBlockSize) {
+      const auto n = std::min(kRealBlockSize, count - offset);
+      BitUnpack(block, packedArray + (offset * width) / 8, (n * width + 7) / 8, n, width);
+      for (std::size_t i = 0; i < n; ++i)
+         dstArray[offset + i] = static_cast<CppT>(fValueMin + block[i] * step);
+   }
+}
+
+template class ROOT::Experimental::Detail::RColumnElementTruncatedReal<float>;
+template class ROOT::Experimental::Detail::RColumnElementTruncatedReal<double>;
+template class ROOT::Experimental::Detail::RColumnElementQuantizedReal<float>;
+template class ROOT::Experimental::Detail::RColumnElementQuantizedReal<double>;
+
 void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kInt32>::Pack(
   void *dst, void *src, std::size_t count) const
 {
@@ -251,3 +708,500 @@ void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental
       int64Array[i] = v;
    }
 }
+
+// Byte split kernels. The SIMD versions are compiled with function-level target attributes so that the library as a
+// whole keeps the baseline instruction set; the best supported kernel is selected at runtime.
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define R__NTUPLE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace {
+
+using ROOT::Experimental::Detail::ESIMDLevel;
+
+/// Scalar split of the elements [first, count), used for the tail of the SIMD kernels
+template <std::size_t N>
+void SplitTail(unsigned char *dst, const unsigned char *src, std::size_t first, std::size_t count)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      for (std::size_t b = 0; b < N; ++b)
+         dst[b * count + i] = src[N * i + b];
+   }
+}
+
+template <std::size_t N>
+void UnsplitTail(unsigned char *dst, const unsigned char *src, std::size_t first, std::size_t count)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      for (std::size_t b = 0; b < N; ++b)
+         dst[N * i + b] = src[b * count + i];
+   }
+}
+
+#ifdef R__NTUPLE_X86_SIMD
+
+// The 128-bit kernels process blocks of 16 elements, i.e. they write one full vector per byte plane.  The pshufb mask
+// gathers equal-rank bytes of the elements in a vector; the remaining transposition is done with unpack instructions.
+// The AVX2 kernels run the same in-lane algorithm on blocks of 32 elements: the low lane holds the first 16 elements,
+// the high lane the next 16.
+
+#define R__LOAD128(ptr) _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr))
+#define R__STORE128(ptr, v) _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), v)
+
+template <std::size_t N>
+void SplitSSE41(unsigned char *dst, const unsigned char *src, std::size_t count);
+template <std::size_t N>
+void UnsplitSSE41(unsigned char *dst, const unsigned char *src, std::size_t count);
+template <std::size_t N>
+void SplitAVX2(unsigned char *dst, const unsigned char *src, std::size_t count);
+template <std::size_t N>
+void UnsplitAVX2(unsigned char *dst, const unsigned char *src, std::size_t count);
+
+template <>
+__attribute__((target("sse4.1"))) void SplitSSE41<2>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   const __m128i mask = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      const __m128i v0 = _mm_shuffle_epi8(R__LOAD128(src + 2 * i), mask);
+      const __m128i v1 = _mm_shuffle_epi8(R__LOAD128(src + 2 * i + 16), mask);
+      R__STORE128(dst + i, _mm_unpacklo_epi64(v0, v1));
+      R__STORE128(dst + count + i, _mm_unpackhi_epi64(v0, v1));
+   }
+   SplitTail<2>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("sse4.1"))) void SplitSSE41<4>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   const __m128i mask = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      const __m128i v0 = _mm_shuffle_epi8(R__LOAD128(src + 4 * i), mask);
+      const __m128i v1 = _mm_shuffle_epi8(R__LOAD128(src + 4 * i + 16), mask);
+      const __m128i v2 = _mm_shuffle_epi8(R__LOAD128(src + 4 * i + 32), mask);
+      const __m128i v3 = _mm_shuffle_epi8(R__LOAD128(src + 4 * i + 48), mask);
+      const __m128i t0 = _mm_unpacklo_epi32(v0, v1);
+      const __m128i t1 = _mm_unpacklo_epi32(v2, v3);
+      const __m128i t2 = _mm_unpackhi_epi32(v0, v1);
+      const __m128i t3 = _mm_unpackhi_epi32(v2, v3);
+      R__STORE128(dst + i, _mm_unpacklo_epi64(t0, t1));
+      R__STORE128(dst + count + i, _mm_unpackhi_epi64(t0, t1));
+      R__STORE128(dst + 2 * count + i, _mm_unpacklo_epi64(t2, t3));
+      R__STORE128(dst + 3 * count + i, _mm_unpackhi_epi64(t2, t3));
+   }
+   SplitTail<4>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("sse4.1"))) void SplitSSE41<8>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   const __m128i mask = _mm_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15);
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      __m128i v[8];
+      for (int j = 0; j < 8; ++j)
+         v[j] = _mm_shuffle_epi8(R__LOAD128(src + 8 * i + 16 * j), mask);
+      // 8x8 transposition of 16-bit words
+      __m128i a[8];
+      for (int j = 0; j < 4; ++j) {
+         a[2 * j] = _mm_unpacklo_epi16(v[2 * j], v[2 * j + 1]);
+         a[2 * j + 1] = _mm_unpackhi_epi16(v[2 * j], v[2 * j + 1]);
+      }
+      __m128i c[8];
+      for (int j = 0; j < 2; ++j) {
+         c[4 * j] = _mm_unpacklo_epi32(a[4 * j], a[4 * j + 2]);
+         c[4 * j + 1] = _mm_unpackhi_epi32(a[4 * j], a[4 * j + 2]);
+         c[4 * j + 2] = _mm_unpacklo_epi32(a[4 * j + 1], a[4 * j + 3]);
+         c[4 * j + 3] = _mm_unpackhi_epi32(a[4 * j + 1], a[4 * j + 3]);
+      }
+      for (int j = 0; j < 4; ++j) {
+         R__STORE128(dst + (2 * j) * count + i, _mm_unpacklo_epi64(c[j], c[j + 4]));
+         R__STORE128(dst + (2 * j + 1) * count + i, _mm_unpackhi_epi64(c[j], c[j + 4]));
+      }
+   }
+   SplitTail<8>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("sse4.1"))) void UnsplitSSE41<2>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      const __m128i p0 = R__LOAD128(src + i);
+      const __m128i p1 = R__LOAD128(src + count + i);
+      R__STORE128(dst + 2 * i, _mm_unpacklo_epi8(p0, p1));
+      R__STORE128(dst + 2 * i + 16, _mm_unpackhi_epi8(p0, p1));
+   }
+   UnsplitTail<2>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("sse4.1"))) void UnsplitSSE41<4>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      const __m128i p0 = R__LOAD128(src + i);
+      const __m128i p1 = R__LOAD128(src + count + i);
+      const __m128i p2 = R__LOAD128(src + 2 * count + i);
+      const __m128i p3 = R__LOAD128(src + 3 * count + i);
+      const __m128i t0 = _mm_unpacklo_epi8(p0, p1);
+      const __m128i t1 = _mm_unpackhi_epi8(p0, p1);
+      const __m128i t2 = _mm_unpacklo_epi8(p2, p3);
+      const __m128i t3 = _mm_unpackhi_epi8(p2, p3);
+      R__STORE128(dst + 4 * i, _mm_unpacklo_epi16(t0, t2));
+      R__STORE128(dst + 4 * i + 16, _mm_unpackhi_epi16(t0, t2));
+      R__STORE128(dst + 4 * i + 32, _mm_unpacklo_epi16(t1, t3));
+      R__STORE128(dst + 4 * i + 48, _mm_unpackhi_epi16(t1, t3));
+   }
+   UnsplitTail<4>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("sse4.1"))) void UnsplitSSE41<8>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      __m128i a[8];
+      for (int j = 0; j < 4; ++j) {
+         const __m128i lo = R__LOAD128(src + (2 * j) * count + i);
+         const __m128i hi = R__LOAD128(src + (2 * j + 1) * count + i);
+         a[2 * j] = _mm_unpacklo_epi8(lo, hi);
+         a[2 * j + 1] = _mm_unpackhi_epi8(lo, hi);
+      }
+      __m128i c[8];
+      for (int j = 0; j < 2; ++j) {
+         c[4 * j] = _mm_unpacklo_epi16(a[4 * j], a[4 * j + 2]);
+         c[4 * j + 1] = _mm_unpackhi_epi16(a[4 * j], a[4 * j + 2]);
+         c[4 * j + 2] = _mm_unpacklo_epi16(a[4 * j + 1], a[4 * j + 3]);
+         c[4 * j + 3] = _mm_unpackhi_epi16(a[4 * j + 1], a[4 * j + 3]);
+      }
+      for (int j = 0; j < 4; ++j) {
+         R__STORE128(dst + 8 * i + 32 * j, _mm_unpacklo_epi32(c[j], c[j + 4]));
+         R__STORE128(dst + 8 * i + 32 * j + 16, _mm_unpackhi_epi32(c[j], c[j + 4]));
+      }
+   }
+   UnsplitTail<8>(dst, src, i, count);
+}
+
+/// Loads 16 bytes from lo into the low lane and 16 bytes from hi into the high lane
+__attribute__((target("avx2"))) inline __m256i LoadLanes(const unsigned char *lo, const unsigned char *hi)
+{
+   return _mm256_inserti128_si256(_mm256_castsi128_si256(R__LOAD128(lo)), R__LOAD128(hi), 1);
+}
+
+__attribute__((target("avx2"))) inline void StoreLanes(unsigned char *lo, unsigned char *hi, __m256i v)
+{
+   R__STORE128(lo, _mm256_castsi256_si128(v));
+   R__STORE128(hi, _mm256_extracti128_si256(v, 1));
+}
+
+__attribute__((target("avx2"))) inline __m256i Load256(const unsigned char *ptr)
+{
+   return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+}
+
+__attribute__((target("avx2"))) inline void Store256(unsigned char *ptr, __m256i v)
+{
+   _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), v);
+}
+
+template <>
+__attribute__((target("avx2"))) void SplitAVX2<2>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   const __m256i mask =
+      _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                       0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      const unsigned char *s = src + 2 * i;
+      const __m256i v0 = _mm256_shuffle_epi8(LoadLanes(s, s + 32), mask);
+      const __m256i v1 = _mm256_shuffle_epi8(LoadLanes(s + 16, s + 48), mask);
+      Store256(dst + i, _mm256_unpacklo_epi64(v0, v1));
+      Store256(dst + count + i, _mm256_unpackhi_epi64(v0, v1));
+   }
+   SplitTail<2>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("avx2"))) void SplitAVX2<4>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   const __m256i mask =
+      _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+                       0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      const unsigned char *s = src + 4 * i;
+      const __m256i v0 = _mm256_shuffle_epi8(LoadLanes(s, s + 64), mask);
+      const __m256i v1 = _mm256_shuffle_epi8(LoadLanes(s + 16, s + 80), mask);
+      const __m256i v2 = _mm256_shuffle_epi8(LoadLanes(s + 32, s + 96), mask);
+      const __m256i v3 = _mm256_shuffle_epi8(LoadLanes(s + 48, s + 112), mask);
+      const __m256i t0 = _mm256_unpacklo_epi32(v0, v1);
+      const __m256i t1 = _mm256_unpacklo_epi32(v2, v3);
+      const __m256i t2 = _mm256_unpackhi_epi32(v0, v1);
+      const __m256i t3 = _mm256_unpackhi_epi32(v2, v3);
+      Store256(dst + i, _mm256_unpacklo_epi64(t0, t1));
+      Store256(dst + count + i, _mm256_unpackhi_epi64(t0, t1));
+      Store256(dst + 2 * count + i, _mm256_unpacklo_epi64(t2, t3));
+      Store256(dst + 3 * count + i, _mm256_unpackhi_epi64(t2, t3));
+   }
+   SplitTail<4>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("avx2"))) void SplitAVX2<8>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   const __m256i mask =
+      _mm256_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15,
+                       0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15);
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      const unsigned char *s = src + 8 * i;
+      __m256i v[8];
+      for (int j = 0; j < 8; ++j)
+         v[j] = _mm256_shuffle_epi8(LoadLanes(s + 16 * j, s + 128 + 16 * j), mask);
+      __m256i a[8];
+      for (int j = 0; j < 4; ++j) {
+         a[2 * j] = _mm256_unpacklo_epi16(v[2 * j], v[2 * j + 1]);
+         a[2 * j + 1] = _mm256_unpackhi_epi16(v[2 * j], v[2 * j + 1]);
+      }
+      __m256i c[8];
+      for (int j = 0; j < 2; ++j) {
+         c[4 * j] = _mm256_unpacklo_epi32(a[4 * j], a[4 * j + 2]);
+         c[4 * j + 1] = _mm256_unpackhi_epi32(a[4 * j], a[4 * j + 2]);
+         c[4 * j + 2] = _mm256_unpacklo_epi32(a[4 * j + 1], a[4 * j + 3]);
+         c[4 * j + 3] = _mm256_unpackhi_epi32(a[4 * j + 1], a[4 * j + 3]);
+      }
+      for (int j = 0; j < 4; ++j) {
+         Store256(dst + (2 * j) * count + i, _mm256_unpacklo_epi64(c[j], c[j + 4]));
+         Store256(dst + (2 * j + 1) * count + i, _mm256_unpackhi_epi64(c[j], c[j + 4]));
+      }
+   }
+   SplitTail<8>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("avx2"))) void UnsplitAVX2<2>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      const __m256i p0 = Load256(src + i);
+      const __m256i p1 = Load256(src + count + i);
+      unsigned char *d = dst + 2 * i;
+      StoreLanes(d, d + 32, _mm256_unpacklo_epi8(p0, p1));
+      StoreLanes(d + 16, d + 48, _mm256_unpackhi_epi8(p0, p1));
+   }
+   UnsplitTail<2>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("avx2"))) void UnsplitAVX2<4>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      const __m256i p0 = Load256(src + i);
+      const __m256i p1 = Load256(src + count + i);
+      const __m256i p2 = Load256(src + 2 * count + i);
+      const __m256i p3 = Load256(src + 3 * count + i);
+      const __m256i t0 = _mm256_unpacklo_epi8(p0, p1);
+      const __m256i t1 = _mm256_unpackhi_epi8(p0, p1);
+      const __m256i t2 = _mm256_unpacklo_epi8(p2, p3);
+      const __m256i t3 = _mm256_unpackhi_epi8(p2, p3);
+      unsigned char *d = dst + 4 * i;
+      StoreLanes(d, d + 64, _mm256_unpacklo_epi16(t0, t2));
+      StoreLanes(d + 16, d + 80, _mm256_unpackhi_epi16(t0, t2));
+      StoreLanes(d + 32, d + 96, _mm256_unpacklo_epi16(t1, t3));
+      StoreLanes(d + 48, d + 112, _mm256_unpackhi_epi16(t1, t3));
+   }
+   UnsplitTail<4>(dst, src, i, count);
+}
+
+template <>
+__attribute__((target("avx2"))) void UnsplitAVX2<8>(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      __m256i a[8];
+      for (int j = 0; j < 4; ++j) {
+         const __m256i lo = Load256(src + (2 * j) * count + i);
+         const __m256i hi = Load256(src + (2 * j + 1) * count + i);
+         a[2 * j] = _mm256_unpacklo_epi8(lo, hi);
+         a[2 * j + 1] = _mm256_unpackhi_epi8(lo, hi);
+      }
+      __m256i c[8];
+      for (int j = 0; j < 2; ++j) {
+         c[4 * j] = _mm256_unpacklo_epi16(a[4 * j], a[4 * j + 2]);
+         c[4 * j + 1] = _mm256_unpackhi_epi16(a[4 * j], a[4 * j + 2]);
+         c[4 * j + 2] = _mm256_unpacklo_epi16(a[4 * j + 1], a[4 * j + 3]);
+         c[4 * j + 3] = _mm256_unpackhi_epi16(a[4 * j + 1], a[4 * j + 3]);
+      }
+      unsigned char *d = dst + 8 * i;
+      for (int j = 0; j < 4; ++j) {
+         StoreLanes(d + 32 * j, d + 128 + 32 * j, _mm256_unpacklo_epi32(c[j], c[j + 4]));
+         StoreLanes(d + 32 * j + 16, d + 128 + 32 * j + 16, _mm256_unpackhi_epi32(c[j], c[j + 4]));
+      }
+   }
+   UnsplitTail<8>(dst, src, i, count);
+}
+
+// The bit unpacking kernels process groups of 8 values, which take `width` bytes.  The first 4 values of a group are
+// loaded from its first byte, the last 4 from the byte in which the fifth value starts.  For every value, pshufb
+// gathers the 4 bytes starting at its first byte into a 32bit word, which is then shifted right by the bit offset of
+// the value and masked.  SSE4.1 has no variable shift; the shift is emulated by a multiplication and a fixed shift.
+
+/// The per-group constants of the bit unpacking kernels for a given bit width
+struct RBitUnpackLayout {
+   std::size_t fHiOffset;         ///< The byte in the group at which the fifth value starts
+   alignas(32) unsigned char fShuffle[32]; ///< Within a 128-bit half, the bytes of the 32bit word of each value
+   alignas(32) std::uint32_t fShift[8];    ///< The bit offset of each value in its first byte
+   alignas(32) std::uint32_t fMultiplier[8]; ///< 2^(7 - fShift)
+
+   explicit RBitUnpackLayout(unsigned int width) : fHiOffset((4 * width) / 8)
+   {
+      for (unsigned int j = 0; j < 8; ++j) {
+         const unsigned int bit = j * width;
+         const unsigned int firstByte = bit / 8 - ((j < 4) ? 0 : fHiOffset);
+         for (unsigned int b = 0; b < 4; ++b)
+            fShuffle[4 * j + b] = static_cast<unsigned char>(firstByte + b);
+         fShift[j] = bit % 8;
+         fMultiplier[j] = 1u << (7 - fShift[j]);
+      }
+   }
+};
+
+__attribute__((target("sse4.1"))) std::size_t BitUnpackSSE41(std::uint32_t *values, const unsigned char *source,
+                                                              std::size_t size, std::size_t count, unsigned int width)
+{
+   const RBitUnpackLayout layout(width);
+   const __m128i shuffleLo = R__LOAD128(layout.fShuffle);
+   const __m128i shuffleHi = R__LOAD128(layout.fShuffle + 16);
+   const __m128i multiplierLo = R__LOAD128(layout.fMultiplier);
+   const __m128i multiplierHi = R__LOAD128(layout.fMultiplier + 4);
+   const __m128i mask = _mm_set1_epi32(static_cast<int>((1u << width) - 1));
+   std::size_t i = 0;
+   // The bits of a value end up at positions [7, 7 + width) of the product, the bits lost in the overflow are not used
+   for (std::size_t offset = 0; i + 8 <= count && offset + layout.fHiOffset + 16 <= size; i += 8, offset += width) {
+      const unsigned char *s = source + offset;
+      const __m128i lo = _mm_mullo_epi32(_mm_shuffle_epi8(R__LOAD128(s), shuffleLo), multiplierLo);
+      const __m128i hi = _mm_mullo_epi32(_mm_shuffle_epi8(R__LOAD128(s + layout.fHiOffset), shuffleHi), multiplierHi);
+      R__STORE128(values + i, _mm_and_si128(_mm_srli_epi32(lo, 7), mask));
+      R__STORE128(values + i + 4, _mm_and_si128(_mm_srli_epi32(hi, 7), mask));
+   }
+   return i;
+}
+
+__attribute__((target("avx2"))) std::size_t BitUnpackAVX2(std::uint32_t *values, const unsigned char *source,
+                                                           std::size_t size, std::size_t count, unsigned int width)
+{
+   const RBitUnpackLayout layout(width);
+   const __m256i shuffle = Load256(layout.fShuffle);
+   const __m256i shift = Load256(reinterpret_cast<const unsigned char *>(layout.fShift));
+   const __m256i mask = _mm256_set1_epi32(static_cast<int>((1u << width) - 1));
+   std::size_t i = 0;
+   for (std::size_t offset = 0; i + 8 <= count && offset + layout.fHiOffset + 16 <= size; i += 8, offset += width) {
+      const unsigned char *s = source + offset;
+      const __m256i v = _mm256_shuffle_epi8(LoadLanes(s, s + layout.fHiOffset), shuffle);
+      Store256(reinterpret_cast<unsigned char *>(values + i), _mm256_and_si256(_mm256_srlv_epi32(v, shift), mask));
+   }
+   return i;
+}
+
+#undef R__LOAD128
+#undef R__STORE128
+
+#endif // R__NTUPLE_X86_SIMD
+
+ESIMDLevel DetectSIMDLevel()
+{
+#ifdef R__NTUPLE_X86_SIMD
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return ESIMDLevel::kAVX2;
+   if (__builtin_cpu_supports("sse4.1"))
+      return ESIMDLevel::kSSE41;
+#endif
+   return ESIMDLevel::kScalar;
+}
+
+std::atomic<ESIMDLevel> &CurrentSIMDLevel()
+{
+   static std::atomic<ESIMDLevel> level{ROOT::Experimental::Detail::GetMaxSIMDLevel()};
+   return level;
+}
+
+std::size_t BitUnpackSIMD(std::uint32_t *values, const unsigned char *source, std::size_t size, std::size_t count,
+                          unsigned int width)
+{
+#ifdef R__NTUPLE_X86_SIMD
+   switch (CurrentSIMDLevel().load(std::memory_order_relaxed)) {
+   case ESIMDLevel::kAVX2: return BitUnpackAVX2(values, source, size, count, width);
+   case ESIMDLevel::kSSE41: return BitUnpackSSE41(values, source, size, count, width);
+   default: break;
+   }
+#endif
+   (void)values;
+   (void)source;
+   (void)size;
+   (void)count;
+   (void)width;
+   return 0;
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::Detail::ESIMDLevel ROOT::Experimental::Detail::GetMaxSIMDLevel()
+{
+   static const ESIMDLevel maxLevel = DetectSIMDLevel();
+   return maxLevel;
+}
+
+void ROOT::Experimental::Detail::SetSIMDLevel(ESIMDLevel level)
+{
+   if (static_cast<int>(level) > static_cast<int>(GetMaxSIMDLevel()))
+      throw RException(R__FAIL("SIMD level not supported by this CPU or build"));
+   CurrentSIMDLevel().store(level, std::memory_order_relaxed);
+}
+
+ROOT::Experimental::Detail::ESIMDLevel ROOT::Experimental::Detail::GetSIMDLevel()
+{
+   return CurrentSIMDLevel().load(std::memory_order_relaxed);
+}
+
+template <std::size_t N>
+void ROOT::Experimental::Detail::SplitBytesLE(void *destination, const void *source, std::size_t count)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+#ifdef R__NTUPLE_X86_SIMD
+   switch (CurrentSIMDLevel().load(std::memory_order_relaxed)) {
+   case ESIMDLevel::kAVX2: SplitAVX2<N>(dst, src, count); return;
+   case ESIMDLevel::kSSE41: SplitSSE41<N>(dst, src, count); return;
+   default: break;
+   }
+#endif
+   SplitTail<N>(dst, src, 0, count);
+}
+
+template <std::size_t N>
+void ROOT::Experimental::Detail::UnsplitBytesLE(void *destination, const void *source, std::size_t count)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+#ifdef R__NTUPLE_X86_SIMD
+   switch (CurrentSIMDLevel().load(std::memory_order_relaxed)) {
+   case ESIMDLevel::kAVX2: UnsplitAVX2<N>(dst, src, count); return;
+   case ESIMDLevel::kSSE41: UnsplitSSE41<N>(dst, src, count); return;
+   default: break;
+   }
+#endif
+   UnsplitTail<N>(dst, src, 0, count);
+}
+
+template void ROOT::Experimental::Detail::SplitBytesLE<2>(void *, const void *, std::size_t);
+template void ROOT::Experimental::Detail::SplitBytesLE<4>(void *, const void *, std::size_t);
+template void ROOT::Experimental::Detail::SplitBytesLE<8>(void *, const void *, std::size_t);
+template void ROOT::Experimental::Detail::UnsplitBytesLE<2>(void *, const void *, std::size_t);
+template void ROOT::Experimental::Detail::UnsplitBytesLE<4>(void *, const void *, std::size_t);
+template void ROOT::Experimental::Detail::UnsplitBytesLE<8>(void *, const void *, std::size_t);
@@ -41,6 +41,7 @@
 #include <algorithm>
 #include <cctype> // for isspace
 #include <charconv>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib> // for malloc, free
 #include <cstring> // for memset
@@ -407,6 +408,61 @@ std::vector<ROOT::Experimental::Detail::RFieldBase *> ROOT::Experimental::Detail
 }
 
 
+void ROOT::Experimental::Detail::RFieldBase::ReadBulk(NTupleSize_t globalIndex, std::size_t count, void *to)
+{
+   if (count == 0)
+      return;
+
+   // Values in an array are spaced by the size rounded up to the alignment
+   const auto alignment = GetAlignment();
+   const auto stride = (GetValueSize() + alignment - 1) / alignment * alignment;
+   auto where = static_cast<unsigned char *>(to);
+   if (fTraits & kTraitMappable) {
+      auto value = CaptureValue(to);
+      fPrincipalColumn->ReadV(globalIndex, count, &value.fMappedElement);
+      if (R__unlikely(!fReadCallbacks.empty())) {
+         for (std::size_t i = 0; i < count; ++i) {
+            auto itemValue = CaptureValue(where + i * stride);
+            InvokeReadCallbacks(itemValue);
+         }
+      }
+      return;
+   }
+
+   for (std::size_t i = 0; i < count; ++i) {
+      auto itemValue = CaptureValue(where + i * stride);
+      Read(globalIndex + i, &itemValue);
+   }
+}
+
+
+void ROOT::Experimental::Detail::RFieldBase::ReadBulk(const RClusterIndex &clusterIndex, std::size_t count, void *to)
+{
+   if (count == 0)
+      return;
+
+   const auto alignment = GetAlignment();
+   const auto stride = (GetValueSize() + alignment - 1) / alignment * alignment;
+   auto where = static_cast<unsigned char *>(to);
+   if (fTraits & kTraitMappable) {
+      auto value = CaptureValue(to);
+      fPrincipalColumn->ReadV(clusterIndex, count, &value.fMappedElement);
+      if (R__unlikely(!fReadCallbacks.empty())) {
+         for (std::size_t i = 0; i < count; ++i) {
+            auto itemValue = CaptureValue(where + i * stride);
+            InvokeReadCallbacks(itemValue);
+         }
+      }
+      return;
+   }
+
+   for (std::size_t i = 0; i < count; ++i) {
+      auto itemValue = CaptureValue(where + i * stride);
+      Read(RClusterIndex(clusterIndex.GetClusterId(), clusterIndex.GetIndex() + i), &itemValue);
+   }
+}
+
+
 void ROOT::Experimental::Detail::RFieldBase::Flush() const
 {
    for (auto& column : fColumns) {
@@ -589,7 +645,7 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kIndex32}, {EColumnType::kSplitIndex32}}, {{}});
    return representations;
 }
 
@@ -614,7 +670,7 @@ void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::AcceptVisito
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<ROOT::Experimental::RNTupleCardinality>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kIndex32}, {EColumnType::kSplitIndex32}}, {{}});
    return representations;
 }
 
@@ -733,48 +789,93 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 
 //------------------------------------------------------------------------------
 
-const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
-ROOT::Experimental::RField<float>::GetColumnRepresentations() const
+template <typename T>
+void ROOT::Experimental::RRealField<T>::GenerateColumnsImpl()
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {{}});
-   return representations;
+   const auto type = GetColumnRepresentative()[0];
+   switch (type) {
+   case EColumnType::kReal32Trunc:
+      fColumns.emplace_back(Detail::RColumn::Create<T>(RColumnModel(type, false, fBitsOnStorage), 0));
+      break;
+   case EColumnType::kReal32Quant:
+      fColumns.emplace_back(
+         Detail::RColumn::Create<T>(RColumnModel(type, false, fBitsOnStorage, fValueMin, fValueMax), 0));
+      break;
+   default: fColumns.emplace_back(Detail::RColumn::Create<T>(RColumnModel(type), 0));
+   }
 }
 
-void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
+template <typename T>
+void ROOT::Experimental::RRealField<T>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   // The on-disk column model carries the precision of truncated and quantized columns
+   const auto &columnDesc = *desc.GetColumnIterable(GetOnDiskId()).begin();
+   fColumns.emplace_back(Detail::RColumn::Create<T>(columnDesc.GetModel(), 0));
 }
 
-void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
+template <typename T>
+void ROOT::Experimental::RRealField<T>::SetTruncated(std::size_t nBits)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(onDiskTypes[0]), 0));
+   const auto validRange = Detail::RColumnElementBase::GetValidBitRange(EColumnType::kReal32Trunc);
+   if ((nBits < validRange.first) || (nBits > validRange.second)) {
+      throw RException(R__FAIL("invalid number of bits for truncated field " + GetName() + ": " +
+                               std::to_string(nBits)));
+   }
+   SetColumnRepresentative({EColumnType::kReal32Trunc});
+   fBitsOnStorage = static_cast<std::uint16_t>(nBits);
+   fValueMin = fValueMax = 0.0;
 }
 
-void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
+template <typename T>
+void ROOT::Experimental::RRealField<T>::SetQuantized(double min, double max, std::size_t nBits)
 {
-   visitor.VisitFloatField(*this);
+   const auto validRange = Detail::RColumnElementBase::GetValidBitRange(EColumnType::kReal32Quant);
+   if ((nBits < validRange.first) || (nBits > validRange.second)) {
+      throw RException(R__FAIL("invalid number of bits for quantized field " + GetName() + ": " +
+                               std::to_string(nBits)));
+   }
+   if (!std::isfinite(min) || !std::isfinite(max) || !(min < max))
+      throw RException(R__FAIL("invalid value range for quantized field " + GetName()));
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fBitsOnStorage = static_cast<std::uint16_t>(nBits);
+   fValueMin = min;
+   fValueMax = max;
 }
 
+template class ROOT::Experimental::RRealField<float>;
+template class ROOT::Experimental::RRealField<double>;
 
 //------------------------------------------------------------------------------
 
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
-ROOT::Experimental::RField<double>::GetColumnRepresentations() const
+ROOT::Experimental::RField<float>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitReal64}, {EColumnType::kReal64}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitReal32},
+                                                  {EColumnType::kReal32},
+                                                  {EColumnType::kReal32Trunc},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {{}});
    return representations;
 }
 
-void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
+void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   visitor.VisitFloatField(*this);
 }
 
-void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
+
+//------------------------------------------------------------------------------
+
+const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
+ROOT::Experimental::RField<double>::GetColumnRepresentations() const
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(onDiskTypes[0]), 0));
+   static RColumnRepresentations representations({{EColumnType::kSplitReal64},
+                                                  {EColumnType::kReal64},
+                                                  {EColumnType::kReal32Trunc},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {{}});
+   return representations;
 }
 
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -787,7 +888,11 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int16_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt16}, {EColumnType::kInt16}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitInt16},
+                                                  {EColumnType::kInt16},
+                                                  {EColumnType::kSplitDeltaInt16},
+                                                  {EColumnType::kBitPackedInt16}},
+                                                 {{}});
    return representations;
 }
 
@@ -812,7 +917,11 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint16_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt16}, {EColumnType::kInt16}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitInt16},
+                                                  {EColumnType::kInt16},
+                                                  {EColumnType::kSplitDeltaInt16},
+                                                  {EColumnType::kBitPackedInt16}},
+                                                 {{}});
    return representations;
 }
 
@@ -837,7 +946,11 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt32}, {EColumnType::kInt32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitInt32},
+                                                  {EColumnType::kInt32},
+                                                  {EColumnType::kSplitDeltaInt32},
+                                                  {EColumnType::kBitPackedInt32}},
+                                                 {{}});
    return representations;
 }
 
@@ -862,7 +975,11 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt32}, {EColumnType::kInt32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitInt32},
+                                                  {EColumnType::kInt32},
+                                                  {EColumnType::kSplitDeltaInt32},
+                                                  {EColumnType::kBitPackedInt32}},
+                                                 {{}});
    return representations;
 }
 
@@ -887,7 +1004,11 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt64}, {EColumnType::kInt64}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitInt64},
+                                                  {EColumnType::kInt64},
+                                                  {EColumnType::kSplitDeltaInt64},
+                                                  {EColumnType::kBitPackedInt64}},
+                                                 {{}});
    return representations;
 }
 
@@ -912,7 +1033,10 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt64}, {EColumnType::kInt64}},
+   static RColumnRepresentations representations({{EColumnType::kSplitInt64},
+                                                  {EColumnType::kInt64},
+                                                  {EColumnType::kSplitDeltaInt64},
+                                                  {EColumnType::kBitPackedInt64}},
                                                  {{EColumnType::kInt32}, {EColumnType::kSplitInt32}});
    return representations;
 }
@@ -938,19 +1062,40 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::string>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32, EColumnType::kChar}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kIndex32, EColumnType::kChar},
+                                                  {EColumnType::kSplitIndex32, EColumnType::kChar},
+                                                  // Dictionary-encoded: ids, dictionary offsets, dictionary chars
+                                                  {EColumnType::kBitPackedInt32, EColumnType::kSplitIndex32,
+                                                   EColumnType::kChar},
+                                                  {EColumnType::kSplitInt32, EColumnType::kSplitIndex32,
+                                                   EColumnType::kChar},
+                                                  {EColumnType::kInt32, EColumnType::kIndex32, EColumnType::kChar}},
+                                                 {{}});
    return representations;
 }
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
-   fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(GetColumnRepresentative()[1]), 1));
+   const auto &representative = GetColumnRepresentative();
+   if (representative.size() == 3) {
+      fColumns.emplace_back(Detail::RColumn::Create<std::uint32_t>(RColumnModel(representative[0]), 0));
+      fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(representative[1]), 1));
+      fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(representative[2]), 2));
+      return;
+   }
+   fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(representative[0]), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(representative[1]), 1));
 }
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
    auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
+   if (onDiskTypes.size() == 3) {
+      fColumns.emplace_back(Detail::RColumn::Create<std::uint32_t>(RColumnModel(onDiskTypes[0]), 0));
+      fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(onDiskTypes[1]), 1));
+      fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(onDiskTypes[2]), 2));
+      return;
+   }
    fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(onDiskTypes[0]), 0));
    fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(onDiskTypes[1]), 1));
 }
@@ -959,6 +1104,23 @@ std::size_t ROOT::Experimental::RField<std::string>::AppendImpl(const ROOT::Expe
 {
    auto typedValue = value.Get<std::string>();
    auto length = typedValue->length();
+
+   if (fColumns.size() == 3) {
+      std::size_t nbytes = sizeof(std::uint32_t);
+      auto [itr, isNew] = fDictionaryIds.try_emplace(*typedValue, static_cast<std::uint32_t>(fDictionaryIds.size()));
+      if (isNew) {
+         Detail::RColumnElement<char> elemChars(const_cast<char *>(typedValue->data()));
+         fColumns[2]->AppendV(elemChars, length);
+         fIndex += length;
+         fColumns[1]->Append(fElemIndex);
+         nbytes += length + sizeof(fElemIndex);
+      }
+      std::uint32_t dictionaryId = itr->second;
+      Detail::RColumnElement<std::uint32_t> elemId(&dictionaryId);
+      fColumns[0]->Append(elemId);
+      return nbytes;
+   }
+
    Detail::RColumnElement<char> elemChars(const_cast<char*>(typedValue->data()));
    fColumns[1]->AppendV(elemChars, length);
    fIndex += length;
@@ -970,6 +1132,16 @@ void ROOT::Experimental::RField<std::string>::ReadGlobalImpl(
    ROOT::Experimental::NTupleSize_t globalIndex, ROOT::Experimental::Detail::RFieldValue *value)
 {
    auto typedValue = value->Get<std::string>();
+
+   if (fColumns.size() == 3) {
+      const auto clusterIndex = fPrincipalColumn->GetClusterIndex(globalIndex);
+      std::uint32_t dictionaryId;
+      Detail::RColumnElement<std::uint32_t> elemId(&dictionaryId);
+      fPrincipalColumn->Read(clusterIndex, &elemId);
+      *typedValue = GetDictionaryEntry(clusterIndex.GetClusterId(), dictionaryId);
+      return;
+   }
+
    RClusterIndex collectionStart;
    ClusterSize_t nChars;
    fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nChars);
@@ -982,9 +1154,96 @@ void ROOT::Experimental::RField<std::string>::ReadGlobalImpl(
    }
 }
 
+void ROOT::Experimental::RField<std::string>::LoadDictionary(DescriptorId_t clusterId)
+{
+   if (clusterId == fDictionaryClusterId)
+      return;
+   fDictionary.clear();
+   fDictionaryLookup.clear();
+   fDictionaryClusterId = clusterId;
+   auto descriptorGuard = fColumns[1]->GetPageSource()->GetSharedDescriptorGuard();
+   fDictionarySize = descriptorGuard->GetClusterDescriptor(clusterId)
+                        .GetColumnRange(fColumns[1]->GetHandleSource().fPhysicalId)
+                        .fNElements;
+}
+
+const std::string &
+ROOT::Experimental::RField<std::string>::GetDictionaryEntry(DescriptorId_t clusterId, std::uint32_t dictionaryId)
+{
+   LoadDictionary(clusterId);
+   if (dictionaryId >= fDictionarySize) {
+      // Clusters written before the field was added to the model have zero ids and no dictionary; their entries
+      // read as empty strings
+      static const std::string kEmpty;
+      if (fDictionarySize == 0)
+         return kEmpty;
+      throw RException(R__FAIL("invalid dictionary id " + std::to_string(dictionaryId) + " in field " +
+                               GetQualifiedFieldName()));
+   }
+   // The dictionary of a cluster is immutable, so the entries read so far can be kept while the cluster is current
+   while (fDictionary.size() <= dictionaryId) {
+      RClusterIndex collectionStart;
+      ClusterSize_t nChars;
+      fColumns[1]->GetCollectionInfo(RClusterIndex(clusterId, fDictionary.size()), &collectionStart, &nChars);
+      std::string entry(nChars, '\0');
+      if (nChars > 0) {
+         Detail::RColumnElement<char> elemChars(entry.data());
+         fColumns[2]->ReadV(collectionStart, nChars, &elemChars);
+      }
+      fDictionary.emplace_back(std::move(entry));
+   }
+   return fDictionary[dictionaryId];
+}
+
 void ROOT::Experimental::RField<std::string>::CommitCluster()
 {
    fIndex = 0;
+   fDictionaryIds.clear();
+}
+
+void ROOT::Experimental::RField<std::string>::SetDictionaryEncoded()
+{
+   SetColumnRepresentative({EColumnType::kBitPackedInt32, EColumnType::kSplitIndex32, EColumnType::kChar});
+}
+
+bool ROOT::Experimental::RField<std::string>::IsDictionaryEncoded() const
+{
+   if (fColumns.empty())
+      return GetColumnRepresentative().size() == 3;
+   return fColumns.size() == 3;
+}
+
+void ROOT::Experimental::RField<std::string>::EnsureDictionaryEncoded() const
+{
+   if (fColumns.size() != 3)
+      throw RException(R__FAIL("field " + GetQualifiedFieldName() + " is not a connected, dictionary-encoded field"));
+}
+
+std::uint32_t ROOT::Experimental::RField<std::string>::GetDictionaryId(NTupleSize_t globalIndex)
+{
+   EnsureDictionaryEncoded();
+   std::uint32_t dictionaryId;
+   Detail::RColumnElement<std::uint32_t> elemId(&dictionaryId);
+   fPrincipalColumn->Read(globalIndex, &elemId);
+   return dictionaryId;
+}
+
+std::uint32_t ROOT::Experimental::RField<std::string>::FindDictionaryId(NTupleSize_t globalIndex, std::string_view value)
+{
+   EnsureDictionaryEncoded();
+   const auto clusterId = fPrincipalColumn->GetClusterIndex(globalIndex).GetClusterId();
+   LoadDictionary(clusterId);
+   // Without a dictionary, all the entries of the cluster are empty strings with id zero
+   if (fDictionarySize == 0)
+      return value.empty() ? 0 : kInvalidDictionaryId;
+   if (fDictionaryLookup.empty()) {
+      GetDictionaryEntry(clusterId, fDictionarySize - 1);
+      fDictionaryLookup.reserve(fDictionarySize);
+      for (std::uint32_t i = 0; i < fDictionarySize; ++i)
+         fDictionaryLookup.emplace(fDictionary[i], i);
+   }
+   const auto itr = fDictionaryLookup.find(value);
+   return (itr == fDictionaryLookup.end()) ? kInvalidDictionaryId : itr->second;
 }
 
 void ROOT::Experimental::RField<std::string>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -1296,7 +1555,7 @@ void ROOT::Experimental::RCollectionClassField::ReadGlobalImpl(NTupleSize_t glob
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RCollectionClassField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kIndex32}, {EColumnType::kSplitIndex32}}, {{}});
    return representations;
 }
 
@@ -1557,7 +1816,7 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RVectorField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kIndex32}, {EColumnType::kSplitIndex32}}, {{}});
    return representations;
 }
 
@@ -1728,7 +1987,7 @@ void ROOT::Experimental::RRVecField::ReadGlobalImpl(NTupleSize_t globalIndex, De
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RRVecField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kIndex32}, {EColumnType::kSplitIndex32}}, {{}});
    return representations;
 }
 
@@ -1915,7 +2174,7 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::vector<bool>>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kIndex32}, {EColumnType::kSplitIndex32}}, {{}});
    return representations;
 }
 
@@ -2138,7 +2397,10 @@ void ROOT::Experimental::RVariantField::ReadGlobalImpl(NTupleSize_t globalIndex,
    RClusterIndex variantIndex;
    std::uint32_t tag;
    fPrincipalColumn->GetSwitchInfo(globalIndex, &variantIndex, &tag);
-   R__ASSERT(tag > 0); // TODO(jblomer): deal with invalid variants
+   // A zero tag is found for variant fields that were added to the model after the entry was written; such entries
+   // keep the default-constructed variant
+   if (tag == 0)
+      return;
 
    auto itemValue = fSubFields[tag - 1]->GenerateValue(value->GetRawPtr());
    fSubFields[tag - 1]->Read(variantIndex, &itemValue);
@@ -2341,7 +2603,7 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RCollectionField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kIndex32}, {EColumnType::kSplitIndex32}}, {{}});
    return representations;
 }
 
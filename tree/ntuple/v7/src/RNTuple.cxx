@@ -16,6 +16,7 @@
 #include <ROOT/RNTuple.hxx>
 
 #include <ROOT/RFieldVisitor.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RPageSourceFriends.hxx>
 #include <ROOT/RPageStorage.hxx>
@@ -273,9 +274,9 @@ const ROOT::Experimental::RNTupleDescriptor *ROOT::Experimental::RNTupleReader::
 
 //------------------------------------------------------------------------------
 
-ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
-                                                 std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
-   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleWriter")
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleFillContext")
 {
    if (!fModel) {
       throw RException(R__FAIL("null model"));
@@ -284,12 +285,6 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimen
       throw RException(R__FAIL("null sink"));
    }
    fModel->Freeze();
-#ifdef R__USE_IMT
-   if (IsImplicitMTEnabled()) {
-      fZipTasks = std::make_unique<RNTupleImtTaskScheduler>();
-      fSink->SetTaskScheduler(fZipTasks.get());
-   }
-#endif
    fSink->Create(*fModel.get());
    fMetrics.ObserveMetrics(fSink->GetMetrics());
 
@@ -300,10 +295,70 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimen
    fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
 }
 
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   try {
+      CommitCluster();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing the last cluster: " << err.GetError().GetReport();
+   }
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted) {
+      return;
+   }
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fNBytesCommitted += fSink->CommitCluster(fNEntries);
+   fNBytesFilled += fUnzippedClusterSize;
+
+   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+   const float compressionFactor =
+      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   fUnzippedClusterSizeEst =
+      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+//------------------------------------------------------------------------------
+
+namespace {
+/// Creates the compression task scheduler for the sink of an RNTupleWriter if IMT is on
+std::unique_ptr<ROOT::Experimental::Detail::RPageStorage::RTaskScheduler>
+CreateZipTasks(ROOT::Experimental::Detail::RPageSink *sink)
+{
+   std::unique_ptr<ROOT::Experimental::Detail::RPageStorage::RTaskScheduler> zipTasks;
+#ifdef R__USE_IMT
+   if (sink && ROOT::IsImplicitMTEnabled()) {
+      zipTasks = std::make_unique<ROOT::Experimental::RNTupleImtTaskScheduler>();
+      sink->SetTaskScheduler(zipTasks.get());
+   }
+#else
+   (void)sink;
+#endif
+   return zipTasks;
+}
+} // anonymous namespace
+
+ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+                                                 std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fZipTasks(CreateZipTasks(sink.get())),
+     fFillContext(std::move(model), std::move(sink)),
+     fMetrics("RNTupleWriter")
+{
+   fMetrics.ObserveMetrics(fFillContext.fSink->GetMetrics());
+}
+
 ROOT::Experimental::RNTupleWriter::~RNTupleWriter()
 {
    CommitCluster(true /* commitClusterGroup */);
-   fSink->CommitDataset();
+   fFillContext.fSink->CommitDataset();
 }
 
 std::unique_ptr<ROOT::Experimental::RNTupleWriter>
@@ -327,35 +382,15 @@ ROOT::Experimental::RNTupleWriter::Append(std::unique_ptr<RNTupleModel> model, s
 
 void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
 {
-   if (fNEntries == fLastCommittedClusterGroup)
+   if (fFillContext.GetNEntries() == fLastCommittedClusterGroup)
       return;
-   fSink->CommitClusterGroup();
-   fLastCommittedClusterGroup = fNEntries;
+   fFillContext.fSink->CommitClusterGroup();
+   fLastCommittedClusterGroup = fFillContext.GetNEntries();
 }
 
 void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
 {
-   if (fNEntries == fLastCommitted) {
-      if (commitClusterGroup)
-         CommitClusterGroup();
-      return;
-   }
-   for (auto &field : *fModel->GetFieldZero()) {
-      field.Flush();
-      field.CommitCluster();
-   }
-   fNBytesCommitted += fSink->CommitCluster(fNEntries);
-   fNBytesFilled += fUnzippedClusterSize;
-
-   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
-   const float compressionFactor =
-      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
-   fUnzippedClusterSizeEst =
-      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
-
-   fLastCommitted = fNEntries;
-   fUnzippedClusterSize = 0;
-
+   fFillContext.CommitCluster();
    if (commitClusterGroup)
       CommitClusterGroup();
 }
@@ -18,6 +18,7 @@
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPage.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <RZip.h>
@@ -278,6 +279,29 @@ ROOT::Experimental::RNTupleDescriptor::FindPhysicalColumnId(DescriptorId_t field
    return GetColumnDescriptor(logicalId).GetPhysicalId();
 }
 
+
+std::uint64_t ROOT::Experimental::RNTupleDescriptor::GetNElementsPerEntry(DescriptorId_t physicalColumnId) const
+{
+   const auto &columnDesc = GetColumnDescriptor(physicalColumnId);
+   if (columnDesc.GetIndex() > 0)
+      return 0;
+   std::uint64_t nElements = 1;
+   auto fieldId = columnDesc.GetFieldId();
+   bool isColumnField = true;
+   while (fieldId != GetFieldZeroId()) {
+      const auto &fieldDesc = GetFieldDescriptor(fieldId);
+      if (!isColumnField && ((fieldDesc.GetStructure() == ENTupleStructure::kCollection) ||
+                             (fieldDesc.GetStructure() == ENTupleStructure::kVariant))) {
+         return 0;
+      }
+      nElements *= std::max<std::uint64_t>(1, fieldDesc.GetNRepetitions());
+      fieldId = fieldDesc.GetParentId();
+      isColumnField = false;
+   }
+   return nElements;
+}
+
+
 ROOT::Experimental::DescriptorId_t
 ROOT::Experimental::RNTupleDescriptor::FindClusterId(DescriptorId_t physicalColumnId, NTupleSize_t index) const
 {
@@ -415,14 +439,54 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(DescriptorId_t
       return R__FAIL("column ID conflict");
    RClusterDescriptor::RColumnRange columnRange{physicalId, firstElementIndex, RClusterSize(0)};
    columnRange.fCompressionSettings = compressionSettings;
+   bool hasStatistics = !pageRange.fPageInfos.empty();
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
+      hasStatistics = hasStatistics && pi.fStatistics.HasRange();
+      if (hasStatistics) {
+         columnRange.fStatistics.fMin = std::min(columnRange.fStatistics.fMin, pi.fStatistics.fMin);
+         columnRange.fStatistics.fMax = std::max(columnRange.fStatistics.fMax, pi.fStatistics.fMax);
+      }
    }
+   if (!hasStatistics)
+      columnRange.fStatistics = RColumnStatistics();
    fCluster.fPageRanges[physicalId] = pageRange.Clone();
    fCluster.fColumnRanges[physicalId] = columnRange;
    return RResult<void>::Success();
 }
 
+ROOT::Experimental::RResult<void>
+ROOT::Experimental::RClusterDescriptorBuilder::AddExtendedColumnRanges(const RNTupleDescriptor &desc)
+{
+   // Zero pages are read into a view of the shared zero buffer; the largest in-memory element (RColumnSwitch) has
+   // 16 bytes
+   constexpr std::uint32_t kMaxElementsPerPageZero = Detail::RPage::kPageZeroSize / 16;
+
+   const auto nPhysicalColumns = desc.GetNPhysicalColumns();
+   for (DescriptorId_t physicalId = 0; physicalId < nPhysicalColumns; ++physicalId) {
+      if (fCluster.fColumnRanges.count(physicalId) > 0)
+         continue;
+
+      const auto nElementsPerEntry = desc.GetNElementsPerEntry(physicalId);
+      RClusterDescriptor::RPageRange pageRange;
+      pageRange.fPhysicalColumnId = physicalId;
+      std::uint64_t nElements = nElementsPerEntry * fCluster.fNEntries;
+      while (nElements > 0) {
+         RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+         pageInfo.fNElements = std::min<std::uint64_t>(nElements, kMaxElementsPerPageZero);
+         pageInfo.fLocator.fType = RNTupleLocator::kTypePageZero;
+         pageInfo.fLocator.fBytesOnStorage = 0;
+         pageInfo.fStatistics = RColumnStatistics{0., 0.};
+         pageRange.fPageInfos.emplace_back(pageInfo);
+         nElements -= pageInfo.fNElements;
+      }
+      auto result = CommitColumnRange(physicalId, nElementsPerEntry * fCluster.fFirstEntryIndex,
+                                      0 /* compressionSettings */, pageRange);
+      if (!result)
+         return R__FORWARD_ERROR(result);
+   }
+   return RResult<void>::Success();
+}
 
 ROOT::Experimental::RResult<ROOT::Experimental::RClusterDescriptor>
 ROOT::Experimental::RClusterDescriptorBuilder::MoveDescriptor()
@@ -13,17 +13,111 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
 
-Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
-   if (inputs == nullptr || mergeInfo == nullptr) {
+#include <TCollection.h>
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Compression settings with compression level 0 all result in uncompressed pages
+bool IsSameCompression(std::int64_t lhs, std::int64_t rhs)
+{
+   return (lhs == rhs) || ((lhs % 100 == 0) && (rhs % 100 == 0));
+}
+
+template <typename T>
+void SetRealFieldPrecision(ROOT::Experimental::RRealField<T> &field, const ROOT::Experimental::RColumnModel &model)
+{
+   using EColumnType = ROOT::Experimental::EColumnType;
+   switch (model.GetType()) {
+   case EColumnType::kReal32Trunc: field.SetTruncated(model.GetBitsOnStorage()); break;
+   case EColumnType::kReal32Quant:
+      field.SetQuantized(model.GetValueMin(), model.GetValueMax(), model.GetBitsOnStorage());
+      break;
+   default: break;
+   }
+}
+
+/// Truncated and quantized floating point columns need the precision of the input in addition to the column type
+void SetRealFieldPrecision(ROOT::Experimental::Detail::RFieldBase &field, const ROOT::Experimental::RColumnModel &model)
+{
+   if (auto floatField = dynamic_cast<ROOT::Experimental::RRealField<float> *>(&field))
+      SetRealFieldPrecision(*floatField, model);
+   else if (auto doubleField = dynamic_cast<ROOT::Experimental::RRealField<double> *>(&field))
+      SetRealFieldPrecision(*doubleField, model);
+}
+
+} // anonymous namespace
+
+Long64_t ROOT::Experimental::RNTuple::Merge(TCollection *inputs, TFileMergeInfo *mergeInfo)
+{
+   // The first entry of the inputs carries the name of the RNTuple, the following entries are the input files.
+   // The output file is given by the merge info.
+   if (inputs == nullptr || mergeInfo == nullptr || mergeInfo->fOutputDirectory == nullptr) {
+      return -1;
+   }
+   if (inputs->GetEntries() < 2) {
+      return -1;
+   }
+
+   TIter itr(inputs);
+   const std::string ntupleName = itr()->GetName();
+
+   auto outFile = dynamic_cast<TFile *>(mergeInfo->fOutputDirectory);
+   if (!outFile) {
+      R__LOG_ERROR(NTupleLog()) << "merging RNTuple '" << ntupleName << "' into a sub directory is unsupported";
+      return -1;
+   }
+
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   while (auto obj = itr()) {
+      auto inFile = dynamic_cast<TFile *>(obj);
+      auto anchor = inFile ? inFile->Get<RNTuple>(ntupleName.c_str()) : nullptr;
+      if (!anchor) {
+         R__LOG_ERROR(NTupleLog()) << "cannot find RNTuple '" << ntupleName << "' in " << obj->GetName();
+         return -1;
+      }
+      sources.emplace_back(anchor->MakePageSource());
+      delete anchor;
+   }
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   for (const auto &s : sources)
+      sourcePtrs.emplace_back(s.get());
+
+   RNTupleWriteOptions options;
+   options.SetCompression(outFile->GetCompressionSettings());
+   auto destination = std::make_unique<Detail::RPageSinkFile>(ntupleName, *outFile, options);
+
+   try {
+      RNTupleMerger merger;
+      merger.Merge(sourcePtrs, *destination);
+   } catch (const RException &e) {
+      R__LOG_ERROR(NTupleLog()) << "cannot merge RNTuple '" << ntupleName << "': " << e.what();
       return -1;
    }
-   return -1;
+
+   return 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -36,3 +130,201 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+void ROOT::Experimental::RNTupleMerger::AddColumnsFromField(std::vector<RColumnInfo> &columns,
+                                                            const RNTupleDescriptor &desc,
+                                                            const RFieldDescriptor &fieldDesc)
+{
+   for (const auto &field : desc.GetFieldIterable(fieldDesc)) {
+      const auto fieldName = desc.GetQualifiedFieldName(field.GetId());
+      for (const auto &column : desc.GetColumnIterable(field)) {
+         // Alias columns of projected fields don't carry data
+         if (column.IsAliasColumn())
+            continue;
+         RColumnInfo info;
+         info.fColumnName = fieldName + "." + std::to_string(column.GetIndex());
+         info.fColumnModel = column.GetModel();
+         info.fColumnInputId = column.GetPhysicalId();
+         columns.emplace_back(info);
+      }
+      AddColumnsFromField(columns, desc, field);
+   }
+}
+
+std::vector<ROOT::Experimental::RNTupleMerger::RColumnInfo>
+ROOT::Experimental::RNTupleMerger::CollectColumns(const RNTupleDescriptor &desc)
+{
+   std::vector<RColumnInfo> columns;
+   AddColumnsFromField(columns, desc, desc.GetFieldZero());
+   return columns;
+}
+
+void ROOT::Experimental::RNTupleMerger::MapColumns(std::vector<RColumnInfo> &columns) const
+{
+   if (columns.size() != fOutputColumns.size())
+      throw RException(R__FAIL("cannot merge RNTuples with a different number of columns"));
+
+   for (auto &column : columns) {
+      auto itr = fOutputColumns.find(column.fColumnName);
+      if (itr == fOutputColumns.end())
+         throw RException(R__FAIL("column `" + column.fColumnName + "` is missing in the merge destination"));
+      const auto inputType = column.fColumnModel.GetType();
+      const auto outputType = itr->second.fColumnModel.GetType();
+      if (outputType != inputType) {
+         throw RException(R__FAIL("column `" + column.fColumnName + "` has type " +
+                                  Detail::RColumnElementBase::GetTypeName(inputType) +
+                                  " but the merge destination expects " +
+                                  Detail::RColumnElementBase::GetTypeName(outputType)));
+      }
+      if (itr->second.fColumnModel != column.fColumnModel) {
+         throw RException(R__FAIL("column `" + column.fColumnName +
+                                  "` has a different precision than the merge destination"));
+      }
+      column.fColumnOutputId = itr->second.fColumnOutputId;
+   }
+}
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources,
+                                              Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no input sources to merge"));
+
+   const auto outputCompression = destination.GetWriteOptions().GetCompression();
+   Detail::RNTupleDecompressor decompressor;
+   std::unique_ptr<RNTupleModel> model;
+   NTupleSize_t nEntries = 0;
+
+   for (auto source : sources) {
+      source->Attach();
+      // Work on a copy of the descriptor so that we don't hold the descriptor lock while loading clusters
+      auto descriptor = source->GetSharedDescriptorGuard()->Clone();
+
+      if (!model) {
+         // The first source defines the schema of the output, including the column representations
+         model = descriptor->GenerateModel();
+         for (auto &field : *model->GetFieldZero()) {
+            if (field.GetOnDiskId() == kInvalidDescriptorId)
+               continue;
+            Detail::RFieldBase::ColumnRepresentation_t onDiskTypes;
+            for (const auto &c : descriptor->GetColumnIterable(field.GetOnDiskId()))
+               onDiskTypes.emplace_back(c.GetModel().GetType());
+            if (!onDiskTypes.empty() && (onDiskTypes != field.GetColumnRepresentative()))
+               field.SetColumnRepresentative(onDiskTypes);
+            if (!onDiskTypes.empty())
+               SetRealFieldPrecision(field, (*descriptor->GetColumnIterable(field.GetOnDiskId()).begin()).GetModel());
+         }
+         destination.Create(*model);
+
+         fOutputColumns.clear();
+         for (auto &info : CollectColumns(destination.GetDescriptor())) {
+            info.fColumnOutputId = info.fColumnInputId;
+            info.fColumnInputId = kInvalidDescriptorId;
+            fOutputColumns[info.fColumnName] = info;
+         }
+      }
+
+      auto columns = CollectColumns(*descriptor);
+      MapColumns(columns);
+      Detail::RCluster::ColumnSet_t columnSet;
+      for (const auto &column : columns)
+         columnSet.insert(column.fColumnInputId);
+
+      // Clusters are not necessarily stored in entry order in the descriptor
+      std::vector<DescriptorId_t> clusterIds;
+      for (const auto &c : descriptor->GetClusterIterable())
+         clusterIds.emplace_back(c.GetId());
+      std::sort(clusterIds.begin(), clusterIds.end(), [&descriptor](DescriptorId_t a, DescriptorId_t b) {
+         return descriptor->GetClusterDescriptor(a).GetFirstEntryIndex() <
+                descriptor->GetClusterDescriptor(b).GetFirstEntryIndex();
+      });
+
+      for (auto clusterId : clusterIds) {
+         const auto &clusterDesc = descriptor->GetClusterDescriptor(clusterId);
+
+         std::unique_ptr<Detail::RCluster> cluster;
+         if (!columnSet.empty()) {
+            std::vector<Detail::RCluster::RKey> clusterKeys{{clusterId, columnSet}};
+            cluster = std::move(source->LoadClusters(clusterKeys)[0]);
+         }
+
+         // The sealed pages either point into the loaded cluster or into one of the recompression buffers;
+         // both need to stay alive until the pages are committed.
+         Detail::RPageStorage::SealedPageSequence_t sealedPages;
+         std::vector<std::unique_ptr<unsigned char[]>> zipBuffers;
+         // For every column, the number of sealed pages in the sequence
+         std::vector<std::pair<DescriptorId_t, std::size_t>> nPagesPerColumn;
+
+         for (const auto &column : columns) {
+            const auto &columnRange = clusterDesc.GetColumnRange(column.fColumnInputId);
+            const bool needsRecompression = !IsSameCompression(columnRange.fCompressionSettings, outputCompression);
+
+            const auto &pageRange = clusterDesc.GetPageRange(column.fColumnInputId);
+            const auto element = Detail::RColumnElementBase::Generate(column.fColumnModel);
+            std::uint64_t pageNo = 0;
+            for (const auto &pageInfo : pageRange.fPageInfos) {
+               if (pageInfo.fLocator.fType == RNTupleLocator::kTypePageZero) {
+                  // Columns added late to the input have no pages in early clusters. In the output, the zero pages
+                  // are materialized by packing zero-valued elements: the packed representation of zero is not
+                  // necessarily all zero bytes, e.g. for quantized reals whose range does not start at zero.
+                  const std::size_t maxBytesPacked = element->GetPackedSize(pageInfo.fNElements);
+                  auto zeroBuffer = std::make_unique<unsigned char[]>(maxBytesPacked);
+                  if (!element->IsMappable()) {
+                     auto zeroElements = std::make_unique<unsigned char[]>(pageInfo.fNElements * element->GetSize());
+                     element->Pack(zeroBuffer.get(), zeroElements.get(), pageInfo.fNElements);
+                  }
+                  const auto bytesPacked = element->GetPackedSizeFromHeader(zeroBuffer.get(), pageInfo.fNElements);
+                  zipBuffers.emplace_back(std::make_unique<unsigned char[]>(bytesPacked));
+                  const std::uint32_t bytesZipped = Detail::RPageStorage::ZipPackedPage(
+                     *element, zeroBuffer.get(), bytesPacked, outputCompression, zipBuffers.back().get());
+                  Detail::RPageStorage::RSealedPage sealedPage{zipBuffers.back().get(), bytesZipped,
+                                                               pageInfo.fNElements};
+                  sealedPage.fStatistics = pageInfo.fStatistics;
+                  sealedPages.emplace_back(std::move(sealedPage));
+                  ++pageNo;
+                  continue;
+               }
+               auto onDiskPage = cluster->GetOnDiskPage(Detail::ROnDiskPage::Key{column.fColumnInputId, pageNo});
+               R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pageInfo.fLocator.fBytesOnStorage));
+               Detail::RPageStorage::RSealedPage sealedPage{onDiskPage->GetAddress(), onDiskPage->GetSize(),
+                                                            pageInfo.fNElements};
+               sealedPage.fStatistics = pageInfo.fStatistics;
+
+               if (needsRecompression) {
+                  const std::size_t bytesPacked = Detail::RPageStorage::GetPackedSize(sealedPage, *element);
+                  auto unzipBuffer = std::make_unique<unsigned char[]>(bytesPacked);
+                  Detail::RPageStorage::UnzipPackedPage(sealedPage, *element, decompressor, unzipBuffer.get());
+                  zipBuffers.emplace_back(std::make_unique<unsigned char[]>(bytesPacked));
+                  sealedPage.fSize = Detail::RPageStorage::ZipPackedPage(*element, unzipBuffer.get(), bytesPacked,
+                                                                         outputCompression, zipBuffers.back().get());
+                  sealedPage.fBuffer = zipBuffers.back().get();
+               }
+
+               sealedPages.emplace_back(std::move(sealedPage));
+               ++pageNo;
+            }
+            nPagesPerColumn.emplace_back(column.fColumnOutputId, pageNo);
+         }
+
+         // Deque iterators are invalidated by emplace_back, so the page groups are only built once all the
+         // pages of the cluster are collected
+         std::vector<Detail::RPageStorage::RSealedPageGroup> sealedPageGroups;
+         auto itrPage = sealedPages.cbegin();
+         for (const auto &[outputId, nPages] : nPagesPerColumn) {
+            auto itrLast = itrPage + nPages;
+            sealedPageGroups.emplace_back(outputId, itrPage, itrLast);
+            itrPage = itrLast;
+         }
+         destination.CommitSealedPageV(sealedPageGroups);
+
+         nEntries += clusterDesc.GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+   }
+
+   destination.CommitClusterGroup();
+   destination.CommitDataset();
+}
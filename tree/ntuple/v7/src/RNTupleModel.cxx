@@ -22,6 +22,7 @@
 #include <atomic>
 #include <cstdlib>
 #include <memory>
+#include <string>
 #include <utility>
 
 ROOT::Experimental::RResult<void>
@@ -128,6 +129,41 @@ ROOT::Experimental::RNTupleModel::RProjectedFields::Clone(const RNTupleModel *ne
    return clone;
 }
 
+ROOT::Experimental::RNTupleModel::RUpdater::RUpdater(RNTupleWriter &writer)
+   : fWriter(writer), fOpenChangeset(fWriter.GetUpdatableModel())
+{
+}
+
+void ROOT::Experimental::RNTupleModel::RUpdater::BeginUpdate()
+{
+   auto &model = fOpenChangeset.fModel;
+   if (!model.GetProjectedFields().IsEmpty())
+      throw RException(R__FAIL("adding fields to a model with projected fields is unsupported"));
+   model.Unfreeze();
+}
+
+void ROOT::Experimental::RNTupleModel::RUpdater::CommitUpdate()
+{
+   auto &model = fOpenChangeset.fModel;
+   if (model.IsFrozen())
+      return;
+
+   if (!fOpenChangeset.IsEmpty()) {
+      // The current cluster is written with the old schema; the new fields are stored from the next cluster on
+      fWriter.CommitCluster();
+      fWriter.GetSink().UpdateSchema(fOpenChangeset, fWriter.fFillContext.GetNEntries());
+   }
+   model.Freeze();
+   fOpenChangeset.fAddedFields.clear();
+}
+
+void ROOT::Experimental::RNTupleModel::RUpdater::AddField(std::unique_ptr<Detail::RFieldBase> field)
+{
+   auto fieldp = field.get();
+   fOpenChangeset.fModel.AddField(std::move(field));
+   fOpenChangeset.fAddedFields.emplace_back(fieldp);
+}
+
 void ROOT::Experimental::RNTupleModel::EnsureValidFieldName(std::string_view fieldName)
 {
    RResult<void> nameValid = Detail::RFieldBase::EnsureValidFieldName(fieldName);
@@ -269,6 +305,51 @@ ROOT::Experimental::RNTupleModel::GetField(std::string_view fieldName) const
    return field;
 }
 
+namespace {
+
+/// Calls `fn` with the float or double field `fieldName` of the given model
+template <typename FnT>
+void ApplyToRealField(const ROOT::Experimental::RNTupleModel &model, std::string_view fieldName, FnT fn)
+{
+   using ROOT::Experimental::RException;
+   using ROOT::Experimental::RRealField;
+   // The model is not frozen, so modifying the field is fine
+   auto field = const_cast<ROOT::Experimental::Detail::RFieldBase *>(model.GetField(fieldName));
+   if (!field)
+      throw RException(R__FAIL("invalid field: " + std::string(fieldName)));
+   if (auto floatField = dynamic_cast<RRealField<float> *>(field))
+      fn(*floatField);
+   else if (auto doubleField = dynamic_cast<RRealField<double> *>(field))
+      fn(*doubleField);
+   else
+      throw RException(R__FAIL("not a floating point field: " + std::string(fieldName)));
+}
+
+} // anonymous namespace
+
+void ROOT::Experimental::RNTupleModel::SetFieldTruncated(std::string_view fieldName, std::size_t nBits)
+{
+   EnsureNotFrozen();
+   ApplyToRealField(*this, fieldName, [nBits](auto &field) { field.SetTruncated(nBits); });
+}
+
+void ROOT::Experimental::RNTupleModel::SetFieldQuantized(std::string_view fieldName, double min, double max,
+                                                         std::size_t nBits)
+{
+   EnsureNotFrozen();
+   ApplyToRealField(*this, fieldName, [min, max, nBits](auto &field) { field.SetQuantized(min, max, nBits); });
+}
+
+void ROOT::Experimental::RNTupleModel::SetFieldDictionaryEncoded(std::string_view fieldName)
+{
+   EnsureNotFrozen();
+   // The model is not frozen, so modifying the field is fine
+   auto field = dynamic_cast<RField<std::string> *>(const_cast<Detail::RFieldBase *>(GetField(fieldName)));
+   if (!field)
+      throw RException(R__FAIL("not a string field: " + std::string(fieldName)));
+   field->SetDictionaryEncoded();
+}
+
 ROOT::Experimental::REntry *ROOT::Experimental::RNTupleModel::GetDefaultEntry() const
 {
    if (!IsFrozen())
@@ -312,6 +393,16 @@ void ROOT::Experimental::RNTupleModel::Freeze()
       fDefaultEntry->fModelId = fModelId;
 }
 
+void ROOT::Experimental::RNTupleModel::Unfreeze()
+{
+   if (!IsFrozen())
+      return;
+
+   fModelId = 0;
+   if (fDefaultEntry)
+      fDefaultEntry->fModelId = 0;
+}
+
 void ROOT::Experimental::RNTupleModel::SetDescription(std::string_view description)
 {
    EnsureNotFrozen();
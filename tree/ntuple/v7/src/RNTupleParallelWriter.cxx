@@ -0,0 +1,157 @@
+/// \file RNTupleParallelWriter.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-06-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleParallelWriter.hxx>
+
+#include <ROOT/RLogger.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageSinkSync.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+
+#include <algorithm>
+#include <utility>
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   fModel->Freeze();
+   fSink->Create(*fModel.get());
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   for (const auto &fillContext : fFillContexts) {
+      if (!fillContext.expired()) {
+         R__LOG_ERROR(NTupleLog()) << "RNTupleFillContext still in use while destructing RNTupleParallelWriter; "
+                                   << "its uncommitted entries are lost";
+      }
+   }
+
+   {
+      std::lock_guard<std::mutex> guard(fOrderMutex);
+      if (!fReleasedSinks.empty()) {
+         R__LOG_ERROR(NTupleLog()) << "missing ordered fill context with sequence number " << fNextSequenceNumber
+                                   << "; appending the remaining clusters out of order";
+      }
+      for (auto &[_, sink] : fReleasedSinks) {
+         if (sink)
+            sink->CommitDeferredClusters();
+      }
+      fReleasedSinks.clear();
+   }
+
+   std::lock_guard<std::mutex> guard(fMutex);
+   if (fSink->GetDescriptor().GetNEntries() > 0)
+      fSink->CommitClusterGroup();
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   // The fill contexts buffer the sealed pages of their open cluster; buffering in the shared sink is not needed
+   auto sinkOptions = options.Clone();
+   sinkOptions->SetUseBufferedWrite(false);
+   auto sink = Detail::RPageSink::Create(ntupleName, storage, *sinkOptions);
+   return std::unique_ptr<RNTupleParallelWriter>(new RNTupleParallelWriter(std::move(model), std::move(sink)));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Append(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                  TFile &file, const RNTupleWriteOptions &options)
+{
+   auto sink = std::make_unique<Detail::RPageSinkFile>(ntupleName, file, options);
+   return std::unique_ptr<RNTupleParallelWriter>(new RNTupleParallelWriter(std::move(model), std::move(sink)));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext>
+ROOT::Experimental::RNTupleParallelWriter::CreateFillContextImpl(std::unique_ptr<RNTupleModel> model, bool isOrdered,
+                                                                 std::uint64_t sequenceNumber)
+{
+   // Creating the fill context reads the descriptor of the shared sink and thus needs to hold the lock
+   std::lock_guard<std::mutex> guard(fMutex);
+
+   if (!model)
+      model = fModel->Clone();
+   auto sink = std::make_unique<Detail::RPageSinkSync>(*fSink, fMutex, isOrdered /* deferCommit */);
+   std::shared_ptr<RNTupleFillContext> fillContext;
+   if (isOrdered) {
+      fillContext = std::shared_ptr<RNTupleFillContext>(
+         new RNTupleFillContext(std::move(model), std::move(sink)),
+         [this, sequenceNumber](RNTupleFillContext *c) { ReleaseOrderedFillContext(c, sequenceNumber); });
+   } else {
+      fillContext = std::shared_ptr<RNTupleFillContext>(new RNTupleFillContext(std::move(model), std::move(sink)));
+   }
+   fFillContexts.erase(std::remove_if(fFillContexts.begin(), fFillContexts.end(),
+                                      [](const std::weak_ptr<RNTupleFillContext> &c) { return c.expired(); }),
+                       fFillContexts.end());
+   fFillContexts.emplace_back(fillContext);
+   return fillContext;
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   return CreateFillContextImpl(nullptr, false /* isOrdered */, 0);
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext>
+ROOT::Experimental::RNTupleParallelWriter::CreateFillContext(std::unique_ptr<RNTupleModel> model)
+{
+   if (!model)
+      throw RException(R__FAIL("null model"));
+   return CreateFillContextImpl(std::move(model), false /* isOrdered */, 0);
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext>
+ROOT::Experimental::RNTupleParallelWriter::CreateOrderedFillContext(std::uint64_t sequenceNumber,
+                                                                    std::unique_ptr<RNTupleModel> model)
+{
+   return CreateFillContextImpl(std::move(model), true /* isOrdered */, sequenceNumber);
+}
+
+void ROOT::Experimental::RNTupleParallelWriter::ReleaseOrderedFillContext(RNTupleFillContext *fillContext,
+                                                                         std::uint64_t sequenceNumber)
+{
+   // Keep the sink, which holds the deferred clusters, and destruct the rest of the fill context
+   std::unique_ptr<Detail::RPageSinkSync> sink;
+   try {
+      fillContext->CommitCluster();
+      sink.reset(static_cast<Detail::RPageSinkSync *>(fillContext->fSink.release()));
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing the last cluster: " << err.GetError().GetReport();
+   }
+   delete fillContext;
+
+   std::lock_guard<std::mutex> guard(fOrderMutex);
+   fReleasedSinks[sequenceNumber] = std::move(sink);
+   for (auto itr = fReleasedSinks.begin(); itr != fReleasedSinks.end() && itr->first == fNextSequenceNumber;
+        itr = fReleasedSinks.erase(itr)) {
+      fNextSequenceNumber++;
+      if (!itr->second)
+         continue;
+      try {
+         itr->second->CommitDeferredClusters();
+      } catch (const RException &err) {
+         R__LOG_ERROR(NTupleLog()) << "failure appending deferred clusters: " << err.GetError().GetReport();
+      }
+   }
+}
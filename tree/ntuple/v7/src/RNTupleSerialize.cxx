@@ -22,6 +22,7 @@
 #include <RVersion.h>
 #include <RZip.h> // for R__crc32
 
+#include <algorithm>
 #include <cstring> // for memcpy
 #include <deque>
 #include <set>
@@ -162,13 +163,53 @@ RResult<std::uint32_t> DeserializeFieldV1(
    return frameSize;
 }
 
+std::uint32_t SerializeColumnV1(const ROOT::Experimental::RColumnDescriptor &columnDesc,
+                                const ROOT::Experimental::Internal::RNTupleSerializer::RContext &context,
+                                void *buffer)
+{
+   using RColumnElementBase = ROOT::Experimental::Detail::RColumnElementBase;
+
+   auto base = reinterpret_cast<unsigned char *>(buffer);
+   auto pos = base;
+   void** where = (buffer == nullptr) ? &buffer : reinterpret_cast<void**>(&pos);
+
+   pos += RNTupleSerializer::SerializeRecordFramePreamble(*where);
+
+   const auto model = columnDesc.GetModel();
+   auto type = model.GetType();
+   pos += RNTupleSerializer::SerializeColumnType(type, *where);
+   // Column types with a configurable precision store their actual number of bits
+   const auto bitsOnStorage = (model.GetBitsOnStorage() > 0) ? model.GetBitsOnStorage()
+                                                             : RColumnElementBase::GetBitsOnStorage(type);
+   pos += RNTupleSerializer::SerializeUInt16(bitsOnStorage, *where);
+   pos += RNTupleSerializer::SerializeUInt32(context.GetOnDiskFieldId(columnDesc.GetFieldId()), *where);
+   std::uint32_t flags = 0;
+   // TODO(jblomer): add support for descending columns in the column model
+   if (model.GetIsSorted())
+      flags |= RNTupleSerializer::kFlagSortAscColumn;
+   // TODO(jblomer): fix for unsigned integer types
+   if ((type == ROOT::Experimental::EColumnType::kIndex32) ||
+       (type == ROOT::Experimental::EColumnType::kSplitIndex32))
+      flags |= RNTupleSerializer::kFlagNonNegativeColumn;
+   if (model.HasValueRange())
+      flags |= RNTupleSerializer::kFlagHasValueRange;
+   pos += RNTupleSerializer::SerializeUInt32(flags, *where);
+   if (model.HasValueRange()) {
+      pos += RNTupleSerializer::SerializeDouble(model.GetValueMin(), *where);
+      pos += RNTupleSerializer::SerializeDouble(model.GetValueMax(), *where);
+   }
+
+   auto size = pos - base;
+   RNTupleSerializer::SerializeFramePostscript(base, size);
+
+   return size;
+}
+
 std::uint32_t SerializeColumnListV1(
    const ROOT::Experimental::RNTupleDescriptor &desc,
    ROOT::Experimental::Internal::RNTupleSerializer::RContext &context,
    void *buffer)
 {
-   using RColumnElementBase = ROOT::Experimental::Detail::RColumnElementBase;
-
    auto base = reinterpret_cast<unsigned char *>(buffer);
    auto pos = base;
    void** where = (buffer == nullptr) ? &buffer : reinterpret_cast<void**>(&pos);
@@ -183,23 +224,7 @@ std::uint32_t SerializeColumnListV1(
          if (c.IsAliasColumn())
             continue;
 
-         auto frame = pos;
-         pos += RNTupleSerializer::SerializeRecordFramePreamble(*where);
-
-         auto type = c.GetModel().GetType();
-         pos += RNTupleSerializer::SerializeColumnType(type, *where);
-         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(type), *where);
-         pos += RNTupleSerializer::SerializeUInt32(context.GetOnDiskFieldId(c.GetFieldId()), *where);
-         std::uint32_t flags = 0;
-         // TODO(jblomer): add support for descending columns in the column model
-         if (c.GetModel().GetIsSorted())
-            flags |= RNTupleSerializer::kFlagSortAscColumn;
-         // TODO(jblomer): fix for unsigned integer types
-         if (type == ROOT::Experimental::EColumnType::kIndex32)
-            flags |= RNTupleSerializer::kFlagNonNegativeColumn;
-         pos += RNTupleSerializer::SerializeUInt32(flags, *where);
-
-         pos += RNTupleSerializer::SerializeFramePostscript(buffer ? frame : nullptr, pos - frame);
+         pos += SerializeColumnV1(c, context, *where);
 
          context.MapColumnId(c.GetLogicalId());
       }
@@ -245,11 +270,25 @@ RResult<std::uint32_t> DeserializeColumnV1(
    bytes += RNTupleSerializer::DeserializeUInt32(bytes, fieldId);
    bytes += RNTupleSerializer::DeserializeUInt32(bytes, flags);
 
-   if (ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type) != bitsOnStorage)
+   const auto validBitRange = ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(type);
+   if ((bitsOnStorage < validBitRange.first) || (bitsOnStorage > validBitRange.second))
       return R__FAIL("column element size mismatch");
 
+   double valueMin = 0.0;
+   double valueMax = 0.0;
+   if (flags & RNTupleSerializer::kFlagHasValueRange) {
+      if (fnFrameSizeLeft() < 2 * sizeof(double))
+         return R__FAIL("column record frame too short");
+      bytes += RNTupleSerializer::DeserializeDouble(bytes, valueMin);
+      bytes += RNTupleSerializer::DeserializeDouble(bytes, valueMax);
+   }
+
    const bool isSorted = (flags & (RNTupleSerializer::kFlagSortAscColumn | RNTupleSerializer::kFlagSortDesColumn));
-   columnDesc.FieldId(fieldId).Model({type, isSorted});
+   if (validBitRange.first == validBitRange.second) {
+      columnDesc.FieldId(fieldId).Model({type, isSorted});
+   } else {
+      columnDesc.FieldId(fieldId).Model({type, isSorted, bitsOnStorage, valueMin, valueMax});
+   }
 
    return frameSize;
 }
@@ -346,6 +385,89 @@ RResult<std::uint32_t> DeserializeAliasColumn(const void *buffer, std::uint32_t
    return frameSize;
 }
 
+/// Adds the fields and columns of a footer schema extension to the descriptor.  The on-disk ids continue the ids of
+/// the header (and of the previous schema extensions).
+RResult<std::uint32_t> DeserializeSchemaExtension(const void *buffer, std::uint32_t bufSize,
+                                                  ROOT::Experimental::RNTupleDescriptorBuilder &descBuilder)
+{
+   using ROOT::Experimental::DescriptorId_t;
+   using ROOT::Experimental::kInvalidDescriptorId;
+   using ROOT::Experimental::RColumnDescriptorBuilder;
+   using ROOT::Experimental::RFieldDescriptorBuilder;
+
+   auto base = reinterpret_cast<const unsigned char *>(buffer);
+   auto bytes = base;
+   std::uint32_t extensionFrameSize;
+   auto result = RNTupleSerializer::DeserializeFrameHeader(bytes, bufSize, extensionFrameSize);
+   if (!result)
+      return R__FORWARD_ERROR(result);
+   bytes += result.Unwrap();
+   auto fnExtensionSizeLeft = [&]() { return extensionFrameSize - static_cast<std::uint32_t>(bytes - base); };
+
+   const auto &desc = descBuilder.GetDescriptor();
+   if (desc.GetNLogicalColumns() != desc.GetNPhysicalColumns())
+      return R__FAIL("schema extension of ntuples with projected fields is unsupported");
+
+   std::uint32_t frameSize;
+   auto frame = bytes;
+   auto fnFrameSizeLeft = [&]() { return frameSize - static_cast<std::uint32_t>(bytes - frame); };
+
+   std::uint32_t nFields;
+   result = RNTupleSerializer::DeserializeFrameHeader(bytes, fnExtensionSizeLeft(), frameSize, nFields);
+   if (!result)
+      return R__FORWARD_ERROR(result);
+   bytes += result.Unwrap();
+   for (std::uint32_t i = 0; i < nFields; ++i) {
+      // The zero field is not stored on disk
+      const DescriptorId_t fieldId = desc.GetNFields() - 1;
+      RFieldDescriptorBuilder fieldBuilder;
+      result = DeserializeFieldV1(bytes, fnFrameSizeLeft(), fieldBuilder);
+      if (!result)
+         return R__FORWARD_ERROR(result);
+      bytes += result.Unwrap();
+      if (fieldId == fieldBuilder.GetParentId())
+         fieldBuilder.ParentId(RNTupleSerializer::kZeroFieldId);
+      auto fieldDesc = fieldBuilder.FieldId(fieldId).MakeDescriptor();
+      if (!fieldDesc)
+         return R__FORWARD_ERROR(fieldDesc);
+      auto parentId = fieldDesc.Inspect().GetParentId();
+      descBuilder.AddField(fieldDesc.Unwrap());
+      auto resVoid = descBuilder.AddFieldLink(parentId, fieldId);
+      if (!resVoid)
+         return R__FORWARD_ERROR(resVoid);
+   }
+   bytes = frame + frameSize;
+
+   std::uint32_t nColumns;
+   frame = bytes;
+   result = RNTupleSerializer::DeserializeFrameHeader(bytes, fnExtensionSizeLeft(), frameSize, nColumns);
+   if (!result)
+      return R__FORWARD_ERROR(result);
+   bytes += result.Unwrap();
+   for (std::uint32_t i = 0; i < nColumns; ++i) {
+      const DescriptorId_t columnId = desc.GetNPhysicalColumns();
+      RColumnDescriptorBuilder columnBuilder;
+      result = DeserializeColumnV1(bytes, fnFrameSizeLeft(), columnBuilder);
+      if (!result)
+         return R__FORWARD_ERROR(result);
+      bytes += result.Unwrap();
+
+      const auto fieldId = columnBuilder.GetFieldId();
+      std::uint32_t idx = 0;
+      while (desc.FindLogicalColumnId(fieldId, idx) != kInvalidDescriptorId)
+         ++idx;
+
+      auto columnDesc = columnBuilder.Index(idx).LogicalColumnId(columnId).PhysicalColumnId(columnId).MakeDescriptor();
+      if (!columnDesc)
+         return R__FORWARD_ERROR(columnDesc);
+      auto resVoid = descBuilder.AddColumn(columnDesc.Unwrap());
+      if (!resVoid)
+         return R__FORWARD_ERROR(resVoid);
+   }
+
+   return extensionFrameSize;
+}
+
 } // anonymous namespace
 
 
@@ -473,6 +595,21 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeUInt64
    return DeserializeInt64(buffer, *reinterpret_cast<std::int64_t *>(&val));
 }
 
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeDouble(double val, void *buffer)
+{
+   std::uint64_t bits;
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeDouble(const void *buffer, double &val)
+{
+   std::uint64_t bits;
+   auto result = DeserializeUInt64(buffer, bits);
+   memcpy(&val, &bits, sizeof(val));
+   return result;
+}
+
 std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeString(const std::string &val, void *buffer)
 {
    if (buffer) {
@@ -525,6 +662,15 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
    case EColumnType::kSplitInt64: return SerializeUInt16(0x13, buffer);
    case EColumnType::kSplitInt32: return SerializeUInt16(0x14, buffer);
    case EColumnType::kSplitInt16: return SerializeUInt16(0x15, buffer);
+   case EColumnType::kSplitIndex32: return SerializeUInt16(0x0F, buffer);
+   case EColumnType::kSplitDeltaInt64: return SerializeUInt16(0x20, buffer);
+   case EColumnType::kSplitDeltaInt32: return SerializeUInt16(0x21, buffer);
+   case EColumnType::kSplitDeltaInt16: return SerializeUInt16(0x22, buffer);
+   case EColumnType::kBitPackedInt64: return SerializeUInt16(0x23, buffer);
+   case EColumnType::kBitPackedInt32: return SerializeUInt16(0x24, buffer);
+   case EColumnType::kBitPackedInt16: return SerializeUInt16(0x25, buffer);
+   case EColumnType::kReal32Trunc: return SerializeUInt16(0x26, buffer);
+   case EColumnType::kReal32Quant: return SerializeUInt16(0x27, buffer);
    default: throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
 }
@@ -554,6 +700,15 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
    case 0x13: type = EColumnType::kSplitInt64; break;
    case 0x14: type = EColumnType::kSplitInt32; break;
    case 0x15: type = EColumnType::kSplitInt16; break;
+   case 0x0F: type = EColumnType::kSplitIndex32; break;
+   case 0x20: type = EColumnType::kSplitDeltaInt64; break;
+   case 0x21: type = EColumnType::kSplitDeltaInt32; break;
+   case 0x22: type = EColumnType::kSplitDeltaInt16; break;
+   case 0x23: type = EColumnType::kBitPackedInt64; break;
+   case 0x24: type = EColumnType::kBitPackedInt32; break;
+   case 0x25: type = EColumnType::kBitPackedInt16; break;
+   case 0x26: type = EColumnType::kReal32Trunc; break;
+   case 0x27: type = EColumnType::kReal32Quant; break;
    default: return R__FAIL("unexpected on-disk column type");
    }
    return result;
@@ -1031,11 +1186,40 @@ ROOT::Experimental::Internal::RNTupleSerializer::SerializeHeaderV1(
    std::uint32_t crc32 = 0;
    size += SerializeEnvelopePostscript(base, size, crc32, *where);
 
+   context.MarkHeaderSchema();
    context.SetHeaderSize(size);
    context.SetHeaderCRC32(crc32);
    return context;
 }
 
+void ROOT::Experimental::Internal::RNTupleSerializer::MapSchemaExtension(const RNTupleDescriptor &desc,
+                                                                         RContext &context)
+{
+   // Same traversal order as for the header: breadth-first for the fields and, in a second pass, for the columns
+   std::deque<DescriptorId_t> idQueue{desc.GetFieldZeroId()};
+   while (!idQueue.empty()) {
+      auto parentId = idQueue.front();
+      idQueue.pop_front();
+      for (const auto &f : desc.GetFieldIterable(parentId)) {
+         if (!context.HasOnDiskFieldId(f.GetId()))
+            context.MapFieldId(f.GetId());
+         idQueue.push_back(f.GetId());
+      }
+   }
+
+   idQueue.push_back(desc.GetFieldZeroId());
+   while (!idQueue.empty()) {
+      auto parentId = idQueue.front();
+      idQueue.pop_front();
+      for (const auto &c : desc.GetColumnIterable(parentId)) {
+         if (!c.IsAliasColumn() && !context.HasOnDiskColumnId(c.GetLogicalId()))
+            context.MapColumnId(c.GetLogicalId());
+      }
+      for (const auto &f : desc.GetFieldIterable(parentId))
+         idQueue.push_back(f.GetId());
+   }
+}
+
 std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageListV1(
    void *buffer, const RNTupleDescriptor &desc, std::span<DescriptorId_t> physClusterIDs, const RContext &context)
 {
@@ -1071,6 +1255,19 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
 
+         // Optional list frame of page statistics; readers that do not know about it skip it with the inner frame
+         const bool hasStatistics = std::any_of(pageRange.fPageInfos.begin(), pageRange.fPageInfos.end(),
+                                                [](const auto &pi) { return pi.fStatistics.HasRange(); });
+         if (hasStatistics) {
+            auto statisticsFrame = pos;
+            pos += SerializeListFramePreamble(pageRange.fPageInfos.size(), *where);
+            for (const auto &pi : pageRange.fPageInfos) {
+               pos += SerializeDouble(pi.fStatistics.fMin, *where);
+               pos += SerializeDouble(pi.fStatistics.fMax, *where);
+            }
+            pos += SerializeFramePostscript(buffer ? statisticsFrame : nullptr, pos - statisticsFrame);
+         }
+
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
       pos += SerializeFramePostscript(buffer ? outerFrame : nullptr, pos - outerFrame);
@@ -1095,9 +1292,36 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeFooterV1
    pos += SerializeFeatureFlags(std::vector<std::int64_t>(), *where);
    pos += SerializeUInt32(context.GetHeaderCRC32(), *where);
 
-   // So far no support for extension headers
+   // The schema extension holds the fields and columns added after the header was written.  It is a single record
+   // frame consisting of the field list frame and the column list frame, as in the header.
+   const bool hasSchemaExtension = (context.GetNFields() > context.GetNHeaderFields()) ||
+                                   (context.GetNColumns() > context.GetNHeaderColumns());
    auto frame = pos;
-   pos += SerializeListFramePreamble(0, *where);
+   pos += SerializeListFramePreamble(hasSchemaExtension ? 1 : 0, *where);
+   if (hasSchemaExtension) {
+      auto extensionFrame = pos;
+      pos += SerializeRecordFramePreamble(*where);
+
+      auto listFrame = pos;
+      pos += SerializeListFramePreamble(context.GetNFields() - context.GetNHeaderFields(), *where);
+      for (auto onDiskId = context.GetNHeaderFields(); onDiskId < context.GetNFields(); ++onDiskId) {
+         const auto &fieldDesc = desc.GetFieldDescriptor(context.GetMemFieldId(onDiskId));
+         const auto parentId = fieldDesc.GetParentId();
+         const auto onDiskParentId =
+            (parentId == desc.GetFieldZeroId()) ? onDiskId : context.GetOnDiskFieldId(parentId);
+         pos += SerializeFieldV1(fieldDesc, onDiskParentId, *where);
+      }
+      pos += SerializeFramePostscript(buffer ? listFrame : nullptr, pos - listFrame);
+
+      listFrame = pos;
+      pos += SerializeListFramePreamble(context.GetNColumns() - context.GetNHeaderColumns(), *where);
+      for (auto onDiskId = context.GetNHeaderColumns(); onDiskId < context.GetNColumns(); ++onDiskId) {
+         pos += SerializeColumnV1(desc.GetColumnDescriptor(context.GetMemColumnId(onDiskId)), context, *where);
+      }
+      pos += SerializeFramePostscript(buffer ? listFrame : nullptr, pos - listFrame);
+
+      pos += SerializeFramePostscript(buffer ? extensionFrame : nullptr, pos - extensionFrame);
+   }
    pos += SerializeFramePostscript(buffer ? frame : nullptr, pos - frame);
 
    // So far no support for shared clusters (no column groups)
@@ -1345,8 +1569,13 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
    result = DeserializeFrameHeader(bytes, fnBufSizeLeft(), frameSize, nXHeaders);
    if (!result)
       return R__FORWARD_ERROR(result);
-   if (nXHeaders > 0)
-      R__LOG_WARNING(NTupleLog()) << "extension headers are still unsupported";
+   bytes += result.Unwrap();
+   for (std::uint32_t i = 0; i < nXHeaders; ++i) {
+      result = DeserializeSchemaExtension(bytes, fnFrameSizeLeft(), descBuilder);
+      if (!result)
+         return R__FORWARD_ERROR(result);
+      bytes += result.Unwrap();
+   }
    bytes = frame + frameSize;
 
    std::uint32_t nColumnGroups;
@@ -1485,6 +1714,26 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
+         if (fnInnerFrameSizeLeft() > 0) {
+            std::uint32_t statisticsFrameSize;
+            auto statisticsFrame = bytes;
+            auto fnStatisticsFrameSizeLeft = [&]() { return statisticsFrameSize - (bytes - statisticsFrame); };
+
+            std::uint32_t nStatistics;
+            result = DeserializeFrameHeader(bytes, fnInnerFrameSizeLeft(), statisticsFrameSize, nStatistics);
+            if (!result)
+               return R__FORWARD_ERROR(result);
+            bytes += result.Unwrap();
+            if (nStatistics != nPages)
+               return R__FAIL("mismatch of page statistics and pages");
+            if (fnStatisticsFrameSizeLeft() < static_cast<int>(nPages * 2 * sizeof(double)))
+               return R__FAIL("page statistics frame too short");
+            for (auto &pi : pageRange.fPageInfos) {
+               bytes += DeserializeDouble(bytes, pi.fStatistics.fMin);
+               bytes += DeserializeDouble(bytes, pi.fStatistics.fMax);
+            }
+         }
+
          clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
          bytes = innerFrame + innerFrameSize;
       }
@@ -14,3 +14,9 @@
  *************************************************************************/
 
 #include <ROOT/RPage.hxx>
+
+const void *ROOT::Experimental::Detail::RPage::GetPageZeroBuffer()
+{
+   alignas(64) static const unsigned char gPageZero[kPageZeroSize]{};
+   return gPageZero;
+}
@@ -18,6 +18,9 @@
 
 #include <TError.h>
 
+#include <cstring>
+#include <utility>
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(
    ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
 {
@@ -31,3 +34,133 @@ void ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(const RPage& pag
 {
    delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+std::shared_ptr<ROOT::Experimental::Detail::RPageBufferAllocator::RCacheBudget>
+ROOT::Experimental::Detail::RPageBufferAllocator::GetSharedCacheBudget()
+{
+   static const auto budget = std::make_shared<RCacheBudget>(kDefaultMaxCachedBytes);
+   return budget;
+}
+
+ROOT::Experimental::Detail::RPageBufferAllocator::RPageBufferAllocator(const std::string &name)
+   : RPageBufferAllocator(name, GetSharedCacheBudget())
+{
+}
+
+ROOT::Experimental::Detail::RPageBufferAllocator::RPageBufferAllocator(const std::string &name,
+                                                                       std::size_t maxCachedBytes)
+   : RPageBufferAllocator(name, std::make_shared<RCacheBudget>(maxCachedBytes))
+{
+}
+
+ROOT::Experimental::Detail::RPageBufferAllocator::RPageBufferAllocator(const std::string &name,
+                                                                       std::shared_ptr<RCacheBudget> budget)
+   : fBudget(std::move(budget)), fMetrics(name)
+{
+   R__ASSERT(fBudget);
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nHit", "", "number of buffers served from the cache"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nMiss", "", "number of buffers allocated on the heap")});
+}
+
+ROOT::Experimental::Detail::RPageBufferAllocator::~RPageBufferAllocator()
+{
+   Trim();
+}
+
+std::uint32_t ROOT::Experimental::Detail::RPageBufferAllocator::GetSizeClass(std::size_t nbytes)
+{
+   std::uint32_t shift = kMinSizeShift;
+   while ((shift <= kMaxSizeShift) && ((std::size_t(1) << shift) < nbytes))
+      ++shift;
+   return (shift > kMaxSizeShift) ? kNoSizeClass : shift - kMinSizeShift;
+}
+
+unsigned char *ROOT::Experimental::Detail::RPageBufferAllocator::Acquire(std::size_t nbytes)
+{
+   auto sizeClass = GetSizeClass(nbytes);
+   if ((sizeClass != kNoSizeClass) && ((std::size_t(1) << (sizeClass + kMinSizeShift)) > fBudget->GetMaxBytes() / 2))
+      sizeClass = kNoSizeClass;
+
+   if (sizeClass != kNoSizeClass) {
+      auto &entry = fSizeClasses[sizeClass];
+      unsigned char *buffer = nullptr;
+      {
+         std::lock_guard<std::mutex> guard(entry.fLock);
+         if (!entry.fFreeBuffers.empty()) {
+            buffer = entry.fFreeBuffers.back();
+            entry.fFreeBuffers.pop_back();
+         }
+      }
+      if (buffer) {
+         fNBytesCached -= std::size_t(1) << (sizeClass + kMinSizeShift);
+         fBudget->Return(std::size_t(1) << (sizeClass + kMinSizeShift));
+         fCounters->fNHit.Inc();
+         return buffer;
+      }
+      nbytes = std::size_t(1) << (sizeClass + kMinSizeShift);
+   }
+
+   fCounters->fNMiss.Inc();
+   auto base = new unsigned char[kHeaderSize + nbytes];
+   memcpy(base, &sizeClass, sizeof(sizeClass));
+   return base + kHeaderSize;
+}
+
+void ROOT::Experimental::Detail::RPageBufferAllocator::Release(unsigned char *buffer)
+{
+   auto base = buffer - kHeaderSize;
+   std::uint32_t sizeClass;
+   memcpy(&sizeClass, base, sizeof(sizeClass));
+
+   if (sizeClass != kNoSizeClass) {
+      const std::size_t nbytes = std::size_t(1) << (sizeClass + kMinSizeShift);
+      if (fBudget->TryReserve(nbytes)) {
+         fNBytesCached += nbytes;
+         auto &entry = fSizeClasses[sizeClass];
+         std::lock_guard<std::mutex> guard(entry.fLock);
+         entry.fFreeBuffers.emplace_back(buffer);
+         return;
+      }
+   }
+   delete[] base;
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageBufferAllocator::NewPage(
+   ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
+{
+   R__ASSERT((elementSize > 0) && (nElements > 0));
+   return RPage(columnId, Acquire(elementSize * nElements), elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageBufferAllocator::DeletePage(const RPage &page)
+{
+   if (page.IsNull())
+      return;
+   Release(reinterpret_cast<unsigned char *>(page.GetBuffer()));
+}
+
+ROOT::Experimental::Detail::RPageDeleter ROOT::Experimental::Detail::RPageBufferAllocator::MakePageDeleter()
+{
+   return RPageDeleter(
+      [](const RPage &page, void *userData) { static_cast<RPageBufferAllocator *>(userData)->DeletePage(page); },
+      this);
+}
+
+void ROOT::Experimental::Detail::RPageBufferAllocator::Trim()
+{
+   for (std::size_t i = 0; i < kNSizeClasses; ++i) {
+      auto &entry = fSizeClasses[i];
+      std::lock_guard<std::mutex> guard(entry.fLock);
+      for (auto buffer : entry.fFreeBuffers)
+         delete[](buffer - kHeaderSize);
+      const auto nbytes = entry.fFreeBuffers.size() * (std::size_t(1) << (i + kMinSizeShift));
+      fNBytesCached -= nbytes;
+      fBudget->Return(nbytes);
+      entry.fFreeBuffers.clear();
+   }
+}
@@ -14,6 +14,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RColumn.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleZip.hxx>
@@ -25,49 +26,103 @@ ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink
    : RPageSink(inner->GetNTupleName(), inner->GetWriteOptions())
    , fMetrics("RPageSinkBuf")
    , fInnerSink(std::move(inner))
+   , fBufferAllocator(std::make_unique<RPageBufferAllocator>())
 {
    fCounters = std::unique_ptr<RCounters>(new RCounters{
       *fMetrics.MakeCounter<RNTuplePlainCounter*>("ParallelZip", "",
-         "compressing pages in parallel")
+         "compressing pages in parallel"),
+      *fMetrics.MakeCounter<RNTuplePlainCounter*>("nZipWait", "",
+         "number of times writing a cluster had to wait for page compression tasks")
    });
    fMetrics.ObserveMetrics(fInnerSink->GetMetrics());
+   fMetrics.ObserveMetrics(fBufferAllocator->GetMetrics());
+   // The page list of the buffered sink is never written; page statistics are computed for the inner sink, either
+   // when sealing a page or by the inner sink itself when committing an unsealed page.
+   fOptions->SetEnablePageStatistics(false);
+}
+
+ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
+{
+   // Tasks may still access buffered pages of the open or the pending cluster
+   if (fTaskScheduler)
+      fTaskScheduler->Wait();
 }
 
 void ROOT::Experimental::Detail::RPageSinkBuf::CreateImpl(const RNTupleModel &model,
                                                           unsigned char * /* serializedHeader */,
                                                           std::uint32_t /* length */)
 {
-   fBufferedColumns.resize(fDescriptorBuilder.GetDescriptor().GetNPhysicalColumns());
+   fOpenCluster = std::make_unique<RBufferedCluster>(fDescriptorBuilder.GetDescriptor().GetNPhysicalColumns());
    fInnerModel = model.Clone();
    fInnerSink->Create(*fInnerModel);
 }
 
+void ROOT::Experimental::Detail::RPageSinkBuf::UpdateSchema(const RNTupleModelChangeset &changeset,
+                                                            NTupleSize_t firstEntry)
+{
+   // The pending cluster is written with the columns of the old schema
+   FlushPendingCluster();
+   RPageSink::UpdateSchema(changeset, firstEntry);
+   fOpenCluster->fColumns.resize(fDescriptorBuilder.GetDescriptor().GetNPhysicalColumns());
+
+   // The cloned fields are connected to the inner sink in the same order, so that the column ids of both sinks match
+   RNTupleModelChangeset innerChangeset{*fInnerModel};
+   fInnerModel->Unfreeze();
+   for (auto field : changeset.fAddedFields) {
+      auto clone = field->Clone(field->GetName());
+      innerChangeset.fAddedFields.emplace_back(clone.get());
+      fInnerModel->AddField(std::move(clone));
+   }
+   fInnerModel->Freeze();
+   fInnerSink->UpdateSchema(innerChangeset, firstEntry);
+}
+
 ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
 {
-   // TODO avoid frequent (de)allocations by holding on to allocated buffers in RColumnBuf
+   if (fPendingCluster) {
+      // Write the previous cluster as soon as it is sealed. Otherwise, limit the memory held by buffered pages to
+      // the maximum uncompressed cluster size by waiting for the pending cluster.
+      if ((fPendingCluster->fNPagesToSeal == 0) ||
+          (fPendingCluster->fNBytesBuffered + fOpenCluster->fNBytesBuffered + page.GetNBytes() >
+           GetWriteOptions().GetMaxUnzippedClusterSize())) {
+         FlushPendingCluster();
+      }
+   }
+
+   // The buffered page is taken from the page allocator of the inner sink, which recycles released page buffers
    RPage bufPage = ReservePage(columnHandle, page.GetNElements());
    // make sure the page is aware of how many elements it will have
    bufPage.GrowUnchecked(page.GetNElements());
    memcpy(bufPage.GetBuffer(), page.GetBuffer(), page.GetNBytes());
+   fOpenCluster->fNBytesBuffered += page.GetNBytes();
    // Safety: RColumnBuf::iterators are guaranteed to be valid until the
    // element is destroyed. In other words, all buffered page iterators are
    // valid until the return value of DrainBufferedPages() goes out of scope in
-   // CommitCluster().
-   RColumnBuf::iterator zipItem = fBufferedColumns.at(columnHandle.fPhysicalId).BufferPage(columnHandle, bufPage);
+   // WriteCluster().
+   auto &bufColumn = fOpenCluster->fColumns.at(columnHandle.fPhysicalId);
+   RColumnBuf::iterator zipItem = bufColumn.BufferPage(columnHandle, bufPage);
    if (!fTaskScheduler) {
       return RNTupleLocator{};
    }
    fCounters->fParallelZip.SetValue(1);
    // Thread safety: Each thread works on a distinct zipItem which owns its
-   // compression buffer.
-   zipItem->AllocateSealedPageBuf();
+   // compression buffer. The task does not access the sink itself, so that the
+   // sink can continue to buffer pages and to write the pending cluster.
+   zipItem->AllocateSealedPageBuf(columnHandle.fColumn->GetElement()->GetPackedSize(page.GetNElements()),
+                                  *fBufferAllocator);
    R__ASSERT(zipItem->fBuf);
-   auto sealedPage = fBufferedColumns.at(columnHandle.fPhysicalId).RegisterSealedPage();
-   fTaskScheduler->AddTask([this, zipItem, sealedPage, colId = columnHandle.fPhysicalId] {
-      *sealedPage = SealPage(zipItem->fPage, *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
-                             GetWriteOptions().GetCompression(), zipItem->fBuf.get());
+   auto sealedPage = bufColumn.RegisterSealedPage();
+   auto cluster = fOpenCluster.get();
+   cluster->fNPagesToSeal++;
+   fTaskScheduler->AddTask([cluster, zipItem, sealedPage, column = columnHandle.fColumn,
+                            compression = GetWriteOptions().GetCompression(),
+                            withStatistics = fInnerSink->GetWriteOptions().GetEnablePageStatistics()] {
+      *sealedPage = SealPage(zipItem->fPage, *column->GetElement(), compression, zipItem->fBuf.get());
+      if (withStatistics)
+         sealedPage->fStatistics = column->GetPageStatistics(zipItem->fPage);
       zipItem->fSealedPage = &(*sealedPage);
+      cluster->fNPagesToSeal--;
    });
 
    // we're feeding bad locators to fOpenPageRanges but it should not matter
@@ -79,67 +134,110 @@ ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(DescriptorId_t physicalColumnId,
                                                                const RSealedPage &sealedPage)
 {
+   FlushPendingCluster();
    fInnerSink->CommitSealedPage(physicalColumnId, sealedPage);
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
    return RNTupleLocator{};
 }
 
-std::uint64_t
-ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::NTupleSize_t nEntries)
+std::uint64_t ROOT::Experimental::Detail::RPageSinkBuf::WriteCluster(RBufferedCluster &cluster)
 {
-   if (fTaskScheduler) {
-      fTaskScheduler->Wait();
-      fTaskScheduler->Reset();
-   }
+   auto &bufferedColumns = cluster.fColumns;
 
    // If we have only sealed pages in all buffered columns, commit them in a single `CommitSealedPageV()` call
-   bool singleCommitCall = std::all_of(fBufferedColumns.begin(), fBufferedColumns.end(),
+   bool singleCommitCall = std::all_of(bufferedColumns.begin(), bufferedColumns.end(),
                                        [](auto &bufColumn) { return bufColumn.HasSealedPagesOnly(); });
    if (singleCommitCall) {
       std::vector<RSealedPageGroup> toCommit;
-      toCommit.reserve(fBufferedColumns.size());
-      for (auto &bufColumn : fBufferedColumns) {
+      toCommit.reserve(bufferedColumns.size());
+      for (auto &bufColumn : bufferedColumns) {
          const auto &sealedPages = bufColumn.GetSealedPages();
          toCommit.emplace_back(bufColumn.GetHandle().fPhysicalId, sealedPages.cbegin(), sealedPages.cend());
       }
       fInnerSink->CommitSealedPageV(toCommit);
 
-      for (auto &bufColumn : fBufferedColumns) {
+      for (auto &bufColumn : bufferedColumns) {
          auto drained = bufColumn.DrainBufferedPages();
          for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained))
             ReleasePage(bufPage.fPage);
       }
-      return fInnerSink->CommitCluster(nEntries);
-   }
+   } else {
+      // Otherwise, try to do it per column
+      for (auto &bufColumn : bufferedColumns) {
+         // In practice, either all (see above) or none of the buffered pages have been sealed, depending on whether
+         // a task scheduler is available. The rare condition of a few columns consisting only of sealed pages should
+         // not happen unless the API is misused.
+         if (bufColumn.HasSealedPagesOnly())
+            throw RException(R__FAIL("only a few columns have all pages sealed"));
 
-   // Otherwise, try to do it per column
-   for (auto &bufColumn : fBufferedColumns) {
-      // In practice, either all (see above) or none of the buffered pages have been sealed, depending on whether
-      // a task scheduler is available. The rare condition of a few columns consisting only of sealed pages should
-      // not happen unless the API is misused.
-      if (bufColumn.HasSealedPagesOnly())
-         throw RException(R__FAIL("only a few columns have all pages sealed"));
-
-      // Slow path: if the buffered column contains both sealed and unsealed pages, commit them one by one.
-      // TODO(jalopezg): coalesce contiguous sealed pages and commit via `CommitSealedPageV()`.
-      auto drained = bufColumn.DrainBufferedPages();
-      for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained)) {
-         if (bufPage.IsSealed()) {
-            fInnerSink->CommitSealedPage(bufColumn.GetHandle().fPhysicalId, *bufPage.fSealedPage);
-         } else {
-            fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage.fPage);
+         // Slow path: if the buffered column contains both sealed and unsealed pages, commit them one by one.
+         // TODO(jalopezg): coalesce contiguous sealed pages and commit via `CommitSealedPageV()`.
+         auto drained = bufColumn.DrainBufferedPages();
+         for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained)) {
+            if (bufPage.IsSealed()) {
+               fInnerSink->CommitSealedPage(bufColumn.GetHandle().fPhysicalId, *bufPage.fSealedPage);
+            } else {
+               fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage.fPage);
+            }
+            ReleasePage(bufPage.fPage);
          }
-         ReleasePage(bufPage.fPage);
       }
    }
-   return fInnerSink->CommitCluster(nEntries);
+
+   auto nbytes = fInnerSink->CommitCluster(cluster.fNEntries);
+   fNBytesUnzippedWritten += cluster.fNBytesBuffered;
+   fNBytesZippedWritten += nbytes;
+   return nbytes;
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::FlushPendingCluster()
+{
+   if (!fPendingCluster)
+      return;
+
+   if (fPendingCluster->fNPagesToSeal > 0) {
+      fCounters->fNZipWait.Inc();
+      // Also waits for the tasks of the open cluster; the task scheduler does not support waiting for a subset
+      fTaskScheduler->Wait();
+      fTaskScheduler->Reset();
+   }
+   WriteCluster(*fPendingCluster);
+   fPendingCluster.reset();
+}
+
+std::uint64_t
+ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::NTupleSize_t nEntries)
+{
+   fOpenCluster->fNEntries = nEntries;
+   auto nColumns = fOpenCluster->fColumns.size();
+
+   if (!fTaskScheduler)
+      return WriteCluster(*fOpenCluster);
+
+   FlushPendingCluster();
+   // Without any written cluster, we cannot estimate the compression ratio of the committed cluster; the first
+   // cluster is thus written synchronously.
+   if (fNBytesUnzippedWritten == 0) {
+      fTaskScheduler->Wait();
+      fTaskScheduler->Reset();
+      return WriteCluster(*fOpenCluster);
+   }
+
+   // Defer writing the cluster until its pages are sealed. The returned number of bytes is an estimate based on the
+   // compression ratio of the clusters written so far; it is used by RNTupleWriter to size the next cluster.
+   const auto nBytesUnzipped = fOpenCluster->fNBytesBuffered;
+   fPendingCluster = std::move(fOpenCluster);
+   fOpenCluster = std::make_unique<RBufferedCluster>(nColumns);
+   return static_cast<std::uint64_t>(static_cast<double>(nBytesUnzipped) * fNBytesZippedWritten /
+                                     fNBytesUnzippedWritten);
 }
 
 ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterGroupImpl(unsigned char * /* serializedPageList */,
                                                                  std::uint32_t /* length */)
 {
+   FlushPendingCluster();
    fInnerSink->CommitClusterGroup();
    // We're not using that locator any further, so it is safe to return a dummy one
    return RNTupleLocator{};
@@ -148,6 +246,7 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterGroupImpl(unsigned char *
 void ROOT::Experimental::Detail::RPageSinkBuf::CommitDatasetImpl(unsigned char * /* serializedFooter */,
                                                                  std::uint32_t /* length */)
 {
+   FlushPendingCluster();
    fInnerSink->CommitDataset();
 }
 
@@ -0,0 +1,202 @@
+/// \file RPageSinkSync.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-06-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RPageSinkSync.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+ROOT::Experimental::Detail::RPageSinkSync::RPageSinkSync(RPageSink &inner, std::mutex &innerMutex, bool deferCommit)
+   : RPageSink(inner.GetNTupleName(), inner.GetWriteOptions()),
+     fInnerSink(&inner),
+     fInnerSinkMutex(&innerMutex),
+     fBufferAllocator(std::make_unique<RPageBufferAllocator>()),
+     fDeferCommit(deferCommit)
+{
+   EnableDefaultMetrics("RPageSinkSync");
+   fSyncCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nClusterCommitted", "",
+                                                    "number of clusters committed to the shared sink"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallLock", "ns",
+                                                    "wall clock time spent waiting for the shared sink")});
+   fMetrics.ObserveMetrics(fBufferAllocator->GetMetrics());
+   // Page statistics are computed when sealing a page and passed on to the inner sink with the sealed page
+   fWithStatistics = fOptions->GetEnablePageStatistics();
+   fOptions->SetEnablePageStatistics(false);
+}
+
+void ROOT::Experimental::Detail::RPageSinkSync::CreateImpl(const RNTupleModel & /* model */,
+                                                           unsigned char * /* serializedHeader */,
+                                                           std::uint32_t /* length */)
+{
+   // The model is a clone of the model of the inner sink; the column ids issued by Create() thus match the column ids
+   // of the inner sink.
+   const auto nColumns = fDescriptorBuilder.GetDescriptor().GetNPhysicalColumns();
+   if (nColumns != fInnerSink->GetDescriptor().GetNPhysicalColumns())
+      throw RException(R__FAIL("model of synchronized sink does not match the model of the inner sink"));
+   fSealedPages.resize(nColumns);
+}
+
+void ROOT::Experimental::Detail::RPageSinkSync::UpdateSchema(const RNTupleModelChangeset & /* changeset */,
+                                                             NTupleSize_t /* firstEntry */)
+{
+   throw RException(R__FAIL("adding fields is unsupported for synchronized page sinks"));
+}
+
+void ROOT::Experimental::Detail::RPageSinkSync::BufferSealedPage(DescriptorId_t physicalColumnId,
+                                                                 RSealedPage &&sealedPage,
+                                                                 RPageBufferAllocator::RBufferPtr buffer)
+{
+   // Sealing an uncompressed, mappable page references the page buffer, which gets reused for the next page
+   if (sealedPage.fBuffer != buffer.get()) {
+      memcpy(buffer.get(), sealedPage.fBuffer, sealedPage.fSize);
+      sealedPage.fBuffer = buffer.get();
+   }
+   fSealedPages.at(physicalColumnId).emplace_back(std::move(sealedPage));
+   fSealedPageBuffers.emplace_back(std::move(buffer));
+}
+
+ROOT::Experimental::RNTupleLocator
+ROOT::Experimental::Detail::RPageSinkSync::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   const auto &element = *columnHandle.fColumn->GetElement();
+   // The buffer needs to hold the packed page, which can be larger than the in-memory page
+   auto buffer =
+      fBufferAllocator->Allocate(std::max<std::size_t>(page.GetNBytes(), element.GetPackedSize(page.GetNElements())));
+
+   RSealedPage sealedPage;
+   {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallZip, fCounters->fTimeCpuZip);
+      sealedPage = SealPage(page, element, GetWriteOptions().GetCompression(), buffer.get());
+   }
+   fCounters->fSzZip.Add(page.GetNBytes());
+   if (fWithStatistics)
+      sealedPage.fStatistics = columnHandle.fColumn->GetPageStatistics(page);
+
+   BufferSealedPage(columnHandle.fPhysicalId, std::move(sealedPage), std::move(buffer));
+   // The locator is not used because the page list of this sink is never written
+   return RNTupleLocator{};
+}
+
+ROOT::Experimental::RNTupleLocator
+ROOT::Experimental::Detail::RPageSinkSync::CommitSealedPageImpl(DescriptorId_t physicalColumnId,
+                                                                const RSealedPage &sealedPage)
+{
+   // The caller may reuse the memory of the sealed page as soon as the call returns
+   RSealedPage copy(sealedPage.fBuffer, sealedPage.fSize, sealedPage.fNElements);
+   copy.fStatistics = sealedPage.fStatistics;
+   BufferSealedPage(physicalColumnId, std::move(copy), fBufferAllocator->Allocate(sealedPage.fSize));
+   return RNTupleLocator{};
+}
+
+std::uint64_t
+ROOT::Experimental::Detail::RPageSinkSync::CommitToInnerSink(const std::vector<SealedPageSequence_t> &sealedPages,
+                                                             NTupleSize_t nEntries)
+{
+   std::vector<RSealedPageGroup> toCommit;
+   toCommit.reserve(sealedPages.size());
+   for (std::size_t i = 0; i < sealedPages.size(); ++i)
+      toCommit.emplace_back(i, sealedPages[i].cbegin(), sealedPages[i].cend());
+
+   fInnerSink->CommitSealedPageV(toCommit);
+   // The cluster is appended to the clusters committed so far by any of the sinks sharing the inner sink
+   auto nbytes = fInnerSink->CommitCluster(fInnerSink->GetDescriptor().GetNEntries() + nEntries);
+   fSyncCounters->fNClusterCommitted.Inc();
+   return nbytes;
+}
+
+std::uint64_t ROOT::Experimental::Detail::RPageSinkSync::CommitClusterImpl(NTupleSize_t nEntries)
+{
+   const auto nEntriesCluster = nEntries - fNEntriesCommitted;
+   fNEntriesCommitted = nEntries;
+
+   if (fDeferCommit) {
+      RDeferredCluster cluster;
+      cluster.fSealedPages.resize(fSealedPages.size());
+      std::uint64_t nbytes = 0;
+      for (std::size_t i = 0; i < fSealedPages.size(); ++i) {
+         for (const auto &sealedPage : fSealedPages[i])
+            nbytes += sealedPage.fSize;
+         std::swap(cluster.fSealedPages[i], fSealedPages[i]);
+      }
+      std::swap(cluster.fSealedPageBuffers, fSealedPageBuffers);
+      cluster.fNEntries = nEntriesCluster;
+      fDeferredClusters.emplace_back(std::move(cluster));
+      return nbytes;
+   }
+
+   std::uint64_t nbytes = 0;
+   {
+      auto tsLock = std::chrono::steady_clock::now();
+      std::lock_guard<std::mutex> guard(*fInnerSinkMutex);
+      fSyncCounters->fTimeWallLock.Add(
+         std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tsLock).count());
+      nbytes = CommitToInnerSink(fSealedPages, nEntriesCluster);
+   }
+
+   for (auto &sealedPages : fSealedPages)
+      sealedPages.clear();
+   fSealedPageBuffers.clear();
+   return nbytes;
+}
+
+void ROOT::Experimental::Detail::RPageSinkSync::CommitDeferredClusters()
+{
+   if (fDeferredClusters.empty())
+      return;
+
+   {
+      auto tsLock = std::chrono::steady_clock::now();
+      std::lock_guard<std::mutex> guard(*fInnerSinkMutex);
+      fSyncCounters->fTimeWallLock.Add(
+         std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tsLock).count());
+      for (const auto &cluster : fDeferredClusters)
+         CommitToInnerSink(cluster.fSealedPages, cluster.fNEntries);
+   }
+   fDeferredClusters.clear();
+}
+
+ROOT::Experimental::RNTupleLocator
+ROOT::Experimental::Detail::RPageSinkSync::CommitClusterGroupImpl(unsigned char * /* serializedPageList */,
+                                                                  std::uint32_t /* length */)
+{
+   // Cluster groups are committed by the owner of the inner sink
+   return RNTupleLocator{};
+}
+
+void ROOT::Experimental::Detail::RPageSinkSync::CommitDatasetImpl(unsigned char * /* serializedFooter */,
+                                                                  std::uint32_t /* length */)
+{
+   // The dataset is committed by the owner of the inner sink
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkSync::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      throw RException(R__FAIL("invalid call: request empty page"));
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return fBufferAllocator->NewPage(columnHandle.fPhysicalId, elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageSinkSync::ReleasePage(RPage &page)
+{
+   fBufferAllocator->DeletePage(page);
+}
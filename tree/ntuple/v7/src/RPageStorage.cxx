@@ -42,6 +42,49 @@ ROOT::Experimental::Detail::RPageStorage::~RPageStorage()
 {
 }
 
+std::size_t ROOT::Experimental::Detail::RPageStorage::ZipPackedPage(const RColumnElementBase &element,
+                                                                    const void *packed, std::size_t packedBytes,
+                                                                    int compressionSetting, void *buf)
+{
+   const auto headerSize = element.GetPackedHeaderSize();
+   R__ASSERT(packedBytes >= headerSize);
+   memcpy(buf, packed, headerSize);
+   if (packedBytes == headerSize)
+      return headerSize;
+   return headerSize + RNTupleCompressor::Zip(static_cast<const unsigned char *>(packed) + headerSize,
+                                              packedBytes - headerSize, compressionSetting,
+                                              static_cast<unsigned char *>(buf) + headerSize);
+}
+
+std::size_t ROOT::Experimental::Detail::RPageStorage::GetPackedSize(const RSealedPage &sealedPage,
+                                                                    const RColumnElementBase &element)
+{
+   if (element.GetPackedHeaderSize() == 0)
+      return element.GetPackedSize(sealedPage.fNElements);
+   if (sealedPage.fSize < element.GetPackedHeaderSize())
+      throw RException(R__FAIL("sealed page too small for its packed header"));
+   return element.GetPackedSizeFromHeader(sealedPage.fBuffer, sealedPage.fNElements);
+}
+
+void ROOT::Experimental::Detail::RPageStorage::UnzipPackedPage(const RSealedPage &sealedPage,
+                                                               const RColumnElementBase &element,
+                                                               RNTupleDecompressor &decompressor, void *packed)
+{
+   const auto headerSize = element.GetPackedHeaderSize();
+   const auto bytesPacked = GetPackedSize(sealedPage, element);
+   memcpy(packed, sealedPage.fBuffer, headerSize);
+   const auto source = static_cast<const unsigned char *>(sealedPage.fBuffer) + headerSize;
+   const auto destination = static_cast<unsigned char *>(packed) + headerSize;
+   if (sealedPage.fSize != bytesPacked) {
+      decompressor.Unzip(source, sealedPage.fSize - headerSize, bytesPacked - headerSize, destination);
+   } else {
+      // We cannot simply map the sealed page as we don't know its life time. Specialized page sources
+      // may decide to implement to not use UnsealPage but to custom mapping / decompression code.
+      // Note that usually pages are compressed.
+      memcpy(destination, source, bytesPacked - headerSize);
+   }
+}
+
 
 //------------------------------------------------------------------------------
 
@@ -80,7 +123,10 @@ ROOT::Experimental::Detail::RPageSource::RActivePhysicalColumns::ToColumnSet() c
 }
 
 ROOT::Experimental::Detail::RPageSource::RPageSource(std::string_view name, const RNTupleReadOptions &options)
-   : RPageStorage(name), fMetrics(""), fOptions(options)
+   : RPageStorage(name),
+     fMetrics(""),
+     fOptions(options),
+     fPageBufferAllocator(std::make_unique<RPageBufferAllocator>())
 {
 }
 
@@ -138,6 +184,14 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
    return columnHandle.fPhysicalId;
 }
 
+void ROOT::Experimental::Detail::RPageSource::LoadClustersStreamed(std::span<RCluster::RKey> clusterKeys,
+                                                                const RClusterCallback_t &onClusterLoaded)
+{
+   auto clusters = LoadClusters(clusterKeys);
+   for (std::size_t i = 0; i < clusters.size(); ++i)
+      onClusterLoaded(i, std::move(clusters[i]));
+}
+
 void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 {
    if (fTaskScheduler)
@@ -145,33 +199,38 @@ void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 }
 
 
-std::unique_ptr<unsigned char []> ROOT::Experimental::Detail::RPageSource::UnsealPage(
-   const RSealedPage &sealedPage, const RColumnElementBase &element)
+ROOT::Experimental::Detail::RPageBufferAllocator::RBufferPtr
+ROOT::Experimental::Detail::RPageSource::UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element)
 {
-   const auto bytesPacked = element.GetPackedSize(sealedPage.fNElements);
+   const auto bytesPacked = GetPackedSize(sealedPage, element);
    const auto pageSize = element.GetSize() * sealedPage.fNElements;
 
-   // TODO(jblomer): We might be able to do better memory handling for unsealing pages than a new malloc for every
-   // new page.
-   auto pageBuffer = std::make_unique<unsigned char[]>(bytesPacked);
-   if (sealedPage.fSize != bytesPacked) {
-      fDecompressor->Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, pageBuffer.get());
-   } else {
-      // We cannot simply map the sealed page as we don't know its life time. Specialized page sources
-      // may decide to implement to not use UnsealPage but to custom mapping / decompression code.
-      // Note that usually pages are compressed.
-      memcpy(pageBuffer.get(), sealedPage.fBuffer, bytesPacked);
-   }
+   auto pageBuffer = fPageBufferAllocator->Allocate(bytesPacked);
+   UnzipPackedPage(sealedPage, element, *fDecompressor, pageBuffer.get());
 
    if (!element.IsMappable()) {
-      auto unpackedBuffer = new unsigned char[pageSize];
-      element.Unpack(unpackedBuffer, pageBuffer.get(), sealedPage.fNElements);
-      pageBuffer = std::unique_ptr<unsigned char []>(unpackedBuffer);
+      // The packed buffer is released to the allocator at the end of the scope and can be reused by the next page
+      auto unpackedBuffer = fPageBufferAllocator->Allocate(pageSize);
+      element.Unpack(unpackedBuffer.get(), pageBuffer.get(), sealedPage.fNElements);
+      std::swap(pageBuffer, unpackedBuffer);
    }
 
    return pageBuffer;
 }
 
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSource::PopulatePageZero(ColumnId_t columnId, std::uint32_t elementSize,
+                                                          std::uint32_t nElements, NTupleSize_t rangeFirst,
+                                                          const RPage::RClusterInfo &clusterInfo)
+{
+   auto page = RPage::MakePageZero(columnId, elementSize);
+   if (nElements > page.GetMaxElements())
+      throw RException(R__FAIL("zero page exceeds the size of the zero buffer"));
+   page.GrowUnchecked(nElements);
+   page.SetWindow(rangeFirst, clusterInfo);
+   return page;
+}
+
 void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::string &prefix)
 {
    fMetrics = RNTupleMetrics(prefix);
@@ -185,6 +244,8 @@ void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::st
                                                    "number of partial clusters preloaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageLoaded", "", "number of pages loaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPagePopulated", "", "number of populated pages"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageMapped", "",
+                                                   "number of populated pages that reference the storage without copy"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallRead", "ns", "wall clock time spent reading"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallUnzip", "ns", "wall clock time spent decompressing"),
       *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuRead", "ns", "CPU time spent reading"),
@@ -261,6 +322,7 @@ void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::st
          }
       )
    });
+   fMetrics.ObserveMetrics(fPageBufferAllocator->GetMetrics());
 }
 
 
@@ -358,6 +420,48 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
    CreateImpl(model, buffer.get(), fSerializationContext.GetHeaderSize());
 }
 
+void ROOT::Experimental::Detail::RPageSink::UpdateSchema(const RNTupleModelChangeset &changeset,
+                                                         NTupleSize_t firstEntry)
+{
+   const auto &descriptor = fDescriptorBuilder.GetDescriptor();
+   // Column ids are issued for physical columns only, which would clash with the logical ids of alias columns
+   if (descriptor.GetNLogicalColumns() != descriptor.GetNPhysicalColumns())
+      throw RException(R__FAIL("adding fields to a model with projected fields is unsupported"));
+   if (firstEntry != fPrevClusterNEntries)
+      throw RException(R__FAIL("schema update requires an empty open cluster"));
+
+   auto fnAddField = [&](RFieldBase &f) {
+      auto fieldId = descriptor.GetNFields();
+      fDescriptorBuilder.AddField(RFieldDescriptorBuilder::FromField(f).FieldId(fieldId).MakeDescriptor().Unwrap());
+      fDescriptorBuilder.AddFieldLink(f.GetParent()->GetOnDiskId(), fieldId);
+      f.SetOnDiskId(fieldId);
+      f.ConnectPageSink(*this); // issues in turn one or several calls to AddColumn()
+   };
+
+   const auto nColumnsBeforeUpdate = descriptor.GetNPhysicalColumns();
+   for (auto field : changeset.fAddedFields) {
+      fnAddField(*field);
+      for (auto &f : *field)
+         fnAddField(f);
+   }
+
+   const auto nColumns = descriptor.GetNPhysicalColumns();
+   for (DescriptorId_t i = nColumnsBeforeUpdate; i < nColumns; ++i) {
+      RClusterDescriptor::RColumnRange columnRange;
+      columnRange.fPhysicalColumnId = i;
+      // The elements of the entries before firstEntry are not stored; readers synthesize them
+      columnRange.fFirstElementIndex = descriptor.GetNElementsPerEntry(i) * firstEntry;
+      columnRange.fNElements = 0;
+      columnRange.fCompressionSettings = GetWriteOptions().GetCompression();
+      fOpenColumnRanges.emplace_back(columnRange);
+      RClusterDescriptor::RPageRange pageRange;
+      pageRange.fPhysicalColumnId = i;
+      fOpenPageRanges.emplace_back(std::move(pageRange));
+   }
+
+   Internal::RNTupleSerializer::MapSchemaExtension(descriptor, fSerializationContext);
+}
+
 
 void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
@@ -365,6 +469,8 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
+   if (fOptions->GetEnablePageStatistics() && columnHandle.fColumn)
+      pageInfo.fStatistics = columnHandle.fColumn->GetPageStatistics(page);
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
    fOpenPageRanges.at(columnHandle.fPhysicalId).fPageInfos.emplace_back(pageInfo);
 }
@@ -377,6 +483,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fStatistics = sealedPage.fStatistics;
    pageInfo.fLocator = CommitSealedPageImpl(physicalColumnId, sealedPage);
    fOpenPageRanges.at(physicalColumnId).fPageInfos.emplace_back(pageInfo);
 }
@@ -403,6 +510,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
 
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
+         pageInfo.fStatistics = sealedPageIt->fStatistics;
          pageInfo.fLocator = locators[i++];
          fOpenPageRanges.at(range.fPhysicalColumnId).fPageInfos.emplace_back(pageInfo);
       }
@@ -480,15 +588,15 @@ ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page,
    auto packedBytes = page.GetNBytes();
 
    if (!element.IsMappable()) {
-      packedBytes = element.GetPackedSize(page.GetNElements());
-      pageBuf = new unsigned char[packedBytes];
+      pageBuf = new unsigned char[element.GetPackedSize(page.GetNElements())];
       isAdoptedBuffer = false;
       element.Pack(pageBuf, page.GetBuffer(), page.GetNElements());
+      packedBytes = element.GetPackedSizeFromHeader(pageBuf, page.GetNElements());
    }
    auto zippedBytes = packedBytes;
 
    if ((compressionSetting != 0) || !element.IsMappable()) {
-      zippedBytes = RNTupleCompressor::Zip(pageBuf, packedBytes, compressionSetting, buf);
+      zippedBytes = ZipPackedPage(element, pageBuf, packedBytes, compressionSetting, buf);
       if (!isAdoptedBuffer)
          delete[] pageBuf;
       pageBuf = reinterpret_cast<unsigned char *>(buf);
@@ -227,12 +227,13 @@ ROOT::Experimental::Detail::RDaosContainerNTupleLocator::LocateNTuple(RDaosConta
 
 ROOT::Experimental::Detail::RPageSinkDaos::RPageSinkDaos(std::string_view ntupleName, std::string_view uri,
                                                          const RNTupleWriteOptions &options)
-   : RPageSink(ntupleName, options), fPageAllocator(std::make_unique<RPageAllocatorHeap>()), fURI(uri)
+   : RPageSink(ntupleName, options), fPageAllocator(std::make_unique<RPageBufferAllocator>()), fURI(uri)
 {
    R__LOG_WARNING(NTupleLog()) << "The DAOS backend is experimental and still under development. "
                                << "Do not store real data with this version of RNTuple!";
    fCompressor = std::make_unique<RNTupleCompressor>();
    EnableDefaultMetrics("RPageSinkDaos");
+   fMetrics.ObserveMetrics(fPageAllocator->GetMetrics());
 }
 
 ROOT::Experimental::Detail::RPageSinkDaos::~RPageSinkDaos() = default;
@@ -476,7 +477,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view nt
                                                              const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options), fPageAllocator(std::make_unique<RPageAllocatorDaos>()),
      fPagePool(std::make_shared<RPagePool>()), fURI(uri),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(
+        std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(), options.GetMaxClusterBunchSize()))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceDaos");
@@ -521,6 +523,7 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceDao
       auto clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(ntplDesc, cgDesc.GetId());
       Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters);
       for (std::size_t i = 0; i < clusters.size(); ++i) {
+         clusters[i].AddExtendedColumnRanges(ntplDesc).ThrowOnError();
          ntplDesc.AddClusterDetails(clusters[i].MoveDescriptor().Unwrap());
       }
    }
@@ -554,6 +557,8 @@ void ROOT::Experimental::Detail::RPageSourceDaos::LoadSealedPage(DescriptorId_t
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   if (pageInfo.fLocator.fType == RNTupleLocator::kTypePageZero)
+      return;
    if (sealedPage.fBuffer) {
       RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(
          fNTupleIndex, clusterId, physicalColumnId, pageInfo.fLocator.GetPosition<RNTupleLocatorObject64>().fLocation);
@@ -575,6 +580,12 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
    const auto elementSize = element->GetSize();
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
 
+   if (pageInfo.fLocator.fType == RNTupleLocator::kTypePageZero) {
+      return PopulatePageZero(columnId, elementSize, pageInfo.fNElements,
+                              clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                              RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+   }
+
    const void *sealedPageBuffer = nullptr; // points either to directReadBuffer or to a read-only page in the cluster
    std::unique_ptr<unsigned char[]> directReadBuffer; // only used if cluster pool is turned off
 
@@ -608,7 +619,7 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
       sealedPageBuffer = onDiskPage->GetAddress();
    }
 
-   std::unique_ptr<unsigned char[]> pageBuffer;
+   RPageBufferAllocator::RBufferPtr pageBuffer;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
       pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
@@ -618,9 +629,7 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
    auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
-   fPagePool->RegisterPage(
-      newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorDaos::DeletePage(page); }, nullptr));
+   fPagePool->RegisterPage(newPage, fPageBufferAllocator->MakePageDeleter());
    fCounters->fNPagePopulated.Inc();
    return newPage;
 }
@@ -675,6 +684,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePage(ColumnHandle_t columnH
 
 void ROOT::Experimental::Detail::RPageSourceDaos::ReleasePage(RPage &page)
 {
+   if (page.IsPageZero())
+      return;
    fPagePool->ReturnPage(page);
 }
 
@@ -730,6 +741,10 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
             NTupleSize_t columnPageCount = 0;
             for (const auto &pageInfo : pageRange.fPageInfos) {
                const auto &pageLocator = pageInfo.fLocator;
+               if (pageLocator.fType == RNTupleLocator::kTypePageZero) {
+                  ++columnPageCount;
+                  continue;
+               }
                uint32_t position, offset;
                std::tie(position, offset) = DecodeDaosPagePosition(pageLocator.GetPosition<RNTupleLocatorObject64>());
                auto [itLoc, _] = onDiskClusterPages.emplace(position, std::vector<RDaosSealedPageLocator>());
@@ -737,9 +752,9 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
                itLoc->second.emplace_back(clusterId, physicalColumnId, columnPageCount, position, offset,
                                           pageLocator.fBytesOnStorage);
                ++columnPageCount;
+               ++nPages;
                clusterBufSz += pageLocator.fBytesOnStorage;
             }
-            nPages += columnPageCount;
          }
       }
       szPayload += clusterBufSz;
@@ -815,12 +830,17 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
       std::uint64_t firstInPage = 0;
       for (const auto &pi : pageRange.fPageInfos) {
+         if (pi.fLocator.fType == RNTupleLocator::kTypePageZero) {
+            firstInPage += pi.fNElements;
+            pageNo++;
+            continue;
+         }
          ROnDiskPage::Key key(columnId, pageNo);
          auto onDiskPage = cluster->GetOnDiskPage(key);
          R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
@@ -833,10 +853,7 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
 
             auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), element->GetSize(), nElements);
             newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-            fPagePool->PreloadPage(
-               newPage,
-               RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorDaos::DeletePage(page); },
-                            nullptr));
+            fPagePool->PreloadPage(newPage, fPageBufferAllocator->MakePageDeleter());
          };
 
          fTaskScheduler->AddTask(taskFunc);
@@ -46,12 +46,13 @@
 ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntupleName,
    const RNTupleWriteOptions &options)
    : RPageSink(ntupleName, options)
-   , fPageAllocator(std::make_unique<RPageAllocatorHeap>())
+   , fPageAllocator(std::make_unique<RPageBufferAllocator>())
 {
    R__LOG_WARNING(NTupleLog()) << "The RNTuple file format will change. " <<
       "Do not store real data with this version of RNTuple!";
    fCompressor = std::make_unique<RNTupleCompressor>();
    EnableDefaultMetrics("RPageSinkFile");
+   fMetrics.ObserveMetrics(fPageAllocator->GetMetrics());
 }
 
 
@@ -126,18 +127,17 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnH
    }
 
    fCounters->fSzZip.Add(page.GetNBytes());
-   return WriteSealedPage(sealedPage, element->GetPackedSize(page.GetNElements()));
+   return WriteSealedPage(sealedPage, GetPackedSize(sealedPage, *element));
 }
 
 ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t physicalColumnId,
                                                                 const RPageStorage::RSealedPage &sealedPage)
 {
-   const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
-      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel().GetType());
-   const auto bytesPacked = (bitsOnStorage * sealedPage.fNElements + 7) / 8;
+   const auto element = RColumnElementBase::Generate(
+      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel());
 
-   return WriteSealedPage(sealedPage, bytesPacked);
+   return WriteSealedPage(sealedPage, GetPackedSize(sealedPage, *element));
 }
 
 
@@ -214,7 +214,8 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    : RPageSource(ntupleName, options)
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
    , fPagePool(std::make_shared<RPagePool>())
-   , fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+   , fClusterPool(
+      std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(), options.GetMaxClusterBunchSize()))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
@@ -225,7 +226,9 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    const RNTupleReadOptions &options)
    : RPageSourceFile(ntupleName, options)
 {
-   fFile = ROOT::Internal::RRawFile::Create(path);
+   ROOT::Internal::RRawFile::ROptions rawFileOptions;
+   rawFileOptions.fUseDirectIO = options.GetUseDirectIO();
+   fFile = ROOT::Internal::RRawFile::Create(path, rawFileOptions);
    R__ASSERT(fFile);
    fReader = Internal::RMiniFileReader(fFile.get());
 }
@@ -257,11 +260,56 @@ ROOT::Experimental::Detail::RPageSourceFile::CreateFromAnchor(const Internal::RF
    return pageSource;
 }
 
-ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile() = default;
+ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile()
+{
+   // The I/O and unzip threads of the cluster pool may still access the mapped file
+   fClusterPool.reset();
+   if (fMappedFile)
+      fFile->Unmap(fMappedFile, fMappedFileSize);
+}
+
+void ROOT::Experimental::Detail::RPageSourceFile::MapFile()
+{
+   if (fMappedFile || !fOptions.GetUseMemoryMap() ||
+       !(fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap))
+      return;
+
+   try {
+      const auto size = fFile->GetSize();
+      if (size == 0)
+         return;
+      std::uint64_t mapdOffset;
+      fMappedFile = static_cast<unsigned char *>(fFile->Map(size, 0, mapdOffset));
+      fMappedFileSize = size;
+   } catch (const std::runtime_error &err) {
+      R__LOG_WARNING(NTupleLog()) << "cannot map " << fFile->GetUrl() << " into memory, falling back to reading: "
+                                  << err.what();
+   }
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceFile::MapPage(ColumnId_t columnId, const RSealedPage &sealedPage,
+                                                     const RColumnElementBase &element)
+{
+   const auto address = static_cast<const unsigned char *>(sealedPage.fBuffer);
+   if (!fMappedFile || (address < fMappedFile) || (address + sealedPage.fSize > fMappedFile + fMappedFileSize))
+      return RPage();
+   if (!element.IsMappable() || (sealedPage.fSize != element.GetPackedSize(sealedPage.fNElements)) ||
+       (reinterpret_cast<std::uintptr_t>(address) % element.GetSize() != 0)) {
+      return RPage();
+   }
+
+   fCounters->fNPageMapped.Inc();
+   // The page is never written to, so that the read-only mapping can be used
+   return RPageAllocatorFile::NewPage(columnId, const_cast<unsigned char *>(address), element.GetSize(),
+                                      sealedPage.fNElements);
+}
 
 
 ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFile::AttachImpl()
 {
+   MapFile();
+
    // If we constructed the page source with (ntuple name, path), we need to find the anchor first.
    // Otherwise, the page source was created by OpenFromAnchor() and the header and footer are already processed.
    if (fDescriptorBuilder.GetDescriptor().GetOnDiskHeaderSize() == 0) {
@@ -282,6 +330,7 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
       auto clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(ntplDesc, cgDesc.GetId());
       Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters);
       for (std::size_t i = 0; i < clusters.size(); ++i) {
+         clusters[i].AddExtendedColumnRanges(ntplDesc).ThrowOnError();
          ntplDesc.AddClusterDetails(clusters[i].MoveDescriptor().Unwrap());
       }
    }
@@ -305,6 +354,8 @@ void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(DescriptorId_t
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   if (pageInfo.fLocator.fType == RNTupleLocator::kTypePageZero)
+      return;
    if (sealedPage.fBuffer)
       fReader.ReadBuffer(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage,
                          pageInfo.fLocator.GetPosition<std::uint64_t>());
@@ -323,12 +374,25 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
    const auto elementSize = element->GetSize();
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
 
+   if (pageInfo.fLocator.fType == RNTupleLocator::kTypePageZero) {
+      return PopulatePageZero(columnId, elementSize, pageInfo.fNElements,
+                              clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                              RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+   }
+
    const void *sealedPageBuffer = nullptr; // points either to directReadBuffer or to a read-only page in the cluster
    std::unique_ptr<unsigned char []> directReadBuffer; // only used if cluster pool is turned off
 
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
+   const auto position = pageInfo.fLocator.GetPosition<std::uint64_t>();
+   // A corrupt locator must not make us read past the end of the mapping; the regular read reports the error
+   const bool isInMappedFile =
+      fMappedFile && (bytesOnStorage <= fMappedFileSize) && (position <= fMappedFileSize - bytesOnStorage);
+   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff && isInMappedFile) {
+      sealedPageBuffer = fMappedFile + position;
+      fCounters->fNPageLoaded.Inc();
+   } else if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
       directReadBuffer = std::make_unique<unsigned char[]>(bytesOnStorage);
-      fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
+      fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, position);
       fCounters->fNPageLoaded.Inc();
       fCounters->fNRead.Inc();
       fCounters->fSzReadPayload.Add(bytesOnStorage);
@@ -348,21 +412,24 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       sealedPageBuffer = onDiskPage->GetAddress();
    }
 
-   std::unique_ptr<unsigned char []> pageBuffer;
-   {
-      RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
-      fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
-   }
+   const RSealedPage sealedPage{sealedPageBuffer, bytesOnStorage, pageInfo.fNElements};
+   auto newPage = MapPage(columnId, sealedPage, *element);
+   // Mapped pages are owned by the memory-mapped file
+   RPageDeleter pageDeleter([](const RPage & /*page*/, void * /*userData*/) {}, nullptr);
+   if (newPage.IsNull()) {
+      RPageBufferAllocator::RBufferPtr pageBuffer;
+      {
+         RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+         pageBuffer = UnsealPage(sealedPage, *element);
+         fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
+      }
 
-   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
+      newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
+      pageDeleter = fPageBufferAllocator->MakePageDeleter();
+   }
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
-   fPagePool->RegisterPage(newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/)
-      {
-         RPageAllocatorFile::DeletePage(page);
-      }, nullptr));
+   fPagePool->RegisterPage(newPage, pageDeleter);
    fCounters->fNPagePopulated.Inc();
    return newPage;
 }
@@ -419,31 +486,27 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
 
 void ROOT::Experimental::Detail::RPageSourceFile::ReleasePage(RPage &page)
 {
+   if (page.IsPageZero())
+      return;
    fPagePool->ReturnPage(page);
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Detail::RPageSourceFile::Clone() const
 {
+   // The clone maps the file on its own when it gets attached
    auto clone = new RPageSourceFile(fNTupleName, fOptions);
    clone->fFile = fFile->Clone();
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
-std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::RClusterBufferInfo
 ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    const RCluster::RKey &clusterKey,
+   std::vector<ROnDiskPageLocator> &onDiskPages,
    std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests)
 {
-   struct ROnDiskPageLocator {
-      ROOT::Experimental::DescriptorId_t fColumnId = 0;
-      ROOT::Experimental::NTupleSize_t fPageNo = 0;
-      std::uint64_t fOffset = 0;
-      std::uint64_t fSize = 0;
-      std::size_t fBufPos = 0;
-   };
-
-   std::vector<ROnDiskPageLocator> onDiskPages;
+   const auto firstPageIdx = onDiskPages.size();
    auto activeSize = 0;
    {
       auto descriptorGuard = GetSharedDescriptorGuard();
@@ -455,6 +518,10 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
          NTupleSize_t pageNo = 0;
          for (const auto &pageInfo : pageRange.fPageInfos) {
             const auto &pageLocator = pageInfo.fLocator;
+            if (pageLocator.fType == RNTupleLocator::kTypePageZero) {
+               ++pageNo;
+               continue;
+            }
             activeSize += pageLocator.fBytesOnStorage;
             onDiskPages.push_back(
                {physicalColumnId, pageNo, pageLocator.GetPosition<std::uint64_t>(), pageLocator.fBytesOnStorage, 0});
@@ -464,7 +531,7 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    }
 
    // Linearize the page requests by file offset
-   std::sort(onDiskPages.begin(), onDiskPages.end(),
+   std::sort(onDiskPages.begin() + firstPageIdx, onDiskPages.end(),
       [](const ROnDiskPageLocator &a, const ROnDiskPageLocator &b) {return a.fOffset < b.fOffset;});
 
    // In order to coalesce close-by pages, we collect the sizes of the gaps between pages on disk.  We then order
@@ -476,7 +543,7 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    // memory consumption, device block size.
    float maxOverhead = 0.25 * float(activeSize);
    std::vector<std::size_t> gaps;
-   for (unsigned i = 1; i < onDiskPages.size(); ++i) {
+   for (auto i = firstPageIdx + 1; i < onDiskPages.size(); ++i) {
       gaps.emplace_back(onDiskPages[i].fOffset - (onDiskPages[i-1].fSize + onDiskPages[i-1].fOffset));
    }
    std::sort(gaps.begin(), gaps.end());
@@ -493,16 +560,13 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
          break;
    }
 
-   // In a first step, we coalesce the read requests and calculate the cluster buffer size.
-   // In a second step, we'll fix-up the memory destinations for the read calls given the
-   // address of the allocated buffer.  We must not touch, however, the read requests from previous
-   // calls to PrepareSingleCluster()
-   const auto currentReadRequestIdx = readRequests.size();
-
+   // We coalesce the read requests and calculate the cluster buffer size.  The caller fixes-up the memory
+   // destinations for the read calls given the address of the allocated buffer.
    ROOT::Internal::RRawFile::RIOVec req;
    std::size_t szPayload = 0;
    std::size_t szOverhead = 0;
-   for (auto &s : onDiskPages) {
+   for (auto itr = onDiskPages.begin() + firstPageIdx; itr != onDiskPages.end(); ++itr) {
+      auto &s = *itr;
       R__ASSERT(s.fSize > 0);
       auto readUpTo = req.fOffset + req.fSize;
       R__ASSERT(s.fOffset >= readUpTo);
@@ -525,21 +589,48 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
       req.fOffset = s.fOffset;
       req.fSize = s.fSize;
    }
-   readRequests.emplace_back(req);
+   if (req.fSize > 0)
+      readRequests.emplace_back(req);
    fCounters->fSzReadPayload.Add(szPayload);
    fCounters->fSzReadOverhead.Add(szOverhead);
+   fCounters->fNPageLoaded.Add(onDiskPages.size() - firstPageIdx);
 
-   // Register the on disk pages in a page map
-   auto buffer = new unsigned char[reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize];
-   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
-   for (const auto &s : onDiskPages) {
-      ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
-      pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
-   }
-   fCounters->fNPageLoaded.Add(onDiskPages.size());
-   for (auto i = currentReadRequestIdx; i < readRequests.size(); ++i) {
-      readRequests[i].fBuffer = buffer + reinterpret_cast<intptr_t>(readRequests[i].fBuffer);
+   RClusterBufferInfo bufferInfo;
+   bufferInfo.fSize = reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize;
+   if (static_cast<std::size_t>(maxOverhead) > szOverhead)
+      bufferInfo.fSpareOverhead = static_cast<std::size_t>(maxOverhead) - szOverhead;
+   return bufferInfo;
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::MapSingleCluster(const RCluster::RKey &clusterKey)
+{
+   auto pageMap = std::make_unique<ROnDiskPageMap>();
+   std::size_t nPages = 0;
+   {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterKey.fClusterId);
+
+      for (auto physicalColumnId : clusterKey.fPhysicalColumnSet) {
+         const auto &pageRange = clusterDesc.GetPageRange(physicalColumnId);
+         NTupleSize_t pageNo = 0;
+         for (const auto &pageInfo : pageRange.fPageInfos) {
+            const auto &pageLocator = pageInfo.fLocator;
+            if (pageLocator.fType == RNTupleLocator::kTypePageZero) {
+               ++pageNo;
+               continue;
+            }
+            const auto offset = pageLocator.GetPosition<std::uint64_t>();
+            if (offset + pageLocator.fBytesOnStorage > fMappedFileSize)
+               throw RException(R__FAIL("page locator beyond the end of file"));
+            ROnDiskPage::Key key(physicalColumnId, pageNo);
+            pageMap->Register(key, ROnDiskPage(fMappedFile + offset, pageLocator.fBytesOnStorage));
+            ++pageNo;
+            ++nPages;
+         }
+      }
    }
+   fCounters->fNPageLoaded.Add(nPages);
 
    auto cluster = std::make_unique<RCluster>(clusterKey.fClusterId);
    cluster->Adopt(std::move(pageMap));
@@ -550,25 +641,145 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
 
 std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
 ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RKey> clusterKeys)
+{
+   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters(clusterKeys.size());
+   LoadClustersStreamed(clusterKeys, [&clusters](std::size_t i, std::unique_ptr<RCluster> cluster) {
+      clusters[i] = std::move(cluster);
+   });
+   return clusters;
+}
+
+void ROOT::Experimental::Detail::RPageSourceFile::LoadClustersStreamed(std::span<RCluster::RKey> clusterKeys,
+                                                                    const RClusterCallback_t &onClusterLoaded)
 {
    fCounters->fNClusterLoaded.Add(clusterKeys.size());
 
-   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters;
+   if (fMappedFile) {
+      for (std::size_t i = 0; i < clusterKeys.size(); ++i)
+         onClusterLoaded(i, MapSingleCluster(clusterKeys[i]));
+      return;
+   }
+
+   const auto nClusters = clusterKeys.size();
+   std::vector<ROnDiskPageLocator> onDiskPages;
+   // For every cluster, the index of its first page in onDiskPages
+   std::vector<std::size_t> firstPageIdx;
    std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   // For every read request, the index of the first and the last cluster it belongs to.  A read request that spans
+   // several clusters belongs to all the clusters in between.
+   std::vector<std::pair<std::size_t, std::size_t>> requestToClusters;
+   // For every cluster, the number of read requests that did not yet complete
+   std::vector<std::size_t> nPendingRequests;
+   // Clusters whose read requests got coalesced share a buffer.  For every cluster, the index of the first cluster
+   // of the group sharing the buffer and the cluster's offset in the buffer.
+   std::vector<std::size_t> bufferOwner;
+   std::vector<std::size_t> bufferOffset;
+   // For the first cluster of every group, the size of the group's buffer and the number of clusters in the group
+   std::vector<std::size_t> bufferSize(nClusters, 0);
+   std::vector<std::size_t> nSharing(nClusters, 0);
+
+   std::vector<ROOT::Internal::RRawFile::RIOVec> clusterRequests;
+   for (std::size_t i = 0; i < nClusters; ++i) {
+      firstPageIdx.emplace_back(onDiskPages.size());
+      clusterRequests.clear();
+      const auto bufferInfo = PrepareSingleCluster(clusterKeys[i], onDiskPages, clusterRequests);
+
+      // If all or most columns are read, consecutive clusters are usually close-by on storage, too.  In this case,
+      // the first read request of this cluster continues the last read request of the previous cluster, provided that
+      // the gap in between fits in the read overhead that the cluster did not use for coalescing its own pages.
+      bool isContinuation = false;
+      std::uint64_t gap = 0;
+      if ((i > 0) && (nPendingRequests[i - 1] > 0) && !clusterRequests.empty()) {
+         const auto readUpTo = readRequests.back().fOffset + readRequests.back().fSize;
+         if (clusterRequests[0].fOffset >= readUpTo) {
+            gap = clusterRequests[0].fOffset - readUpTo;
+            isContinuation = (gap <= bufferInfo.fSpareOverhead);
+         }
+      }
+      bufferOwner.emplace_back(isContinuation ? bufferOwner[i - 1] : i);
+      const auto owner = bufferOwner[i];
+      if (isContinuation) {
+         bufferSize[owner] += gap;
+         fCounters->fSzReadOverhead.Add(gap);
+      }
+      bufferOffset.emplace_back(bufferSize[owner]);
+      for (auto &req : clusterRequests)
+         req.fBuffer = reinterpret_cast<unsigned char *>(req.fBuffer) + bufferSize[owner];
+      bufferSize[owner] += bufferInfo.fSize;
+      nSharing[owner]++;
+
+      nPendingRequests.emplace_back(clusterRequests.size());
+      auto itrReq = clusterRequests.begin();
+      if (isContinuation) {
+         // The cluster buffers are consecutive, so the last request of the previous cluster ends where the gap in
+         // front of the first request of this cluster starts, in the buffer as well as on storage
+         R__ASSERT(reinterpret_cast<unsigned char *>(readRequests.back().fBuffer) + readRequests.back().fSize + gap ==
+                   itrReq->fBuffer);
+         readRequests.back().fSize += gap + itrReq->fSize;
+         requestToClusters.back().second = i;
+         ++itrReq;
+      }
+      for (; itrReq != clusterRequests.end(); ++itrReq) {
+         readRequests.emplace_back(*itrReq);
+         requestToClusters.emplace_back(i, i);
+      }
+   }
 
-   for (auto key: clusterKeys) {
-      clusters.emplace_back(PrepareSingleCluster(key, readRequests));
+   // Allocate the buffers, register the on-disk pages in the page maps, and fix-up the read request destinations
+   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters;
+   std::vector<unsigned char *> buffers(nClusters, nullptr);
+   std::shared_ptr<unsigned char[]> sharedBuffer;
+   for (std::size_t i = 0; i < nClusters; ++i) {
+      const auto owner = bufferOwner[i];
+      std::unique_ptr<ROnDiskPageMap> pageMap;
+      if (nSharing[owner] == 1) {
+         buffers[owner] = new unsigned char[bufferSize[owner]];
+         pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char[]>(buffers[owner]));
+      } else {
+         if (owner == i) {
+            sharedBuffer = std::shared_ptr<unsigned char[]>(new unsigned char[bufferSize[owner]]);
+            buffers[owner] = sharedBuffer.get();
+         }
+         pageMap = std::make_unique<ROnDiskPageMapShared>(sharedBuffer);
+      }
+
+      const auto lastPageIdx = (i + 1 < nClusters) ? firstPageIdx[i + 1] : onDiskPages.size();
+      for (auto p = firstPageIdx[i]; p < lastPageIdx; ++p) {
+         const auto &s = onDiskPages[p];
+         ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
+         pageMap->Register(key, ROnDiskPage(buffers[owner] + bufferOffset[i] + s.fBufPos, s.fSize));
+      }
+
+      auto cluster = std::make_unique<RCluster>(clusterKeys[i].fClusterId);
+      cluster->Adopt(std::move(pageMap));
+      for (auto colId : clusterKeys[i].fPhysicalColumnSet)
+         cluster->SetColumnAvailable(colId);
+      clusters.emplace_back(std::move(cluster));
+   }
+   for (std::size_t i = 0; i < readRequests.size(); ++i) {
+      readRequests[i].fBuffer =
+         buffers[bufferOwner[requestToClusters[i].first]] + reinterpret_cast<intptr_t>(readRequests[i].fBuffer);
    }
 
    auto nReqs = readRequests.size();
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
-      fFile->ReadV(&readRequests[0], nReqs);
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+         if (nPendingRequests[i] == 0)
+            onClusterLoaded(i, std::move(clusters[i]));
+      }
+      if (nReqs > 0) {
+         fFile->ReadVStreamed(&readRequests[0], nReqs, [&](unsigned int reqIdx) {
+            // A coalesced read request completes a part of every cluster it spans
+            for (auto i = requestToClusters[reqIdx].first; i <= requestToClusters[reqIdx].second; ++i) {
+               if (nPendingRequests[i] > 0 && --nPendingRequests[i] == 0)
+                  onClusterLoaded(i, std::move(clusters[i]));
+            }
+         });
+      }
    }
    fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
-
-   return clusters;
 }
 
 
@@ -587,12 +798,19 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
       std::uint64_t firstInPage = 0;
       for (const auto &pi : pageRange.fPageInfos) {
+         // Zero pages are not backed by storage and are never preloaded
+         if (pi.fLocator.fType == RNTupleLocator::kTypePageZero) {
+            firstInPage += pi.fNElements;
+            pageNo++;
+            continue;
+         }
+
          ROnDiskPage::Key key(columnId, pageNo);
          auto onDiskPage = cluster->GetOnDiskPage(key);
          R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
@@ -603,16 +821,20 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
              nElements = pi.fNElements,
              indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex
             ] () {
-               auto pageBuffer = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element);
+               const RSealedPage sealedPage{onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements};
+               auto newPage = MapPage(columnId, sealedPage, *element);
+               if (!newPage.IsNull()) {
+                  newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+                  fPagePool->PreloadPage(newPage, RPageDeleter([](const RPage & /*page*/, void * /*userData*/) {}));
+                  return;
+               }
+
+               auto pageBuffer = UnsealPage(sealedPage, *element);
                fCounters->fSzUnzip.Add(element->GetSize() * nElements);
 
-               auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), element->GetSize(), nElements);
+               newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), element->GetSize(), nElements);
                newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-               fPagePool->PreloadPage(newPage,
-                  RPageDeleter([](const RPage &page, void * /*userData*/)
-                  {
-                     RPageAllocatorFile::DeletePage(page);
-                  }, nullptr));
+               fPagePool->PreloadPage(newPage, fPageBufferAllocator->MakePageDeleter());
             };
 
          fTaskScheduler->AddTask(taskFunc);
@@ -0,0 +1,93 @@
+#include <ROOT/RColumnElement.hxx>
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Micro-benchmark of the split encoding kernels: compares the throughput of the (un)packing of split columns for the
+// different SIMD levels supported by the CPU.  The tests are disabled so that they do not slow down regular test runs;
+// run them with `ntuple_bench_packing --gtest_also_run_disabled_tests`.  The consistency of the SIMD levels is checked
+// by ntuple_packing.
+
+using EColumnType = ROOT::Experimental::EColumnType;
+using ESIMDLevel = ROOT::Experimental::Detail::ESIMDLevel;
+template <typename CppT, EColumnType ColumnT>
+using RColumnElement = ROOT::Experimental::Detail::RColumnElement<CppT, ColumnT>;
+
+namespace {
+
+const char *GetSIMDLevelName(ESIMDLevel level)
+{
+   switch (level) {
+   case ESIMDLevel::kScalar: return "scalar";
+   case ESIMDLevel::kSSE41: return "SSE4.1";
+   case ESIMDLevel::kAVX2: return "AVX2";
+   }
+   return "unknown";
+}
+
+/// Prints the throughput in MB/s of packing and unpacking a page of nElements, repeated nRounds times
+template <typename CppT, EColumnType ColumnT>
+void BenchmarkSplit(const std::string &name, std::size_t nElements = 64 * 1024, unsigned nRounds = 200)
+{
+   RColumnElement<CppT, ColumnT> element(nullptr);
+   std::vector<CppT> mem(nElements);
+   for (std::size_t i = 0; i < nElements; ++i)
+      mem[i] = static_cast<CppT>(i * 3 + 1);
+   std::vector<CppT> reference(nElements);
+   std::vector<CppT> packed(nElements);
+   std::vector<CppT> unpacked(nElements);
+
+   const auto maxLevel = ROOT::Experimental::Detail::GetMaxSIMDLevel();
+   for (auto level : {ESIMDLevel::kScalar, ESIMDLevel::kSSE41, ESIMDLevel::kAVX2}) {
+      if (static_cast<int>(level) > static_cast<int>(maxLevel))
+         break;
+      ROOT::Experimental::Detail::SetSIMDLevel(level);
+
+      auto tsStart = std::chrono::steady_clock::now();
+      for (unsigned r = 0; r < nRounds; ++r)
+         element.Pack(packed.data(), mem.data(), nElements);
+      auto tsPacked = std::chrono::steady_clock::now();
+      for (unsigned r = 0; r < nRounds; ++r)
+         element.Unpack(unpacked.data(), packed.data(), nElements);
+      auto tsUnpacked = std::chrono::steady_clock::now();
+
+      if (level == ESIMDLevel::kScalar)
+         reference = packed;
+      EXPECT_EQ(reference, packed);
+      EXPECT_EQ(mem, unpacked);
+
+      const double nMB = static_cast<double>(nRounds) * nElements * sizeof(CppT) / 1e6;
+      const double tPack = std::chrono::duration<double>(tsPacked - tsStart).count();
+      const double tUnpack = std::chrono::duration<double>(tsUnpacked - tsPacked).count();
+      std::cout << name << " [" << GetSIMDLevelName(level) << "]: pack " << nMB / tPack << " MB/s, unpack "
+                << nMB / tUnpack << " MB/s" << std::endl;
+   }
+   ROOT::Experimental::Detail::SetSIMDLevel(maxLevel);
+}
+
+} // anonymous namespace
+
+TEST(BenchPacking, DISABLED_SplitReal64)
+{
+   BenchmarkSplit<double, EColumnType::kSplitReal64>("SplitReal64");
+}
+
+TEST(BenchPacking, DISABLED_SplitReal32)
+{
+   BenchmarkSplit<float, EColumnType::kSplitReal32>("SplitReal32");
+}
+
+TEST(BenchPacking, DISABLED_SplitInt16)
+{
+   BenchmarkSplit<std::int16_t, EColumnType::kSplitInt16>("SplitInt16");
+}
+
+TEST(BenchPacking, DISABLED_SplitDeltaInt32)
+{
+   BenchmarkSplit<std::int32_t, EColumnType::kSplitDeltaInt32>("SplitDeltaInt32");
+}
@@ -15,12 +15,14 @@
 #include <ROOT/RStringView.hxx>
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <vector>
 
 using ClusterSize_t = ROOT::Experimental::ClusterSize_t;
 using RCluster = ROOT::Experimental::Detail::RCluster;
+using RClusterBunchSizeAdapter = ROOT::Experimental::Detail::RClusterBunchSizeAdapter;
 using RClusterPool = ROOT::Experimental::Detail::RClusterPool;
 using RNTupleDescriptor = ROOT::Experimental::RNTupleDescriptor;
 using ROnDiskPage = ROOT::Experimental::Detail::ROnDiskPage;
@@ -56,14 +58,14 @@ public:
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RCluster::ColumnSet_t> fReqsColumns;
 
-   RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
+   explicit RPageSourceMock(unsigned nClusters = 6) : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
-      for (unsigned i = 0; i <= 5; ++i) {
+      for (unsigned i = 0; i < nClusters; ++i) {
          descBuilder.AddClusterSummary(i, i, 1);
       }
       auto descriptorGuard = GetExclDescriptorGuard();
       descriptorGuard.MoveIn(descBuilder.MoveDescriptor());
-      for (unsigned i = 0; i <= 5; ++i) {
+      for (unsigned i = 0; i < nClusters; ++i) {
          descriptorGuard->AddClusterDetails(
             ROOT::Experimental::RClusterDescriptorBuilder(i, i, 1).MoveDescriptor().Unwrap());
       }
@@ -281,6 +283,90 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterPool, BunchSizeAdapter)
+{
+   // All times in nanoseconds.  A stall of more than 10% of the processing time doubles the bunch size.
+   RClusterBunchSizeAdapter a1(1, 8);
+   EXPECT_EQ(1U, a1.GetBunchSize());
+   EXPECT_EQ(8U, a1.GetMaxBunchSize());
+   a1.Update(1000, 100, 500);
+   EXPECT_EQ(1U, a1.GetBunchSize());
+   a1.Update(1000, 101, 500);
+   EXPECT_EQ(2U, a1.GetBunchSize());
+   a1.Update(1000, 500, 500);
+   EXPECT_EQ(4U, a1.GetBunchSize());
+   a1.Update(1000, 500, 500);
+   EXPECT_EQ(8U, a1.GetBunchSize());
+   a1.Update(1000, 500, 500);
+   EXPECT_EQ(8U, a1.GetBunchSize());
+
+   // Without stalls for two bunches, the bunch size shrinks if reading is much faster than processing
+   RClusterBunchSizeAdapter a2(4, 8);
+   for (unsigned i = 0; i < 7; ++i)
+      a2.Update(1000, 0, 100);
+   EXPECT_EQ(4U, a2.GetBunchSize());
+   a2.Update(1000, 0, 100);
+   EXPECT_EQ(3U, a2.GetBunchSize());
+   for (unsigned i = 0; i < 5; ++i)
+      a2.Update(1000, 0, 100);
+   EXPECT_EQ(3U, a2.GetBunchSize());
+   a2.Update(1000, 0, 100);
+   EXPECT_EQ(2U, a2.GetBunchSize());
+   for (unsigned i = 0; i < 100; ++i)
+      a2.Update(1000, 0, 100);
+   EXPECT_EQ(1U, a2.GetBunchSize());
+
+   // A stall resets the count of clusters without stall
+   RClusterBunchSizeAdapter a3(2, 8);
+   for (unsigned i = 0; i < 3; ++i)
+      a3.Update(1000, 0, 100);
+   a3.Update(1000, 200, 100);
+   EXPECT_EQ(4U, a3.GetBunchSize());
+   for (unsigned i = 0; i < 7; ++i)
+      a3.Update(1000, 0, 100);
+   EXPECT_EQ(4U, a3.GetBunchSize());
+
+   // Reading is not much faster than processing: keep the bunch size
+   RClusterBunchSizeAdapter a4(4, 8);
+   for (unsigned i = 0; i < 100; ++i)
+      a4.Update(1000, 0, 250);
+   EXPECT_EQ(4U, a4.GetBunchSize());
+
+   // The maximum is never below the initial bunch size
+   RClusterBunchSizeAdapter a5(2, 1);
+   EXPECT_EQ(2U, a5.GetMaxBunchSize());
+   a5.Update(1000, 1000, 1000);
+   EXPECT_EQ(2U, a5.GetBunchSize());
+}
+
+TEST(ClusterPool, AdaptiveBunchSize)
+{
+   RPageSourceMock p1(32);
+   {
+      RClusterPool c1(p1, 1, 8);
+      EXPECT_EQ(1U, c1.GetClusterBunchSize());
+      for (unsigned i = 0; i < 32; ++i) {
+         c1.GetCluster(i, {0});
+         EXPECT_GE(c1.GetClusterBunchSize(), 1U);
+         EXPECT_LE(c1.GetClusterBunchSize(), 8U);
+      }
+      c1.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(32U, p1.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 32; ++i)
+      EXPECT_EQ(i, p1.fReqsClusterIds[i]);
+
+   // Fixed bunch size
+   RPageSourceMock p2(32);
+   {
+      RClusterPool c2(p2, 2);
+      for (unsigned i = 0; i < 32; ++i)
+         c2.GetCluster(i, {0});
+      EXPECT_EQ(2U, c2.GetClusterBunchSize());
+      c2.WaitForInFlightClusters();
+   }
+}
+
 TEST(PageStorageFile, LoadClusters)
 {
    FileRaii fileGuard("test_pagestoragefile_loadclusters.root");
@@ -340,3 +426,88 @@ TEST(PageStorageFile, LoadClusters)
    EXPECT_EQ(1U, clusters[1]->GetId());
    EXPECT_EQ(1U, clusters[1]->GetNOnDiskPages());
 }
+
+TEST(PageStorageFile, LoadClustersCoalesced)
+{
+   FileRaii fileGuard("test_pagestoragefile_loadclusters_coalesced.root");
+
+   auto modelWrite = ROOT::Experimental::RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt", 0.0);
+   auto wrTag = modelWrite->MakeField<std::int32_t>("tag", 0);
+
+   {
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetCompression(0);
+      ROOT::Experimental::RNTupleWriter ntuple(
+         std::move(modelWrite),
+         std::make_unique<ROOT::Experimental::Detail::RPageSinkFile>("myNTuple", fileGuard.GetPath(), options));
+      for (unsigned i = 0; i < 3; ++i) {
+         for (unsigned j = 0; j < 1000; ++j) {
+            *wrPt = i * 1000 + j;
+            *wrTag = j;
+            ntuple.Fill();
+         }
+         ntuple.CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::Detail::RPageSourceFile source(
+      "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleReadOptions());
+   source.Attach();
+   source.GetMetrics().Enable();
+   auto nReadV = source.GetMetrics().GetCounter("RPageSourceFile.nReadV");
+   auto nRead = source.GetMetrics().GetCounter("RPageSourceFile.nRead");
+   ASSERT_NE(nullptr, nReadV);
+   ASSERT_NE(nullptr, nRead);
+
+   ROOT::Experimental::DescriptorId_t colPt;
+   ROOT::Experimental::DescriptorId_t colTag;
+   {
+      auto descriptorGuard = source.GetSharedDescriptorGuard();
+      colPt = descriptorGuard->FindPhysicalColumnId(descriptorGuard->FindFieldId("pt"), 0);
+      colTag = descriptorGuard->FindPhysicalColumnId(descriptorGuard->FindFieldId("tag"), 0);
+   }
+
+   // The pages of consecutive clusters are only separated by key headers on storage.  The two pages of the first
+   // cluster are read separately; the first page of every following cluster is read along with the last page of
+   // the previous cluster.
+   std::vector<ROOT::Experimental::Detail::RCluster::RKey> clusterKeys;
+   for (ROOT::Experimental::DescriptorId_t i = 0; i < 3; ++i)
+      clusterKeys.push_back({i, {colPt, colTag}});
+   auto clusters = source.LoadClusters(clusterKeys);
+   EXPECT_EQ(1, nReadV->GetValueAsInt());
+   EXPECT_EQ(4, nRead->GetValueAsInt());
+   ASSERT_EQ(3U, clusters.size());
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(i, clusters[i]->GetId());
+      EXPECT_EQ(2U, clusters[i]->GetNOnDiskPages());
+      auto onDiskPage = clusters[i]->GetOnDiskPage(ROnDiskPage::Key(colPt, 0));
+      ASSERT_NE(nullptr, onDiskPage);
+      ASSERT_EQ(4000U, onDiskPage->GetSize());
+      float values[2];
+      memcpy(values, onDiskPage->GetAddress(), sizeof(values));
+      EXPECT_FLOAT_EQ(i * 1000, values[0]);
+      EXPECT_FLOAT_EQ(i * 1000 + 1, values[1]);
+   }
+
+   // The buffer shared by the clusters must stay valid as long as any of the clusters is alive
+   clusters[0].reset();
+   clusters[2].reset();
+   auto onDiskPage = clusters[1]->GetOnDiskPage(ROnDiskPage::Key(colTag, 0));
+   ASSERT_NE(nullptr, onDiskPage);
+   std::int32_t tags[2];
+   memcpy(tags, (const unsigned char *)onDiskPage->GetAddress() + onDiskPage->GetSize() - sizeof(tags), sizeof(tags));
+   EXPECT_EQ(998, tags[0]);
+   EXPECT_EQ(999, tags[1]);
+   clusters.clear();
+
+   // Clusters that are not consecutive are read with separate requests
+   clusterKeys.clear();
+   clusterKeys.push_back({0, {colPt, colTag}});
+   clusterKeys.push_back({2, {colPt, colTag}});
+   clusters = source.LoadClusters(clusterKeys);
+   EXPECT_EQ(2, nReadV->GetValueAsInt());
+   EXPECT_EQ(8, nRead->GetValueAsInt());
+   ASSERT_EQ(2U, clusters.size());
+   EXPECT_EQ(2U, clusters[1]->GetNOnDiskPages());
+}
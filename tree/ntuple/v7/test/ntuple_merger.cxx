@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <TFileMerger.h>
+
 namespace {
 
 // Reads an integer from a little-endian 4 byte buffer
@@ -15,6 +17,37 @@ std::int32_t ReadRawInt(const void *ptr)
 #endif
 }
 
+// Writes an ntuple with the fields "foo" and "bar" and with entries in [firstEntry, firstEntry + nEntries)
+void WriteFooBar(const std::string &path, int firstEntry, int nEntries, int compression)
+{
+   auto model = RNTupleModel::Create();
+   auto fldFoo = model->MakeField<int>("foo");
+   auto fldBar = model->MakeField<std::vector<float>>("bar");
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", path, options);
+   for (int i = firstEntry; i < firstEntry + nEntries; ++i) {
+      *fldFoo = i;
+      *fldBar = std::vector<float>(i % 3, static_cast<float>(i));
+      writer->Fill();
+      if (i % 4 == 3)
+         writer->CommitCluster();
+   }
+}
+
+// Checks that the ntuple at the given path contains the fields "foo" and "bar" with entries in [0, nEntries)
+void CheckFooBar(const std::string &path, int nEntries)
+{
+   auto reader = RNTupleReader::Open("ntuple", path);
+   ASSERT_EQ(static_cast<NTupleSize_t>(nEntries), reader->GetNEntries());
+   auto viewFoo = reader->GetView<int>("foo");
+   auto viewBar = reader->GetView<std::vector<float>>("bar");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_EQ(static_cast<int>(i), viewFoo(i));
+      EXPECT_EQ(std::vector<float>(i % 3, static_cast<float>(i)), viewBar(i));
+   }
+}
+
 } // anonymous namespace
 
 TEST(RPageStorage, ReadSealedPages)
@@ -79,3 +112,117 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+TEST(RNTupleMerger, MergeSymmetric)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_out.root");
+
+   WriteFooBar(fileGuard1.GetPath(), 0, 10, 505);
+   WriteFooBar(fileGuard2.GetPath(), 10, 13, 505);
+
+   RNTupleWriteOptions options;
+   options.SetCompression(505);
+   {
+      auto source1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+      auto source2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+      std::vector<RPageSource *> sources{source1.get(), source2.get()};
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), options);
+      RNTupleMerger merger;
+      merger.Merge(sources, *destination);
+
+      // Pages with matching compression are copied verbatim
+      auto descIn = source1->GetSharedDescriptorGuard()->Clone();
+      const auto &descOut = destination->GetDescriptor();
+      const auto columnIdIn = descIn->FindPhysicalColumnId(descIn->FindFieldId("foo"), 0);
+      const auto columnIdOut = descOut.FindPhysicalColumnId(descOut.FindFieldId("foo"), 0);
+      const auto &pageInfoIn =
+         descIn->GetClusterDescriptor(descIn->FindClusterId(columnIdIn, 0)).GetPageRange(columnIdIn).fPageInfos[0];
+      const auto &pageInfoOut =
+         descOut.GetClusterDescriptor(descOut.FindClusterId(columnIdOut, 0)).GetPageRange(columnIdOut).fPageInfos[0];
+      EXPECT_EQ(pageInfoIn.fNElements, pageInfoOut.fNElements);
+      EXPECT_EQ(pageInfoIn.fLocator.fBytesOnStorage, pageInfoOut.fLocator.fBytesOnStorage);
+   }
+
+   CheckFooBar(fileGuard3.GetPath(), 23);
+   auto reader = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   // 3 clusters from the first input (entries 0-3, 4-7, 8-9), 4 clusters from the second one (10-11, ..., 20-22)
+   EXPECT_EQ(7U, reader->GetDescriptor()->GetNClusters());
+}
+
+TEST(RNTupleMerger, MergeRecompress)
+{
+   FileRaii fileGuard1("test_ntuple_merge_recompress_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_recompress_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_recompress_out.root");
+
+   WriteFooBar(fileGuard1.GetPath(), 0, 100, 0);
+   WriteFooBar(fileGuard2.GetPath(), 100, 50, 101);
+
+   RNTupleWriteOptions options;
+   options.SetCompression(505);
+   {
+      auto source1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+      auto source2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+      std::vector<RPageSource *> sources{source1.get(), source2.get()};
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), options);
+      RNTupleMerger merger;
+      merger.Merge(sources, *destination);
+   }
+
+   CheckFooBar(fileGuard3.GetPath(), 150);
+   auto reader = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   for (const auto &cluster : desc->GetClusterIterable()) {
+      for (auto columnId : cluster.GetColumnIds())
+         EXPECT_EQ(505, cluster.GetColumnRange(columnId).fCompressionSettings);
+   }
+}
+
+TEST(RNTupleMerger, MergeIncompatible)
+{
+   FileRaii fileGuard1("test_ntuple_merge_incompatible_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_incompatible_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_incompatible_out.root");
+
+   WriteFooBar(fileGuard1.GetPath(), 0, 10, 505);
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("foo");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard2.GetPath());
+      writer->Fill();
+   }
+
+   auto source1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+   auto source2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+   std::vector<RPageSource *> sources{source1.get(), source2.get()};
+   auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), RNTupleWriteOptions());
+   RNTupleMerger merger;
+   try {
+      merger.Merge(sources, *destination);
+      FAIL() << "merging RNTuples with different schema should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("columns"));
+   }
+}
+
+TEST(RNTupleMerger, TFileMerger)
+{
+   FileRaii fileGuard1("test_ntuple_merge_hadd_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_hadd_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_hadd_out.root");
+
+   WriteFooBar(fileGuard1.GetPath(), 0, 10, 505);
+   WriteFooBar(fileGuard2.GetPath(), 10, 10, 505);
+
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuard3.GetPath().c_str(), "RECREATE", 505);
+      fileMerger.AddFile(fileGuard1.GetPath().c_str());
+      fileMerger.AddFile(fileGuard2.GetPath().c_str());
+      EXPECT_TRUE(fileMerger.Merge());
+   }
+
+   CheckFooBar(fileGuard3.GetPath(), 20);
+}
@@ -0,0 +1,313 @@
+#include "ntuple_test.hxx"
+
+namespace {
+void WriteExtended(const std::string &path, const RNTupleWriteOptions &options)
+{
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt", 0.0);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", path, options);
+   for (int i = 0; i < 5; ++i) {
+      *fieldPt = i;
+      writer->Fill();
+   }
+
+   auto updater = writer->CreateModelUpdater();
+   updater->BeginUpdate();
+   auto fieldEta = updater->MakeField<float>("eta");
+   auto fieldVec = updater->MakeField<std::vector<float>>("vec");
+   auto fieldArr = updater->MakeField<std::array<std::int32_t, 2>>("arr");
+   auto fieldVariant = updater->MakeField<std::variant<std::int32_t, std::string>>("variant");
+   updater->CommitUpdate();
+
+   for (int i = 5; i < 10; ++i) {
+      *fieldPt = i;
+      *fieldEta = 2.0 * i;
+      *fieldVec = std::vector<float>(i, 1.0);
+      *fieldArr = {i, -i};
+      *fieldVariant = std::to_string(i);
+      writer->Fill();
+   }
+}
+
+void CheckExtended(const std::string &path)
+{
+   auto reader = RNTupleReader::Open("ntuple", path);
+   EXPECT_EQ(10U, reader->GetNEntries());
+   EXPECT_EQ(2U, reader->GetDescriptor()->GetNClusters());
+
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewEta = reader->GetView<float>("eta");
+   auto viewVec = reader->GetView<std::vector<float>>("vec");
+   auto viewArr = reader->GetView<std::array<std::int32_t, 2>>("arr");
+   auto viewVariant = reader->GetView<std::variant<std::int32_t, std::string>>("variant");
+   for (int i = 0; i < 5; ++i) {
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+      EXPECT_FLOAT_EQ(0.0, viewEta(i));
+      EXPECT_TRUE(viewVec(i).empty());
+      EXPECT_EQ(0, viewArr(i)[0]);
+      EXPECT_EQ(0, viewArr(i)[1]);
+   }
+   for (int i = 5; i < 10; ++i) {
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+      EXPECT_FLOAT_EQ(2.0 * i, viewEta(i));
+      EXPECT_EQ(std::vector<float>(i, 1.0), viewVec(i));
+      EXPECT_EQ(i, viewArr(i)[0]);
+      EXPECT_EQ(-i, viewArr(i)[1]);
+      EXPECT_EQ(std::to_string(i), std::get<std::string>(viewVariant(i)));
+   }
+}
+} // anonymous namespace
+
+TEST(RNTupleModelExtension, Basics)
+{
+   FileRaii fileGuard("test_ntuple_modelext_basics.root");
+   WriteExtended(fileGuard.GetPath(), RNTupleWriteOptions());
+   CheckExtended(fileGuard.GetPath());
+
+   // The absent columns of the first cluster are not stored
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = *reader->GetDescriptor();
+   const auto columnId = desc.FindPhysicalColumnId(desc.FindFieldId("eta"), 0);
+   const auto &pageRange = desc.GetClusterDescriptor(desc.FindClusterId(columnId, 0)).GetPageRange(columnId);
+   ASSERT_EQ(1U, pageRange.fPageInfos.size());
+   EXPECT_EQ(5U, pageRange.fPageInfos[0].fNElements);
+   EXPECT_EQ(0U, pageRange.fPageInfos[0].fLocator.fBytesOnStorage);
+}
+
+TEST(RNTupleModelExtension, Unbuffered)
+{
+   FileRaii fileGuard("test_ntuple_modelext_unbuffered.root");
+   RNTupleWriteOptions options;
+   options.SetUseBufferedWrite(false);
+   WriteExtended(fileGuard.GetPath(), options);
+   CheckExtended(fileGuard.GetPath());
+}
+
+TEST(RNTupleModelExtension, MultipleUpdates)
+{
+   FileRaii fileGuard("test_ntuple_modelext_multiple.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldA = model->MakeField<std::int32_t>("a", 1);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      writer->Fill();
+
+      auto updater = writer->CreateModelUpdater();
+      updater->BeginUpdate();
+      auto fieldB = updater->MakeField<std::int32_t>("b", 2);
+      updater->CommitUpdate();
+      writer->Fill();
+
+      // An update without changes does not start a new cluster
+      updater->BeginUpdate();
+      updater->CommitUpdate();
+      writer->Fill();
+
+      updater->BeginUpdate();
+      updater->AddField(std::make_unique<RField<std::string>>("c"));
+      updater->CommitUpdate();
+      auto entry = writer->CreateEntry();
+      *entry->Get<std::int32_t>("b") = 3;
+      *entry->Get<std::string>("c") = "abc";
+      writer->Fill(*entry);
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(4U, reader->GetNEntries());
+   EXPECT_EQ(3U, reader->GetDescriptor()->GetNClusters());
+   auto viewA = reader->GetView<std::int32_t>("a");
+   auto viewB = reader->GetView<std::int32_t>("b");
+   auto viewC = reader->GetView<std::string>("c");
+   EXPECT_EQ(1, viewA(0));
+   EXPECT_EQ(0, viewB(0));
+   EXPECT_EQ(2, viewB(1));
+   EXPECT_EQ(2, viewB(2));
+   EXPECT_EQ(3, viewB(3));
+   EXPECT_TRUE(viewC(0).empty());
+   EXPECT_TRUE(viewC(2).empty());
+   EXPECT_EQ("abc", viewC(3));
+}
+
+TEST(RNTupleModelExtension, DictionaryEncodedString)
+{
+   FileRaii fileGuard("test_ntuple_modelext_dictionary.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldA = model->MakeField<std::int32_t>("a", 1);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      writer->Fill();
+      writer->Fill();
+
+      auto updater = writer->CreateModelUpdater();
+      updater->BeginUpdate();
+      auto field = std::make_unique<RField<std::string>>("tag");
+      field->SetDictionaryEncoded();
+      updater->AddField(std::move(field));
+      updater->CommitUpdate();
+      auto entry = writer->CreateEntry();
+      for (auto tag : {"x", "y", "x"}) {
+         *entry->Get<std::string>("tag") = tag;
+         writer->Fill(*entry);
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(5U, reader->GetNEntries());
+   EXPECT_EQ(2U, reader->GetDescriptor()->GetNClusters());
+   auto viewTag = reader->GetView<std::string>("tag");
+   // The entries written before the field was added have no dictionary and read as empty strings
+   EXPECT_TRUE(viewTag(0).empty());
+   EXPECT_TRUE(viewTag(1).empty());
+   EXPECT_EQ(0U, viewTag.GetDictionaryId(1));
+   EXPECT_EQ(0U, viewTag.FindDictionaryId(0, ""));
+   EXPECT_EQ(RField<std::string>::kInvalidDictionaryId, viewTag.FindDictionaryId(0, "x"));
+   EXPECT_EQ("x", viewTag(2));
+   EXPECT_EQ("y", viewTag(3));
+   EXPECT_EQ("x", viewTag(4));
+   EXPECT_TRUE(viewTag(0).empty());
+   EXPECT_EQ(viewTag.GetDictionaryId(2), viewTag.FindDictionaryId(4, "x"));
+}
+
+TEST(RNTupleModelExtension, Errors)
+{
+   FileRaii fileGuard("test_ntuple_modelext_errors.root");
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   model->AddProjectedField(std::make_unique<RField<float>>("aliasPt"), [](const std::string &) { return "pt"; })
+      .ThrowOnError();
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+
+   auto updater = writer->CreateModelUpdater();
+   try {
+      updater->BeginUpdate();
+      FAIL() << "adding fields to a model with projected fields should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("projected fields"));
+   }
+}
+
+TEST(RNTupleModelExtension, StaleEntry)
+{
+   FileRaii fileGuard("test_ntuple_modelext_stale.root");
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+   auto entry = writer->CreateEntry();
+   writer->Fill(*entry);
+
+   auto updater = writer->CreateModelUpdater();
+   updater->BeginUpdate();
+   updater->MakeField<float>("eta");
+   updater->CommitUpdate();
+
+   try {
+      writer->Fill(*entry);
+      FAIL() << "filling an entry created before the model update should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("mismatch"));
+   }
+   writer->Fill(*writer->CreateEntry());
+}
+
+TEST(RNTupleModelExtension, Merge)
+{
+   FileRaii fileGuardIn("test_ntuple_modelext_merge_in.root");
+   FileRaii fileGuardOut("test_ntuple_modelext_merge_out.root");
+   WriteExtended(fileGuardIn.GetPath(), RNTupleWriteOptions());
+
+   {
+      auto source = RPageSource::Create("ntuple", fileGuardIn.GetPath());
+      std::vector<RPageSource *> sources{source.get()};
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuardOut.GetPath(), RNTupleWriteOptions());
+      RNTupleMerger merger;
+      merger.Merge(sources, *destination);
+   }
+   CheckExtended(fileGuardOut.GetPath());
+}
+
+TEST(RNTupleModelExtension, MergeQuantized)
+{
+   FileRaii fileGuardIn("test_ntuple_modelext_merge_quant_in.root");
+   FileRaii fileGuardOut("test_ntuple_modelext_merge_quant_out.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt", 1.0);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuardIn.GetPath());
+      writer->Fill();
+      writer->Fill();
+
+      auto updater = writer->CreateModelUpdater();
+      updater->BeginUpdate();
+      auto field = std::make_unique<RField<float>>("eta");
+      // All-zero packed bytes would read as the lower bound of the range, -1, rather than 0
+      field->SetQuantized(-1.0, 1.0, 16);
+      updater->AddField(std::move(field));
+      updater->CommitUpdate();
+      auto entry = writer->CreateEntry();
+      *entry->Get<float>("eta") = 0.5;
+      writer->Fill(*entry);
+   }
+
+   {
+      auto source = RPageSource::Create("ntuple", fileGuardIn.GetPath());
+      std::vector<RPageSource *> sources{source.get()};
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuardOut.GetPath(), RNTupleWriteOptions());
+      RNTupleMerger merger;
+      merger.Merge(sources, *destination);
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuardOut.GetPath());
+   EXPECT_EQ(3U, reader->GetNEntries());
+   auto viewEta = reader->GetView<float>("eta");
+   EXPECT_NEAR(0.0, viewEta(0), 2.0 / 65535);
+   EXPECT_NEAR(0.0, viewEta(1), 2.0 / 65535);
+   EXPECT_NEAR(0.5, viewEta(2), 2.0 / 65535);
+}
+
+TEST(RNTupleModelExtension, MergeInteger)
+{
+   FileRaii fileGuardIn("test_ntuple_modelext_merge_int_in.root");
+   FileRaii fileGuardOut("test_ntuple_modelext_merge_int_out.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt", 1.0);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuardIn.GetPath());
+      writer->Fill();
+      writer->Fill();
+
+      auto updater = writer->CreateModelUpdater();
+      updater->BeginUpdate();
+      updater->MakeField<std::int32_t>("split");
+      auto field = std::make_unique<RField<std::int64_t>>("bitpacked");
+      field->SetColumnRepresentative({EColumnType::kBitPackedInt64});
+      updater->AddField(std::move(field));
+      updater->CommitUpdate();
+      auto entry = writer->CreateEntry();
+      for (std::int64_t i = 1; i <= 3; ++i) {
+         *entry->Get<std::int32_t>("split") = -i;
+         *entry->Get<std::int64_t>("bitpacked") = 1000 + i;
+         writer->Fill(*entry);
+      }
+   }
+
+   {
+      auto source = RPageSource::Create("ntuple", fileGuardIn.GetPath());
+      std::vector<RPageSource *> sources{source.get()};
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuardOut.GetPath(), RNTupleWriteOptions());
+      RNTupleMerger merger;
+      merger.Merge(sources, *destination);
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuardOut.GetPath());
+   EXPECT_EQ(5U, reader->GetNEntries());
+   auto viewSplit = reader->GetView<std::int32_t>("split");
+   auto viewBitPacked = reader->GetView<std::int64_t>("bitpacked");
+   for (int i = 0; i < 2; ++i) {
+      EXPECT_EQ(0, viewSplit(i));
+      EXPECT_EQ(0, viewBitPacked(i));
+   }
+   for (std::int64_t i = 1; i <= 3; ++i) {
+      EXPECT_EQ(-i, viewSplit(i + 1));
+      EXPECT_EQ(1000 + i, viewBitPacked(i + 1));
+   }
+}
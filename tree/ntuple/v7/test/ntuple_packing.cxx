@@ -2,6 +2,7 @@
 
 #include <array>
 #include <limits>
+#include <vector>
 
 TEST(Packing, Bitfield)
 {
@@ -75,3 +76,307 @@ TEST(Packing, SplitReal64)
 
    EXPECT_EQ(mem, cmp);
 }
+
+namespace {
+template <std::size_t N>
+void CheckSplitBytes(std::size_t count)
+{
+   std::vector<unsigned char> mem(N * count);
+   for (std::size_t i = 0; i < mem.size(); ++i)
+      mem[i] = static_cast<unsigned char>(i * 7 + i / 251);
+
+   std::vector<unsigned char> expected(N * count);
+   for (std::size_t i = 0; i < count; ++i) {
+      for (std::size_t b = 0; b < N; ++b)
+         expected[b * count + i] = mem[N * i + b];
+   }
+
+   std::vector<unsigned char> packed(N * count);
+   std::vector<unsigned char> cmp(N * count);
+   ROOT::Experimental::Detail::SplitBytesLE<N>(packed.data(), mem.data(), count);
+   ROOT::Experimental::Detail::UnsplitBytesLE<N>(cmp.data(), packed.data(), count);
+   EXPECT_EQ(expected, packed) << "N = " << N << ", count = " << count;
+   EXPECT_EQ(mem, cmp) << "N = " << N << ", count = " << count;
+}
+
+/// Checks that all the SIMD levels supported by the CPU pack a column like the scalar code, and unpack it back
+template <typename CppT, EColumnType ColumnT>
+void CheckSplitSIMDLevels(std::size_t count)
+{
+   using ROOT::Experimental::Detail::ESIMDLevel;
+   ROOT::Experimental::Detail::RColumnElement<CppT, ColumnT> element(nullptr);
+   std::vector<CppT> mem(count);
+   for (std::size_t i = 0; i < count; ++i)
+      mem[i] = static_cast<CppT>(i * 3 + 1);
+   std::vector<CppT> reference(count);
+   std::vector<CppT> packed(count);
+   std::vector<CppT> cmp(count);
+
+   const auto maxLevel = ROOT::Experimental::Detail::GetMaxSIMDLevel();
+   for (auto level : {ESIMDLevel::kScalar, ESIMDLevel::kSSE41, ESIMDLevel::kAVX2}) {
+      if (static_cast<int>(level) > static_cast<int>(maxLevel))
+         break;
+      ROOT::Experimental::Detail::SetSIMDLevel(level);
+      element.Pack(packed.data(), mem.data(), count);
+      element.Unpack(cmp.data(), packed.data(), count);
+      if (level == ESIMDLevel::kScalar)
+         reference = packed;
+      EXPECT_EQ(reference, packed) << "level = " << static_cast<int>(level) << ", count = " << count;
+      EXPECT_EQ(mem, cmp) << "level = " << static_cast<int>(level) << ", count = " << count;
+   }
+   ROOT::Experimental::Detail::SetSIMDLevel(maxLevel);
+}
+
+/// Checks that all the SIMD levels supported by the CPU unpack a bit-packed page of values that fit in `width` bits
+template <typename CppT, EColumnType ColumnT>
+void CheckBitUnpackSIMDLevels(unsigned int width, std::size_t count)
+{
+   using ROOT::Experimental::Detail::ESIMDLevel;
+   using UnsignedT = std::make_unsigned_t<CppT>;
+   ROOT::Experimental::Detail::RColumnElement<CppT, ColumnT> element(nullptr);
+   const std::uint64_t mask = (width == 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << width) - 1);
+   std::vector<CppT> mem(count);
+   std::uint64_t x = 42;
+   for (std::size_t i = 0; i < count; ++i) {
+      x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+      mem[i] = static_cast<CppT>(static_cast<UnsignedT>((x >> 7) & mask));
+   }
+   std::vector<unsigned char> maxPacked(element.GetPackedSize(count));
+   element.Pack(maxPacked.data(), mem.data(), count);
+   ASSERT_LE(maxPacked[8], width);
+   // Unpacking must not read past the end of the actual page
+   const auto packedSize = element.GetPackedSizeFromHeader(maxPacked.data(), count);
+   EXPECT_EQ(9 + (count * maxPacked[8] + 7) / 8, packedSize);
+   std::vector<unsigned char> packed(maxPacked.begin(), maxPacked.begin() + packedSize);
+
+   const auto maxLevel = ROOT::Experimental::Detail::GetMaxSIMDLevel();
+   for (auto level : {ESIMDLevel::kScalar, ESIMDLevel::kSSE41, ESIMDLevel::kAVX2}) {
+      if (static_cast<int>(level) > static_cast<int>(maxLevel))
+         break;
+      ROOT::Experimental::Detail::SetSIMDLevel(level);
+      std::vector<CppT> cmp(count);
+      element.Unpack(cmp.data(), packed.data(), count);
+      EXPECT_EQ(mem, cmp) << "level = " << static_cast<int>(level) << ", width = " << width << ", count = " << count;
+   }
+   ROOT::Experimental::Detail::SetSIMDLevel(maxLevel);
+}
+} // anonymous namespace
+
+TEST(Packing, SplitBytes)
+{
+   using ROOT::Experimental::Detail::ESIMDLevel;
+   const auto maxLevel = ROOT::Experimental::Detail::GetMaxSIMDLevel();
+   for (auto level : {ESIMDLevel::kScalar, ESIMDLevel::kSSE41, ESIMDLevel::kAVX2}) {
+      if (static_cast<int>(level) > static_cast<int>(maxLevel)) {
+         EXPECT_THROW(ROOT::Experimental::Detail::SetSIMDLevel(level), RException);
+         continue;
+      }
+      ROOT::Experimental::Detail::SetSIMDLevel(level);
+      // Cover the vectorized blocks as well as the scalar tails
+      for (std::size_t count : {0, 1, 15, 16, 17, 31, 32, 33, 100, 1000, 4099}) {
+         CheckSplitBytes<2>(count);
+         CheckSplitBytes<4>(count);
+         CheckSplitBytes<8>(count);
+      }
+   }
+   ROOT::Experimental::Detail::SetSIMDLevel(maxLevel);
+}
+
+TEST(Packing, SplitSIMDLevels)
+{
+   for (std::size_t count : {1, 17, 33, 4099}) {
+      CheckSplitSIMDLevels<double, EColumnType::kSplitReal64>(count);
+      CheckSplitSIMDLevels<float, EColumnType::kSplitReal32>(count);
+      CheckSplitSIMDLevels<std::int16_t, EColumnType::kSplitInt16>(count);
+      CheckSplitSIMDLevels<std::int32_t, EColumnType::kSplitDeltaInt32>(count);
+   }
+}
+
+TEST(Packing, SplitIndex32)
+{
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32> element(
+      nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::array<ClusterSize_t, 5> mem{ClusterSize_t{0}, ClusterSize_t{1}, ClusterSize_t{1}, ClusterSize_t{300},
+                                    ClusterSize_t{0xffffffff}};
+   std::array<std::uint32_t, 5> packed;
+   std::array<ClusterSize_t, 5> cmp;
+
+   element.Pack(packed.data(), mem.data(), 5);
+   element.Unpack(cmp.data(), packed.data(), 5);
+
+   EXPECT_EQ(mem, cmp);
+}
+
+TEST(Packing, SplitDeltaInt64)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitDeltaInt64> element(
+      nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::array<std::int64_t, 6> mem{0, -1, 1, std::numeric_limits<std::int64_t>::max(),
+                                   std::numeric_limits<std::int64_t>::min(), 42};
+   std::array<std::int64_t, 6> packed;
+   std::array<std::int64_t, 6> cmp;
+
+   element.Pack(packed.data(), mem.data(), 6);
+   element.Unpack(cmp.data(), packed.data(), 6);
+
+   EXPECT_EQ(mem, cmp);
+
+   // Small differences result in zero bytes in the upper byte streams
+   std::array<std::int64_t, 4> slow{1000000, 1000001, 999999, 1000002};
+   std::array<unsigned char, 32> packedSlow;
+   element.Pack(packedSlow.data(), slow.data(), 4);
+   for (unsigned i = 4 * 3; i < 32; ++i)
+      EXPECT_EQ(0, packedSlow[i]);
+}
+
+TEST(Packing, BitPackedInt)
+{
+   using RColumnElementBase = ROOT::Experimental::Detail::RColumnElementBase;
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kBitPackedInt32> element(
+      nullptr);
+   EXPECT_EQ(9U, element.GetPackedSize(0));
+   EXPECT_EQ(9U + 4 * 100, element.GetPackedSize(100));
+   EXPECT_EQ(element.GetPackedSize(100),
+             RColumnElementBase::GetPackedSize(ROOT::Experimental::EColumnType::kBitPackedInt32, 100));
+
+   // Range of 7 fits in 3 bits
+   std::array<std::int32_t, 100> mem;
+   for (unsigned i = 0; i < mem.size(); ++i)
+      mem[i] = -3 + (i % 8);
+   std::vector<unsigned char> packed(element.GetPackedSize(mem.size()));
+   std::array<std::int32_t, 100> cmp;
+   element.Pack(packed.data(), mem.data(), mem.size());
+   EXPECT_EQ(3, packed[8]);
+   // The page ends after the header and the 300 bits of payload
+   EXPECT_EQ(9U, element.GetPackedHeaderSize());
+   EXPECT_EQ(9U + 38, element.GetPackedSizeFromHeader(packed.data(), mem.size()));
+   element.Unpack(cmp.data(), packed.data(), mem.size());
+   EXPECT_EQ(mem, cmp);
+
+   // Constant pages need no payload
+   mem.fill(137);
+   element.Pack(packed.data(), mem.data(), mem.size());
+   EXPECT_EQ(0, packed[8]);
+   EXPECT_EQ(9U, element.GetPackedSizeFromHeader(packed.data(), mem.size()));
+   cmp.fill(0);
+   element.Unpack(cmp.data(), packed.data(), mem.size());
+   EXPECT_EQ(mem, cmp);
+
+   // Full range
+   ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kBitPackedInt64>
+      element64(nullptr);
+   std::array<std::uint64_t, 5> mem64{0, 1, std::numeric_limits<std::uint64_t>::max(), 42, 1ULL << 63};
+   std::vector<unsigned char> packed64(element64.GetPackedSize(mem64.size()));
+   std::array<std::uint64_t, 5> cmp64;
+   element64.Pack(packed64.data(), mem64.data(), mem64.size());
+   EXPECT_EQ(64, packed64[8]);
+   EXPECT_EQ(packed64.size(), element64.GetPackedSizeFromHeader(packed64.data(), mem64.size()));
+   element64.Unpack(cmp64.data(), packed64.data(), mem64.size());
+   EXPECT_EQ(mem64, cmp64);
+
+   // Invalid bit widths are rejected before the page is decompressed
+   packed[8] = 33;
+   EXPECT_THROW(element.GetPackedSizeFromHeader(packed.data(), mem.size()), RException);
+}
+
+TEST(Packing, BitUnpackSIMDLevels)
+{
+   // Cover the vectorized groups of 8 values, the blocks of the 16bit and 64bit types, and the scalar tails
+   for (std::size_t count : {1, 7, 8, 9, 63, 64, 65, 257, 4099}) {
+      for (unsigned int width = 1; width <= 64; ++width) {
+         if (width <= 16)
+            CheckBitUnpackSIMDLevels<std::int16_t, EColumnType::kBitPackedInt16>(width, count);
+         if (width <= 32)
+            CheckBitUnpackSIMDLevels<std::int32_t, EColumnType::kBitPackedInt32>(width, count);
+         CheckBitUnpackSIMDLevels<std::int64_t, EColumnType::kBitPackedInt64>(width, count);
+      }
+   }
+}
+
+TEST(Packing, Real32Trunc)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32Trunc> element(nullptr);
+   EXPECT_THROW(element.SetPrecision(RColumnModel(EColumnType::kReal32Trunc, false, 9)),
+                ROOT::Experimental::RException);
+   element.SetPrecision(RColumnModel(EColumnType::kReal32Trunc, false, 16));
+   EXPECT_EQ(16U, element.GetBitsOnStorage());
+   EXPECT_EQ(200U, element.GetPackedSize(100));
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::array<float, 100> mem;
+   for (unsigned i = 0; i < mem.size(); ++i)
+      mem[i] = (i % 2 ? -1.0f : 1.0f) * (1.0f + i) * 1.37f;
+   mem[0] = 0.0f;
+   mem[1] = std::numeric_limits<float>::infinity();
+   // Exactly representable with 7 mantissa bits
+   mem[2] = 1.5f;
+   std::array<unsigned char, 200> packed;
+   std::array<float, 100> cmp;
+   element.Pack(packed.data(), mem.data(), mem.size());
+   element.Unpack(cmp.data(), packed.data(), mem.size());
+
+   EXPECT_EQ(0.0f, cmp[0]);
+   EXPECT_EQ(std::numeric_limits<float>::infinity(), cmp[1]);
+   EXPECT_EQ(1.5f, cmp[2]);
+   for (unsigned i = 3; i < mem.size(); ++i)
+      EXPECT_NEAR(mem[i], cmp[i], std::abs(mem[i]) / 128);
+
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32Trunc> element64(
+      nullptr);
+   element64.SetPrecision(RColumnModel(EColumnType::kReal32Trunc, false, 31));
+   std::array<double, 3> mem64{1.0, -3.0e10, 1.0 / 3.0};
+   std::array<unsigned char, 12> packed64;
+   std::array<double, 3> cmp64;
+   element64.Pack(packed64.data(), mem64.data(), mem64.size());
+   element64.Unpack(cmp64.data(), packed64.data(), mem64.size());
+   for (unsigned i = 0; i < mem64.size(); ++i)
+      EXPECT_FLOAT_EQ(mem64[i], cmp64[i]);
+}
+
+TEST(Packing, Real32Quant)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32Quant> element(nullptr);
+   EXPECT_THROW(element.SetPrecision(RColumnModel(EColumnType::kReal32Quant, false, 8, 1.0, 1.0)),
+                ROOT::Experimental::RException);
+   EXPECT_THROW(element.SetPrecision(RColumnModel(EColumnType::kReal32Quant, false, 33, 0.0, 1.0)),
+                ROOT::Experimental::RException);
+   element.SetPrecision(RColumnModel(EColumnType::kReal32Quant, false, 10, -1.0, 1.0));
+   EXPECT_EQ(125U, element.GetPackedSize(100));
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::array<float, 100> mem;
+   for (unsigned i = 0; i < mem.size(); ++i)
+      mem[i] = -1.0f + 0.02f * i;
+   // Out of range values are clamped
+   mem[0] = -5.0f;
+   mem[1] = 5.0f;
+   std::array<unsigned char, 125> packed;
+   std::array<float, 100> cmp;
+   element.Pack(packed.data(), mem.data(), mem.size());
+   element.Unpack(cmp.data(), packed.data(), mem.size());
+
+   EXPECT_FLOAT_EQ(-1.0f, cmp[0]);
+   EXPECT_FLOAT_EQ(1.0f, cmp[1]);
+   const float step = 2.0f / 1023;
+   for (unsigned i = 2; i < mem.size(); ++i)
+      EXPECT_NEAR(mem[i], cmp[i], step / 2 + 1e-6);
+
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32Quant> element64(
+      nullptr);
+   element64.SetPrecision(RColumnModel(EColumnType::kReal32Quant, false, 32, 0.0, 100.0));
+   std::array<double, 3> mem64{0.0, 100.0, 42.4242};
+   std::array<unsigned char, 12> packed64;
+   std::array<double, 3> cmp64;
+   element64.Pack(packed64.data(), mem64.data(), mem64.size());
+   element64.Unpack(cmp64.data(), packed64.data(), mem64.size());
+   for (unsigned i = 0; i < mem64.size(); ++i)
+      EXPECT_NEAR(mem64[i], cmp64[i], 1e-7);
+}
@@ -12,6 +12,94 @@ TEST(Pages, Allocation)
    allocator.DeletePage(page);
 }
 
+TEST(Pages, BufferAllocator)
+{
+   RPageBufferAllocator allocator("allocator", 1024 * 1024);
+   allocator.GetMetrics().Enable();
+   auto nHit = allocator.GetMetrics().GetCounter("allocator.nHit");
+   auto nMiss = allocator.GetMetrics().GetCounter("allocator.nMiss");
+   ASSERT_NE(nullptr, nHit);
+   ASSERT_NE(nullptr, nMiss);
+
+   auto buffer = allocator.Acquire(100);
+   EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(buffer) % alignof(std::max_align_t));
+   memset(buffer, 0xAB, 100);
+   allocator.Release(buffer);
+   EXPECT_EQ(128U, allocator.GetNBytesCached());
+
+   // Same size class
+   auto recycled = allocator.Acquire(128);
+   EXPECT_EQ(buffer, recycled);
+   EXPECT_EQ(0U, allocator.GetNBytesCached());
+   EXPECT_EQ(1, nHit->GetValueAsInt());
+   EXPECT_EQ(1, nMiss->GetValueAsInt());
+   // Different size class
+   auto other = allocator.Acquire(129);
+   EXPECT_NE(recycled, other);
+   EXPECT_EQ(2, nMiss->GetValueAsInt());
+   allocator.Release(recycled);
+   allocator.Release(other);
+   EXPECT_EQ(128U + 256U, allocator.GetNBytesCached());
+
+   {
+      auto page = allocator.NewPage(42, 4, 32);
+      EXPECT_FALSE(page.IsNull());
+      EXPECT_EQ(32U, page.GetMaxElements());
+      EXPECT_EQ(recycled, page.GetBuffer());
+      auto deleter = allocator.MakePageDeleter();
+      deleter(page);
+   }
+   EXPECT_EQ(2, nHit->GetValueAsInt());
+
+   // Buffers larger than half of the cache limit are not cached
+   auto large = allocator.Allocate(600 * 1024);
+   large.reset();
+   EXPECT_EQ(128U + 256U, allocator.GetNBytesCached());
+
+   // Released buffers exceeding the cache limit are freed
+   std::vector<RPageBufferAllocator::RBufferPtr> buffers;
+   for (int i = 0; i < 5; ++i)
+      buffers.emplace_back(allocator.Allocate(256 * 1024));
+   buffers.clear();
+   EXPECT_LE(allocator.GetNBytesCached(), allocator.GetMaxCachedBytes());
+   EXPECT_GE(allocator.GetNBytesCached(), 3U * 256U * 1024U);
+
+   allocator.Trim();
+   EXPECT_EQ(0U, allocator.GetNBytesCached());
+}
+
+TEST(Pages, BufferAllocatorSharedBudget)
+{
+   auto budget = std::make_shared<RPageBufferAllocator::RCacheBudget>(1024 * 1024);
+   RPageBufferAllocator allocator1("allocator1", budget);
+   RPageBufferAllocator allocator2("allocator2", budget);
+
+   std::vector<RPageBufferAllocator::RBufferPtr> buffers;
+   for (int i = 0; i < 3; ++i) {
+      buffers.emplace_back(allocator1.Allocate(256 * 1024));
+      buffers.emplace_back(allocator2.Allocate(256 * 1024));
+   }
+   buffers.clear();
+   // Together, both allocators stay within the shared limit
+   EXPECT_EQ(1024U * 1024U, budget->GetNBytesCached());
+   EXPECT_EQ(budget->GetNBytesCached(), allocator1.GetNBytesCached() + allocator2.GetNBytesCached());
+
+   allocator1.Trim();
+   EXPECT_EQ(allocator2.GetNBytesCached(), budget->GetNBytesCached());
+   // A recycled buffer gives its space back to the budget
+   auto recycled = allocator2.Allocate(256 * 1024);
+   EXPECT_EQ(allocator2.GetNBytesCached(), budget->GetNBytesCached());
+   recycled.reset();
+   allocator2.Trim();
+   EXPECT_EQ(0U, budget->GetNBytesCached());
+
+   // Default-constructed allocators share the process-wide budget
+   RPageBufferAllocator allocator3;
+   RPageBufferAllocator allocator4;
+   EXPECT_EQ(&allocator3.GetCacheBudget(), &allocator4.GetCacheBudget());
+   EXPECT_EQ(RPageBufferAllocator::kDefaultMaxCachedBytes, allocator3.GetMaxCachedBytes());
+}
+
 TEST(Pages, Pool)
 {
    RPagePool pool;
@@ -0,0 +1,177 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_basics.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->MakeField<std::vector<std::int32_t>>("ids");
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      auto fillContext = writer->CreateFillContext();
+      auto entry = fillContext->CreateEntry();
+      *entry->Get<float>("pt") = 1.0;
+      *entry->Get<std::vector<std::int32_t>>("ids") = {1, 2, 3};
+      fillContext->Fill(*entry);
+      fillContext->CommitCluster();
+      *entry->Get<float>("pt") = 2.0;
+      *entry->Get<std::vector<std::int32_t>>("ids") = {4};
+      fillContext->Fill(*entry);
+      EXPECT_EQ(2U, fillContext->GetNEntries());
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(2U, ntuple->GetNEntries());
+   EXPECT_EQ(2U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewIds = ntuple->GetView<std::vector<std::int32_t>>("ids");
+   EXPECT_FLOAT_EQ(1.0, viewPt(0));
+   EXPECT_EQ(std::vector<std::int32_t>({1, 2, 3}), viewIds(0));
+   EXPECT_FLOAT_EQ(2.0, viewPt(1));
+   EXPECT_EQ(std::vector<std::int32_t>({4}), viewIds(1));
+}
+
+TEST(RNTupleParallelWriter, Empty)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_empty.root");
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      auto fillContext = writer->CreateFillContext();
+   }
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(0U, ntuple->GetNEntries());
+}
+
+TEST(RNTupleParallelWriter, EntryMismatch)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_mismatch.root");
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+   auto fillContext = writer->CreateFillContext();
+   auto otherModel = RNTupleModel::Create();
+   otherModel->MakeField<float>("pt");
+   otherModel->Freeze();
+   auto entry = otherModel->CreateEntry();
+   EXPECT_THROW(fillContext->Fill(*entry), ROOT::Experimental::RException);
+}
+
+TEST(RNTupleParallelWriter, Concurrent)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_concurrent.root");
+
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 20000;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<std::int32_t>("thread");
+      model->MakeField<std::int32_t>("index");
+      model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(8 * 1024);
+      options.SetApproxUnzippedPageSize(1024);
+      options.SetEnablePageStatistics(true);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      writer->EnableMetrics();
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t] {
+            auto fillContext = writer->CreateFillContext();
+            auto entry = fillContext->CreateEntry();
+            auto thread = entry->Get<std::int32_t>("thread");
+            auto index = entry->Get<std::int32_t>("index");
+            auto tag = entry->Get<std::string>("tag");
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *thread = t;
+               *index = i;
+               *tag = std::to_string(t) + ":" + std::to_string(i);
+               fillContext->Fill(*entry);
+            }
+         });
+      }
+      for (auto &t : threads)
+         t.join();
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), ntuple->GetNEntries());
+   EXPECT_GT(ntuple->GetDescriptor()->GetNClusters(), static_cast<std::size_t>(kNThreads));
+
+   auto viewThread = ntuple->GetView<std::int32_t>("thread");
+   auto viewIndex = ntuple->GetView<std::int32_t>("index");
+   auto viewTag = ntuple->GetView<std::string>("tag");
+   // Entries of a single fill context keep their order, entries of different fill contexts are interleaved by cluster
+   std::vector<std::int32_t> nextIndex(kNThreads, 0);
+   for (auto i : ntuple->GetEntryRange()) {
+      auto t = viewThread(i);
+      ASSERT_GE(t, 0);
+      ASSERT_LT(t, kNThreads);
+      EXPECT_EQ(nextIndex[t], viewIndex(i));
+      EXPECT_EQ(std::to_string(t) + ":" + std::to_string(viewIndex(i)), viewTag(i));
+      nextIndex[t]++;
+   }
+   for (auto n : nextIndex)
+      EXPECT_EQ(kNEntriesPerThread, n);
+
+   // Page statistics are computed by the fill contexts and stored by the shared sink
+   const auto &desc = *ntuple->GetDescriptor();
+   const auto fieldId = desc.FindFieldId("index");
+   const auto columnId = desc.FindPhysicalColumnId(fieldId, 0);
+   for (const auto &cluster : desc.GetClusterIterable()) {
+      for (const auto &pageInfo : cluster.GetPageRange(columnId).fPageInfos) {
+         EXPECT_TRUE(pageInfo.fStatistics.HasRange());
+      }
+   }
+}
+
+TEST(RNTupleParallelWriter, Ordered)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_ordered.root");
+
+   constexpr int kNContexts = 4;
+   constexpr int kNEntriesPerContext = 5000;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<std::int32_t>("index");
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(4 * 1024);
+      options.SetApproxUnzippedPageSize(1024);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+
+      // Create the fill contexts in reverse order and fill them concurrently
+      std::vector<std::thread> threads;
+      for (int c = kNContexts - 1; c >= 0; --c) {
+         threads.emplace_back([&writer, c] {
+            auto fillContext = writer->CreateOrderedFillContext(c);
+            auto entry = fillContext->CreateEntry();
+            auto index = entry->Get<std::int32_t>("index");
+            for (int i = 0; i < kNEntriesPerContext; ++i) {
+               *index = c * kNEntriesPerContext + i;
+               fillContext->Fill(*entry);
+            }
+         });
+      }
+      for (auto &t : threads)
+         t.join();
+
+      // Fill contexts with given model
+      auto otherModel = RNTupleModel::Create();
+      auto otherIndex = otherModel->MakeField<std::int32_t>("index");
+      auto fillContext = writer->CreateOrderedFillContext(kNContexts, std::move(otherModel));
+      *otherIndex = kNContexts * kNEntriesPerContext;
+      fillContext->Fill();
+      EXPECT_THROW(writer->CreateFillContext(nullptr), ROOT::Experimental::RException);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(static_cast<NTupleSize_t>(kNContexts * kNEntriesPerContext + 1), ntuple->GetNEntries());
+   EXPECT_GT(ntuple->GetDescriptor()->GetNClusters(), static_cast<std::size_t>(kNContexts));
+   auto viewIndex = ntuple->GetView<std::int32_t>("index");
+   for (auto i : ntuple->GetEntryRange()) {
+      ASSERT_EQ(static_cast<std::int32_t>(i), viewIndex(i));
+   }
+}
@@ -1,5 +1,8 @@
 #include "ntuple_test.hxx"
 
+#include <limits>
+#include <set>
+
 TEST(RNTuple, RDF)
 {
    FileRaii fileGuard("test_ntuple_rdf.root");
@@ -48,3 +51,155 @@ TEST(RNTuple, RDF)
    EXPECT_EQ(2U, *rdf.Min("R_rdf_sizeof_jets"));
    EXPECT_EQ(3U, *rdf.Min("R_rdf_sizeof_klass.v1"));
 }
+
+TEST(RNTuple, RDFPushdown)
+{
+   FileRaii fileGuard("test_ntuple_rdf_pushdown.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrX = model->MakeField<std::int32_t>("x");
+      auto wrY = model->MakeField<float>("y");
+      auto wrTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      options.SetApproxUnzippedPageSize(200);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (std::int32_t i = 0; i < 1000; ++i) {
+         *wrX = i;
+         // The first cluster of y has no value range
+         *wrY = (i < 250) ? std::numeric_limits<float>::quiet_NaN() : static_cast<float>(i);
+         *wrTag = std::to_string(i);
+         ntuple->Fill();
+         if (i % 250 == 249)
+            ntuple->CommitCluster();
+      }
+   }
+
+   {
+      auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+      const auto &desc = *reader->GetDescriptor();
+      const auto xColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("x"), 0);
+      const auto yColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("y"), 0);
+      const auto tagColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("tag"), 0);
+      EXPECT_EQ(4u, desc.GetNClusters());
+      for (const auto &clusterDesc : desc.GetClusterIterable()) {
+         const auto firstEntry = clusterDesc.GetFirstEntryIndex();
+         const auto &xStatistics = clusterDesc.GetColumnRange(xColumnId).fStatistics;
+         EXPECT_EQ(static_cast<double>(firstEntry), xStatistics.fMin);
+         EXPECT_EQ(static_cast<double>(firstEntry + 249), xStatistics.fMax);
+         EXPECT_EQ(firstEntry > 0, clusterDesc.GetColumnRange(yColumnId).fStatistics.HasRange());
+         // Index columns carry no statistics
+         EXPECT_FALSE(clusterDesc.GetColumnRange(tagColumnId).fStatistics.HasRange());
+
+         const auto &pageInfos = clusterDesc.GetPageRange(xColumnId).fPageInfos;
+         EXPECT_GT(pageInfos.size(), 1u);
+         auto pageStart = firstEntry;
+         for (const auto &pageInfo : pageInfos) {
+            EXPECT_EQ(static_cast<double>(pageStart), pageInfo.fStatistics.fMin);
+            EXPECT_EQ(static_cast<double>(pageStart + pageInfo.fNElements - 1), pageInfo.fStatistics.fMax);
+            pageStart += pageInfo.fNElements;
+         }
+      }
+   }
+
+   {
+      RNTupleWriteOptions options;
+      options.SetEnablePageStatistics(false);
+      FileRaii fileGuardNoStats("test_ntuple_rdf_pushdown_nostats.root");
+      auto model = RNTupleModel::Create();
+      *model->MakeField<std::int32_t>("x") = 1;
+      RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuardNoStats.GetPath(), options)->Fill();
+      auto reader = RNTupleReader::Open("ntpl", fileGuardNoStats.GetPath());
+      const auto &desc = *reader->GetDescriptor();
+      const auto xColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("x"), 0);
+      EXPECT_FALSE(desc.GetClusterDescriptor(0).GetColumnRange(xColumnId).fStatistics.HasRange());
+   }
+
+   {
+      ROOT::Experimental::RNTupleDS ds(RPageSource::Create("ntpl", fileGuard.GetPath()));
+      ds.SetNSlots(2);
+      ds.SetColumnRangeHints({{"x", 600., 650.}, {"y", 0., 1000.}, {"tag", 0., 1.}});
+      ds.Initialize();
+      auto ranges = ds.GetEntryRanges();
+      ULong64_t nEntries = 0;
+      std::set<ULong64_t> entries;
+      for (const auto &r : ranges) {
+         EXPECT_LT(r.first, r.second);
+         nEntries += r.second - r.first;
+         for (auto i = r.first; i < r.second; ++i)
+            entries.insert(i);
+      }
+      EXPECT_EQ(nEntries, entries.size());
+      // Only parts of the third cluster are selected
+      EXPECT_LT(nEntries, 250u);
+      EXPECT_GE(*entries.begin(), 500u);
+      EXPECT_LT(*entries.rbegin(), 750u);
+      for (ULong64_t i = 600; i <= 650; ++i)
+         EXPECT_EQ(1u, entries.count(i));
+      EXPECT_TRUE(ds.GetEntryRanges().empty());
+      ds.Finalize();
+
+      ds.SetColumnRangeHints({{"x", 2000., 3000.}});
+      ds.Initialize();
+      EXPECT_TRUE(ds.GetEntryRanges().empty());
+      ds.Finalize();
+
+      ds.SetColumnRangeHints({});
+      ds.Initialize();
+      nEntries = 0;
+      for (const auto &r : ds.GetEntryRanges())
+         nEntries += r.second - r.first;
+      EXPECT_EQ(1000u, nEntries);
+      ds.Finalize();
+   }
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(51u, *df.Filter("x >= 600 && (650 >= x)").Count());
+   EXPECT_EQ(99u, *df.Filter("y > 900").Count());
+   EXPECT_EQ(0u, *df.Filter("x < -1").Count());
+   EXPECT_EQ(1u, *df.Filter("x > 10 && tag == \"3\" || x == 5").Count());
+   // Literals that overflow double or float yield no hint but must not prevent booking the filter
+   EXPECT_EQ(1000u, *df.Filter("x < 1e400").Count());
+   EXPECT_EQ(1000u, *df.Filter("x < 1e39f").Count());
+
+   // Nodes that do not hang from the filter disable the pushdown
+   auto cFiltered = df.Filter("x < 10").Count();
+   auto cAll = df.Count();
+   EXPECT_EQ(10u, *cFiltered);
+   EXPECT_EQ(1000u, *cAll);
+
+   auto named = df.Filter("x < 10", "cut");
+   auto cNamed = named.Count();
+   auto report = named.Report();
+   EXPECT_EQ(10u, *cNamed);
+   EXPECT_EQ(1000u, report->At("cut").GetAll());
+}
+
+TEST(RNTuple, RDFBulkRead)
+{
+   FileRaii fileGuard("test_ntuple_rdf_bulk_read.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrX = model->MakeField<std::int64_t>("x");
+      auto wrTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(1000);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (std::int64_t i = 0; i < 10000; ++i) {
+         *wrX = i;
+         *wrTag = std::to_string(i);
+         ntuple->Fill();
+         if (i % 3000 == 2999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntpl", fileGuard.GetPath());
+   // Simple columns are read in blocks spanning at most one page
+   EXPECT_EQ(49995000, *df.Sum<std::int64_t>("x"));
+   auto nMatch = df.Filter([](std::int64_t x, const std::string &tag) { return std::to_string(x) == tag; },
+                           {"x", "tag"})
+                    .Count();
+   EXPECT_EQ(10000u, *nMatch);
+   EXPECT_EQ(5099, *df.Filter("x >= 5000 && x < 5100").Max<std::int64_t>("x"));
+}
@@ -529,6 +529,38 @@ TEST(RNTuple, SerializeHeader)
 }
 
 
+TEST(RNTuple, SerializeColumnPrecision)
+{
+   RNTupleDescriptorBuilder builder;
+   builder.SetNTuple("ntpl", "");
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(0).FieldName("").Structure(ENTupleStructure::kRecord).MakeDescriptor().Unwrap());
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(1).FieldName("pt").Structure(ENTupleStructure::kLeaf).MakeDescriptor().Unwrap());
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(2).FieldName("eta").Structure(ENTupleStructure::kLeaf).MakeDescriptor().Unwrap());
+   builder.AddFieldLink(0, 1);
+   builder.AddFieldLink(0, 2);
+   builder.AddColumn(0, 0, 1, RColumnModel(EColumnType::kReal32Trunc, false, 16), 0);
+   builder.AddColumn(1, 1, 2, RColumnModel(EColumnType::kReal32Quant, false, 12, -2.5, 2.5), 0);
+
+   auto desc = builder.MoveDescriptor();
+   auto context = RNTupleSerializer::SerializeHeaderV1(nullptr, desc);
+   auto buffer = std::make_unique<unsigned char[]>(context.GetHeaderSize());
+   context = RNTupleSerializer::SerializeHeaderV1(buffer.get(), desc);
+
+   RNTupleSerializer::DeserializeHeaderV1(buffer.get(), context.GetHeaderSize(), builder);
+   desc = builder.MoveDescriptor();
+
+   const auto &ptColumn = desc.GetColumnDescriptor(desc.FindLogicalColumnId(desc.FindFieldId("pt"), 0));
+   EXPECT_EQ(EColumnType::kReal32Trunc, ptColumn.GetModel().GetType());
+   EXPECT_EQ(16U, ptColumn.GetModel().GetBitsOnStorage());
+   EXPECT_FALSE(ptColumn.GetModel().HasValueRange());
+
+   const auto &etaColumn = desc.GetColumnDescriptor(desc.FindLogicalColumnId(desc.FindFieldId("eta"), 0));
+   EXPECT_EQ(RColumnModel(EColumnType::kReal32Quant, false, 12, -2.5, 2.5), etaColumn.GetModel());
+}
+
 TEST(RNTuple, SerializeFooter)
 {
    RNTupleDescriptorBuilder builder;
@@ -623,3 +655,81 @@ TEST(RNTuple, SerializeFooter)
    EXPECT_EQ(100u, pageRange.fPageInfos[0].fNElements);
    EXPECT_EQ(7000u, pageRange.fPageInfos[0].fLocator.GetPosition<std::uint64_t>());
 }
+
+TEST(RNTuple, SerializePageStatistics)
+{
+   RNTupleDescriptorBuilder builder;
+   builder.SetNTuple("ntpl", "");
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(0).FieldName("").Structure(ENTupleStructure::kRecord).MakeDescriptor().Unwrap());
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(1).FieldName("pt").Structure(ENTupleStructure::kLeaf).MakeDescriptor().Unwrap());
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(2).FieldName("eta").Structure(ENTupleStructure::kLeaf).MakeDescriptor().Unwrap());
+   builder.AddFieldLink(0, 1);
+   builder.AddFieldLink(0, 2);
+   builder.AddColumn(0, 0, 1, RColumnModel(EColumnType::kReal64, false), 0);
+   builder.AddColumn(1, 1, 2, RColumnModel(EColumnType::kReal64, false), 0);
+
+   RClusterDescriptorBuilder clusterBuilder(0, 0, 100);
+   for (DescriptorId_t columnId = 0; columnId < 2; ++columnId) {
+      ROOT::Experimental::RClusterDescriptor::RPageRange pageRange;
+      pageRange.fPhysicalColumnId = columnId;
+      for (unsigned i = 0; i < 2; ++i) {
+         ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+         pageInfo.fNElements = 50;
+         pageInfo.fLocator.fPosition = 1000U * columnId + 100U * i;
+         // Only the first page of the second column has no value range, e.g. because all its values are NaN
+         if (columnId == 0 || i == 1) {
+            pageInfo.fStatistics.fMin = -1.0 - i;
+            pageInfo.fStatistics.fMax = 2.0 + i;
+         }
+         pageRange.fPageInfos.emplace_back(pageInfo);
+      }
+      clusterBuilder.CommitColumnRange(columnId, 0, 100, pageRange);
+   }
+   builder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
+   RClusterGroupDescriptorBuilder cgBuilder;
+   cgBuilder.ClusterGroupId(0).PageListLength(0).PageListLocator(RNTupleLocator());
+   cgBuilder.AddCluster(0);
+   builder.AddClusterGroup(std::move(cgBuilder));
+
+   auto desc = builder.MoveDescriptor();
+   const auto columnRange = desc.GetClusterDescriptor(0).GetColumnRange(0);
+   EXPECT_TRUE(columnRange.fStatistics.HasRange());
+   EXPECT_DOUBLE_EQ(-2.0, columnRange.fStatistics.fMin);
+   EXPECT_DOUBLE_EQ(3.0, columnRange.fStatistics.fMax);
+   EXPECT_FALSE(desc.GetClusterDescriptor(0).GetColumnRange(1).fStatistics.HasRange());
+
+   auto context = RNTupleSerializer::SerializeHeaderV1(nullptr, desc);
+   auto bufHeader = std::make_unique<unsigned char[]>(context.GetHeaderSize());
+   context = RNTupleSerializer::SerializeHeaderV1(bufHeader.get(), desc);
+   std::vector<DescriptorId_t> physClusterIDs{context.MapClusterId(0)};
+   context.MapClusterGroupId(0);
+
+   auto sizePageList = RNTupleSerializer::SerializePageListV1(nullptr, desc, physClusterIDs, context);
+   auto bufPageList = std::make_unique<unsigned char[]>(sizePageList);
+   EXPECT_EQ(sizePageList, RNTupleSerializer::SerializePageListV1(bufPageList.get(), desc, physClusterIDs, context));
+   auto sizeFooter = RNTupleSerializer::SerializeFooterV1(nullptr, desc, context);
+   auto bufFooter = std::make_unique<unsigned char[]>(sizeFooter);
+   RNTupleSerializer::SerializeFooterV1(bufFooter.get(), desc, context);
+
+   RNTupleSerializer::DeserializeHeaderV1(bufHeader.get(), context.GetHeaderSize(), builder);
+   RNTupleSerializer::DeserializeFooterV1(bufFooter.get(), sizeFooter, builder);
+   desc = builder.MoveDescriptor();
+   std::vector<RClusterDescriptorBuilder> clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(desc, 0);
+   RNTupleSerializer::DeserializePageListV1(bufPageList.get(), sizePageList, clusters).ThrowOnError();
+   desc.AddClusterDetails(clusters[0].MoveDescriptor().Unwrap());
+
+   const auto &clusterDesc = desc.GetClusterDescriptor(0);
+   EXPECT_EQ(columnRange, clusterDesc.GetColumnRange(0));
+   EXPECT_FALSE(clusterDesc.GetColumnRange(1).fStatistics.HasRange());
+   const auto &pageInfos = clusterDesc.GetPageRange(1).fPageInfos;
+   ASSERT_EQ(2u, pageInfos.size());
+   EXPECT_FALSE(pageInfos[0].fStatistics.HasRange());
+   EXPECT_TRUE(pageInfos[0].fStatistics.MayOverlap(100.0, 200.0));
+   EXPECT_DOUBLE_EQ(-2.0, pageInfos[1].fStatistics.fMin);
+   EXPECT_DOUBLE_EQ(3.0, pageInfos[1].fStatistics.fMax);
+   EXPECT_FALSE(pageInfos[1].fStatistics.MayOverlap(3.5, 4.0));
+   EXPECT_TRUE(pageInfos[1].fStatistics.MayOverlap(3.0, 4.0));
+}
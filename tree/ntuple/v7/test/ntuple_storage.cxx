@@ -268,6 +268,33 @@ TEST(RNTuple, PageFillingString) {
    EXPECT_EQ(8u, pr4.fPageInfos[1].fNElements);
 }
 
+TEST(RNTuple, PageFillingStringShadowPage)
+{
+   FileRaii fileGuard("test_ntuple_page_filling_string_shadow.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldX = model->MakeField<std::string>("x");
+
+   RNTupleWriteOptions options;
+   options.SetApproxUnzippedPageSize(16);
+
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      // The second page starts with the last 2 characters of the third string. The fourth string is appended in bulk
+      // from 2 to 8 characters, which crosses the 50% fill level and must flush the full shadow page; otherwise the
+      // next swap of the write pages finds the shadow page still in use.
+      *fldX = "abcdef";
+      for (int i = 0; i < 10; ++i)
+         ntuple->Fill();
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   auto viewX = ntuple->GetView<std::string>("x");
+   ASSERT_EQ(10u, ntuple->GetNEntries());
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_EQ("abcdef", viewX(i));
+}
+
 TEST(RPageSinkBuf, Basics)
 {
    struct TestModel {
@@ -456,6 +483,43 @@ TEST(RPageSinkBuf, CommitSealedPageV)
    }
 }
 
+TEST(RPageSinkBuf, Pipeline)
+{
+   RNTupleWriteOptions options;
+   options.SetApproxUnzippedPageSize(8);
+   options.SetApproxZippedClusterSize(8);
+   options.SetMaxUnzippedClusterSize(64);
+
+   ROOT::EnableImplicitMT();
+   std::unique_ptr<RPageSink> sink(new RPageSinkMock(options));
+   auto &counters = static_cast<RPageSinkMock *>(sink.get())->fCounters;
+
+   auto model = RNTupleModel::Create();
+   auto u32Field = model->MakeField<std::uint32_t>("u32");
+   auto ntuple = std::make_unique<RNTupleWriter>(std::move(model), std::make_unique<RPageSinkBuf>(std::move(sink)));
+   ntuple->Fill();
+   ntuple->Fill();
+   ntuple->CommitCluster();
+   // The first cluster is written synchronously
+   EXPECT_EQ(1, counters.fNCommitSealedPageV);
+
+   for (int i = 0; i < 8; ++i)
+      ntuple->Fill();
+   ntuple->CommitCluster();
+   // The second cluster is written once its pages are sealed, at the latest on the next cluster commit
+   EXPECT_EQ(1, counters.fNCommitSealedPageV);
+
+   // Buffering another 48 bytes exceeds the maximum uncompressed cluster size of 64 bytes together with the
+   // 32 bytes of the pending cluster
+   for (int i = 0; i < 12; ++i)
+      ntuple->Fill();
+   EXPECT_EQ(2, counters.fNCommitSealedPageV);
+   ntuple->CommitCluster(true /* commitClusterGroup */);
+   EXPECT_EQ(3, counters.fNCommitSealedPageV);
+   EXPECT_EQ(0, counters.fNCommitPage);
+   EXPECT_EQ(0, counters.fNCommitSealedPage);
+}
+
 TEST(RPageSink, Empty)
 {
    FileRaii fileGuard("test_ntuple_empty.ntuple");
@@ -507,3 +571,119 @@ TEST(RPageSink, MultipleClusterGroups)
    ntuple->LoadEntry(2);
    EXPECT_EQ(12.0, *rdPt);
 }
+
+TEST(RPageSourceFile, MemoryMap)
+{
+   FileRaii fileGuard("test_ntuple_memory_map.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = std::make_unique<RField<float>>("pt");
+      fieldPt->SetColumnRepresentative({EColumnType::kReal32});
+      model->AddField(std::move(fieldPt));
+      auto wrPt = model->GetDefaultEntry()->Get<float>("pt");
+      auto wrId = model->MakeField<std::int64_t>("id");
+      auto wrTag = model->MakeField<std::string>("tag");
+      auto wrFlag = model->MakeField<bool>("flag");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *wrPt = 0.5 * i;
+         *wrId = -i;
+         *wrTag = std::to_string(i);
+         *wrFlag = (i % 3) == 0;
+         ntuple->Fill();
+         if (i == 499)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetUseMemoryMap(true);
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewId = ntuple->GetView<std::int64_t>("id");
+      auto viewTag = ntuple->GetView<std::string>("tag");
+      auto viewFlag = ntuple->GetView<bool>("flag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_FLOAT_EQ(0.5 * i, viewPt(i));
+         EXPECT_EQ(-static_cast<std::int64_t>(i), viewId(i));
+         EXPECT_EQ(std::to_string(i), viewTag(i));
+         EXPECT_EQ((i % 3) == 0, viewFlag(i));
+      }
+
+      auto nPageMapped = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageMapped");
+      ASSERT_NE(nullptr, nPageMapped);
+#if R__LITTLE_ENDIAN == 1
+      // The pages of pt and of the characters of tag are used in place; bit-packed and split columns are unpacked
+      // into a separate buffer
+      EXPECT_GT(nPageMapped->GetValueAsInt(), 0);
+#else
+      EXPECT_EQ(0, nPageMapped->GetValueAsInt());
+#endif
+   }
+
+   // Compressed pages are decompressed from the mapping
+   FileRaii fileGuardZip("test_ntuple_memory_map_zip.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuardZip.GetPath());
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+      }
+   }
+   RNTupleReadOptions options;
+   options.SetUseMemoryMap(true);
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuardZip.GetPath(), options);
+   ntuple->EnableMetrics();
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+   EXPECT_EQ(0, ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageMapped")->GetValueAsInt());
+}
+
+TEST(RPageStorageFile, BufferRecycling)
+{
+   FileRaii fileGuard("test_ntuple_buffer_recycling.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      for (int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+      auto nHit = ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.RPageSinkFile.RPageBufferAllocator.nHit");
+      ASSERT_NE(nullptr, nHit);
+      EXPECT_GT(nHit->GetValueAsInt(), 0);
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewPt = ntuple->GetView<float>("pt");
+      for (auto i : ntuple->GetEntryRange())
+         EXPECT_FLOAT_EQ(i, viewPt(i));
+
+      auto nHit = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.RPageBufferAllocator.nHit");
+      auto nMiss = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.RPageBufferAllocator.nMiss");
+      ASSERT_NE(nullptr, nHit);
+      ASSERT_NE(nullptr, nMiss);
+      // Pages of previous clusters are released once the view moves on, their buffers are handed out again
+      EXPECT_GT(nHit->GetValueAsInt(), 0);
+      EXPECT_GT(nMiss->GetValueAsInt(), 0);
+   }
+}
@@ -376,6 +376,183 @@ TEST(RNTuple, Int16)
              *reader->GetModel()->GetDefaultEntry()->Get<std::uint16_t>("i4"));
 }
 
+TEST(RNTuple, IntegerEncodings)
+{
+   FileRaii fileGuard("test_ntuple_integer_encodings.root");
+
+   auto model = RNTupleModel::Create();
+
+   auto f1 = std::make_unique<RField<std::int32_t>>("delta");
+   f1->SetColumnRepresentative({ROOT::Experimental::EColumnType::kSplitDeltaInt32});
+   model->AddField(std::move(f1));
+
+   auto f2 = std::make_unique<RField<std::int64_t>>("bitpacked64");
+   f2->SetColumnRepresentative({ROOT::Experimental::EColumnType::kBitPackedInt64});
+   model->AddField(std::move(f2));
+
+   auto f3 = std::make_unique<RField<std::uint16_t>>("bitpacked16");
+   f3->SetColumnRepresentative({ROOT::Experimental::EColumnType::kBitPackedInt16});
+   model->AddField(std::move(f3));
+
+   auto f4 = std::make_unique<RField<std::vector<float>>>("vec");
+   f4->SetColumnRepresentative({ROOT::Experimental::EColumnType::kSplitIndex32});
+   model->AddField(std::move(f4));
+
+   {
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      auto e = writer->CreateEntry();
+      for (int i = 0; i < 100; ++i) {
+         *e->Get<std::int32_t>("delta") = (i % 2) ? -i : i;
+         *e->Get<std::int64_t>("bitpacked64") = std::numeric_limits<std::int64_t>::max() - i;
+         *e->Get<std::uint16_t>("bitpacked16") = i % 5;
+         e->Get<std::vector<float>>("vec")->resize(i % 3);
+         writer->Fill(*e);
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto *desc = reader->GetDescriptor();
+   EXPECT_EQ(ROOT::Experimental::EColumnType::kSplitDeltaInt32,
+             (*desc->GetColumnIterable(desc->FindFieldId("delta")).begin()).GetModel().GetType());
+   EXPECT_EQ(ROOT::Experimental::EColumnType::kBitPackedInt64,
+             (*desc->GetColumnIterable(desc->FindFieldId("bitpacked64")).begin()).GetModel().GetType());
+   EXPECT_EQ(ROOT::Experimental::EColumnType::kBitPackedInt16,
+             (*desc->GetColumnIterable(desc->FindFieldId("bitpacked16")).begin()).GetModel().GetType());
+   EXPECT_EQ(ROOT::Experimental::EColumnType::kSplitIndex32,
+             (*desc->GetColumnIterable(desc->FindFieldId("vec")).begin()).GetModel().GetType());
+
+   auto viewDelta = reader->GetView<std::int32_t>("delta");
+   auto viewBitPacked64 = reader->GetView<std::int64_t>("bitpacked64");
+   auto viewBitPacked16 = reader->GetView<std::uint16_t>("bitpacked16");
+   auto viewVec = reader->GetView<std::vector<float>>("vec");
+   for (int i = 0; i < 100; ++i) {
+      EXPECT_EQ((i % 2) ? -i : i, viewDelta(i));
+      EXPECT_EQ(std::numeric_limits<std::int64_t>::max() - i, viewBitPacked64(i));
+      EXPECT_EQ(i % 5, viewBitPacked16(i));
+      EXPECT_EQ(static_cast<std::size_t>(i % 3), viewVec(i).size());
+   }
+}
+
+TEST(RNTuple, ReducedPrecisionReal)
+{
+   FileRaii fileGuard("test_ntuple_reduced_precision_real.root");
+
+   auto model = RNTupleModel::Create();
+   auto pt = model->MakeField<float>("pt");
+   auto energy = model->MakeField<double>("energy");
+   auto eta = model->MakeField<float>("eta");
+   auto phi = model->MakeField<std::vector<double>>("phi");
+   model->SetFieldTruncated("pt", 16);
+   model->SetFieldTruncated("energy", 24);
+   model->SetFieldQuantized("eta", -5.0, 5.0, 12);
+   model->SetFieldQuantized("phi._0", -3.2, 3.2, 20);
+   EXPECT_THROW(model->SetFieldTruncated("phi", 16), RException);
+   EXPECT_THROW(model->SetFieldTruncated("pt", 8), RException);
+   EXPECT_THROW(model->SetFieldQuantized("eta", 1.0, -1.0, 8), RException);
+   EXPECT_THROW(model->SetFieldQuantized("nonexistent", -1.0, 1.0, 8), RException);
+
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 100; ++i) {
+         *pt = 1.0f + i * 0.37f;
+         *energy = 1000.0 + i * 13.7;
+         *eta = -5.0f + 0.1f * i;
+         *phi = {-3.2 + 0.064 * i, 0.0};
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto *desc = reader->GetDescriptor();
+   const auto ptModel = (*desc->GetColumnIterable(desc->FindFieldId("pt")).begin()).GetModel();
+   EXPECT_EQ(EColumnType::kReal32Trunc, ptModel.GetType());
+   EXPECT_EQ(16U, ptModel.GetBitsOnStorage());
+   const auto etaModel = (*desc->GetColumnIterable(desc->FindFieldId("eta")).begin()).GetModel();
+   EXPECT_EQ(RColumnModel(EColumnType::kReal32Quant, false, 12, -5.0, 5.0), etaModel);
+
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewEnergy = reader->GetView<double>("energy");
+   auto viewEta = reader->GetView<float>("eta");
+   auto viewPhi = reader->GetView<std::vector<double>>("phi");
+   for (int i = 0; i < 100; ++i) {
+      // 7 and 15 mantissa bits, respectively
+      EXPECT_NEAR(1.0f + i * 0.37f, viewPt(i), (1.0f + i * 0.37f) / 256);
+      EXPECT_NEAR(1000.0 + i * 13.7, viewEnergy(i), (1000.0 + i * 13.7) / 65536);
+      EXPECT_NEAR(-5.0f + 0.1f * i, viewEta(i), 10.0 / 4095);
+      ASSERT_EQ(2U, viewPhi(i).size());
+      EXPECT_NEAR(-3.2 + 0.064 * i, viewPhi(i)[0], 6.4 / ((1 << 20) - 1));
+   }
+}
+
+TEST(RNTuple, StringDictionary)
+{
+   FileRaii fileGuard("test_ntuple_string_dictionary.root");
+
+   const std::vector<std::string> tags{"HLT_Mu20", "HLT_Ele32", "", "HLT_PFJet500"};
+   auto model = RNTupleModel::Create();
+   auto tag = model->MakeField<std::string>("tag");
+   auto plain = model->MakeField<std::string>("plain");
+   auto tagList = model->MakeField<std::vector<std::string>>("tagList");
+   model->SetFieldDictionaryEncoded("tag");
+   model->SetFieldDictionaryEncoded("tagList._0");
+   EXPECT_THROW(model->SetFieldDictionaryEncoded("tagList"), RException);
+
+   {
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *tag = tags[i % 4];
+         *plain = tags[i % 4];
+         *tagList = {tags[i % 3], tags[(i + 1) % 4]};
+         writer->Fill();
+         if (i == 499)
+            writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto *desc = reader->GetDescriptor();
+   std::vector<EColumnType> columnTypes;
+   for (const auto &c : desc->GetColumnIterable(desc->FindFieldId("tag")))
+      columnTypes.emplace_back(c.GetModel().GetType());
+   EXPECT_EQ(std::vector<EColumnType>({EColumnType::kBitPackedInt32, EColumnType::kSplitIndex32, EColumnType::kChar}),
+             columnTypes);
+   // Only the distinct strings of every cluster are stored
+   const auto dictionaryColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("tag"), 2);
+   EXPECT_EQ(2 * (8 + 9 + 12U), desc->GetNElements(dictionaryColumnId));
+
+   auto viewTag = reader->GetView<std::string>("tag");
+   auto viewPlain = reader->GetView<std::string>("plain");
+   auto viewTagList = reader->GetView<std::vector<std::string>>("tagList");
+   for (int i = 0; i < 1000; ++i) {
+      EXPECT_EQ(tags[i % 4], viewTag(i));
+      EXPECT_EQ(tags[i % 4], viewPlain(i));
+      EXPECT_EQ(std::vector<std::string>({tags[i % 3], tags[(i + 1) % 4]}), viewTagList(i));
+   }
+   // Random access across clusters
+   EXPECT_EQ(tags[3], viewTag(999));
+   EXPECT_EQ(tags[1], viewTag(1));
+   EXPECT_EQ(tags[2], viewTag(502));
+
+   // Compare on the dictionary id within a cluster
+   for (NTupleSize_t firstEntry : {0, 500}) {
+      const auto muId = viewTag.FindDictionaryId(firstEntry, "HLT_Mu20");
+      ASSERT_NE(RField<std::string>::kInvalidDictionaryId, muId);
+      EXPECT_EQ(RField<std::string>::kInvalidDictionaryId, viewTag.FindDictionaryId(firstEntry, "HLT_IsoMu24"));
+      for (NTupleSize_t i = firstEntry; i < firstEntry + 500; ++i)
+         EXPECT_EQ(i % 4 == 0, viewTag.GetDictionaryId(i) == muId);
+   }
+   // Every distinct string maps to the id of its entries, also when switching back and forth between clusters
+   for (NTupleSize_t firstEntry : {500, 0, 500}) {
+      for (int i = 0; i < 4; ++i)
+         EXPECT_EQ(viewTag.GetDictionaryId(firstEntry + i), viewTag.FindDictionaryId(firstEntry + i, tags[i]));
+   }
+   EXPECT_THROW(viewPlain.GetDictionaryId(0), RException);
+}
+
 TEST(RNTuple, Char)
 {
    auto charField = RField<char>("myChar");
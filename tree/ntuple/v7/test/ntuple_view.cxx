@@ -132,6 +132,97 @@ TEST(RNTuple, BulkViewCollection)
    }
 }
 
+TEST(RNTuple, BulkRead)
+{
+   FileRaii fileGuard("test_ntuple_bulk_read.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldTag = model->MakeField<std::string>("tag");
+   auto eltsPerPage = 1000;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(eltsPerPage * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldPt = i;
+         *fieldTag = std::to_string(i);
+         ntuple->Fill();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+
+   // Spans several pages
+   auto viewPt = ntuple->GetView<float>("pt");
+   std::vector<float> pts(3000);
+   viewPt.ReadBulk(5, pts.size(), pts.data());
+   for (std::size_t i = 0; i < pts.size(); ++i) {
+      ASSERT_EQ(static_cast<float>(i + 5), pts[i]) << i;
+   }
+   viewPt.ReadBulk(RClusterIndex(0, 9990), 10, pts.data());
+   for (std::size_t i = 0; i < 10; ++i) {
+      EXPECT_EQ(static_cast<float>(i + 9990), pts[i]) << i;
+   }
+
+   // Not mappable
+   auto viewTag = ntuple->GetView<std::string>("tag");
+   std::vector<std::string> tags(20);
+   viewTag.ReadBulk(990, tags.size(), tags.data());
+   for (std::size_t i = 0; i < tags.size(); ++i) {
+      EXPECT_EQ(std::to_string(i + 990), tags[i]);
+   }
+}
+
+TEST(RNTuple, BulkReadCollection)
+{
+   FileRaii fileGuard("test_ntuple_bulk_read_collection.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldVec = model->MakeField<std::vector<double>>("vec");
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(4096);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldVec = std::vector<double>(i % 5, i);
+         ntuple->Fill();
+         if (i % 1000 == 999)
+            ntuple->CommitCluster();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewVec = ntuple->GetViewCollection("vec");
+   auto viewItems = viewVec.GetView<double>("_0");
+
+   constexpr std::size_t kBulkSize = 512;
+   std::vector<ClusterSize_t> offsets(kBulkSize + 1);
+   std::vector<double> items;
+   RClusterIndex itemStart;
+
+   // Reading stops at the cluster boundary
+   EXPECT_EQ(100U, viewVec.ReadBulkOffsets(900, kBulkSize, offsets.data(), itemStart));
+   EXPECT_EQ(0U, viewVec.ReadBulkOffsets(0, 0, offsets.data(), itemStart));
+
+   NTupleSize_t nEntries = 0;
+   while (nEntries < ntuple->GetNEntries()) {
+      const auto count = std::min<NTupleSize_t>(kBulkSize, ntuple->GetNEntries() - nEntries);
+      const auto nRead = viewVec.ReadBulkOffsets(nEntries, count, offsets.data(), itemStart);
+      ASSERT_GT(nRead, 0U);
+      ASSERT_LE(nRead, count);
+      items.resize(offsets[nRead]);
+      viewItems.ReadBulk(itemStart, items.size(), items.data());
+      for (std::size_t i = 0; i < nRead; ++i) {
+         const auto entry = nEntries + i;
+         ASSERT_EQ(entry % 5, offsets[i + 1] - offsets[i]) << entry;
+         for (std::size_t j = offsets[i]; j < offsets[i + 1]; ++j) {
+            ASSERT_EQ(static_cast<double>(entry), items[j]) << entry;
+         }
+      }
+      nEntries += nRead;
+   }
+   EXPECT_EQ(10'000U, nEntries);
+}
+
 TEST(RNTuple, Composable)
 {
    FileRaii fileGuard("test_ntuple_composable.root");
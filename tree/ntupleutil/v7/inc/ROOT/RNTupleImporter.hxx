@@ -30,8 +30,10 @@
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
+class TChain;
 class TLeaf;
 
 namespace ROOT {
@@ -58,6 +60,21 @@ The output file is created if it does not exist, otherwise the ntuple is added t
 Note that input file and output file can be identical if the ntuple is stored under a different name than the tree
 (use `SetNTupleName()`).
 
+All the trees of a TChain can be imported into a single RNTuple:
+
+~~~ {.cpp}
+TChain chain("TreeName");
+chain.Add("data_*.root");
+auto importer = RNTupleImporter::Create(&chain, "output.root").Unwrap();
+importer->Import().ThrowOnError();
+~~~
+
+With `SetIsParallel(true)` and implicit multi-threading enabled, Import() reads and transforms ranges of input clusters
+concurrently on the IMT pool.  Every range becomes one cluster of the RNTuple.  The clusters are appended in input
+order, so the order of entries is the same as in the sequential import.  A range is started at most twice the number of
+IMT threads ranges after the oldest range that is not yet finished, which bounds the number of clusters that wait in
+memory for their predecessors.  If a range fails, the remaining ranges are skipped and Import() returns the error.
+
 By default, the RNTuple is compressed with zstd, independent of the input compression. The compression settings
 (and other output parameters) can be changed by `SetWriteOptions()`.
 
@@ -203,10 +220,22 @@ private:
       void ResetEntry() final { fNum = 0; }
    };
 
+   /// In parallel mode, a range of consecutive entries of one of the input files that is imported by a single task
+   struct RImportChunk {
+      std::size_t fFileIndex = 0; ///< Index into fSourceFileNames
+      Long64_t fFirstEntry = 0;   ///< First entry of the range in the tree of the input file
+      Long64_t fEndEntry = 0;     ///< One past the last entry of the range
+   };
+
    RNTupleImporter() = default;
 
    std::unique_ptr<TFile> fSourceFile;
    std::unique_ptr<TTree> fSourceTree;
+   /// The input files; a single one unless a TChain is imported.  Used by the parallel import to open the input per task
+   std::vector<std::string> fSourceFileNames;
+   /// The name of the tree in each of fSourceFileNames; chain elements can name a tree other than the chain's
+   std::vector<std::string> fSourceTreeNames;
+   std::string fSourceTreeName;
 
    std::string fDestFileName;
    std::string fNTupleName;
@@ -215,6 +244,8 @@ private:
 
    /// No standard output, conversely if set to false, schema information and progress is printed
    bool fIsQuiet = false;
+   /// Whether Import() uses the IMT pool, provided that implicit multi-threading is enabled
+   bool fIsParallel = false;
    std::unique_ptr<RProgressCallback> fProgressCallback;
 
    std::vector<RImportBranch> fImportBranches;
@@ -226,11 +257,20 @@ private:
    std::unique_ptr<RNTupleModel> fModel;
    std::unique_ptr<REntry> fEntry;
 
+   /// Opens the output file for writing (update) and sets the default write options
+   RResult<void> InitDestination(std::string_view destFile);
    void ResetSchema();
    /// Sets up the connection from TTree branches to RNTuple fields, including initialization of the memory
    /// buffers used for reading and writing.
    RResult<void> PrepareSchema();
    void ReportSchema();
+   /// Moves the data of the current input entry into the memory locations of the output entry.  The input entry has
+   /// been read by `fSourceTree->GetEntry()`.
+   RResult<void> TransformEntry();
+   /// Splits the input into ranges of input clusters of approximately the size of an output cluster
+   RResult<std::vector<RImportChunk>> GetImportChunks();
+   RResult<void> ImportSequential();
+   RResult<void> ImportParallel();
 
 public:
    RNTupleImporter(const RNTupleImporter &other) = delete;
@@ -242,6 +282,9 @@ public:
    /// Opens the input file for reading and the output file for writing (update).
    static RResult<std::unique_ptr<RNTupleImporter>>
    Create(std::string_view sourceFile, std::string_view treeName, std::string_view destFile);
+   /// Imports all the trees of the given chain into a single RNTuple, named after the chain.  The importer does not
+   /// use the chain object itself but only its list of files.
+   static RResult<std::unique_ptr<RNTupleImporter>> Create(TChain *sourceChain, std::string_view destFile);
 
    RNTupleWriteOptions GetWriteOptions() const { return fWriteOptions; }
    void SetWriteOptions(RNTupleWriteOptions options) { fWriteOptions = options; }
@@ -249,12 +292,15 @@ public:
 
    /// Whether or not information and progress is printed to stdout.
    void SetIsQuiet(bool value) { fIsQuiet = value; }
+   /// Whether or not ranges of input clusters are imported concurrently if implicit multi-threading is enabled.
+   void SetIsParallel(bool value) { fIsParallel = value; }
 
    /// Import works in two steps:
    /// 1. PrepareSchema() calls SetBranchAddress() on all the TTree branches and creates the corresponding RNTuple
    ///    fields and the model
    /// 2. An event loop reads every entry from the TTree, applies transformations where necessary, and writes the
    ///    output entry to the RNTuple.
+   /// In parallel mode, every task performs both steps for its own range of input clusters.
    RResult<void> Import();
 }; // class RNTupleImporter
 
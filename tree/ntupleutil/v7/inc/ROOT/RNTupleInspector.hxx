@@ -20,8 +20,13 @@
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 
+#include <cstdint>
 #include <cstdlib>
+#include <iosfwd>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -50,19 +55,89 @@ auto inspector = RNTupleInspector::Create(rntuple).Unwrap();
 std::cout << "The compression factor is " << std::fixed << std::setprecision(2)
                                           << inspector->GetCompressionFactor()
                                           << std::endl;
+
+// Detailed report on the storage layout, per column, per field, per cluster and per encoding
+inspector->PrintJSONReport(std::cout);
 ~~~
+
+The same report can be obtained from the command line with `rntupleinspect data.rntuple NTupleName`.
 */
 // clang-format on
 class RNTupleInspector {
+public:
+   /// Storage statistics of a single physical column, accumulated over all clusters
+   struct RColumnInfo {
+      DescriptorId_t fPhysicalColumnId = kInvalidDescriptorId;
+      DescriptorId_t fFieldId = kInvalidDescriptorId;
+      EColumnType fType = EColumnType::kUnknown;
+      std::uint64_t fNElements = 0;
+      std::uint64_t fNPages = 0;
+      /// The size on storage, i.e. after packing and compression
+      std::uint64_t fCompressedSize = 0;
+      /// The size of the packed pages before compression.  The size of bit-packed integer pages depends on their
+      /// values, which the inspector does not read; for those, this is the largest possible packed size.
+      std::uint64_t fPackedSize = 0;
+      /// The size of the unpacked elements in memory
+      std::uint64_t fUncompressedSize = 0;
+      /// Number of pages by their size on storage: bucket i counts the pages with a size in [2^i, 2^(i+1)),
+      /// empty pages are counted in bucket 0
+      std::vector<std::uint64_t> fPageSizeHistogram;
+      /// Estimated time in nanoseconds to decompress and unpack all the pages, see EstimateDecodeCost()
+      double fDecodeCost = 0.0;
+
+      float GetCompressionFactor() const { return (float)fUncompressedSize / (float)fCompressedSize; }
+   };
+
+   /// Storage statistics of a field, including the columns of all its subfields
+   struct RFieldInfo {
+      DescriptorId_t fFieldId = kInvalidDescriptorId;
+      std::string fQualifiedName;
+      std::string fTypeName;
+      std::uint64_t fNColumns = 0;
+      std::uint64_t fNPages = 0;
+      std::uint64_t fCompressedSize = 0;
+      std::uint64_t fUncompressedSize = 0;
+      double fDecodeCost = 0.0;
+
+      float GetCompressionFactor() const { return (float)fUncompressedSize / (float)fCompressedSize; }
+   };
+
+   /// Storage statistics of a cluster, summed over all its columns
+   struct RClusterInfo {
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      NTupleSize_t fFirstEntryIndex = kInvalidNTupleIndex;
+      std::uint64_t fNEntries = 0;
+      std::uint64_t fNPages = 0;
+      std::uint64_t fCompressedSize = 0;
+      std::uint64_t fUncompressedSize = 0;
+   };
+
+   /// Storage statistics of all the columns that share the same column type, i.e. the same on-disk encoding
+   struct REncodingInfo {
+      EColumnType fType = EColumnType::kUnknown;
+      std::uint64_t fNColumns = 0;
+      std::uint64_t fNElements = 0;
+      std::uint64_t fCompressedSize = 0;
+      std::uint64_t fUncompressedSize = 0;
+      double fDecodeCost = 0.0;
+   };
+
 private:
    std::unique_ptr<ROOT::Experimental::Detail::RPageSource> fPageSource;
    int fCompressionSettings;
    std::uint64_t fCompressedSize;
    std::uint64_t fUncompressedSize;
+   /// Indexed by the physical column id
+   std::vector<RColumnInfo> fColumnInfo;
+   /// Only fields with columns in their subtree have an entry
+   std::unordered_map<DescriptorId_t, RFieldInfo> fFieldInfo;
+   /// Ordered by the first entry index of the clusters
+   std::vector<RClusterInfo> fClusterInfo;
 
    RNTupleInspector(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource) : fPageSource(std::move(pageSource)) {};
 
    void CollectSizeData();
+   void CollectLayoutData();
 
 public:
    RNTupleInspector(const RNTupleInspector &other) = delete;
@@ -91,6 +166,26 @@ public:
 
    /// Get the compression factor of the RNTuple being inspected.
    float GetCompressionFactor();
+
+   /// Get the storage statistics of the given physical column. Throws if the column does not exist.
+   const RColumnInfo &GetColumnInfo(DescriptorId_t physicalColumnId) const;
+   /// Get the storage statistics of the given field, including its subfields. Throws if the field does not exist.
+   const RFieldInfo &GetFieldInfo(DescriptorId_t fieldId) const;
+   /// Like GetFieldInfo(DescriptorId_t) but for the fully qualified field name, e.g. "jets.pt"
+   const RFieldInfo &GetFieldInfo(const std::string &qualifiedFieldName) const;
+   /// Get the storage statistics of all the clusters, ordered by their first entry
+   const std::vector<RClusterInfo> &GetClusterInfo() const { return fClusterInfo; }
+   /// Get the storage statistics summed over all the columns of the same type, ordered by column type
+   std::vector<REncodingInfo> GetEncodingInfo() const;
+
+   /// Write the full storage report (totals, clusters, columns, fields, and encodings) as a JSON document
+   void PrintJSONReport(std::ostream &output);
+
+   /// A rough estimate of the time in nanoseconds it takes on a contemporary CPU to read back a page of the given
+   /// column type: decompressing the packed page, if its size on storage indicates that it was compressed, and
+   /// unpacking the elements to their in-memory representation. Meant for comparing encodings, not as a benchmark.
+   static double EstimateDecodeCost(EColumnType type, int compressionSettings, std::uint64_t nElements,
+                                    std::uint64_t packedSize, std::uint64_t bytesOnStorage);
 };
 } // namespace Experimental
 } // namespace ROOT
@@ -15,26 +15,39 @@
 
 #include <ROOT/RError.hxx>
 #include <ROOT/RField.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleImporter.hxx>
 #include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <TBranch.h>
+#include <TChain.h>
+#include <TChainElement.h>
 #include <TClass.h>
 #include <TDataType.h>
 #include <TLeaf.h>
 #include <TLeafC.h>
 #include <TLeafElement.h>
 #include <TLeafObject.h>
+#include <TROOT.h>
 
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <mutex>
 #include <utility>
 
 namespace {
@@ -86,6 +99,9 @@ ROOT::Experimental::RNTupleImporter::Create(std::string_view sourceFile, std::st
 {
    auto importer = std::unique_ptr<RNTupleImporter>(new RNTupleImporter());
    importer->fNTupleName = treeName;
+   importer->fSourceFileNames.emplace_back(sourceFile);
+   importer->fSourceTreeNames.emplace_back(treeName);
+   importer->fSourceTreeName = treeName;
    importer->fSourceFile = std::unique_ptr<TFile>(TFile::Open(std::string(sourceFile).c_str()));
    if (!importer->fSourceFile || importer->fSourceFile->IsZombie()) {
       return R__FAIL("cannot open source file " + std::string(sourceFile));
@@ -97,16 +113,53 @@ ROOT::Experimental::RNTupleImporter::Create(std::string_view sourceFile, std::st
    // If we have IMT enabled, its best use is for parallel page compression
    importer->fSourceTree->SetImplicitMT(false);
 
-   importer->fDestFileName = destFile;
-   importer->fWriteOptions.SetCompression(kDefaultCompressionSettings);
-   importer->fDestFile = std::unique_ptr<TFile>(TFile::Open(importer->fDestFileName.c_str(), "UPDATE"));
-   if (!importer->fDestFile || importer->fDestFile->IsZombie()) {
-      return R__FAIL("cannot open dest file " + std::string(importer->fDestFileName));
+   auto result = importer->InitDestination(destFile);
+   if (!result)
+      return R__FORWARD_ERROR(result);
+
+   return importer;
+}
+
+ROOT::Experimental::RResult<std::unique_ptr<ROOT::Experimental::RNTupleImporter>>
+ROOT::Experimental::RNTupleImporter::Create(TChain *sourceChain, std::string_view destFile)
+{
+   if (!sourceChain)
+      return R__FAIL("null source chain");
+
+   auto importer = std::unique_ptr<RNTupleImporter>(new RNTupleImporter());
+   importer->fNTupleName = sourceChain->GetName();
+   importer->fSourceTreeName = sourceChain->GetName();
+   // The importer uses its own chain so that it does not interfere with branch addresses set on the given chain
+   auto chain = std::make_unique<TChain>(importer->fSourceTreeName.c_str());
+   for (auto element : TRangeDynCast<TChainElement>(sourceChain->GetListOfFiles())) {
+      assert(element);
+      importer->fSourceFileNames.emplace_back(element->GetTitle());
+      importer->fSourceTreeNames.emplace_back(element->GetName());
+      chain->AddFile(element->GetTitle(), TTree::kMaxEntries, element->GetName());
    }
+   if (importer->fSourceFileNames.empty())
+      return R__FAIL("no files in source chain " + importer->fSourceTreeName);
+   chain->SetImplicitMT(false);
+   importer->fSourceTree = std::move(chain);
+
+   auto result = importer->InitDestination(destFile);
+   if (!result)
+      return R__FORWARD_ERROR(result);
 
    return importer;
 }
 
+ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::InitDestination(std::string_view destFile)
+{
+   fDestFileName = destFile;
+   fWriteOptions.SetCompression(kDefaultCompressionSettings);
+   fDestFile = std::unique_ptr<TFile>(TFile::Open(fDestFileName.c_str(), "UPDATE"));
+   if (!fDestFile || fDestFile->IsZombie()) {
+      return R__FAIL("cannot open dest file " + std::string(fDestFileName));
+   }
+   return RResult<void>::Success();
+}
+
 void ROOT::Experimental::RNTupleImporter::ReportSchema()
 {
    for (const auto &f : fImportFields) {
@@ -320,12 +373,82 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::PrepareSc
    return RResult<void>::Success();
 }
 
+ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::TransformEntry()
+{
+   for (const auto &[_, c] : fLeafCountCollections) {
+      for (Int_t l = 0; l < *c.fCountVal; ++l) {
+         for (auto &t : c.fTransformations) {
+            auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
+            if (!result)
+               return R__FORWARD_ERROR(result);
+         }
+         c.fCollectionWriter->Fill(c.fCollectionEntry.get());
+      }
+      for (auto &t : c.fTransformations)
+         t->ResetEntry();
+   }
+
+   for (auto &t : fImportTransformations) {
+      auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
+      if (!result)
+         return R__FORWARD_ERROR(result);
+      t->ResetEntry();
+   }
+
+   return RResult<void>::Success();
+}
+
+ROOT::Experimental::RResult<std::vector<ROOT::Experimental::RNTupleImporter::RImportChunk>>
+ROOT::Experimental::RNTupleImporter::GetImportChunks()
+{
+   std::vector<RImportChunk> chunks;
+   for (std::size_t i = 0; i < fSourceFileNames.size(); ++i) {
+      auto file = std::unique_ptr<TFile>(TFile::Open(fSourceFileNames[i].c_str()));
+      if (!file || file->IsZombie())
+         return R__FAIL("cannot open source file " + fSourceFileNames[i]);
+      auto tree = std::unique_ptr<TTree>(file->Get<TTree>(fSourceTreeNames[i].c_str()));
+      if (!tree)
+         return R__FAIL("cannot read TTree " + fSourceTreeNames[i] + " from " + fSourceFileNames[i]);
+      const auto nEntries = tree->GetEntries();
+      if (nEntries == 0)
+         continue;
+
+      // Input clusters are grouped such that a range approximately results in an output cluster, using the sizes of
+      // the input tree as an estimate.  In any case, a range consists of at least one input cluster.
+      const double zipBytesPerEntry = std::max(1.0, static_cast<double>(tree->GetZipBytes()) / nEntries);
+      const double totBytesPerEntry = std::max(1.0, static_cast<double>(tree->GetTotBytes()) / nEntries);
+      const auto nEntriesTarget = static_cast<Long64_t>(std::max(
+         1.0, std::min(fWriteOptions.GetApproxZippedClusterSize() / zipBytesPerEntry,
+                       fWriteOptions.GetMaxUnzippedClusterSize() / totBytesPerEntry)));
+
+      auto clusterIter = tree->GetClusterIterator(0);
+      Long64_t firstEntry = 0;
+      while (clusterIter() < nEntries) {
+         const auto endEntry = std::min(clusterIter.GetNextEntry(), nEntries);
+         if ((endEntry - firstEntry >= nEntriesTarget) || (endEntry == nEntries)) {
+            chunks.push_back({i, firstEntry, endEntry});
+            firstEntry = endEntry;
+         }
+      }
+   }
+   return chunks;
+}
+
 ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::Import()
 {
    if (fDestFile->FindKey(fNTupleName.c_str()) != nullptr)
       return R__FAIL("Key '" + fNTupleName + "' already exists in file " + fDestFileName);
 
-   PrepareSchema();
+   if (fIsParallel && ROOT::IsImplicitMTEnabled())
+      return ImportParallel();
+   return ImportSequential();
+}
+
+ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::ImportSequential()
+{
+   auto result = PrepareSchema();
+   if (!result)
+      return R__FORWARD_ERROR(result);
 
    auto sink = std::make_unique<Detail::RPageSinkFile>(fNTupleName, *fDestFile, fWriteOptions);
    sink->GetMetrics().Enable();
@@ -339,25 +462,9 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::Import()
    for (decltype(nEntries) i = 0; i < nEntries; ++i) {
       fSourceTree->GetEntry(i);
 
-      for (const auto &[_, c] : fLeafCountCollections) {
-         for (Int_t l = 0; l < *c.fCountVal; ++l) {
-            for (auto &t : c.fTransformations) {
-               auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
-               if (!result)
-                  return R__FORWARD_ERROR(result);
-            }
-            c.fCollectionWriter->Fill(c.fCollectionEntry.get());
-         }
-         for (auto &t : c.fTransformations)
-            t->ResetEntry();
-      }
-
-      for (auto &t : fImportTransformations) {
-         auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
-         if (!result)
-            return R__FORWARD_ERROR(result);
-         t->ResetEntry();
-      }
+      result = TransformEntry();
+      if (!result)
+         return R__FORWARD_ERROR(result);
 
       ntplWriter->Fill(*fEntry);
 
@@ -369,3 +476,132 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::Import()
 
    return RResult<void>::Success();
 }
+
+ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::ImportParallel()
+{
+#ifdef R__USE_IMT
+   auto chunksOrError = GetImportChunks();
+   if (!chunksOrError)
+      return R__FORWARD_ERROR(chunksOrError);
+   const auto chunks = chunksOrError.Unwrap();
+
+   // The schema of the importer itself defines the model of the writer.  Every task prepares its own schema for its
+   // own input tree; the resulting models are identical.
+   auto result = PrepareSchema();
+   if (!result)
+      return R__FORWARD_ERROR(result);
+
+   auto writer = RNTupleParallelWriter::Append(std::move(fModel), fNTupleName, *fDestFile, fWriteOptions);
+   fModel = nullptr;
+   writer->EnableMetrics();
+   auto ctrZippedBytes = writer->GetMetrics().GetCounter("RNTupleParallelWriter.RPageSinkFile.szWritePayload");
+
+   fProgressCallback = fIsQuiet ? nullptr : std::make_unique<RDefaultProgressCallback>();
+   std::mutex progressMutex;
+   std::uint64_t nEntriesImported = 0;
+
+   // Imports a chunk into the ordered fill context with the chunk index as sequence number.  Sets hasFillContext once
+   // that fill context exists: its destruction releases the sequence number, even if the import throws afterwards.
+   auto fnImportChunk = [&](std::size_t chunkIdx, bool &hasFillContext) {
+      const auto &chunk = chunks[chunkIdx];
+      const auto &fileName = fSourceFileNames[chunk.fFileIndex];
+      const auto &treeName = fSourceTreeNames[chunk.fFileIndex];
+
+      auto worker = std::unique_ptr<RNTupleImporter>(new RNTupleImporter());
+      worker->fIsQuiet = true;
+      worker->fSourceFile = std::unique_ptr<TFile>(TFile::Open(fileName.c_str()));
+      if (!worker->fSourceFile || worker->fSourceFile->IsZombie())
+         throw RException(R__FAIL("cannot open source file " + fileName));
+      worker->fSourceTree = std::unique_ptr<TTree>(worker->fSourceFile->Get<TTree>(treeName.c_str()));
+      if (!worker->fSourceTree)
+         throw RException(R__FAIL("cannot read TTree " + treeName + " from " + fileName));
+      worker->fSourceTree->SetImplicitMT(false);
+      worker->PrepareSchema().ThrowOnError();
+
+      // The ordered fill context appends its clusters once it is destructed and all previous ranges are written
+      auto fillContext = writer->CreateOrderedFillContext(chunkIdx, std::move(worker->fModel));
+      hasFillContext = true;
+      for (auto i = chunk.fFirstEntry; i < chunk.fEndEntry; ++i) {
+         worker->fSourceTree->GetEntry(i);
+         worker->TransformEntry().ThrowOnError();
+         fillContext->Fill(*worker->fEntry);
+      }
+      fillContext.reset();
+
+      std::lock_guard<std::mutex> guard(progressMutex);
+      nEntriesImported += chunk.fEndEntry - chunk.fFirstEntry;
+      if (fProgressCallback && ctrZippedBytes)
+         fProgressCallback->Call(ctrZippedBytes->GetValueAsInt(), nEntriesImported);
+   };
+
+   // The parallel writer keeps the clusters of a finished chunk in memory until all previous chunks are appended.  In
+   // order to bound the memory use, chunks are started in input order and at most maxChunksAhead chunks past the
+   // oldest unfinished one.
+   ROOT::TThreadExecutor pool;
+   const std::size_t maxChunksAhead = 2 * pool.GetPoolSize();
+   std::mutex chunksMutex;
+   std::condition_variable chunksCV;
+   // Protected by chunksMutex
+   std::size_t nextChunk = 0;
+   std::size_t oldestUnfinishedChunk = 0;
+   std::vector<bool> isChunkFinished(chunks.size(), false);
+   std::string errorReport; // the error of the first failed chunk
+   std::atomic<bool> hasFailed{false};
+
+   auto fnWork = [&]() {
+      while (true) {
+         std::size_t chunkIdx;
+         {
+            std::unique_lock<std::mutex> lock(chunksMutex);
+            chunksCV.wait(lock, [&] {
+               return nextChunk == chunks.size() || nextChunk < oldestUnfinishedChunk + maxChunksAhead;
+            });
+            if (nextChunk == chunks.size())
+               return;
+            chunkIdx = nextChunk++;
+         }
+
+         // Once a chunk failed, the remaining chunks are skipped
+         std::string chunkError;
+         bool hasFillContext = false;
+         if (!hasFailed) {
+            try {
+               fnImportChunk(chunkIdx, hasFillContext);
+            } catch (const std::exception &err) {
+               chunkError = err.what();
+               hasFailed = true;
+            }
+         }
+         // A chunk that did not reach its fill context still has to release its sequence number with an empty one,
+         // otherwise the clusters of all following chunks would be held back
+         if (!hasFillContext) {
+            try {
+               writer->CreateOrderedFillContext(chunkIdx).reset();
+            } catch (const std::exception &err) {
+               R__LOG_ERROR(NTupleLog()) << "cannot release range " << chunkIdx << ": " << err.what();
+            }
+         }
+
+         {
+            std::lock_guard<std::mutex> lock(chunksMutex);
+            if (!chunkError.empty() && errorReport.empty())
+               errorReport = chunkError;
+            isChunkFinished[chunkIdx] = true;
+            while (oldestUnfinishedChunk < chunks.size() && isChunkFinished[oldestUnfinishedChunk])
+               ++oldestUnfinishedChunk;
+         }
+         chunksCV.notify_all();
+      }
+   };
+
+   pool.Foreach(fnWork, pool.GetPoolSize());
+   if (hasFailed)
+      return R__FAIL("parallel import failed: " + errorReport);
+   if (fProgressCallback && ctrZippedBytes)
+      fProgressCallback->Finish(ctrZippedBytes->GetValueAsInt(), nEntriesImported);
+
+   return RResult<void>::Success();
+#else
+   return ImportSequential();
+#endif
+}
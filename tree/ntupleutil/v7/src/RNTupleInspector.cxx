@@ -19,7 +19,115 @@
 #include <ROOT/RNTupleInspector.hxx>
 #include <ROOT/RError.hxx>
 
+#include <Compression.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <cstring>
+#include <map>
+#include <ostream>
+
+namespace {
+
+/// Decompression time in nanoseconds per uncompressed (packed) byte, by compression algorithm.  The values are the
+/// inverse of the single-core decompression throughput at the default compression levels, taken as order-of-magnitude
+/// figures: about 300 MB/s for zlib, 50 MB/s for LZMA, 4 GB/s for LZ4, and 1 GB/s for zstd.  Unknown algorithms are
+/// assumed to cost as much as zlib, on which the old ROOT algorithm is based.
+double GetDecompressionCostPerByte(int compressionSettings)
+{
+   switch (compressionSettings / 100) {
+   case ROOT::RCompressionSetting::EAlgorithm::kZLIB: return 3.0;
+   case ROOT::RCompressionSetting::EAlgorithm::kLZMA: return 20.0;
+   case ROOT::RCompressionSetting::EAlgorithm::kOldCompressionAlgo: return 3.0;
+   case ROOT::RCompressionSetting::EAlgorithm::kLZ4: return 0.25;
+   case ROOT::RCompressionSetting::EAlgorithm::kZSTD: return 1.0;
+   default: return 3.0;
+   }
+}
+
+/// Unpacking time in nanoseconds per element, by column type.  The values are relative to a plain copy of 4 to 8 byte
+/// elements at roughly 10 GB/s (0.1 ns per element): byte-sized elements copy at twice the rate, byte splitting
+/// triples the cost because every byte of an element is gathered from a different place, delta decoding adds a
+/// dependent addition per element, and bit unpacking, truncated and quantized reals take about one shift-and-mask
+/// sequence per element.  The ratios between the column types matter more than the absolute values.
+double GetUnpackCostPerElement(ROOT::Experimental::EColumnType type)
+{
+   using ROOT::Experimental::EColumnType;
+   switch (type) {
+   case EColumnType::kByte:
+   case EColumnType::kChar:
+   case EColumnType::kInt8: return 0.05;
+   case EColumnType::kIndex32:
+   case EColumnType::kSwitch:
+   case EColumnType::kReal64:
+   case EColumnType::kReal32:
+   case EColumnType::kInt64:
+   case EColumnType::kInt32:
+   case EColumnType::kInt16: return 0.1;
+   case EColumnType::kSplitReal64:
+   case EColumnType::kSplitReal32:
+   case EColumnType::kSplitInt64:
+   case EColumnType::kSplitInt32:
+   case EColumnType::kSplitInt16: return 0.3;
+   case EColumnType::kBit: return 0.5;
+   case EColumnType::kSplitIndex32:
+   case EColumnType::kSplitDeltaInt64:
+   case EColumnType::kSplitDeltaInt32:
+   case EColumnType::kSplitDeltaInt16: return 0.5;
+   case EColumnType::kReal32Trunc: return 0.7;
+   case EColumnType::kReal16:
+   case EColumnType::kBitPackedInt64:
+   case EColumnType::kBitPackedInt32:
+   case EColumnType::kBitPackedInt16:
+   case EColumnType::kReal32Quant: return 1.0;
+   default: return 1.0;
+   }
+}
+
+std::size_t GetPageSizeBucket(std::uint64_t bytesOnStorage)
+{
+   std::size_t bucket = 0;
+   while (bytesOnStorage > 1) {
+      bytesOnStorage >>= 1;
+      ++bucket;
+   }
+   return bucket;
+}
+
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   result.reserve(str.size());
+   for (auto c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned int>(c));
+            result += buf;
+         } else {
+            result += c;
+         }
+      }
+   }
+   return result;
+}
+
+/// Prints the compression factor or null if it is undefined (nothing on storage)
+void PrintJSONFactor(std::ostream &output, std::uint64_t uncompressedSize, std::uint64_t compressedSize)
+{
+   if (compressedSize == 0)
+      output << "null";
+   else
+      output << static_cast<double>(uncompressedSize) / static_cast<double>(compressedSize);
+}
+
+} // anonymous namespace
 
 void ROOT::Experimental::RNTupleInspector::CollectSizeData()
 {
@@ -52,12 +160,107 @@ void ROOT::Experimental::RNTupleInspector::CollectSizeData()
    fUncompressedSize = uncompressedSize;
 }
 
+void ROOT::Experimental::RNTupleInspector::CollectLayoutData()
+{
+   using ROOT::Experimental::Detail::RColumnElementBase;
+
+   // The page source has already been attached by CollectSizeData()
+   auto descriptorGuard = fPageSource->GetSharedDescriptorGuard();
+   const auto &desc = descriptorGuard.GetRef();
+
+   const auto nColumns = desc.GetNPhysicalColumns();
+   std::vector<RColumnModel> columnModels;
+   std::vector<std::uint64_t> elementSizes;
+   fColumnInfo.resize(nColumns);
+   for (DescriptorId_t colId = 0; colId < nColumns; ++colId) {
+      const auto &colDesc = desc.GetColumnDescriptor(colId);
+      columnModels.emplace_back(colDesc.GetModel());
+      elementSizes.emplace_back(RColumnElementBase::Generate(colDesc.GetModel().GetType())->GetSize());
+      fColumnInfo[colId].fPhysicalColumnId = colId;
+      fColumnInfo[colId].fFieldId = colDesc.GetFieldId();
+      fColumnInfo[colId].fType = colDesc.GetModel().GetType();
+   }
+
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      RClusterInfo clusterInfo;
+      clusterInfo.fClusterId = clusterDesc.GetId();
+      clusterInfo.fFirstEntryIndex = clusterDesc.GetFirstEntryIndex();
+      clusterInfo.fNEntries = clusterDesc.GetNEntries();
+
+      for (auto colId : clusterDesc.GetColumnIds()) {
+         auto &columnInfo = fColumnInfo.at(colId);
+         const auto &columnRange = clusterDesc.GetColumnRange(colId);
+         const auto &pageRange = clusterDesc.GetPageRange(colId);
+
+         for (const auto &pageInfo : pageRange.fPageInfos) {
+            // Zero pages of late-added columns are not stored
+            if (pageInfo.fLocator.fType == RNTupleLocator::kTypePageZero)
+               continue;
+            const std::uint64_t bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
+            const std::uint64_t packedSize = RColumnElementBase::GetPackedSize(columnModels[colId], pageInfo.fNElements);
+
+            columnInfo.fNPages++;
+            columnInfo.fCompressedSize += bytesOnStorage;
+            columnInfo.fPackedSize += packedSize;
+            columnInfo.fDecodeCost += EstimateDecodeCost(columnInfo.fType, columnRange.fCompressionSettings,
+                                                         pageInfo.fNElements, packedSize, bytesOnStorage);
+            const auto bucket = GetPageSizeBucket(bytesOnStorage);
+            if (columnInfo.fPageSizeHistogram.size() <= bucket)
+               columnInfo.fPageSizeHistogram.resize(bucket + 1, 0);
+            columnInfo.fPageSizeHistogram[bucket]++;
+
+            clusterInfo.fNPages++;
+            clusterInfo.fCompressedSize += bytesOnStorage;
+         }
+         columnInfo.fNElements += columnRange.fNElements;
+         columnInfo.fUncompressedSize += columnRange.fNElements * elementSizes[colId];
+         clusterInfo.fUncompressedSize += columnRange.fNElements * elementSizes[colId];
+      }
+
+      fClusterInfo.emplace_back(clusterInfo);
+   }
+   std::sort(fClusterInfo.begin(), fClusterInfo.end(), [](const RClusterInfo &a, const RClusterInfo &b) {
+      return a.fFirstEntryIndex < b.fFirstEntryIndex;
+   });
+
+   // Every column contributes to its own field and to all the ancestors up to, but excluding, the zero field
+   const auto fieldZeroId = desc.GetFieldZeroId();
+   for (const auto &columnInfo : fColumnInfo) {
+      for (auto fieldId = columnInfo.fFieldId; fieldId != fieldZeroId && fieldId != kInvalidDescriptorId;
+           fieldId = desc.GetFieldDescriptor(fieldId).GetParentId()) {
+         auto &fieldInfo = fFieldInfo[fieldId];
+         if (fieldInfo.fFieldId == kInvalidDescriptorId) {
+            fieldInfo.fFieldId = fieldId;
+            fieldInfo.fQualifiedName = desc.GetQualifiedFieldName(fieldId);
+            fieldInfo.fTypeName = desc.GetFieldDescriptor(fieldId).GetTypeName();
+         }
+         fieldInfo.fNColumns++;
+         fieldInfo.fNPages += columnInfo.fNPages;
+         fieldInfo.fCompressedSize += columnInfo.fCompressedSize;
+         fieldInfo.fUncompressedSize += columnInfo.fUncompressedSize;
+         fieldInfo.fDecodeCost += columnInfo.fDecodeCost;
+      }
+   }
+}
+
+double ROOT::Experimental::RNTupleInspector::EstimateDecodeCost(EColumnType type, int compressionSettings,
+                                                                std::uint64_t nElements, std::uint64_t packedSize,
+                                                                std::uint64_t bytesOnStorage)
+{
+   double cost = nElements * GetUnpackCostPerElement(type);
+   // Pages that do not shrink are stored uncompressed
+   if (bytesOnStorage < packedSize)
+      cost += packedSize * GetDecompressionCostPerByte(compressionSettings);
+   return cost;
+}
+
 ROOT::Experimental::RResult<std::unique_ptr<ROOT::Experimental::RNTupleInspector>>
 ROOT::Experimental::RNTupleInspector::Create(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource)
 {
    auto inspector = std::unique_ptr<RNTupleInspector>(new RNTupleInspector(std::move(pageSource)));
 
    inspector->CollectSizeData();
+   inspector->CollectLayoutData();
 
    return inspector;
 }
@@ -96,3 +299,144 @@ float ROOT::Experimental::RNTupleInspector::GetCompressionFactor()
 {
    return (float)fUncompressedSize / (float)fCompressedSize;
 }
+
+const ROOT::Experimental::RNTupleInspector::RColumnInfo &
+ROOT::Experimental::RNTupleInspector::GetColumnInfo(DescriptorId_t physicalColumnId) const
+{
+   if (physicalColumnId >= fColumnInfo.size())
+      throw RException(R__FAIL("no column with id " + std::to_string(physicalColumnId)));
+   return fColumnInfo[physicalColumnId];
+}
+
+const ROOT::Experimental::RNTupleInspector::RFieldInfo &
+ROOT::Experimental::RNTupleInspector::GetFieldInfo(DescriptorId_t fieldId) const
+{
+   auto itr = fFieldInfo.find(fieldId);
+   if (itr == fFieldInfo.end())
+      throw RException(R__FAIL("no field with id " + std::to_string(fieldId) + " or the field has no columns"));
+   return itr->second;
+}
+
+const ROOT::Experimental::RNTupleInspector::RFieldInfo &
+ROOT::Experimental::RNTupleInspector::GetFieldInfo(const std::string &qualifiedFieldName) const
+{
+   for (const auto &[_, fieldInfo] : fFieldInfo) {
+      if (fieldInfo.fQualifiedName == qualifiedFieldName)
+         return fieldInfo;
+   }
+   throw RException(R__FAIL("no field named '" + qualifiedFieldName + "' or the field has no columns"));
+}
+
+std::vector<ROOT::Experimental::RNTupleInspector::REncodingInfo>
+ROOT::Experimental::RNTupleInspector::GetEncodingInfo() const
+{
+   std::map<EColumnType, REncodingInfo> encodings;
+   for (const auto &columnInfo : fColumnInfo) {
+      auto &encodingInfo = encodings[columnInfo.fType];
+      encodingInfo.fType = columnInfo.fType;
+      encodingInfo.fNColumns++;
+      encodingInfo.fNElements += columnInfo.fNElements;
+      encodingInfo.fCompressedSize += columnInfo.fCompressedSize;
+      encodingInfo.fUncompressedSize += columnInfo.fUncompressedSize;
+      encodingInfo.fDecodeCost += columnInfo.fDecodeCost;
+   }
+
+   std::vector<REncodingInfo> result;
+   result.reserve(encodings.size());
+   for (const auto &[_, encodingInfo] : encodings)
+      result.emplace_back(encodingInfo);
+   return result;
+}
+
+void ROOT::Experimental::RNTupleInspector::PrintJSONReport(std::ostream &output)
+{
+   using ROOT::Experimental::Detail::RColumnElementBase;
+
+   std::string name;
+   NTupleSize_t nEntries;
+   {
+      auto descriptorGuard = fPageSource->GetSharedDescriptorGuard();
+      name = descriptorGuard->GetName();
+      nEntries = descriptorGuard->GetNEntries();
+   }
+
+   output << "{\n";
+   output << "  \"name\": \"" << EscapeJSON(name) << "\",\n";
+   output << "  \"entries\": " << nEntries << ",\n";
+   output << "  \"compressionSettings\": " << fCompressionSettings << ",\n";
+   output << "  \"compressedSize\": " << fCompressedSize << ",\n";
+   output << "  \"uncompressedSize\": " << fUncompressedSize << ",\n";
+   output << "  \"compressionFactor\": ";
+   PrintJSONFactor(output, fUncompressedSize, fCompressedSize);
+   output << ",\n";
+
+   output << "  \"clusters\": [";
+   for (std::size_t i = 0; i < fClusterInfo.size(); ++i) {
+      const auto &info = fClusterInfo[i];
+      output << (i == 0 ? "\n" : ",\n");
+      output << "    {\"id\": " << info.fClusterId << ", \"firstEntry\": " << info.fFirstEntryIndex
+             << ", \"entries\": " << info.fNEntries << ", \"pages\": " << info.fNPages
+             << ", \"compressedSize\": " << info.fCompressedSize
+             << ", \"uncompressedSize\": " << info.fUncompressedSize << ", \"compressionFactor\": ";
+      PrintJSONFactor(output, info.fUncompressedSize, info.fCompressedSize);
+      output << "}";
+   }
+   output << (fClusterInfo.empty() ? "],\n" : "\n  ],\n");
+
+   output << "  \"columns\": [";
+   for (std::size_t i = 0; i < fColumnInfo.size(); ++i) {
+      const auto &info = fColumnInfo[i];
+      output << (i == 0 ? "\n" : ",\n");
+      output << "    {\"id\": " << info.fPhysicalColumnId << ", \"fieldId\": " << info.fFieldId
+             << ", \"type\": \"" << RColumnElementBase::GetTypeName(info.fType) << "\""
+             << ", \"elements\": " << info.fNElements << ", \"pages\": " << info.fNPages
+             << ", \"compressedSize\": " << info.fCompressedSize << ", \"packedSize\": " << info.fPackedSize
+             << ", \"uncompressedSize\": " << info.fUncompressedSize << ", \"compressionFactor\": ";
+      PrintJSONFactor(output, info.fUncompressedSize, info.fCompressedSize);
+      output << ", \"decodeCostNs\": " << info.fDecodeCost << ", \"pageSizeHistogram\": [";
+      bool isFirstBucket = true;
+      for (std::size_t bucket = 0; bucket < info.fPageSizeHistogram.size(); ++bucket) {
+         if (info.fPageSizeHistogram[bucket] == 0)
+            continue;
+         output << (isFirstBucket ? "" : ", ");
+         output << "{\"minSize\": " << (bucket == 0 ? 0 : (std::uint64_t(1) << bucket))
+                << ", \"maxSize\": " << ((std::uint64_t(1) << (bucket + 1)) - 1)
+                << ", \"pages\": " << info.fPageSizeHistogram[bucket] << "}";
+         isFirstBucket = false;
+      }
+      output << "]}";
+   }
+   output << (fColumnInfo.empty() ? "],\n" : "\n  ],\n");
+
+   std::map<DescriptorId_t, const RFieldInfo *> sortedFields;
+   for (const auto &[fieldId, fieldInfo] : fFieldInfo)
+      sortedFields[fieldId] = &fieldInfo;
+   output << "  \"fields\": [";
+   bool isFirstField = true;
+   for (const auto &[_, info] : sortedFields) {
+      output << (isFirstField ? "\n" : ",\n");
+      output << "    {\"id\": " << info->fFieldId << ", \"name\": \"" << EscapeJSON(info->fQualifiedName) << "\""
+             << ", \"type\": \"" << EscapeJSON(info->fTypeName) << "\", \"columns\": " << info->fNColumns
+             << ", \"pages\": " << info->fNPages << ", \"compressedSize\": " << info->fCompressedSize
+             << ", \"uncompressedSize\": " << info->fUncompressedSize << ", \"compressionFactor\": ";
+      PrintJSONFactor(output, info->fUncompressedSize, info->fCompressedSize);
+      output << ", \"decodeCostNs\": " << info->fDecodeCost << "}";
+      isFirstField = false;
+   }
+   output << (sortedFields.empty() ? "],\n" : "\n  ],\n");
+
+   const auto encodings = GetEncodingInfo();
+   output << "  \"encodings\": [";
+   for (std::size_t i = 0; i < encodings.size(); ++i) {
+      const auto &info = encodings[i];
+      output << (i == 0 ? "\n" : ",\n");
+      output << "    {\"type\": \"" << RColumnElementBase::GetTypeName(info.fType) << "\""
+             << ", \"columns\": " << info.fNColumns << ", \"elements\": " << info.fNElements
+             << ", \"compressedSize\": " << info.fCompressedSize
+             << ", \"uncompressedSize\": " << info.fUncompressedSize << ", \"compressionFactor\": ";
+      PrintJSONFactor(output, info.fUncompressedSize, info.fCompressedSize);
+      output << ", \"decodeCostNs\": " << info.fDecodeCost << "}";
+   }
+   output << (encodings.empty() ? "]\n" : "\n  ]\n");
+   output << "}\n";
+}
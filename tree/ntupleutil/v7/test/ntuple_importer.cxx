@@ -1,6 +1,8 @@
 #include <ROOT/RNTupleImporter.hxx>
 
+#include <TChain.h>
 #include <TFile.h>
+#include <TROOT.h>
 #include <TTree.h>
 
 #include <cstdio>
@@ -494,3 +496,133 @@ TEST(RNTupleImporter, CollectionProxyClass)
       }
    }
 }
+
+namespace {
+
+/// Writes a tree with `nEntries` entries, starting at `firstIndex`, and small clusters
+void WriteIndexTree(const std::string &path, Int_t firstIndex, Int_t nEntries, const char *treeName = "tree")
+{
+   std::unique_ptr<TFile> file(TFile::Open(path.c_str(), "RECREATE"));
+   auto tree = std::make_unique<TTree>(treeName, "");
+   tree->SetAutoFlush(100);
+   Int_t index;
+   Int_t n;
+   float values[4];
+   char tag[16];
+   tree->Branch("index", &index);
+   tree->Branch("n", &n);
+   tree->Branch("values", values, "values[n]/F");
+   tree->Branch("tag", tag, "tag/C");
+   for (Int_t i = firstIndex; i < firstIndex + nEntries; ++i) {
+      index = i;
+      n = i % 5;
+      for (Int_t j = 0; j < n; ++j)
+         values[j] = i + j;
+      snprintf(tag, sizeof(tag), "%d", i);
+      tree->Fill();
+   }
+   tree->Write();
+}
+
+void CheckIndexNTuple(RNTupleReader &reader, Int_t nEntries)
+{
+   EXPECT_EQ(static_cast<std::uint64_t>(nEntries), reader.GetNEntries());
+   auto viewIndex = reader.GetView<std::int32_t>("index");
+   auto viewValues = reader.GetView<ROOT::RVec<float>>("values");
+   auto viewTag = reader.GetView<std::string>("tag");
+   for (auto i : reader.GetEntryRange()) {
+      const auto index = static_cast<Int_t>(i);
+      ASSERT_EQ(index, viewIndex(i));
+      const auto &values = viewValues(i);
+      ASSERT_EQ(static_cast<std::size_t>(index % 5), values.size());
+      for (std::size_t j = 0; j < values.size(); ++j)
+         EXPECT_FLOAT_EQ(static_cast<float>(index + j), values[j]);
+      EXPECT_EQ(std::to_string(index), viewTag(i));
+   }
+}
+
+} // anonymous namespace
+
+TEST(RNTupleImporter, Chain)
+{
+   FileRaii fileGuard1("test_ntuple_importer_chain1.root");
+   FileRaii fileGuard2("test_ntuple_importer_chain2.root");
+   FileRaii fileGuardOut("test_ntuple_importer_chain_out.root");
+   WriteIndexTree(fileGuard1.GetPath(), 0, 300);
+   WriteIndexTree(fileGuard2.GetPath(), 300, 200);
+
+   TChain chain("tree");
+   chain.Add(fileGuard1.GetPath().c_str());
+   chain.Add(fileGuard2.GetPath().c_str());
+   auto importer = RNTupleImporter::Create(&chain, fileGuardOut.GetPath()).Unwrap();
+   importer->SetIsQuiet(true);
+   importer->Import().ThrowOnError();
+
+   auto reader = RNTupleReader::Open("tree", fileGuardOut.GetPath());
+   CheckIndexNTuple(*reader, 500);
+
+   TChain emptyChain("tree");
+   EXPECT_FALSE(RNTupleImporter::Create(&emptyChain, fileGuardOut.GetPath()));
+}
+
+TEST(RNTupleImporter, ChainElementTreeNames)
+{
+   FileRaii fileGuard1("test_ntuple_importer_chain_names1.root");
+   FileRaii fileGuard2("test_ntuple_importer_chain_names2.root");
+   WriteIndexTree(fileGuard1.GetPath(), 0, 300);
+   WriteIndexTree(fileGuard2.GetPath(), 300, 2000, "othertree");
+
+   for (bool isParallel : {false, true}) {
+      FileRaii fileGuardOut("test_ntuple_importer_chain_names_out.root");
+#ifdef R__USE_IMT
+      if (isParallel)
+         ROOT::EnableImplicitMT(4);
+#endif
+      TChain chain("tree");
+      chain.Add(fileGuard1.GetPath().c_str());
+      chain.Add((fileGuard2.GetPath() + "?#othertree").c_str());
+      auto importer = RNTupleImporter::Create(&chain, fileGuardOut.GetPath()).Unwrap();
+      importer->SetIsQuiet(true);
+      importer->SetIsParallel(isParallel);
+      auto options = importer->GetWriteOptions();
+      options.SetApproxZippedClusterSize(2000);
+      importer->SetWriteOptions(options);
+      importer->Import().ThrowOnError();
+#ifdef R__USE_IMT
+      ROOT::DisableImplicitMT();
+#endif
+
+      auto reader = RNTupleReader::Open("tree", fileGuardOut.GetPath());
+      CheckIndexNTuple(*reader, 2300);
+   }
+}
+
+#ifdef R__USE_IMT
+TEST(RNTupleImporter, Parallel)
+{
+   FileRaii fileGuard1("test_ntuple_importer_parallel1.root");
+   FileRaii fileGuard2("test_ntuple_importer_parallel2.root");
+   FileRaii fileGuardOut("test_ntuple_importer_parallel_out.root");
+   WriteIndexTree(fileGuard1.GetPath(), 0, 3000);
+   WriteIndexTree(fileGuard2.GetPath(), 3000, 2000);
+
+   ROOT::EnableImplicitMT(4);
+   TChain chain("tree");
+   chain.Add(fileGuard1.GetPath().c_str());
+   chain.Add(fileGuard2.GetPath().c_str());
+   auto importer = RNTupleImporter::Create(&chain, fileGuardOut.GetPath()).Unwrap();
+   importer->SetIsQuiet(true);
+   importer->SetIsParallel(true);
+   auto options = importer->GetWriteOptions();
+   options.SetApproxZippedClusterSize(2000);
+   options.SetApproxUnzippedPageSize(1000);
+   importer->SetWriteOptions(options);
+   importer->Import().ThrowOnError();
+   ROOT::DisableImplicitMT();
+
+   auto reader = RNTupleReader::Open("tree", fileGuardOut.GetPath());
+   // Every range of input clusters is written as a separate cluster, in input order
+   EXPECT_GT(reader->GetDescriptor()->GetNClusters(), 2U);
+   CheckIndexNTuple(*reader, 5000);
+}
+#endif
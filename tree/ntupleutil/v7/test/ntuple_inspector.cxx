@@ -1,8 +1,13 @@
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RNTupleInspector.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 
 #include <TFile.h>
 
+#include <nlohmann/json.hpp>
+
+#include <sstream>
+
 #include "ntupleutil_test.hxx"
 
 using ROOT::Experimental::RNTuple;
@@ -137,3 +142,233 @@ TEST(RNTupleInspector, SingleIntFieldCompression)
    EXPECT_LT(inspector->GetCompressedSize(), inspector->GetUncompressedSize());
    EXPECT_GT(inspector->GetCompressionFactor(), 1);
 }
+
+TEST(RNTupleInspector, ColumnInfo)
+{
+   FileRaii fileGuard("test_ntuple_inspector_column_info.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto nFldFloat = model->MakeField<float>("f");
+      auto nFldVec = model->MakeField<std::vector<std::int32_t>>("v");
+
+      auto writeOptions = RNTupleWriteOptions();
+      writeOptions.SetCompression(505);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), writeOptions);
+
+      for (int32_t i = 0; i < 1000; ++i) {
+         *nFldFloat = i;
+         *nFldVec = std::vector<std::int32_t>(i % 4, i);
+         ntuple->Fill();
+         if (i % 250 == 249)
+            ntuple->CommitCluster();
+      }
+   }
+
+   std::unique_ptr<TFile> file(TFile::Open(fileGuard.GetPath().c_str()));
+   auto ntuple = file->Get<RNTuple>("ntuple");
+   auto inspector = RNTupleInspector::Create(ntuple).Unwrap();
+
+   std::uint64_t compressedSize = 0;
+   std::uint64_t uncompressedSize = 0;
+   for (ROOT::Experimental::DescriptorId_t colId = 0; colId < 3; ++colId) {
+      const auto &columnInfo = inspector->GetColumnInfo(colId);
+      EXPECT_EQ(colId, columnInfo.fPhysicalColumnId);
+      EXPECT_LT(0u, columnInfo.fNPages);
+      EXPECT_LT(0u, columnInfo.fCompressedSize);
+      EXPECT_LT(0.0, columnInfo.fDecodeCost);
+
+      std::uint64_t nPages = 0;
+      for (auto n : columnInfo.fPageSizeHistogram)
+         nPages += n;
+      EXPECT_EQ(columnInfo.fNPages, nPages);
+
+      compressedSize += columnInfo.fCompressedSize;
+      uncompressedSize += columnInfo.fUncompressedSize;
+   }
+   EXPECT_THROW(inspector->GetColumnInfo(3), ROOT::Experimental::RException);
+   EXPECT_EQ(inspector->GetCompressedSize(), compressedSize);
+   EXPECT_EQ(inspector->GetUncompressedSize(), uncompressedSize);
+
+   EXPECT_EQ(1000u, inspector->GetColumnInfo(0).fNElements);
+   EXPECT_EQ(1000u * sizeof(float), inspector->GetColumnInfo(0).fUncompressedSize);
+   EXPECT_EQ(1500u, inspector->GetColumnInfo(2).fNElements);
+}
+
+TEST(RNTupleInspector, FieldInfo)
+{
+   FileRaii fileGuard("test_ntuple_inspector_field_info.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto nFldFloat = model->MakeField<float>("f");
+      auto nFldVec = model->MakeField<std::vector<std::int32_t>>("v");
+
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int32_t i = 0; i < 100; ++i) {
+         *nFldFloat = i;
+         *nFldVec = std::vector<std::int32_t>(i % 4, i);
+         ntuple->Fill();
+      }
+   }
+
+   std::unique_ptr<TFile> file(TFile::Open(fileGuard.GetPath().c_str()));
+   auto ntuple = file->Get<RNTuple>("ntuple");
+   auto inspector = RNTupleInspector::Create(ntuple).Unwrap();
+
+   const auto &floatInfo = inspector->GetFieldInfo("f");
+   EXPECT_EQ("float", floatInfo.fTypeName);
+   EXPECT_EQ(1u, floatInfo.fNColumns);
+   EXPECT_EQ(100u * sizeof(float), floatInfo.fUncompressedSize);
+
+   const auto &vecInfo = inspector->GetFieldInfo("v");
+   const auto &itemInfo = inspector->GetFieldInfo("v._0");
+   EXPECT_EQ(2u, vecInfo.fNColumns);
+   EXPECT_EQ(1u, itemInfo.fNColumns);
+   EXPECT_EQ(150u * sizeof(std::int32_t), itemInfo.fUncompressedSize);
+   EXPECT_LT(itemInfo.fCompressedSize, vecInfo.fCompressedSize);
+   EXPECT_LT(itemInfo.fUncompressedSize, vecInfo.fUncompressedSize);
+   EXPECT_EQ(inspector->GetCompressedSize(), floatInfo.fCompressedSize + vecInfo.fCompressedSize);
+   EXPECT_EQ(&vecInfo, &inspector->GetFieldInfo(vecInfo.fFieldId));
+
+   EXPECT_THROW(inspector->GetFieldInfo("nonexistent"), ROOT::Experimental::RException);
+}
+
+TEST(RNTupleInspector, ClusterAndEncodingInfo)
+{
+   FileRaii fileGuard("test_ntuple_inspector_cluster_info.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto nFldX = model->MakeField<double>("x");
+      auto nFldY = model->MakeField<double>("y");
+
+      auto writeOptions = RNTupleWriteOptions();
+      writeOptions.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), writeOptions);
+      for (int i = 0; i < 30; ++i) {
+         *nFldX = i;
+         *nFldY = -i;
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   std::unique_ptr<TFile> file(TFile::Open(fileGuard.GetPath().c_str()));
+   auto ntuple = file->Get<RNTuple>("ntuple");
+   auto inspector = RNTupleInspector::Create(ntuple).Unwrap();
+
+   const auto &clusterInfo = inspector->GetClusterInfo();
+   ASSERT_EQ(3u, clusterInfo.size());
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(10u * i, clusterInfo[i].fFirstEntryIndex);
+      EXPECT_EQ(10u, clusterInfo[i].fNEntries);
+      EXPECT_EQ(2u, clusterInfo[i].fNPages);
+      EXPECT_EQ(2 * 10 * sizeof(double), clusterInfo[i].fUncompressedSize);
+      // Without compression, the size on storage is the packed size
+      EXPECT_EQ(clusterInfo[i].fUncompressedSize, clusterInfo[i].fCompressedSize);
+   }
+
+   const auto encodings = inspector->GetEncodingInfo();
+   ASSERT_EQ(1u, encodings.size());
+   EXPECT_EQ(2u, encodings[0].fNColumns);
+   EXPECT_EQ(60u, encodings[0].fNElements);
+   EXPECT_EQ(inspector->GetCompressedSize(), encodings[0].fCompressedSize);
+   // Uncompressed pages only contribute the unpacking to the decode cost
+   EXPECT_DOUBLE_EQ(RNTupleInspector::EstimateDecodeCost(encodings[0].fType, 0, 60, 480, 480),
+                    encodings[0].fDecodeCost);
+   EXPECT_LT(RNTupleInspector::EstimateDecodeCost(encodings[0].fType, 0, 60, 480, 480),
+             RNTupleInspector::EstimateDecodeCost(encodings[0].fType, 505, 60, 480, 100));
+}
+
+TEST(RNTupleInspector, JSONReport)
+{
+   FileRaii fileGuard("test_ntuple_inspector_json_report.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto nFldInt = model->MakeField<std::int32_t>("i");
+      auto nFldVec = model->MakeField<std::vector<float>>("v");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int32_t i = 0; i < 10; ++i) {
+         *nFldInt = i;
+         *nFldVec = std::vector<float>(i % 3, i);
+         ntuple->Fill();
+         if (i == 4)
+            ntuple->CommitCluster();
+      }
+   }
+
+   std::unique_ptr<TFile> file(TFile::Open(fileGuard.GetPath().c_str()));
+   auto ntuple = file->Get<RNTuple>("ntuple");
+   auto inspector = RNTupleInspector::Create(ntuple).Unwrap();
+
+   std::ostringstream os;
+   inspector->PrintJSONReport(os);
+   const auto report = nlohmann::json::parse(os.str());
+
+   EXPECT_EQ("ntuple", report["name"]);
+   EXPECT_EQ(10, report["entries"]);
+   EXPECT_EQ(inspector->GetCompressionSettings(), report["compressionSettings"]);
+   EXPECT_EQ(inspector->GetCompressedSize(), report["compressedSize"]);
+   EXPECT_EQ(inspector->GetUncompressedSize(), report["uncompressedSize"]);
+   EXPECT_NEAR(inspector->GetCompressionFactor(), report["compressionFactor"].get<double>(), 1e-5);
+
+   const auto &clusters = report["clusters"];
+   ASSERT_EQ(2u, clusters.size());
+   EXPECT_EQ(0, clusters[0]["firstEntry"]);
+   EXPECT_EQ(5, clusters[0]["entries"]);
+   EXPECT_EQ(5, clusters[1]["firstEntry"]);
+   EXPECT_EQ(5, clusters[1]["entries"]);
+   EXPECT_EQ(inspector->GetCompressedSize(),
+             clusters[0]["compressedSize"].get<std::uint64_t>() + clusters[1]["compressedSize"].get<std::uint64_t>());
+
+   // i, the offsets of v, and the items of v
+   const auto &columns = report["columns"];
+   ASSERT_EQ(3u, columns.size());
+   for (const auto &column : columns) {
+      const auto &columnInfo = inspector->GetColumnInfo(column["id"].get<std::uint64_t>());
+      EXPECT_EQ(columnInfo.fFieldId, column["fieldId"]);
+      EXPECT_EQ(ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(columnInfo.fType), column["type"]);
+      EXPECT_EQ(columnInfo.fNElements, column["elements"]);
+      EXPECT_EQ(columnInfo.fNPages, column["pages"]);
+      EXPECT_EQ(columnInfo.fCompressedSize, column["compressedSize"]);
+      EXPECT_EQ(columnInfo.fPackedSize, column["packedSize"]);
+      EXPECT_EQ(columnInfo.fUncompressedSize, column["uncompressedSize"]);
+      EXPECT_NEAR(columnInfo.fDecodeCost, column["decodeCostNs"].get<double>(), 1e-5 * columnInfo.fDecodeCost);
+      std::uint64_t nHistogramPages = 0;
+      for (const auto &bucket : column["pageSizeHistogram"]) {
+         EXPECT_LE(bucket["minSize"].get<std::uint64_t>(), bucket["maxSize"].get<std::uint64_t>());
+         nHistogramPages += bucket["pages"].get<std::uint64_t>();
+      }
+      EXPECT_EQ(columnInfo.fNPages, nHistogramPages);
+   }
+
+   // v and its item field v._0
+   const auto &fields = report["fields"];
+   ASSERT_EQ(3u, fields.size());
+   for (const auto &field : fields) {
+      const auto &fieldInfo = inspector->GetFieldInfo(field["name"].get<std::string>());
+      EXPECT_EQ(fieldInfo.fFieldId, field["id"]);
+      EXPECT_EQ(fieldInfo.fTypeName, field["type"]);
+      EXPECT_EQ(fieldInfo.fNColumns, field["columns"]);
+      EXPECT_EQ(fieldInfo.fNPages, field["pages"]);
+      EXPECT_EQ(fieldInfo.fCompressedSize, field["compressedSize"]);
+      EXPECT_EQ(fieldInfo.fUncompressedSize, field["uncompressedSize"]);
+      EXPECT_NEAR(fieldInfo.fDecodeCost, field["decodeCostNs"].get<double>(), 1e-5 * fieldInfo.fDecodeCost);
+   }
+   EXPECT_EQ(10u * sizeof(std::int32_t), inspector->GetFieldInfo("i").fUncompressedSize);
+   EXPECT_EQ(9u * sizeof(float), inspector->GetFieldInfo("v._0").fUncompressedSize);
+
+   const auto encodings = inspector->GetEncodingInfo();
+   ASSERT_EQ(encodings.size(), report["encodings"].size());
+   std::uint64_t nEncodingElements = 0;
+   for (std::size_t i = 0; i < encodings.size(); ++i) {
+      const auto &encoding = report["encodings"][i];
+      EXPECT_EQ(ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(encodings[i].fType), encoding["type"]);
+      EXPECT_EQ(encodings[i].fNColumns, encoding["columns"]);
+      EXPECT_EQ(encodings[i].fNElements, encoding["elements"]);
+      EXPECT_EQ(encodings[i].fCompressedSize, encoding["compressedSize"]);
+      EXPECT_EQ(encodings[i].fUncompressedSize, encoding["uncompressedSize"]);
+      nEncodingElements += encoding["elements"].get<std::uint64_t>();
+   }
+   // 10 values of i, 10 offsets of v, 9 items of v
+   EXPECT_EQ(29u, nEncodingElements);
+}
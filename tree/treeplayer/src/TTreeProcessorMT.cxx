@@ -19,14 +19,32 @@ passes a function whose only parameter is a TTreeReader. The function iterates
 on a subrange of entries by using that TTreeReader.
 
 The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the subranges,
-each corresponding to a cluster in the TTree. This is possible thanks to the use
+each corresponding to one or more clusters in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
 objects.
+
+The cost of processing a cluster is estimated from the compressed size of its baskets.
+Consecutive cheap clusters are fused, and clusters that are much more expensive than the others
+are split into subranges at the basket boundaries of the most expensive branch, so that the tasks
+of a file have a similar cost.
+Each thread processes the tasks of one file at a time. Once there are no more files to start, idle
+threads steal tasks from the file with the largest estimated cost left, so that all threads stay
+busy until the end of the processing.
 */
 
 #include "TROOT.h"
+#include "TBranch.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+
 using namespace ROOT;
 
 namespace {
@@ -49,15 +67,16 @@ static bool ClustersAreSortedAndContiguous(const std::vector<std::vector<EntryRa
 
 /// Take a vector of vectors of EntryRanges (a vector per file), filter the entries according to entryList, and
 /// and return a new vector of vectors of EntryRanges where cluster start/end entry numbers have been converted to
-/// TEntryList-local entry numbers.
+/// TEntryList-local entry numbers. The estimated costs of the clusters that do not contain any selected entry are
+/// removed from `costs`, so that it keeps matching the returned clusters.
 ///
 /// This routine assumes that entry numbers in the TEntryList (and, if present, in the sub-entrylists) are in
 /// ascending order, i.e., for n > m:
 ///   elist.GetEntry(n) + tree_offset_for_entry_from_elist(n) > elist.GetEntry(m) + tree_offset_for_entry_from_elist(m)
 static std::vector<std::vector<EntryRange>>
-ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryList &entryList,
-                       const std::vector<std::string> &treeNames, const std::vector<std::string> &fileNames,
-                       const std::vector<Long64_t> &entriesPerFile)
+ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, std::vector<std::vector<double>> &costs,
+                       TEntryList &entryList, const std::vector<std::string> &treeNames,
+                       const std::vector<std::string> &fileNames, const std::vector<Long64_t> &entriesPerFile)
 {
    R__ASSERT(entryList.GetN() > 0); // wasteful to call this function if it has nothing to do
    R__ASSERT(ClustersAreSortedAndContiguous(clusters));
@@ -99,7 +118,10 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
 
    for (auto fileN = 0u; fileN < nFiles; ++fileN) {
       std::vector<EntryRange> elistClustersForFile;
-      for (const auto &c : clusters[fileN]) {
+      std::vector<double> elistCostsForFile;
+      const auto nClusters = clusters[fileN].size();
+      for (auto clusterN = 0u; clusterN < nClusters; ++clusterN) {
+         const auto &c = clusters[fileN][clusterN];
          if (entry >= c.second || entry == -1ll) // no entrylist entries in this cluster
             continue;
          R__ASSERT(entry >= c.first); // current entry should never come before the cluster we are looking at
@@ -108,8 +130,10 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
          while (entry < c.second && entry != -1ll)
             entry = Next(elistEntry, entryList, chain.get());
          elistClustersForFile.emplace_back(EntryRange{elistRangeStart, elistEntry});
+         elistCostsForFile.emplace_back(costs[fileN][clusterN]);
       }
       elistClusters.emplace_back(std::move(elistClustersForFile));
+      costs[fileN] = std::move(elistCostsForFile);
    }
 
    R__ASSERT(elistClusters.size() == clusters.size()); // same number of files
@@ -119,21 +143,183 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
    return elistClusters;
 }
 
-// EntryRanges and number of entries per file
-using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::vector<Long64_t>>;
+/// EntryRanges, their estimated processing cost and number of entries per file
+struct ClustersAndEntries {
+   std::vector<std::vector<EntryRange>> fClusters;
+   std::vector<std::vector<double>> fCosts; ///< Same layout as fClusters
+   std::vector<Long64_t> fEntries;
+};
+
+////////////////////////////////////////////////////////////////////////
+/// Add to `costs` the compressed size of the baskets of `branches` (and of their sub-branches) that must be read to
+/// process each of the clusters. A basket that spans several clusters is attributed to them proportionally to the
+/// number of entries. `basketStarts` is set to the entries inside a cluster at which a basket of the most expensive
+/// branch starts, `basketStartsCost` being the cost of that branch; pass in an empty vector and 0 the first time.
+/// `cutCosts` accumulates, for each cluster, the expected compressed size of the baskets that contain an entry picked
+/// at random in the cluster, i.e. the bytes that one more task has to read if the cluster is cut at that entry.
+/// `basketStartsCutCosts` is the contribution of the most expensive branch to `cutCosts`.
+/// This only uses the basket metadata that is loaded together with the TTree, no basket is read.
+static void EstimateClusterCosts(TObjArray &branches, const std::vector<EntryRange> &clusters,
+                                 std::vector<double> &costs, std::vector<double> &cutCosts,
+                                 std::vector<Long64_t> &basketStarts, double &basketStartsCost,
+                                 std::vector<double> &basketStartsCutCosts)
+{
+   const auto nClusters = clusters.size();
+   std::vector<Long64_t> branchBasketStarts;
+   std::vector<double> branchCutCosts;
+   for (auto *branch : ROOT::Detail::TRangeStaticCast<TBranch>(branches)) {
+      // baskets that are still attached to the TTree object have no entry in these arrays and no cost
+      const auto nBaskets = branch->GetWriteBasket();
+      const Long64_t *basketEntry = branch->GetBasketEntry();
+      const Int_t *basketBytes = branch->GetBasketBytes();
+      double branchCost = 0.;
+      branchBasketStarts.clear();
+      branchCutCosts.assign(nClusters, 0.);
+      std::size_t clusterIdx = 0u;
+      for (Int_t i = 0; i < nBaskets && clusterIdx < nClusters; ++i) {
+         const Long64_t first = basketEntry[i];
+         const Long64_t end = i + 1 < nBaskets ? basketEntry[i + 1] : branch->GetEntries();
+         if (end <= first)
+            continue;
+         // both baskets and clusters are sorted, skip the clusters that end before this basket starts
+         while (clusterIdx < nClusters && clusters[clusterIdx].second <= first)
+            ++clusterIdx;
+         if (clusterIdx < nClusters && clusters[clusterIdx].first < first)
+            branchBasketStarts.emplace_back(first);
+         const double bytesPerEntry = double(basketBytes[i]) / (end - first);
+         for (auto c = clusterIdx; c < nClusters && clusters[c].first < end; ++c) {
+            const auto overlap = std::min(end, clusters[c].second) - std::max(first, clusters[c].first);
+            costs[c] += overlap * bytesPerEntry;
+            branchCost += overlap * bytesPerEntry;
+            // a cut anywhere in the overlap makes both sides decompress the whole basket
+            branchCutCosts[c] += double(basketBytes[i]) * overlap / (clusters[c].second - clusters[c].first);
+         }
+      }
+      for (auto c = 0u; c < nClusters; ++c)
+         cutCosts[c] += branchCutCosts[c];
+      if (branchCost > basketStartsCost) {
+         std::swap(basketStarts, branchBasketStarts);
+         std::swap(basketStartsCutCosts, branchCutCosts);
+         basketStartsCost = branchCost;
+      }
+      EstimateClusterCosts(*branch->GetListOfBranches(), clusters, costs, cutCosts, basketStarts, basketStartsCost,
+                           basketStartsCutCosts);
+   }
+}
 
 ////////////////////////////////////////////////////////////////////////
-/// Return a vector of cluster boundaries for the given tree and files.
+/// Partition the clusters of a file into at most maxTasks entry ranges of similar estimated cost.
+/// \param[in] clusters The clusters of the file.
+/// \param[in] costs The estimated cost of each cluster.
+/// \param[in] cutCosts The estimated cost that each cut of a cluster adds, see EstimateClusterCosts().
+/// \param[in] basketStarts Sorted entries, within the clusters, at which a basket of the most expensive branch starts.
+/// \param[in] nWorkers The number of workers.
+/// \param[in] maxTasks The maximum number of tasks for this file.
+/// \param[out] tasks The entry ranges of the tasks.
+/// \param[out] taskCosts The estimated cost of each task.
+///
+/// Only clusters that cost more than the share of one worker in the file are split into sub-ranges. The split points
+/// are chosen among the basket boundaries of the most expensive branch, so that its baskets are not decompressed by
+/// two tasks. The baskets of the other branches are not cut: a basket that contains k - 1 split points is decompressed
+/// by all the k tasks around them. The cluster is split in as many pieces as make each piece, including these
+/// duplicated baskets, cost about the share of one worker; if the duplicated baskets alone cost that much, the cluster
+/// is not split at all. Consecutive cheap clusters are fused together, so that the tasks of a file have a similar cost
+/// even if clusters do not.
+static void MakeTasks(const std::vector<EntryRange> &clusters, const std::vector<double> &costs,
+                      const std::vector<double> &cutCosts, const std::vector<Long64_t> &basketStarts,
+                      unsigned int nWorkers, unsigned int maxTasks, std::vector<EntryRange> &tasks,
+                      std::vector<double> &taskCosts)
+{
+   if (clusters.empty())
+      return;
+
+   double totalCost = std::accumulate(costs.begin(), costs.end(), 0.);
+   // without any basket on disk (e.g. a TTree that fits in its own buffers) we fall back to counting entries
+   const bool useEntriesAsCost = totalCost <= 0.;
+   if (useEntriesAsCost)
+      totalCost = clusters.back().second - clusters.front().first;
+   const double targetCost = totalCost / maxTasks;
+   const double workerShare = totalCost / std::max(nWorkers, 1u);
+
+   std::vector<EntryRange> ranges;
+   std::vector<double> rangeCosts;
+   ranges.reserve(clusters.size());
+   rangeCosts.reserve(clusters.size());
+   for (auto i = 0u; i < clusters.size(); ++i) {
+      const auto start = clusters[i].first;
+      const auto end = clusters[i].second;
+      const double cost = useEntriesAsCost ? double(end - start) : costs[i];
+      const double cutCost = useEntriesAsCost ? 0. : cutCosts[i];
+      // k pieces cost cost + (k - 1) * cutCost in total, we want each of them to cost about workerShare
+      Long64_t nPieces = 1;
+      if (cost > workerShare && cutCost < workerShare)
+         nPieces = std::min<Long64_t>(std::llround((cost - cutCost) / (workerShare - cutCost)), maxTasks);
+      auto splitIt = std::upper_bound(basketStarts.begin(), basketStarts.end(), start);
+      const auto splitEnd = std::lower_bound(splitIt, basketStarts.end(), end);
+      if (nPieces < 2 || splitIt == splitEnd) {
+         ranges.emplace_back(start, end);
+         rangeCosts.emplace_back(cost);
+         continue;
+      }
+      // cut the cluster at the basket boundaries that are closest to an even split
+      const auto firstPiece = ranges.size();
+      Long64_t pieceStart = start;
+      for (Long64_t piece = 1; piece < nPieces && splitIt != splitEnd; ++piece) {
+         const Long64_t ideal = start + (end - start) * piece / nPieces;
+         auto it = std::lower_bound(splitIt, splitEnd, ideal);
+         if (it == splitEnd || (it != splitIt && ideal - *(it - 1) < *it - ideal))
+            --it;
+         ranges.emplace_back(pieceStart, *it);
+         rangeCosts.emplace_back(cost * (*it - pieceStart) / (end - start) + cutCost);
+         pieceStart = *it;
+         splitIt = it + 1;
+      }
+      ranges.emplace_back(pieceStart, end);
+      rangeCosts.emplace_back(cost * (end - pieceStart) / (end - start) + cutCost);
+      // every cut is paid once on each side: the first and the last piece only have one cut
+      rangeCosts[firstPiece] -= cutCost / 2.;
+      rangeCosts.back() -= cutCost / 2.;
+   }
+
+   if (ranges.size() <= maxTasks) {
+      tasks = std::move(ranges);
+      taskCosts = std::move(rangeCosts);
+      return;
+   }
+
+   // Fuse consecutive ranges: a range goes to the task in whose share of the total cost its midpoint falls
+   double cumulativeCost = 0.;
+   Long64_t lastTaskIdx = -1;
+   for (auto i = 0u; i < ranges.size(); ++i) {
+      const auto taskIdx = static_cast<Long64_t>((cumulativeCost + rangeCosts[i] / 2.) / targetCost);
+      cumulativeCost += rangeCosts[i];
+      if (taskIdx != lastTaskIdx) {
+         tasks.emplace_back(ranges[i]);
+         taskCosts.emplace_back(rangeCosts[i]);
+         lastTaskIdx = taskIdx;
+      } else {
+         tasks.back().second = ranges[i].second;
+         taskCosts.back() += rangeCosts[i];
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Return a vector of entry ranges to be processed as separate tasks, and their estimated cost, for the given tree
+/// and files.
 static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
-                                       const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
+                                       const std::vector<std::string> &fileNames, const unsigned int nWorkers,
+                                       const unsigned int maxTasksPerFile,
                                        const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
    TDirectory::TContext c;
    const auto nFileNames = fileNames.size();
-   std::vector<std::vector<EntryRange>> clustersPerFile;
-   std::vector<Long64_t> entriesPerFile;
+   ClustersAndEntries clustersAndEntries;
+   auto &tasksPerFile = clustersAndEntries.fClusters;
+   auto &costsPerFile = clustersAndEntries.fCosts;
+   auto &entriesPerFile = clustersAndEntries.fEntries;
    entriesPerFile.reserve(nFileNames);
    Long64_t offset = 0ll;
    bool rangeEndReached = false; // flag to break the outer loop
@@ -161,10 +347,32 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
       auto clusterIter = t->GetClusterIterator(0);
       Long64_t clusterStart = 0ll, clusterEnd = 0ll;
       const Long64_t entries = t->GetEntries();
-      // Iterate over the clusters in the current file
-      std::vector<EntryRange> entryRanges;
-      while ((clusterStart = clusterIter()) < entries && !rangeEndReached) {
+      // Iterate over the clusters in the current file, up to the end of the desired range
+      std::vector<EntryRange> clusters;
+      while ((clusterStart = clusterIter()) < entries) {
          clusterEnd = clusterIter.GetNextEntry();
+         clusters.emplace_back(EntryRange{clusterStart, clusterEnd});
+         if (clusterEnd + offset >= range.second)
+            break;
+      }
+      std::vector<double> clusterCosts(clusters.size(), 0.);
+      std::vector<double> clusterCutCosts(clusters.size(), 0.);
+      std::vector<Long64_t> basketStarts;
+      double basketStartsCost = 0.;
+      std::vector<double> basketStartsCutCosts(clusters.size(), 0.);
+      if (offset + entries > range.first) { // no need to look at the baskets if the file is before the range
+         EstimateClusterCosts(*t->GetListOfBranches(), clusters, clusterCosts, clusterCutCosts, basketStarts,
+                              basketStartsCost, basketStartsCutCosts);
+         // the clusters are only cut at the basket boundaries of the most expensive branch
+         for (auto j = 0u; j < clusters.size(); ++j)
+            clusterCutCosts[j] -= basketStartsCutCosts[j];
+      }
+
+      std::vector<EntryRange> entryRanges;
+      std::vector<double> entryRangeCosts;
+      std::vector<double> entryRangeCutCosts;
+      for (auto j = 0u; j < clusters.size(); ++j) {
+         std::tie(clusterStart, clusterEnd) = clusters[j];
          // Currently, if a user specified a range, the clusters will be only globally obtained
          // Assume that there are 3 files with entries: [0, 100], [0, 150], [0, 200] (in this order)
          // Since the cluster boundaries are obtained sequentially, applying the offsets, the boundaries
@@ -178,13 +386,41 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
          const auto currentEnd = std::min(clusterEnd + offset, range.second);
          // This is not satified if the desired start is larger than the last entry of some cluster
          // In this case, this cluster is not going to be processes further
-         if (currentStart < currentEnd)
+         if (currentStart < currentEnd) {
             entryRanges.emplace_back(EntryRange{currentStart, currentEnd});
+            // only the fraction of the cluster that is in the range is going to be processed
+            entryRangeCosts.emplace_back(clusterCosts[j] * (currentEnd - currentStart) / (clusterEnd - clusterStart));
+            entryRangeCutCosts.emplace_back(clusterCutCosts[j]);
+         }
          if (currentEnd == range.second) // if the desired end is reached, stop reading further
             rangeEndReached = true;
       }
+      for (auto &basketStart : basketStarts)
+         basketStart += offset;
       offset += entries; // consistently keep track of the total number of entries
-      clustersPerFile.emplace_back(std::move(entryRanges));
+
+      // Here we turn clusters into tasks of similar cost. If the number of clusters is too big with respect to
+      // the number of slots, we "fuse" clusters together, otherwise we can incur in an overhead which is big enough
+      // to make parallelisation detrimental to performance.
+      // For example, this is the case when, following a merging of many small files, a file
+      // contains a tree with many entries and with clusters of just a few entries each.
+      // Another problematic case is a high number of slots (e.g. 256) coupled with a high number
+      // of files (e.g. 1000 files): the large amount of files might result in a large amount
+      // of tasks, but the elevated concurrency level makes the little synchronization required by
+      // task initialization very expensive. In this case it's better to simply process fewer, larger tasks.
+      // Cluster-merging can help reduce the number of tasks down to a minumum of one task per file.
+      // Conversely, a cluster that costs more than the share of one worker in the file would make a few threads
+      // finish last, so it is split into sub-ranges at the basket boundaries of the most expensive branch.
+      //
+      // The criterion is to have around TTreeProcessorMT::GetTasksPerWorkerHint() tasks per slot.
+      // Concretely, for each file we will cap the number of tasks to ceil(GetTasksPerWorkerHint() * nWorkers /
+      // nFiles), and each task will have a similar estimated cost.
+      std::vector<EntryRange> tasks;
+      std::vector<double> taskCosts;
+      MakeTasks(entryRanges, entryRangeCosts, entryRangeCutCosts, basketStarts, nWorkers, maxTasksPerFile, tasks,
+                taskCosts);
+      tasksPerFile.emplace_back(std::move(tasks));
+      costsPerFile.emplace_back(std::move(taskCosts));
       // Keep track of the entries, even if their corresponding tree is out of the range, e.g. entryRanges is empty
       entriesPerFile.emplace_back(entries);
    }
@@ -193,54 +429,57 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
                              "but the starting entry (" + range.first + ") is larger than the total number of " +
                              "entries (" + offset + ") in the dataset.");
 
-   // Here we "fuse" clusters together if the number of clusters is too big with respect to
-   // the number of slots, otherwise we can incur in an overhead which is big enough
-   // to make parallelisation detrimental to performance.
-   // For example, this is the case when, following a merging of many small files, a file
-   // contains a tree with many entries and with clusters of just a few entries each.
-   // Another problematic case is a high number of slots (e.g. 256) coupled with a high number
-   // of files (e.g. 1000 files): the large amount of files might result in a large amount
-   // of tasks, but the elevated concurrency level makes the little synchronization required by
-   // task initialization very expensive. In this case it's better to simply process fewer, larger tasks.
-   // Cluster-merging can help reduce the number of tasks down to a minumum of one task per file.
-   //
-   // The criterion according to which we fuse clusters together is to have around
-   // TTreeProcessorMT::GetTasksPerWorkerHint() clusters per slot.
-   // Concretely, for each file we will cap the number of tasks to ceil(GetTasksPerWorkerHint() * nWorkers / nFiles).
-
-   std::vector<std::vector<EntryRange>> eventRangesPerFile(clustersPerFile.size());
-   auto clustersPerFileIt = clustersPerFile.begin();
-   auto eventRangesPerFileIt = eventRangesPerFile.begin();
-   for (; clustersPerFileIt != clustersPerFile.end(); clustersPerFileIt++, eventRangesPerFileIt++) {
-      const auto clustersInThisFileSize = clustersPerFileIt->size();
-      const auto nFolds = clustersInThisFileSize / maxTasksPerFile;
-      // If the number of clusters is less than maxTasksPerFile
-      // we take the clusters as they are
-      if (nFolds == 0) {
-         *eventRangesPerFileIt = std::move(*clustersPerFileIt);
-         continue;
-      }
-      // Otherwise, we have to merge clusters, distributing the reminder evenly
-      // onto the first clusters
-      auto nReminderClusters = clustersInThisFileSize % maxTasksPerFile;
-      const auto &clustersInThisFile = *clustersPerFileIt;
-      for (auto i = 0ULL; i < clustersInThisFileSize; ++i) {
-         const auto start = clustersInThisFile[i].first;
-         // We lump together at least nFolds clusters, therefore
-         // we need to jump ahead of nFolds-1.
-         i += (nFolds - 1);
-         // We now add a cluster if we have some reminder left
-         if (nReminderClusters > 0) {
-            i += 1U;
-            nReminderClusters--;
-         }
-         const auto end = clustersInThisFile[i].second;
-         eventRangesPerFileIt->emplace_back(EntryRange({start, end}));
+   return clustersAndEntries;
+}
+
+/// The tasks of a file that are yet to be processed.
+/// The worker that starts processing a file takes its tasks from the front, i.e. in entry order. Workers that run
+/// out of files steal tasks from the back, so that they compete with the first worker only for the last task.
+class FileTasks {
+   std::mutex fMutex;
+   std::deque<EntryRange> fTasks;
+   std::deque<double> fCosts;
+   std::atomic<std::size_t> fNTasks{0};
+   std::atomic<double> fRemainingCost{0.};
+
+public:
+   Long64_t fEntries = 0; ///< Number of entries of the file, only set when clusters are retrieved per file
+
+   void Set(const std::vector<EntryRange> &tasks, const std::vector<double> &costs)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fTasks.assign(tasks.begin(), tasks.end());
+      fCosts.assign(costs.begin(), costs.end());
+      fNTasks = fTasks.size();
+      fRemainingCost = std::accumulate(costs.begin(), costs.end(), 0.);
+   }
+
+   /// Take a task from the front or the back of the queue, return false if there is none left.
+   bool Pop(bool fromBack, EntryRange &task)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (fTasks.empty())
+         return false;
+      double cost = 0.;
+      if (fromBack) {
+         task = fTasks.back();
+         cost = fCosts.back();
+         fTasks.pop_back();
+         fCosts.pop_back();
+      } else {
+         task = fTasks.front();
+         cost = fCosts.front();
+         fTasks.pop_front();
+         fCosts.pop_front();
       }
+      fNTasks = fTasks.size();
+      fRemainingCost = fTasks.empty() ? 0. : fRemainingCost - cost;
+      return true;
    }
 
-   return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
-}
+   bool HasTasks() const { return fNTasks > 0; }
+   double GetRemainingCost() const { return fRemainingCost; }
+};
 
 } // anonymous namespace
 
@@ -452,8 +691,8 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRang
 void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
 {
    // compute number of tasks per file
-   const unsigned int maxTasksPerFile =
-      std::ceil(float(GetTasksPerWorkerHint() * fPool.GetPoolSize()) / float(fFileNames.size()));
+   const unsigned int nWorkers = fPool.GetPoolSize();
+   const unsigned int maxTasksPerFile = std::ceil(float(GetTasksPerWorkerHint() * nWorkers) / float(fFileNames.size()));
 
    // If an entry list or friend trees are present, we need to generate clusters with global entry numbers,
    // so we do it here for all files.
@@ -465,39 +704,16 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || fGlobalRange.first > 0 ||
                                           fGlobalRange.second != std::numeric_limits<Long64_t>::max();
    ClustersAndEntries allClusterAndEntries{};
-   auto &allClusters = allClusterAndEntries.first;
-   const auto &allEntries = allClusterAndEntries.second;
+   auto &allClusters = allClusterAndEntries.fClusters;
+   auto &allCosts = allClusterAndEntries.fCosts;
+   const auto &allEntries = allClusterAndEntries.fEntries;
    if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
+      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, nWorkers, maxTasksPerFile, fGlobalRange);
       if (hasEntryList)
-         allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
+         allClusters = ConvertToElistClusters(std::move(allClusters), allCosts, fEntryList, fTreeNames, fFileNames,
+                                              allEntries);
    }
 
-   // Per-file processing in case we retrieved all cluster info upfront
-   auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
-      auto processCluster = [&](const EntryRange &c) {
-         auto r =
-            fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList, allEntries);
-         func(*r);
-      };
-      fPool.Foreach(processCluster, allClusters[fileIdx]);
-   };
-
-   // Per-file processing that also retrieves cluster info for a file
-   auto processFileRetrievingClusters = [&](std::size_t fileIdx) {
-      // Evaluate clusters (with local entry numbers) and number of entries for this file
-      const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
-      const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
-      const auto &clusters = clustersAndEntries.first[0];
-      const auto &entries = clustersAndEntries.second[0];
-      auto processCluster = [&](const EntryRange &c) {
-         auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries});
-         func(*r);
-      };
-      fPool.Foreach(processCluster, clusters);
-   };
-
    const auto firstNonEmpty =
       fGlobalRange.first > 0u ? std::distance(allClusters.begin(), std::find_if(allClusters.begin(), allClusters.end(),
                                                                                 [](auto &c) { return !c.empty(); }))
@@ -506,10 +722,121 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
    std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
 
-   if (shouldRetrieveAllClusters)
-      fPool.Foreach(processFileUsingGlobalClusters, fileIdxs);
-   else
-      fPool.Foreach(processFileRetrievingClusters, fileIdxs);
+   const auto nFiles = fFileNames.size();
+   std::vector<FileTasks> fileTasks(nFiles);
+   if (shouldRetrieveAllClusters) {
+      for (auto fileIdx : fileIdxs)
+         fileTasks[fileIdx].Set(allClusters[fileIdx], allCosts[fileIdx]);
+   }
+
+   // Files whose tasks are not published yet, including the files no worker has started: workers that find no task
+   // to steal wait until this decreases, since those files will have tasks to steal. Guarded by retrievalMutex.
+   std::size_t nFilesToRetrieve = shouldRetrieveAllClusters ? 0u : fileIdxs.size();
+   std::mutex retrievalMutex;
+   std::condition_variable retrievalCV;
+   std::atomic<bool> hasFailed{false}; // stop all workers if one of them throws
+   auto setFailed = [&]() {
+      {
+         std::lock_guard<std::mutex> lock(retrievalMutex);
+         hasFailed = true;
+      }
+      retrievalCV.notify_all();
+   };
+
+   // Retrieve the tasks (with local entry numbers) and number of entries of a file
+   auto retrieveTasks = [&](std::size_t fileIdx) {
+      // the file is accounted as retrieved even if retrieval throws, so that waiting workers do not hang
+      struct RetrievalRAII {
+         std::size_t &fCounter;
+         std::mutex &fMutex;
+         std::condition_variable &fCV;
+         ~RetrievalRAII()
+         {
+            {
+               std::lock_guard<std::mutex> lock(fMutex);
+               --fCounter;
+            }
+            fCV.notify_all();
+         }
+      } retrieval{nFilesToRetrieve, retrievalMutex, retrievalCV};
+      const auto clustersAndEntries =
+         MakeClusters({fTreeNames[fileIdx]}, {fFileNames[fileIdx]}, nWorkers, maxTasksPerFile);
+      fileTasks[fileIdx].fEntries = clustersAndEntries.fEntries[0];
+      fileTasks[fileIdx].Set(clustersAndEntries.fClusters[0], clustersAndEntries.fCosts[0]);
+   };
+
+   auto processTask = [&](std::size_t fileIdx, const EntryRange &c) {
+      std::unique_ptr<TTreeReader> r;
+      if (shouldRetrieveAllClusters)
+         r = fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList, allEntries);
+      else
+         r = fTreeView->GetTreeReader(c.first, c.second, {fTreeNames[fileIdx]}, {fFileNames[fileIdx]}, fFriendInfo,
+                                      fEntryList, {fileTasks[fileIdx].fEntries});
+      func(*r);
+   };
+
+   // The file with tasks left that has the largest estimated cost left, nFiles if there is none
+   auto findFileToStealFrom = [&]() {
+      std::size_t victim = nFiles;
+      double maxCost = -1.;
+      for (auto fileIdx : fileIdxs) {
+         const auto &tasks = fileTasks[fileIdx];
+         if (tasks.HasTasks() && tasks.GetRemainingCost() > maxCost) {
+            victim = fileIdx;
+            maxCost = tasks.GetRemainingCost();
+         }
+      }
+      return victim;
+   };
+
+   // Each worker processes the tasks of one file at a time, starting a new file when the current one has no tasks
+   // left. When there are no new files left either, the worker steals tasks from the file with the largest
+   // estimated cost left, so that all workers stay busy until the very end of the processing.
+   std::atomic<std::size_t> nextFile{0u};
+   auto work = [&]() {
+      std::size_t currentFile = nFiles;
+      bool isStealing = false;
+      EntryRange task;
+      while (!hasFailed) {
+         if (currentFile < nFiles && fileTasks[currentFile].Pop(isStealing, task)) {
+            try {
+               processTask(currentFile, task);
+            } catch (...) {
+               setFailed();
+               throw;
+            }
+            continue;
+         }
+         const auto next = nextFile++;
+         if (next < fileIdxs.size()) {
+            currentFile = fileIdxs[next];
+            isStealing = false;
+            if (!shouldRetrieveAllClusters) {
+               try {
+                  retrieveTasks(currentFile);
+               } catch (...) {
+                  setFailed();
+                  throw;
+               }
+            }
+            continue;
+         }
+         // Look for a victim under the lock: the tasks of a file are published before nFilesToRetrieve is
+         // decremented, so tasks that are missed here wake us up below
+         std::unique_lock<std::mutex> lock(retrievalMutex);
+         const auto nFilesLeft = nFilesToRetrieve;
+         currentFile = findFileToStealFrom();
+         isStealing = true;
+         if (currentFile == nFiles) {
+            // other workers might still be retrieving the tasks of their file, which we can then steal
+            if (nFilesLeft == 0u)
+               break;
+            retrievalCV.wait(lock, [&] { return hasFailed || nFilesToRetrieve < nFilesLeft; });
+         }
+      }
+   };
+
+   fPool.Foreach(work, fPool.GetPoolSize());
 
    // make sure TChains and TFiles are cleaned up since they are not globally tracked
    for (unsigned int islot = 0; islot < fTreeView.GetNSlots(); ++islot) {
@@ -536,6 +863,13 @@ unsigned int TTreeProcessorMT::GetTasksPerWorkerHint()
 /// processed files features a bad clustering, for example with a lot of
 /// entries and just a few entries per cluster, or to limit the number of
 /// tasks spawned when a very large number of files and workers is used.
+/// Clusters that are more expensive than the share of one worker in their
+/// file are split into smaller tasks, within the same cap on the number of
+/// tasks per file (tasksPerWorkerHint * nWorkers / nFiles). A split
+/// only happens at the basket boundaries of the most expensive branch; the
+/// baskets of the other branches that contain k - 1 split points are read
+/// by all the k tasks around them, so a split is not done if those alone
+/// cost as much as the share of a worker.
 void TTreeProcessorMT::SetTasksPerWorkerHint(unsigned int tasksPerWorkerHint)
 {
    fgTasksPerWorkerHint = tasksPerWorkerHint;
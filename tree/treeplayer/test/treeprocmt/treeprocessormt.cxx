@@ -1,7 +1,12 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <random>
+#include <set>
 #include <string>
 #include <thread>
 #include <utility>
@@ -362,6 +367,165 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, LargeClusterSplitAtBaskets)
+{
+   const auto nEvents = 10000;
+   const auto filename = "TreeProcessorMT_LargeClusterSplitAtBaskets.root";
+   const auto treename = "t";
+   {
+      TFile file(filename, "recreate");
+      TTree t(treename, treename);
+      int v = 0;
+      // a single cluster made of many small baskets
+      t.Branch("v", &v, /*bufsize*/ 1000);
+      t.SetAutoFlush(nEvents);
+      for (auto i = 0; i < nEvents; ++i) {
+         ++v;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   std::vector<Long64_t> basketStarts;
+   {
+      TFile file(filename);
+      auto *br = file.Get<TTree>(treename)->GetBranch("v");
+      basketStarts.assign(br->GetBasketEntry(), br->GetBasketEntry() + br->GetWriteBasket());
+   }
+   ASSERT_GT(basketStarts.size(), 10u) << "this should never happen, fix test logic";
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> clusters;
+   auto get_clusters = [&m, &clusters](TTreeReader &t) {
+      std::lock_guard<std::mutex> l(m);
+      clusters.emplace_back(t.GetEntriesRange());
+   };
+
+   for (auto nThreads = 1; nThreads <= 4; ++nThreads) {
+      ROOT::EnableImplicitMT(nThreads);
+
+      ROOT::TTreeProcessorMT p(filename, treename);
+      p.Process(get_clusters);
+
+      // with several workers, the only cluster is split in sub-ranges, at basket boundaries
+      if (nThreads > 1) {
+         EXPECT_GT(clusters.size(), 1u);
+      } else {
+         EXPECT_EQ(clusters.size(), 1u);
+      }
+      EXPECT_LE(clusters.size(), ROOT::TTreeProcessorMT::GetTasksPerWorkerHint() * ROOT::GetThreadPoolSize());
+      CheckClusters(clusters, nEvents);
+      for (const auto &c : clusters)
+         EXPECT_TRUE(std::find(basketStarts.begin(), basketStarts.end(), c.first) != basketStarts.end());
+      clusters.clear();
+      ROOT::DisableImplicitMT();
+   }
+
+   gSystem->Unlink(filename);
+}
+
+TEST(TreeProcessorMT, UnevenFilesAndBranches)
+{
+   const std::vector<Long64_t> nEvents = {20000, 1000, 100};
+   const auto nFiles = nEvents.size();
+   const auto treename = "t";
+   std::vector<std::string> filenames;
+   std::vector<std::vector<Long64_t>> arrBasketStarts(nFiles);
+   std::mt19937 gen(42);
+   std::uniform_real_distribution<double> dist;
+   for (auto f = 0u; f < nFiles; ++f) {
+      filenames.emplace_back("TreeProcessorMT_UnevenFilesAndBranches" + std::to_string(f) + ".root");
+      TFile file(filenames.back().c_str(), "recreate");
+      TTree t(treename, treename);
+      int fileIdx = f;
+      Long64_t id = 0;
+      double arr[8];
+      // one cluster per file; random doubles make "arr" by far the most expensive branch, "id" has smaller baskets
+      t.Branch("file", &fileIdx, "file/I", /*bufsize*/ 32000);
+      t.Branch("id", &id, "id/L", /*bufsize*/ 700);
+      t.Branch("arr", arr, "arr[8]/D", /*bufsize*/ 8000);
+      t.SetAutoFlush(nEvents[f]);
+      for (id = 0; id < nEvents[f]; ++id) {
+         for (auto &a : arr)
+            a = dist(gen);
+         t.Fill();
+      }
+      t.Write();
+   }
+   for (auto f = 0u; f < nFiles; ++f) {
+      TFile file(filenames[f].c_str());
+      auto *br = file.Get<TTree>(treename)->GetBranch("arr");
+      arrBasketStarts[f].assign(br->GetBasketEntry(), br->GetBasketEntry() + br->GetWriteBasket());
+   }
+   ASSERT_GT(arrBasketStarts[0].size(), 100u) << "this should never happen, fix test logic";
+
+   ROOT::EnableImplicitMT(4);
+   const auto nThreads = ROOT::GetThreadPoolSize();
+
+   std::mutex m;
+   std::condition_variable stolenCV;
+   bool isFirstTaskOfLargeFile = true;
+   std::vector<std::vector<std::pair<Long64_t, Long64_t>>> tasks(nFiles);
+   std::map<int, std::set<std::thread::id>> threadsPerFile;
+   std::vector<Long64_t> nEntriesRead(nFiles, 0);
+   auto processTask = [&](TTreeReader &r) {
+      TTreeReaderValue<int> fileIdx(r, "file");
+      TTreeReaderValue<Long64_t> id(r, "id");
+      const auto range = r.GetEntriesRange();
+      Long64_t nRead = 0;
+      int f = -1;
+      while (r.Next()) {
+         // entry numbers are local to the file, which is retrieved on its own
+         EXPECT_EQ(range.first + nRead, *id);
+         f = *fileIdx;
+         ++nRead;
+      }
+      std::unique_lock<std::mutex> l(m);
+      ASSERT_GE(f, 0);
+      tasks[f].emplace_back(range);
+      threadsPerFile[f].insert(std::this_thread::get_id());
+      nEntriesRead[f] += nRead;
+      if (f != 0 || nThreads < 2)
+         return;
+      // The worker of the first task of the large file only returns once another worker has processed one of the
+      // remaining tasks of that file, i.e. has stolen it. The timeout only guards against a hang if stealing is broken.
+      if (isFirstTaskOfLargeFile) {
+         isFirstTaskOfLargeFile = false;
+         EXPECT_TRUE(stolenCV.wait_for(l, std::chrono::seconds(60), [&] { return threadsPerFile[0].size() > 1; }));
+      } else {
+         stolenCV.notify_all();
+      }
+   };
+
+   std::vector<std::string_view> fnames(filenames.begin(), filenames.end());
+   ROOT::TTreeProcessorMT p(fnames, treename);
+   p.Process(processTask);
+   ROOT::DisableImplicitMT();
+
+   const auto maxTasksPerFile = static_cast<std::size_t>(
+      std::ceil(float(ROOT::TTreeProcessorMT::GetTasksPerWorkerHint() * nThreads) / float(nFiles)));
+   for (auto f = 0u; f < nFiles; ++f) {
+      ASSERT_FALSE(tasks[f].empty());
+      EXPECT_LE(tasks[f].size(), maxTasksPerFile);
+      EXPECT_EQ(nEvents[f], nEntriesRead[f]);
+      CheckClusters(tasks[f], nEvents[f]);
+      // clusters are split at the basket boundaries of the most expensive branch only
+      for (const auto &task : tasks[f])
+         EXPECT_TRUE(std::find(arrBasketStarts[f].begin(), arrBasketStarts[f].end(), task.first) !=
+                     arrBasketStarts[f].end());
+   }
+   // the only cluster of the large file is split in tasks of similar size...
+   EXPECT_GT(tasks[0].size(), 1u);
+   for (const auto &task : tasks[0])
+      EXPECT_LT(task.second - task.first, 2 * nEvents[0] / Long64_t(tasks[0].size()));
+   // ...which are also processed by the workers that are done with the small files
+   if (nThreads > 1) {
+      EXPECT_GT(threadsPerFile[0].size(), 1u);
+   }
+
+   DeleteFiles(filenames);
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};